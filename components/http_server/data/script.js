@@ -36,7 +36,14 @@ function predictSound() {
     .then((res) => res.json())
     .then((data) => {
       const output = document.getElementById("predictionOutput");
-      output.innerText = `Prediction: ${data.category}`;
+      if (data.error) {
+        output.innerText = `Prediction failed: ${data.error}`;
+      } else {
+        const ranked = data.top_k
+          .map((entry) => `${entry.category} ${(entry.score * 100).toFixed(1)}%`)
+          .join(", ");
+        output.innerText = `Prediction: ${data.category} (${ranked}) in ${(data.latency_us.invoke / 1000).toFixed(1)} ms`;
+      }
       output.style.display = "block";
     })
     .catch(() => alert("Prediction failed."));
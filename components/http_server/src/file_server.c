@@ -8,6 +8,7 @@
 #include <netinet/in.h>
 #include <arpa/inet.h>
 #include <errno.h>
+#include <stdarg.h>
 
 #include "esp_err.h"
 #include "esp_log.h"
@@ -19,9 +20,19 @@
 #include "esp_vfs_fat.h"
 #include "file_operations.h"
 #include "esp_timer.h"
+#include "inference_scheduler.h"
+#include "inference_service.h"
+#include "result_snapshot.h"
+#include "cascade_gate.h"
+#include "shadow_evaluator.h"
+#include "sound_enrollment.h"
+#include "reclassify_job.h"
+#include "model_benchmark.h"
 
 static const char *TAG = "file_server";
 
+#define PREDICT_TIMEOUT_MS 2000     ///< Longest an on-demand /predict waits for its window
+
 /**
  * @brief Extracts filesystem path from URI
  * @param dest Destination buffer for path
@@ -95,14 +106,25 @@ static void httpd_close_func(httpd_handle_t hd, int sockfd)
     ESP_LOGD(TAG, "Forcefully closed socket %d", sockfd);
 }
 
+static volatile bool is_recording = false;     ///< Set while a WAV recording owns the mic and SD card
+
 /**
-* @brief Timer callback to stop recording after timeout
-* @param arg Pointer to recording flag (bool)
+* @brief Recording task: records one WAV file, then hands the mic back
+* @param arg Category name (heap copy, freed here)
+*
+* @note is_recording is cleared and inference resumed only once
+* the file is closed, however long the SD card writes take.
 */
-static void recording_timer_callback(void* arg) {
-    bool* recording_flag = (bool*)arg;
-    *recording_flag = false;
-    ESP_LOGI(TAG, "Recording timer expired - flag set to false");
+static void recording_task(void *arg) {
+    char *category = (char *)arg;
+    record_category(category);
+    free(category);
+
+    is_recording = false;
+    inference_scheduler_resume();
+    inference_service_resume();
+    ESP_LOGI(TAG, "Recording finished");
+    vTaskDelete(NULL);
 }
 
 /**
@@ -113,15 +135,20 @@ static void recording_timer_callback(void* arg) {
 * @example 
 * GET /start_recording?category=voice
 * 
-* @note Creates a new task for recording and sets a timer to stop it
+* @note Creates a new task for recording, which clears the in-progress flag
+* and resumes continuous inference when the file is written.
+* Continuous and on-demand inference are paused while the recording owns the microphone.
+* Refused while recordings are being reclassified, since recording remounts the card.
 */
 esp_err_t start_recording_handler(httpd_req_t *req) {
-    static bool is_recording = false;
-    
     if (is_recording) {
         httpd_resp_send_custom_err(req, HTTPD_400, "Recording already in progress");
         return ESP_FAIL;
     }
+    if (reclassify_is_running()) {
+        httpd_resp_send_custom_err(req, HTTPD_400, "Reclassification in progress");
+        return ESP_FAIL;
+    }
 
     char query[64];
     if (httpd_req_get_url_query_str(req, query, sizeof(query)) != ESP_OK) {
@@ -142,25 +169,17 @@ esp_err_t start_recording_handler(httpd_req_t *req) {
     }
 
     is_recording = true;
-    xTaskCreate(
-        (TaskFunction_t)start_recording,
-        "rec_task",
-        4096,
-        (void*)task_category,
-        5,
-        NULL
-    );
-
-    // Timer setup
-    const esp_timer_create_args_t timer_args = {
-        .callback = &recording_timer_callback,
-        .arg = &is_recording,
-        .name = "recording_timer"
-    };
-    
-    esp_timer_handle_t timer;
-    ESP_ERROR_CHECK(esp_timer_create(&timer_args, &timer));
-    ESP_ERROR_CHECK(esp_timer_start_once(timer, CONFIG_EXAMPLE_REC_TIME * 1000000 + 1000000));
+    inference_scheduler_pause();
+    inference_service_pause();
+    if (xTaskCreate(recording_task, "rec_task", 4096, task_category, 5, NULL) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create recording task");
+        free(task_category);
+        is_recording = false;
+        inference_scheduler_resume();
+        inference_service_resume();
+        httpd_resp_send_500(req);
+        return ESP_FAIL;
+    }
 
     httpd_resp_send(req, "Recording started", HTTPD_RESP_USE_STRLEN);
     return ESP_OK;
@@ -336,11 +355,18 @@ esp_err_t list_files_handler(httpd_req_t *req) {
  * @response "File deleted successfully" or error message
  * 
  * @security Checks for valid path format before deletion
+ *
+ * @note Refused while recordings are being reclassified, which reads them from the card
  */
 esp_err_t delete_file_handler(httpd_req_t *req) {
     char filepath[MAX_PATH_LENGTH];
     char decoded_path[MAX_PATH_LENGTH];
     
+    if (reclassify_is_running()) {
+        httpd_resp_send_custom_err(req, HTTPD_400, "Reclassification in progress");
+        return ESP_FAIL;
+    }
+
     if (httpd_req_get_url_query_str(req, filepath, sizeof(filepath)) != ESP_OK) {
         httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Filename required");
         return ESP_FAIL;
@@ -523,13 +549,20 @@ esp_err_t send_index_html(httpd_req_t *req)
  * - 303 See Other redirect to home page
  * - Sets Connection: close header
  * 
- * @note Uses server_data context for base path resolution
+ * @note Uses server_data context for base path resolution. Refused while
+ * recordings are being reclassified.
  */
 esp_err_t delete_post_handler(httpd_req_t *req)
 {
     struct file_server_data *server_data = req->user_ctx;
     char filepath[FILE_PATH_MAX];
     
+    // delete_path() remounts the card under the running reclassification
+    if (reclassify_is_running()) {
+        httpd_resp_send_custom_err(req, HTTPD_400, "Reclassification in progress");
+        return ESP_FAIL;
+    }
+
     const char *filename = get_path_from_uri(filepath, server_data->base_path,
                                            req->uri + sizeof("/delete") - 1, sizeof(filepath));
     if (!filename) {
@@ -614,6 +647,84 @@ esp_err_t download_get_handler(httpd_req_t *req)
     return ESP_OK;
 }
 
+/**
+ * @brief Appends formatted text to a JSON response buffer
+ * @param buf Response buffer
+ * @param len Size of the response buffer
+ * @param offset Current write offset, advanced by the appended length
+ * @param fmt printf-style format string
+ * @return true if the text fit into the buffer
+ */
+static bool json_append(char *buf, size_t len, size_t *offset, const char *fmt, ...) {
+    if (*offset >= len) {
+        return false;
+    }
+
+    va_list args;
+    va_start(args, fmt);
+    int written = vsnprintf(buf + *offset, len - *offset, fmt, args);
+    va_end(args);
+
+    if (written < 0 || (size_t)written >= len - *offset) {
+        *offset = len;
+        return false;
+    }
+    *offset += written;
+    return true;
+}
+
+/**
+ * @brief Serializes the fields of a prediction result into an open JSON object
+ * @param buf Response buffer
+ * @param len Size of the response buffer
+ * @param offset Current write offset, advanced by the appended length
+ * @param result Prediction result to serialize
+ * @return true if the result fit into the buffer
+ * 
+ * @response Fields appended (without surrounding braces):
+ * "category":"RAIN","class":4,
+ * "scores":{"ALARM":0.012,...},
+ * "top_k":[{"category":"RAIN","score":0.91},...],
+ * "timestamp_us":123456,
+ * "latency_us":{"capture":64000,"features":310,"quantize":120,"invoke":21000},
+ * "heads":{"CRYING_BABY":{"score":0.93,"detected":true}} (enabled detection heads, if the model has any)
+ */
+static bool append_prediction_json(char *buf, size_t len, size_t *offset, const prediction_result_t *result) {
+    bool ok = json_append(buf, len, offset, "\"category\":\"%s\",\"class\":%d,\"gated\":%s,\"scores\":{",
+                          model_class_name(result->top_class), result->top_class,
+                          result->gated ? "true" : "false");
+    for (int i = 0; i < MODEL_NUM_CLASSES; i++) {
+        ok = ok && json_append(buf, len, offset, "%s\"%s\":%.4f", i ? "," : "",
+                               model_class_name(i), result->scores[i]);
+    }
+    ok = ok && json_append(buf, len, offset, "},\"top_k\":[");
+    for (int k = 0; k < MODEL_TOP_K; k++) {
+        ok = ok && json_append(buf, len, offset, "%s{\"category\":\"%s\",\"score\":%.4f}", k ? "," : "",
+                               model_class_name(result->top_k[k]), result->scores[result->top_k[k]]);
+    }
+    ok = ok && json_append(buf, len, offset,
+                           "],\"timestamp_us\":%lld,\"latency_us\":{\"capture\":%lu,\"features\":%lu,\"quantize\":%lu,\"invoke\":%lu}",
+                           result->capture_timestamp_us, result->capture_us, result->features_us,
+                           result->quantize_us, result->invoke_us);
+
+    const int heads = model_head_count();
+    if (heads > 0) {
+        ok = ok && json_append(buf, len, offset, ",\"heads\":{");
+        bool first = true;
+        for (int h = 0; h < heads; h++) {
+            if (!result->heads[h].enabled) {
+                continue;
+            }
+            ok = ok && json_append(buf, len, offset, "%s\"%s\":{\"score\":%.4f,\"detected\":%s}",
+                                   first ? "" : ",", model_head_name(h), result->heads[h].score,
+                                   result->heads[h].detected ? "true" : "false");
+            first = false;
+        }
+        ok = ok && json_append(buf, len, offset, "}");
+    }
+    return ok;
+}
+
 /**
  * @brief HTTP GET handler for real-time audio classification
  * @param req HTTP request object containing client connection details
@@ -623,19 +734,38 @@ esp_err_t download_get_handler(httpd_req_t *req)
  * 
  * @response JSON response format:
  * {
- *   "category": "<predicted_class_name>"
+ *   "category": "<predicted_class_name>",
+ *   "class": <class_index>,
+ *   "gated": true|false,        (true: rejected by the cascade stage-one detector, no inference ran)
+ *   "scores": {"<class_name>": <score>, ...},
+ *   "top_k": [{"category": "<class_name>", "score": <score>}, ...],
+ *   "timestamp_us": <capture_time>,
+ *   "latency_us": {"capture": .., "features": .., "quantize": .., "invoke": ..},
+ *   "window_id": <window_sequence>,
+ *   "age_ms": <time_since_capture>,
+ *   "smoothed": {"category": "<class_name>", "score": <averaged_score>},  (continuous inference only)
+ *   "pooled": {"category": .., "score": .., "span_ms": ..},  (CONFIG_INFERENCE_POOLING_ENABLE, once a span is covered)
+ *   "service": {"requests": .., "captures": ..}                           (on-demand only)
  * }
  * OR error response:
  * {
  *   "error": "<error_description>"
  * }
  * 
- * @note This handler performs the following operations:
- * 1. Initializes I2S microphone if not already done
+ * @handles GET /predict[?max_age_ms=<ms>]
+ *
+ * @note The latest classification is kept in a lock-free snapshot. If it is
+ * at most max_age_ms old it is returned immediately. Otherwise the handler
+ * waits for the next scheduled inference when the continuous scheduler is
+ * running, or asks the on-demand inference service, which:
+ * 1. Initializes I2S microphone on first use
  * 2. Records 1024 audio samples (16-bit mono @16kHz)
- * 3. Converts samples to normalized float32 format
+ * 3. Normalizes and quantizes samples to the int8 model input
  * 4. Passes data to TensorFlow Lite model for inference
- * 5. Returns the top prediction class via HTTP and console
+ * 5. Hands the result to every request that arrived during the capture
+ *
+ * Without max_age_ms, the continuous mode returns the latest result of any
+ * age and the on-demand mode always captures a new window.
  * 
  * @section Class Mapping:
  * - 0: Alarm
@@ -647,73 +777,666 @@ esp_err_t download_get_handler(httpd_req_t *req)
  * 
  * @section Error Handling:
  * - Returns HTTP 500 with JSON error on:
- *   - Audio recording failure
+ *   - Audio recording failure or timeout
  *   - Invalid prediction result
  *   - HTTP response failure
- * - Always logs prediction results to console (visible even if HTTP fails)
  * 
  * @section Performance:
  * - Typical execution time: <100ms (including 64ms audio capture)
  * - Memory: Requires ~8KB for audio buffer + model tensors
- * - Blocks during audio capture and inference
+ * - Blocks during audio capture and inference; concurrent requests share them
  * 
- * @see init_microphone() for I2S configuration
+ * @see inference_service_predict() for the on-demand path
  * @see predict_class() for model inference implementation
+ * @see inference_scheduler_get_state() for the continuous mode
+ * @see result_snapshot_read() for the cached result
  */
 
 // Prediction handler function
 static esp_err_t prediction_handler(httpd_req_t *req) {
     httpd_resp_set_type(req, "application/json");
-    char response[128];
-    static const char* CLASS_NAMES[] = {"ALARM", "BELL", "CRYING_BABY", "NOISE", "RAIN", "ROOSTER"};
+    char response[768];
+    size_t offset = 0;
+
+    ESP_LOGD(TAG, "Prediction Handler Called");
+
+    // Without max_age_ms the scheduler's latest result is always good enough,
+    // while on-demand mode captures a new window
+    const bool continuous = inference_scheduler_is_running();
+    uint32_t max_age_ms = continuous ? UINT32_MAX : 0;
+    char query[32];
+    char value[12];
+    if (httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK &&
+        httpd_query_key_value(query, "max_age_ms", value, sizeof(value)) == ESP_OK) {
+        max_age_ms = strtoul(value, NULL, 10);
+    }
 
-    ESP_LOGI(TAG, "Prediction Handler Called");
+    // A fresh enough snapshot is served without waiting on inference at all
+    result_snapshot_t snapshot;
+    if (!result_snapshot_read(&snapshot) || result_snapshot_age_ms(&snapshot) > (int64_t)max_age_ms) {
+        esp_err_t err;
+        if (continuous) {
+            err = result_snapshot_wait(snapshot.sequence, &snapshot, PREDICT_TIMEOUT_MS);
+        } else {
+            // Concurrent requests share one capture and Invoke()
+            err = inference_service_predict(&snapshot.result, &snapshot.window_id, PREDICT_TIMEOUT_MS);
+        }
+        if (err != ESP_OK) {
+            ESP_LOGE(TAG, "Prediction failed: %s", esp_err_to_name(err));
+            httpd_resp_set_status(req, HTTPD_500);
+            return httpd_resp_sendstr(req, err == ESP_ERR_TIMEOUT ? "{\"error\":\"Timed out\"}"
+                                                                  : "{\"error\":\"Model failure\"}");
+        }
+    }
 
-    // Initialize microphone if not already done
-    static bool mic_initialized = false;
-    if (!mic_initialized) {
-        init_microphone();
-        mic_initialized = true;
-        
-        // Optional warm-up read to stabilize microphone
-        int16_t discard_buffer[1024];
-        get_audio_samples(discard_buffer);
+    json_append(response, sizeof(response), &offset, "{");
+    append_prediction_json(response, sizeof(response), &offset, &snapshot.result);
+    json_append(response, sizeof(response), &offset, ",\"window_id\":%lu,\"age_ms\":%lld",
+                snapshot.window_id, result_snapshot_age_ms(&snapshot));
+
+    inference_state_t state;
+    if (continuous && inference_scheduler_get_state(&state) == ESP_OK) {
+        json_append(response, sizeof(response), &offset, ",\"smoothed\":{\"category\":\"%s\",\"score\":%.4f}",
+                    model_class_name(state.top_class), state.score);
+#if CONFIG_INFERENCE_POOLING_ENABLE
+        if (state.pooled.top_class >= 0) {
+            json_append(response, sizeof(response), &offset,
+                        ",\"pooled\":{\"category\":\"%s\",\"score\":%.4f,\"span_ms\":%lu}",
+                        model_class_name(state.pooled.top_class), state.pooled.score, state.pooled.covered_ms);
+        }
+#endif
+    } else if (!continuous) {
+        inference_service_stats_t stats;
+        inference_service_get_stats(&stats);
+        json_append(response, sizeof(response), &offset, ",\"service\":{\"requests\":%lu,\"captures\":%lu}",
+                    stats.requests, stats.captures);
     }
+    json_append(response, sizeof(response), &offset, "}");
+    return httpd_resp_send(req, response, strlen(response));
+}
 
-    // Audio processing buffers
-    static int16_t input_data[1024];
-    static float normalized_input[1024];
-    
-    // Get audio samples
-    get_audio_samples(input_data);
+/**
+ * @brief HTTP GET handler for continuous inference statistics
+ * @param req HTTP request object
+ * @return ESP_OK on success, error code on failure
+ * 
+ * @handles GET /inference_stats
+ * 
+ * @response JSON response format:
+ * {
+ *   "window_id": <latest_window>,
+ *   "windows": {"classified": .., "skipped": .., "dropped": .., "gated": ..},
+ *   "stateful": true|false, "state_resets": <streaming model state cleared after a gap>,
+ *   "pooled": {"class": .., "score": .., "windows": .., "covered_ms": .., "scores": [..],
+ *              "last_detection": .., "last_detection_ms": ..} (CONFIG_INFERENCE_POOLING_ENABLE),
+ *   "stage_avg_us": {"capture": .., "features": .., "handoff": .., "inference": .., "end_to_end": ..}
+ * }
+ * 
+ * @note Returns HTTP 500 when continuous inference is not running
+ */
+static esp_err_t inference_stats_handler(httpd_req_t *req) {
+    httpd_resp_set_type(req, "application/json");
+
+    inference_state_t state;
+    if (inference_scheduler_get_state(&state) != ESP_OK) {
+        httpd_resp_set_status(req, HTTPD_500);
+        return httpd_resp_sendstr(req, "{\"error\":\"Continuous inference not running\"}");
+    }
+
+    char response[768];
+    size_t offset = 0;
+    json_append(response, sizeof(response), &offset,
+                "{\"window_id\":%lu,\"windows\":{\"classified\":%lu,\"skipped\":%lu,\"dropped\":%lu,\"gated\":%lu},",
+                state.window_id, state.windows_classified, state.windows_skipped, state.windows_dropped,
+                state.windows_gated);
+    json_append(response, sizeof(response), &offset, "\"stateful\":%s,\"state_resets\":%lu,",
+                model_is_stateful() ? "true" : "false", state.state_resets);
+#if CONFIG_INFERENCE_POOLING_ENABLE
+    const temporal_pooling_decision_t *pooled = &state.pooled;
+    json_append(response, sizeof(response), &offset,
+                "\"pooled\":{\"class\":\"%s\",\"score\":%.3f,\"windows\":%lu,\"covered_ms\":%lu,\"scores\":[",
+                pooled->top_class >= 0 ? model_class_name(pooled->top_class) : "", pooled->score,
+                pooled->windows, pooled->covered_ms);
+    for (int c = 0; c < MODEL_NUM_CLASSES; c++) {
+        json_append(response, sizeof(response), &offset, "%s%.3f", c > 0 ? "," : "", pooled->pooled_scores[c]);
+    }
+    json_append(response, sizeof(response), &offset, "],\"last_detection\":\"%s\",\"last_detection_ms\":%lld},",
+                state.last_pooled_detection_class >= 0 ? model_class_name(state.last_pooled_detection_class) : "",
+                state.last_pooled_detection_ms);
+#endif
+    json_append(response, sizeof(response), &offset,
+                "\"stage_avg_us\":{\"capture\":%lu,\"features\":%lu,\"handoff\":%lu,\"inference\":%lu,\"end_to_end\":%lu}}",
+                state.stage_avg_us.capture, state.stage_avg_us.features, state.stage_avg_us.handoff,
+                state.stage_avg_us.inference, state.stage_avg_us.end_to_end);
+    return httpd_resp_send(req, response, strlen(response));
+}
+
+/**
+ * @brief HTTP GET handler for the shadow model comparison
+ * @param req HTTP request object
+ * @return ESP_OK on success, error code on failure
+ *
+ * @handles GET /shadow_stats
+ *
+ * @response JSON response format:
+ * {
+ *   "windows": {"offered": .., "evaluated": .., "skipped": .., "failed": ..},
+ *   "agreement": <fraction of evaluated windows with the same top class>,
+ *   "confusion": [[..], ..] (row: active class, column: shadow class),
+ *   "invoke_avg_us": {"active": .., "shadow": .., "delta": <shadow - active>},
+ *   "arena_used_bytes": {"active": .., "shadow": .., "delta": <shadow - active>}
+ * }
+ *
+ * @note Returns HTTP 500 when the shadow model is not built or not running
+ */
+static esp_err_t shadow_stats_handler(httpd_req_t *req) {
+    httpd_resp_set_type(req, "application/json");
 
-    // Normalize audio
-    int16_t min_val = input_data[0];
-    int16_t max_val = input_data[0];
-    for (int i = 1; i < 1024; ++i) {
-        if (input_data[i] < min_val) min_val = input_data[i];
-        if (input_data[i] > max_val) max_val = input_data[i];
+    if (!shadow_evaluator_is_running()) {
+        httpd_resp_set_status(req, HTTPD_500);
+        return httpd_resp_sendstr(req, "{\"error\":\"Shadow model not running\"}");
     }
 
-    float range = (float)(max_val - min_val);
-    if (range == 0) range = 1.0f;
+    shadow_stats_t stats;
+    shadow_evaluator_get_stats(&stats);
+    const float agreement = stats.windows_evaluated > 0 ? (float)stats.agreements / stats.windows_evaluated : 0.0f;
+
+    char response[768];
+    size_t offset = 0;
+    json_append(response, sizeof(response), &offset,
+                "{\"windows\":{\"offered\":%lu,\"evaluated\":%lu,\"skipped\":%lu,\"failed\":%lu},"
+                "\"agreement\":%.4f,\"confusion\":[",
+                stats.windows_offered, stats.windows_evaluated, stats.windows_skipped, stats.failures, agreement);
+    for (int active = 0; active < MODEL_NUM_CLASSES; active++) {
+        json_append(response, sizeof(response), &offset, "%s[", active > 0 ? "," : "");
+        for (int shadow = 0; shadow < MODEL_NUM_CLASSES; shadow++) {
+            json_append(response, sizeof(response), &offset, "%s%lu", shadow > 0 ? "," : "",
+                        stats.confusion[active][shadow]);
+        }
+        json_append(response, sizeof(response), &offset, "]");
+    }
+    json_append(response, sizeof(response), &offset,
+                "],\"invoke_avg_us\":{\"active\":%lu,\"shadow\":%lu,\"delta\":%ld},",
+                stats.active_invoke_avg_us, stats.shadow_invoke_avg_us,
+                (long)stats.shadow_invoke_avg_us - (long)stats.active_invoke_avg_us);
+    json_append(response, sizeof(response), &offset,
+                "\"arena_used_bytes\":{\"active\":%u,\"shadow\":%u,\"delta\":%ld}}",
+                (unsigned)stats.active_arena_used_bytes, (unsigned)stats.shadow_arena_used_bytes,
+                (long)stats.shadow_arena_used_bytes - (long)stats.active_arena_used_bytes);
+    return httpd_resp_send(req, response, strlen(response));
+}
 
-    for (int i = 0; i < 1024; ++i) {
-        normalized_input[i] = ((float)(input_data[i]) - min_val) / range;
+/**
+ * @brief HTTP GET handler for the enrolled custom sounds
+ * @param req HTTP request object
+ * @return ESP_OK on success, error code on failure
+ *
+ * @handles GET /enroll
+ *
+ * @response JSON response format:
+ * {
+ *   "count": <enrolled sounds>,
+ *   "sounds": [{"id": .., "label": .., "examples": ..}] (the first 16),
+ *   "enrolling": null | {"label": .., "collected": .., "target": ..},
+ *   "latest": {"window_id": .., "id": <-1 if none>, "label": .., "similarity": ..},
+ *   "windows": {"matched": .., "busy": ..}, "match_avg_us": ..
+ * }
+ *
+ * @note Returns HTTP 500 when custom sound matching is not built or not running
+ */
+static esp_err_t enroll_status_handler(httpd_req_t *req) {
+    httpd_resp_set_type(req, "application/json");
+
+    sound_enrollment_status_t status;
+    sound_enrollment_get_status(&status);
+    if (!status.running) {
+        httpd_resp_set_status(req, HTTPD_500);
+        return httpd_resp_sendstr(req, "{\"error\":\"Custom sound matching not running\"}");
     }
 
-    // Run prediction
-    int predicted_class = predict_class(normalized_input);
-    
-    // Format response
-    if (predicted_class >= 0 && predicted_class < 6) {
-        ESP_LOGI(TAG, "Predicted sound: %s", CLASS_NAMES[predicted_class]);
-        snprintf(response, sizeof(response), "{\"category\":\"%s\"}", CLASS_NAMES[predicted_class]);
+    sound_class_t sounds[16];
+    const size_t count = sound_enrollment_list(sounds, sizeof(sounds) / sizeof(sounds[0]));
+
+    char response[1280];
+    size_t offset = 0;
+    json_append(response, sizeof(response), &offset, "{\"count\":%lu,\"sounds\":[", status.classes);
+    for (size_t i = 0; i < count; i++) {
+        json_append(response, sizeof(response), &offset, "%s{\"id\":%u,\"label\":\"%s\",\"examples\":%u}",
+                    i > 0 ? "," : "", sounds[i].id, sounds[i].label, sounds[i].examples);
+    }
+    if (status.enrolling) {
+        json_append(response, sizeof(response), &offset,
+                    "],\"enrolling\":{\"label\":\"%s\",\"collected\":%lu,\"target\":%lu},",
+                    status.enrolling_label, status.examples_collected, status.examples_target);
     } else {
-        ESP_LOGE(TAG, "Invalid prediction: %d", predicted_class);
-        snprintf(response, sizeof(response), "{\"error\":\"Model failure\"}");
+        json_append(response, sizeof(response), &offset, "],\"enrolling\":null,");
     }
+    json_append(response, sizeof(response), &offset,
+                "\"latest\":{\"window_id\":%lu,\"id\":%d,\"label\":\"%s\",\"similarity\":%.4f},"
+                "\"windows\":{\"matched\":%lu,\"busy\":%lu},\"match_avg_us\":%lu}",
+                status.latest.window_id, status.latest.id, status.latest.label, status.latest.similarity,
+                status.windows_matched, status.windows_busy, status.match_avg_us);
+    return httpd_resp_send(req, response, strlen(response));
+}
 
+/**
+ * @brief Tells whether a custom sound label only uses characters safe in JSON and file names
+ */
+static bool is_valid_label(const char *label) {
+    if (label[0] == '\0') {
+        return false;
+    }
+    for (const char *c = label; *c != '\0'; c++) {
+        if (!((*c >= 'a' && *c <= 'z') || (*c >= 'A' && *c <= 'Z') || (*c >= '0' && *c <= '9') ||
+              *c == '_' || *c == '-')) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief HTTP POST handler that changes the enrolled custom sounds
+ * @param req HTTP request object
+ * @return ESP_OK on success, error code on failure
+ *
+ * @handles POST /enroll?label=<name>[&examples=<1-100>]  enrolls the next live windows (default 10)
+ * @handles POST /enroll?delete=<id>                        removes one sound
+ * @handles POST /enroll?cancel=1                           abandons the enrollment in progress
+ * @handles POST /enroll?clear=1                            removes every sound
+ */
+static esp_err_t enroll_update_handler(httpd_req_t *req) {
+    char query[64];
+    char value[SOUND_ENROLLMENT_LABEL_SIZE];
+    if (httpd_req_get_url_query_str(req, query, sizeof(query)) != ESP_OK) {
+        httpd_resp_send_custom_err(req, HTTPD_400, "Query required");
+        return ESP_FAIL;
+    }
+
+    esp_err_t ret;
+    const char *done;
+    if (httpd_query_key_value(query, "delete", value, sizeof(value)) == ESP_OK) {
+        ret = sound_enrollment_delete((uint16_t)strtoul(value, NULL, 10));
+        done = "Sound deleted";
+    } else if (httpd_query_key_value(query, "cancel", value, sizeof(value)) == ESP_OK) {
+        sound_enrollment_cancel();
+        ret = ESP_OK;
+        done = "Enrollment cancelled";
+    } else if (httpd_query_key_value(query, "clear", value, sizeof(value)) == ESP_OK) {
+        ret = sound_enrollment_clear();
+        done = "All sounds deleted";
+    } else if (httpd_query_key_value(query, "label", value, sizeof(value)) == ESP_OK) {
+        if (!is_valid_label(value)) {
+            httpd_resp_send_custom_err(req, HTTPD_400, "Label must use letters, digits, '_' or '-'");
+            return ESP_FAIL;
+        }
+        char examples[8];
+        uint32_t count = 10;
+        if (httpd_query_key_value(query, "examples", examples, sizeof(examples)) == ESP_OK) {
+            count = strtoul(examples, NULL, 10);
+        }
+        ret = sound_enrollment_begin(value, count);
+        done = "Enrollment started, play the sound now";
+    } else {
+        httpd_resp_send_custom_err(req, HTTPD_400, "Expected label, delete, cancel or clear");
+        return ESP_FAIL;
+    }
+
+    switch (ret) {
+    case ESP_OK:
+        return httpd_resp_sendstr(req, done);
+    case ESP_ERR_INVALID_ARG:
+        httpd_resp_send_custom_err(req, HTTPD_400, "Examples must be between 1 and 100");
+        return ESP_FAIL;
+    case ESP_ERR_NOT_FOUND:
+        httpd_resp_send_err(req, HTTPD_404_NOT_FOUND, "No such sound");
+        return ESP_FAIL;
+    case ESP_ERR_NO_MEM:
+        httpd_resp_send_custom_err(req, HTTPD_400, "Too many enrolled sounds");
+        return ESP_FAIL;
+    case ESP_ERR_INVALID_STATE:
+        httpd_resp_send_custom_err(req, HTTPD_400, "Matching not running or enrollment already in progress");
+        return ESP_FAIL;
+    default:
+        httpd_resp_send_500(req);
+        return ESP_FAIL;
+    }
+}
+
+/**
+ * @brief Reports and tunes the two-stage detection cascade
+ * @param req HTTP request object
+ * @return ESP_OK on success, error code on failure
+ *
+ * @handles GET /cascade[?threshold=<0..1>]
+ *
+ * @response JSON response format:
+ * {
+ *   "enabled": true|false,
+ *   "threshold": <stage_one_threshold>,
+ *   "stage1": {"runs": .., "hits": .., "avg_us": ..},
+ *   "stage2": {"runs": .., "avg_us": ..}
+ * }
+ *
+ * @note The optional threshold query updates the stage-one threshold first
+ */
+static esp_err_t cascade_handler(httpd_req_t *req) {
+    char query[32];
+    char value[16];
+    if (httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK &&
+        httpd_query_key_value(query, "threshold", value, sizeof(value)) == ESP_OK) {
+        char *end = NULL;
+        float threshold = strtof(value, &end);
+        if (end == value || cascade_set_threshold(threshold) != ESP_OK) {
+            httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Threshold must be between 0 and 1");
+            return ESP_FAIL;
+        }
+    }
+
+    cascade_stats_t stats;
+    cascade_get_stats(&stats);
+#if CONFIG_MODEL_CASCADE_ENABLE
+    const char *enabled = "true";
+#else
+    const char *enabled = "false";
+#endif
+
+    char response[256];
+    size_t offset = 0;
+    json_append(response, sizeof(response), &offset,
+                "{\"enabled\":%s,\"threshold\":%.3f,",
+                enabled, stats.threshold);
+    json_append(response, sizeof(response), &offset,
+                "\"stage1\":{\"runs\":%lu,\"hits\":%lu,\"avg_us\":%lu},\"stage2\":{\"runs\":%lu,\"avg_us\":%lu}}",
+                stats.stage1_runs, stats.stage1_hits, stats.stage1_avg_us,
+                stats.stage2_runs, stats.stage2_avg_us);
+
+    httpd_resp_set_type(req, "application/json");
+    return httpd_resp_send(req, response, strlen(response));
+}
+
+/**
+ * @brief Reports and tunes the binary detection heads
+ * @param req HTTP request object
+ * @return ESP_OK on success, error code on failure
+ *
+ * @handles GET /heads[?name=<head>&enabled=<0|1>&threshold=<0..1>]
+ *
+ * @response JSON response format:
+ * {
+ *   "heads": [{"name": .., "enabled": true|false, "threshold": ..}]
+ * }
+ *
+ * @note With a name, the given settings of that head are updated first;
+ * omitted settings keep their value
+ */
+static esp_err_t heads_handler(httpd_req_t *req) {
+    char query[96];
+    char value[24];
+    if (httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK &&
+        httpd_query_key_value(query, "name", value, sizeof(value)) == ESP_OK) {
+        const int head = model_head_find(value);
+        model_head_config_t config;
+        if (head < 0 || model_head_get_config(head, &config) != 0) {
+            httpd_resp_send_err(req, HTTPD_404_NOT_FOUND, "No such detection head");
+            return ESP_FAIL;
+        }
+        if (httpd_query_key_value(query, "enabled", value, sizeof(value)) == ESP_OK) {
+            config.enabled = strcmp(value, "0") != 0 && strcmp(value, "false") != 0;
+        }
+        if (httpd_query_key_value(query, "threshold", value, sizeof(value)) == ESP_OK) {
+            char *end = NULL;
+            config.threshold = strtof(value, &end);
+            if (end == value) {
+                config.threshold = -1.0f;
+            }
+        }
+        if (model_head_set_config(head, &config) != 0) {
+            httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Threshold must be between 0 and 1");
+            return ESP_FAIL;
+        }
+    }
+
+    char response[384];
+    size_t offset = 0;
+    json_append(response, sizeof(response), &offset, "{\"heads\":[");
+    for (int h = 0; h < model_head_count(); h++) {
+        model_head_config_t config;
+        model_head_get_config(h, &config);
+        json_append(response, sizeof(response), &offset, "%s{\"name\":\"%s\",\"enabled\":%s,\"threshold\":%.3f}",
+                    h > 0 ? "," : "", model_head_name(h), config.enabled ? "true" : "false", config.threshold);
+    }
+    json_append(response, sizeof(response), &offset, "]}");
+
+    httpd_resp_set_type(req, "application/json");
+    return httpd_resp_send(req, response, strlen(response));
+}
+
+/**
+ * @brief Starts reclassifying every recording on the SD card
+ * @param req HTTP request object
+ * @return ESP_OK on success, error code on failure
+ *
+ * @handles POST /reclassify
+ *
+ * @example
+ * curl -X POST http://192.168.4.1/reclassify
+ *
+ * @note Results are written as <recording>.csv next to each WAV file;
+ * progress is reported by GET /reclassify
+ */
+static esp_err_t reclassify_start_handler(httpd_req_t *req) {
+    if (is_recording) {
+        httpd_resp_send_custom_err(req, HTTPD_400, "Recording in progress");
+        return ESP_FAIL;
+    }
+
+    esp_err_t ret = reclassify_start();
+    if (ret == ESP_ERR_INVALID_STATE) {
+        httpd_resp_send_custom_err(req, HTTPD_400, "Reclassification already in progress");
+        return ESP_FAIL;
+    }
+    if (ret != ESP_OK) {
+        httpd_resp_send_500(req);
+        return ESP_FAIL;
+    }
+
+    httpd_resp_send(req, "Reclassification started", HTTPD_RESP_USE_STRLEN);
+    return ESP_OK;
+}
+
+/**
+ * @brief Reports the progress of the reclassification job
+ * @param req HTTP request object
+ * @return ESP_OK on success, error code on failure
+ *
+ * @handles GET /reclassify
+ *
+ * @response JSON response format:
+ * {
+ *   "running": true|false,
+ *   "files_done": .., "files_failed": .., "windows": ..,
+ *   "current_file": "<category>/<file>.wav",
+ *   "elapsed_ms": <duration of the current or last run>
+ * }
+ */
+static esp_err_t reclassify_status_handler(httpd_req_t *req) {
+    reclassify_status_t status;
+    reclassify_get_status(&status);
+
+    const int64_t end_ms = status.running ? esp_timer_get_time() / 1000 : status.finished_at_ms;
+    const int64_t elapsed_ms = status.started_at_ms == 0 ? 0 : end_ms - status.started_at_ms;
+
+    char response[256];
+    size_t offset = 0;
+    json_append(response, sizeof(response), &offset,
+                "{\"running\":%s,\"files_done\":%lu,\"files_failed\":%lu,\"windows\":%lu,",
+                status.running ? "true" : "false", status.files_done, status.files_failed,
+                status.windows_classified);
+    json_append(response, sizeof(response), &offset,
+                "\"current_file\":\"%s\",\"elapsed_ms\":%lld}", status.current_file, elapsed_ms);
+
+    httpd_resp_set_type(req, "application/json");
+    return httpd_resp_send(req, response, strlen(response));
+}
+
+/**
+ * @brief Sends the latency of the classifier with every arena and weight placement
+ * @param req HTTP request object
+ * @param iterations Number of inferences timed per placement
+ * @return ESP_OK on success, error code on failure
+ */
+static esp_err_t send_placement_comparison(httpd_req_t *req, uint32_t iterations) {
+    model_placement_comparison_t comparison;
+    if (model_benchmark_placement(iterations, &comparison) != ESP_OK) {
+        httpd_resp_send_500(req);
+        return ESP_FAIL;
+    }
+
+    char response[800];
+    size_t offset = 0;
+    json_append(response, sizeof(response), &offset,
+                "{\"iterations\":%lu,\"policy\":{\"activations\":\"%s\",\"weights\":\"%s\",\"audio_history\":\"%s\"},"
+                "\"placements\":[",
+                comparison.iterations, model_memory_name(comparison.activations),
+                model_memory_name(comparison.weights), model_memory_name(comparison.audio_history));
+    for (int p = 0; p < MODEL_PLACEMENT_COUNT; p++) {
+        const model_placement_benchmark_t *placement = &comparison.placements[p];
+        json_append(response, sizeof(response), &offset,
+                    "%s{\"arena\":\"%s\",\"weights\":\"%s\",\"measured\":%s",
+                    p > 0 ? "," : "", model_memory_name(placement->arena), model_memory_name(placement->weights),
+                    placement->measured ? "true" : "false");
+        if (placement->measured) {
+            json_append(response, sizeof(response), &offset,
+                        ",\"invoke_us\":{\"min\":%lu,\"avg\":%lu,\"max\":%lu}",
+                        placement->invoke_min_us, placement->invoke_avg_us, placement->invoke_max_us);
+        }
+        json_append(response, sizeof(response), &offset, "}");
+    }
+    json_append(response, sizeof(response), &offset, "]}");
+
+    httpd_resp_set_type(req, "application/json");
+    return httpd_resp_send(req, response, strlen(response));
+}
+
+/**
+ * @brief Sends TFLM initialization time and arena use with and without the offline memory plan
+ * @param req HTTP request object
+ * @return ESP_OK on success, error code on failure
+ */
+static esp_err_t send_planning_comparison(httpd_req_t *req) {
+    model_planning_benchmark_t planning;
+    esp_err_t ret = model_benchmark_planning(&planning);
+    if (ret == ESP_ERR_NOT_FOUND) {
+        httpd_resp_send_err(req, HTTPD_404_NOT_FOUND, "Model has no offline memory plan");
+        return ESP_FAIL;
+    }
+    if (ret != ESP_OK) {
+        httpd_resp_send_500(req);
+        return ESP_FAIL;
+    }
+
+    char response[256];
+    size_t offset = 0;
+    json_append(response, sizeof(response), &offset,
+                "{\"offline_tensors\":%lu,\"honored\":%s,\"init_us\":{\"offline\":%lu,\"online\":%lu},"
+                "\"arena_used_bytes\":{\"offline\":%u,\"online\":%u}}",
+                planning.tensors, planning.honored ? "true" : "false",
+                planning.offline_init_us, planning.online_init_us,
+                (unsigned)planning.offline_arena_bytes, (unsigned)planning.online_arena_bytes);
+
+    httpd_resp_set_type(req, "application/json");
+    return httpd_resp_send(req, response, strlen(response));
+}
+
+/**
+ * @brief Benchmarks the deployed model on a synthetic window
+ * @param req HTTP request object
+ * @return ESP_OK on success, error code on failure
+ *
+ * @handles GET /model_benchmark?iterations=<1-500>[&placement=1|&planning=1]
+ *
+ * @response JSON response format:
+ * {
+ *   "engine": "tflm",
+ *   "iterations": ..,
+ *   "invoke_us": {"min": .., "avg": .., "max": ..},
+ *   "quantize_avg_us": ..,
+ *   "model_bytes": .., "arena_bytes": .., "arena_used_bytes": ..,
+ *   "decompressed_bytes": .., "load_us": ..,
+ *   "shared_arena": {"interpreters": .., "bytes": .., "peak_bytes": .., "persistent_bytes": .., "persistent_used_bytes": ..}
+ * }
+ * With placement=1, the TFLM classifier is timed with its arena and weights
+ * in each memory ("flash", "internal", "psram"):
+ * {
+ *   "iterations": ..,
+ *   "policy": {"activations": .., "weights": .., "audio_history": ..},
+ *   "placements": [{"arena": .., "weights": .., "measured": true|false, "invoke_us": {..}}]
+ * }
+ * With planning=1, AllocateTensors() is timed with the offline memory plan
+ * from tools/plan_tflite_memory.py and with on-device planning (404 if the
+ * model has no plan):
+ * {
+ *   "offline_tensors": .., "honored": true|false,
+ *   "init_us": {"offline": .., "online": ..},
+ *   "arena_used_bytes": {"offline": .., "online": ..}
+ * }
+ *
+ * @note Runs on the server task and shares the interpreter with live
+ * inference, so latencies include any waiting for the interpreter lock
+ */
+static esp_err_t model_benchmark_handler(httpd_req_t *req) {
+    char query[48];
+    char value[8];
+    uint32_t iterations = 20;
+    bool placement = false;
+    bool planning = false;
+    if (httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK) {
+        if (httpd_query_key_value(query, "iterations", value, sizeof(value)) == ESP_OK) {
+            iterations = strtoul(value, NULL, 10);
+            if (iterations == 0 || iterations > 500) {
+                httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Iterations must be between 1 and 500");
+                return ESP_FAIL;
+            }
+        }
+        placement = httpd_query_key_value(query, "placement", value, sizeof(value)) == ESP_OK &&
+                    strcmp(value, "1") == 0;
+        planning = httpd_query_key_value(query, "planning", value, sizeof(value)) == ESP_OK &&
+                   strcmp(value, "1") == 0;
+    }
+
+    if (placement) {
+        return send_placement_comparison(req, iterations);
+    }
+    if (planning) {
+        return send_planning_comparison(req);
+    }
+
+    model_benchmark_result_t result;
+    if (model_benchmark_run(iterations, &result) != ESP_OK) {
+        httpd_resp_send_500(req);
+        return ESP_FAIL;
+    }
+
+    char response[480];
+    size_t offset = 0;
+    json_append(response, sizeof(response), &offset,
+                "{\"engine\":\"%s\",\"iterations\":%lu,\"invoke_us\":{\"min\":%lu,\"avg\":%lu,\"max\":%lu},\"quantize_avg_us\":%lu,",
+                result.model.engine, result.iterations, result.invoke_min_us, result.invoke_avg_us,
+                result.invoke_max_us, result.quantize_avg_us);
+    json_append(response, sizeof(response), &offset,
+                "\"model_bytes\":%u,\"arena_bytes\":%u,\"arena_used_bytes\":%u,\"decompressed_bytes\":%u,\"load_us\":%lu,",
+                (unsigned)result.model.model_bytes, (unsigned)result.model.arena_bytes,
+                (unsigned)result.model.arena_used_bytes, (unsigned)result.model.decompressed_bytes,
+                result.model.load_us);
+    json_append(response, sizeof(response), &offset,
+                "\"shared_arena\":{\"interpreters\":%lu,\"bytes\":%u,\"peak_bytes\":%u,"
+                "\"persistent_bytes\":%u,\"persistent_used_bytes\":%u}}",
+                result.arena.interpreters, (unsigned)result.arena.shared_bytes,
+                (unsigned)result.arena.shared_peak_bytes, (unsigned)result.arena.persistent_bytes,
+                (unsigned)result.arena.persistent_used_bytes);
+
+    httpd_resp_set_type(req, "application/json");
     return httpd_resp_send(req, response, strlen(response));
 }
 
@@ -741,7 +1464,7 @@ esp_err_t start_file_server(const char *base_path)
     config.uri_match_fn = httpd_uri_match_wildcard;
     config.keep_alive_enable = false;
     config.lru_purge_enable = true;
-    config.max_uri_handlers = 20;
+    config.max_uri_handlers = 24;
     config.close_fn = httpd_close_func;
     config.stack_size = 8192;  // Double the default stack size
 
@@ -763,6 +1486,15 @@ esp_err_t start_file_server(const char *base_path)
         {.uri = "/delete_file", .method = HTTP_GET, .handler = delete_file_handler, .user_ctx = NULL},
         {.uri = "/download_file", .method = HTTP_GET, .handler = download_file_handler, .user_ctx = NULL},
         {.uri = "/predict", .method = HTTP_GET, .handler = prediction_handler, .user_ctx = server_data},
+        {.uri = "/inference_stats", .method = HTTP_GET, .handler = inference_stats_handler, .user_ctx = NULL},
+        {.uri = "/shadow_stats", .method = HTTP_GET, .handler = shadow_stats_handler, .user_ctx = NULL},
+        {.uri = "/cascade", .method = HTTP_GET, .handler = cascade_handler, .user_ctx = NULL},
+        {.uri = "/heads", .method = HTTP_GET, .handler = heads_handler, .user_ctx = NULL},
+        {.uri = "/enroll", .method = HTTP_GET, .handler = enroll_status_handler, .user_ctx = NULL},
+        {.uri = "/enroll", .method = HTTP_POST, .handler = enroll_update_handler, .user_ctx = NULL},
+        {.uri = "/reclassify", .method = HTTP_POST, .handler = reclassify_start_handler, .user_ctx = NULL},
+        {.uri = "/reclassify", .method = HTTP_GET, .handler = reclassify_status_handler, .user_ctx = NULL},
+        {.uri = "/model_benchmark", .method = HTTP_GET, .handler = model_benchmark_handler, .user_ctx = NULL},
         {.uri = "/*", .method = HTTP_GET, .handler = download_get_handler, .user_ctx = server_data},
     };
 
@@ -0,0 +1,87 @@
+#pragma once
+
+#ifndef INFERENCE_SCHEDULER_H
+#define INFERENCE_SCHEDULER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "model_predictor.h"
+#include "temporal_pooling.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Moving averages of the per-window latency of each pipeline stage
+ */
+typedef struct {
+    uint32_t capture;                 ///< Waiting for one hop of audio
+    uint32_t features;                ///< Normalizing the window
+    uint32_t handoff;                 ///< Queued between the front end and the model
+    uint32_t inference;               ///< Quantize and Invoke()
+    uint32_t end_to_end;              ///< Newest sample captured to result published
+} inference_stage_stats_t;
+
+/**
+ * @brief Stable, smoothed view of what the device currently hears
+ */
+typedef struct {
+    uint32_t window_id;               ///< Sequence number of the latest classified window
+    int64_t updated_at_ms;            ///< Capture time of the latest classified window
+    int top_class;                    ///< Smoothed class, -1 until enough windows were seen
+    float score;                      ///< Averaged score of top_class
+    float average_scores[MODEL_NUM_CLASSES];
+    int last_detection_class;         ///< Class of the last detection event, -1 if none
+    int64_t last_detection_ms;        ///< Time of the last detection event
+    temporal_pooling_decision_t pooled; ///< Long-span decision (CONFIG_INFERENCE_POOLING_ENABLE, top_class -1 otherwise)
+    int last_pooled_detection_class;  ///< Class of the last long-span detection, -1 if none
+    int64_t last_pooled_detection_ms; ///< Time of the last long-span detection
+    uint32_t windows_classified;      ///< Windows that went through the model
+    uint32_t windows_skipped;         ///< Windows skipped to stay within the CPU budget
+    uint32_t windows_dropped;         ///< Windows dropped because the pipeline was full
+    uint32_t windows_gated;           ///< Windows rejected by the cascade stage-one detector
+    uint32_t state_resets;            ///< Streaming model state cleared after a gap in the windows
+    inference_stage_stats_t stage_avg_us;
+} inference_state_t;
+
+/**
+ * @brief Starts the continuous inference pipeline
+ * @return ESP_OK on success, ESP_ERR_INVALID_STATE if already running
+ *
+ * @note Hop, smoothing, CPU budget and core placement come from the
+ * "Sound Classification Inference" Kconfig menu
+ */
+esp_err_t inference_scheduler_start(void);
+
+/**
+ * @brief Reports whether the continuous inference pipeline is running
+ */
+bool inference_scheduler_is_running(void);
+
+/**
+ * @brief Copies the current smoothed state
+ * @param state Output state
+ * @note The unsmoothed result of the latest window is in result_snapshot_read()
+ * @return ESP_OK on success, ESP_ERR_INVALID_STATE if the scheduler is not running
+ */
+esp_err_t inference_scheduler_get_state(inference_state_t *state);
+
+/**
+ * @brief Suspends audio capture so another user can own the microphone
+ *
+ * @note Used while a WAV recording is in progress
+ */
+void inference_scheduler_pause(void);
+
+/**
+ * @brief Resumes audio capture after inference_scheduler_pause()
+ */
+void inference_scheduler_resume(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // INFERENCE_SCHEDULER_H
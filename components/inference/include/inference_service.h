@@ -0,0 +1,72 @@
+#pragma once
+
+#ifndef INFERENCE_SERVICE_H
+#define INFERENCE_SERVICE_H
+
+#include <stdint.h>
+#include "esp_err.h"
+#include "model_predictor.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Counters of the on-demand inference service
+ */
+typedef struct {
+    uint32_t requests;                ///< Calls to inference_service_predict()
+    uint32_t captures;                ///< Windows captured and classified for them
+    uint32_t timeouts;                ///< Calls that gave up before their window was ready
+} inference_service_stats_t;
+
+/**
+ * @brief Starts the task that owns the microphone, buffers and interpreter for on-demand requests
+ * @return ESP_OK on success, ESP_ERR_INVALID_STATE if already started
+ *
+ * @note The task only captures while requests are waiting, and callers only
+ * use it while the continuous scheduler is not running
+ */
+esp_err_t inference_service_start(void);
+
+/**
+ * @brief Classifies the next microphone window
+ * @param result Output result, including capture and feature latencies
+ * @param window_id Output sequence number of the classified window (may be NULL)
+ * @param timeout_ms Maximum time to wait for the window
+ * @return ESP_OK on success, ESP_ERR_INVALID_STATE if the service is not started,
+ *         ESP_ERR_NO_MEM if too many callers are waiting, ESP_ERR_TIMEOUT,
+ *         ESP_FAIL if inference failed
+ *
+ * @note Requests are coalesced: every caller that arrives while a window is
+ * being captured gets that window's result, so N concurrent callers cost one
+ * capture and one Invoke(). A caller arriving after the capture finished
+ * waits for the next window, so a result never predates its request.
+ */
+esp_err_t inference_service_predict(prediction_result_t *result, uint32_t *window_id, uint32_t timeout_ms);
+
+/**
+ * @brief Keeps the service off the microphone so another user can own it
+ *
+ * @note Waits for an in-flight capture to finish. Windows requested while
+ * paused are captured after inference_service_resume(), so callers with a
+ * shorter timeout get ESP_ERR_TIMEOUT. Used while a WAV recording is in progress.
+ */
+void inference_service_pause(void);
+
+/**
+ * @brief Lets the service capture again after inference_service_pause()
+ */
+void inference_service_resume(void);
+
+/**
+ * @brief Copies the service counters
+ * @param stats Output counters
+ */
+void inference_service_get_stats(inference_service_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // INFERENCE_SERVICE_H
@@ -0,0 +1,70 @@
+#pragma once
+
+#ifndef POSTERIOR_SMOOTHER_H
+#define POSTERIOR_SMOOTHER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "model_predictor.h"
+
+#define POSTERIOR_SMOOTHER_MAX_RESULTS 64   ///< Capacity of the averaging history
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    uint32_t average_window_ms;   ///< Span of results averaged together
+    float detection_threshold;    ///< Minimum averaged score to report a detection
+    uint32_t suppression_ms;      ///< Hold-off before the same class is reported again
+    uint32_t minimum_count;       ///< Results required in the window before deciding
+} posterior_smoother_config_t;
+
+typedef struct {
+    int64_t timestamp_ms;
+    float scores[MODEL_NUM_CLASSES];
+} posterior_result_t;
+
+typedef struct {
+    posterior_smoother_config_t config;
+    posterior_result_t results[POSTERIOR_SMOOTHER_MAX_RESULTS];
+    int head;                     ///< Index of the oldest result
+    int count;                    ///< Number of results held
+    int previous_top_class;       ///< Last reported class, -1 before the first detection
+    int64_t previous_top_time_ms; ///< Time of the last reported detection
+} posterior_smoother_t;
+
+typedef struct {
+    int top_class;                ///< Class with the highest averaged score
+    float score;                  ///< Averaged score of top_class
+    bool is_new_detection;        ///< True when this result crossed the threshold anew
+    float average_scores[MODEL_NUM_CLASSES];
+} posterior_decision_t;
+
+/**
+ * @brief Initializes a posterior smoother
+ * @param smoother Smoother instance to initialize
+ * @param config Averaging and detection parameters
+ * @return ESP_OK on success, ESP_ERR_INVALID_ARG on bad parameters
+ */
+esp_err_t posterior_smoother_init(posterior_smoother_t *smoother, const posterior_smoother_config_t *config);
+
+/**
+ * @brief Adds the latest per-window scores and computes a smoothed decision
+ * @param smoother Smoother instance
+ * @param scores MODEL_NUM_CLASSES scores for the latest window
+ * @param timestamp_ms Capture time of the latest window
+ * @param decision Output decision
+ * @return ESP_OK on success, ESP_ERR_INVALID_ARG if results arrive out of order
+ *
+ * @note Modeled on RecognizeCommands from the TFLM micro_speech example
+ */
+esp_err_t posterior_smoother_process(posterior_smoother_t *smoother, const float *scores,
+                                     int64_t timestamp_ms, posterior_decision_t *decision);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // POSTERIOR_SMOOTHER_H
@@ -0,0 +1,54 @@
+#pragma once
+
+#ifndef RECLASSIFY_JOB_H
+#define RECLASSIFY_JOB_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Progress of the background reclassification job
+ */
+typedef struct {
+    bool running;                     ///< Job currently walking the card
+    uint32_t files_done;              ///< Recordings classified in this run
+    uint32_t files_failed;            ///< Recordings that could not be read or written
+    uint32_t windows_classified;      ///< Windows classified in this run
+    int64_t started_at_ms;            ///< Start time of the last run
+    int64_t finished_at_ms;           ///< End time of the last run, 0 while running
+    char current_file[64];            ///< Recording being processed (relative to the card)
+} reclassify_status_t;
+
+/**
+ * @brief Starts reclassifying every recording on the SD card
+ * @return ESP_OK on success, ESP_ERR_INVALID_STATE if a run is in progress
+ *
+ * @note Walks SD_MOUNT_POINT/<category>/<name>.wav in a low-priority task and
+ * writes <recording>.csv next to each file with one line per window:
+ * window index, start time, predicted class and every class score.
+ * Existing result files are overwritten, so one call refreshes the whole
+ * card after a model update.
+ */
+esp_err_t reclassify_start(void);
+
+/**
+ * @brief Reports whether a reclassification run is in progress
+ */
+bool reclassify_is_running(void);
+
+/**
+ * @brief Copies the progress of the current or last run
+ * @param status Output status
+ */
+void reclassify_get_status(reclassify_status_t *status);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RECLASSIFY_JOB_H
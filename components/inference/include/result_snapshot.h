@@ -0,0 +1,72 @@
+#pragma once
+
+#ifndef RESULT_SNAPSHOT_H
+#define RESULT_SNAPSHOT_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "model_predictor.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Most recent classification, from the scheduler or the on-demand service
+ */
+typedef struct {
+    uint32_t sequence;                ///< Publish count, changes with every new result
+    uint32_t window_id;               ///< Window id assigned by the publisher
+    prediction_result_t result;       ///< Class, scores, capture timestamp and latencies
+} result_snapshot_t;
+
+/**
+ * @brief Prepares the snapshot for waiters
+ *
+ * @note Idempotent; called by inference_scheduler_start() and
+ * inference_service_start()
+ */
+void result_snapshot_init(void);
+
+/**
+ * @brief Publishes a new result and wakes every result_snapshot_wait() caller
+ * @param result Classified window (capture_timestamp_us must be set)
+ * @param window_id Publisher's window id
+ *
+ * @note Readers never block writers: the snapshot is a sequence lock, and
+ * the writer-side mutex only orders the two publishers. Does nothing before
+ * result_snapshot_init()
+ */
+void result_snapshot_publish(const prediction_result_t *result, uint32_t window_id);
+
+/**
+ * @brief Copies the latest snapshot without taking a lock
+ * @param snapshot Output snapshot
+ * @return false if nothing was published yet
+ */
+bool result_snapshot_read(result_snapshot_t *snapshot);
+
+/**
+ * @brief Age of a snapshot's window
+ * @param snapshot Snapshot from result_snapshot_read()
+ * @return Milliseconds since the newest sample of the window was captured
+ */
+int64_t result_snapshot_age_ms(const result_snapshot_t *snapshot);
+
+/**
+ * @brief Waits for a result newer than a given sequence
+ * @param sequence Last sequence the caller has seen (0 if none)
+ * @param snapshot Output snapshot
+ * @param timeout_ms Maximum time to wait
+ * @return ESP_OK on success, ESP_ERR_INVALID_STATE before result_snapshot_init(),
+ *         ESP_ERR_NO_MEM if CONFIG_INFERENCE_SERVICE_MAX_WAITERS callers already wait,
+ *         ESP_ERR_TIMEOUT if nothing was published in time
+ */
+esp_err_t result_snapshot_wait(uint32_t sequence, result_snapshot_t *snapshot, uint32_t timeout_ms);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RESULT_SNAPSHOT_H
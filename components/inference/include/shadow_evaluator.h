@@ -0,0 +1,68 @@
+#pragma once
+
+#ifndef SHADOW_EVALUATOR_H
+#define SHADOW_EVALUATOR_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "model_predictor.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Comparison of the shadow model against the active model on live windows
+ */
+typedef struct {
+    uint32_t windows_offered;         ///< Windows the active model classified while the shadow ran
+    uint32_t windows_evaluated;       ///< Windows both models classified
+    uint32_t windows_skipped;         ///< Windows offered while the shadow was still busy
+    uint32_t failures;                ///< Shadow inferences that failed
+    uint32_t agreements;              ///< Evaluated windows where both top classes match
+    uint32_t confusion[MODEL_NUM_CLASSES][MODEL_NUM_CLASSES]; ///< [active class][shadow class] counts
+    uint32_t active_invoke_avg_us;    ///< Moving average of the active Invoke() on evaluated windows
+    uint32_t shadow_invoke_avg_us;    ///< Moving average of the shadow Invoke() on the same windows
+    size_t active_arena_used_bytes;   ///< Arena used by the active model
+    size_t shadow_arena_used_bytes;   ///< Arena used by the shadow model
+} shadow_stats_t;
+
+/**
+ * @brief Loads the shadow model and starts its low-priority evaluation task
+ * @return ESP_OK on success, ESP_ERR_NOT_SUPPORTED without CONFIG_MODEL_SHADOW_ENABLE,
+ *         ESP_ERR_INVALID_STATE if already started, ESP_FAIL if the model could not be loaded
+ *
+ * @note Called by inference_scheduler_start()
+ */
+esp_err_t shadow_evaluator_start(void);
+
+/**
+ * @brief Hands a classified window to the shadow model
+ * @param features Window the active model ran on (MODEL_INPUT_SIZE int8 values)
+ * @param active Active model's result for the window
+ *
+ * @note Never blocks: the window is copied into the single shadow slot, or
+ * skipped if the shadow has not finished the previous one. Running below
+ * the inference tasks, the shadow only gets the CPU they leave idle, so a
+ * short CPU turns into skipped windows instead of late active results.
+ */
+void shadow_evaluator_offer(const int8_t *features, const prediction_result_t *active);
+
+/**
+ * @brief Tells whether the shadow evaluation is running
+ */
+bool shadow_evaluator_is_running(void);
+
+/**
+ * @brief Copies the comparison counters
+ * @param stats Output statistics
+ */
+void shadow_evaluator_get_stats(shadow_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SHADOW_EVALUATOR_H
@@ -0,0 +1,142 @@
+#pragma once
+
+#ifndef SOUND_ENROLLMENT_H
+#define SOUND_ENROLLMENT_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "model_predictor.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SOUND_ENROLLMENT_LABEL_SIZE 16    ///< Label bytes including the terminator
+#define SOUND_ENROLLMENT_MAX_EXAMPLES 100 ///< Most windows averaged into one centroid
+
+/**
+ * @brief A custom sound stored in the enrollment database
+ */
+typedef struct {
+    uint16_t id;                          ///< Assigned at enrollment, never reused (1-based)
+    uint16_t examples;                    ///< Windows averaged into the centroid
+    char label[SOUND_ENROLLMENT_LABEL_SIZE];
+} sound_class_t;
+
+/**
+ * @brief Closest enrolled sound to one window
+ */
+typedef struct {
+    int id;                               ///< Matched sound, -1 if no centroid reaches the threshold
+    char label[SOUND_ENROLLMENT_LABEL_SIZE]; ///< Label of the matched sound, empty if none
+    float similarity;                     ///< Cosine similarity to the closest centroid, matched or not
+    uint32_t window_id;                   ///< Window the match was computed for
+} sound_match_t;
+
+/**
+ * @brief Enrollment progress and matching statistics
+ */
+typedef struct {
+    bool running;                         ///< Database loaded and live windows are matched
+    size_t embedding_size;                ///< Elements of the model's embedding
+    uint32_t classes;                     ///< Enrolled sounds
+    bool enrolling;                       ///< Collecting examples for a new sound
+    char enrolling_label[SOUND_ENROLLMENT_LABEL_SIZE];
+    uint32_t examples_collected;          ///< Windows collected for the sound being enrolled
+    uint32_t examples_target;             ///< Windows requested for the sound being enrolled
+    uint32_t windows_matched;             ///< Live windows compared with the centroids
+    uint32_t windows_busy;                ///< Live windows skipped while the database was being changed
+    uint32_t match_avg_us;                ///< Moving average of the comparison with every centroid
+    sound_match_t latest;                 ///< Result of the latest matched window
+} sound_enrollment_status_t;
+
+/**
+ * @brief Loads the enrollment database from the SD card, creating it if needed
+ * @return ESP_OK on success, ESP_ERR_NOT_SUPPORTED if the model has no
+ *         embedding output, ESP_ERR_INVALID_STATE if already started,
+ *         ESP_ERR_NO_MEM or ESP_FAIL otherwise
+ *
+ * @note Called by inference_scheduler_start(). A database written for an
+ * embedding of another size belongs to another model and is replaced
+ */
+esp_err_t sound_enrollment_start(void);
+
+/**
+ * @brief Tells whether live windows are matched against the enrolled sounds
+ */
+bool sound_enrollment_is_running(void);
+
+/**
+ * @brief Enrolls a new sound from the next live windows
+ * @param label Name of the sound (at most SOUND_ENROLLMENT_LABEL_SIZE - 1 characters)
+ * @param examples Windows to average (1-SOUND_ENROLLMENT_MAX_EXAMPLES)
+ * @return ESP_OK when collection started, ESP_ERR_INVALID_ARG for a bad label
+ *         or count, ESP_ERR_INVALID_STATE if not running or already enrolling,
+ *         ESP_ERR_NO_MEM if CONFIG_SOUND_ENROLLMENT_MAX_CLASSES sounds are enrolled
+ *
+ * @note Play the sound while the windows are collected. Windows where the
+ * embedding layer did not activate at all are not counted. Once the last
+ * window is collected, a low-priority task writes the centroid to the SD card
+ */
+esp_err_t sound_enrollment_begin(const char *label, uint32_t examples);
+
+/**
+ * @brief Abandons the enrollment in progress, if any
+ */
+void sound_enrollment_cancel(void);
+
+/**
+ * @brief Removes an enrolled sound
+ * @param id Id of the sound
+ * @return ESP_OK on success, ESP_ERR_NOT_FOUND for an unknown id,
+ *         ESP_ERR_INVALID_STATE if not running, ESP_FAIL if the SD card write failed
+ */
+esp_err_t sound_enrollment_delete(uint16_t id);
+
+/**
+ * @brief Removes every enrolled sound
+ * @return ESP_OK on success, ESP_ERR_INVALID_STATE if not running, ESP_FAIL on SD card errors
+ */
+esp_err_t sound_enrollment_clear(void);
+
+/**
+ * @brief Feeds one classified live window to the enrollment and the matcher
+ * @param window_id Sequence number of the window
+ * @param embedding Unit-length embedding from predict_stream_embedding()
+ *
+ * @note Called by the inference task. Never waits for the database: while
+ * an HTTP request changes it, the window is skipped
+ */
+void sound_enrollment_process(uint32_t window_id, const float *embedding);
+
+/**
+ * @brief Finds the enrolled sound closest to an embedding
+ * @param embedding Unit-length embedding from predict_stream_embedding()
+ * @param match Output match (id -1 below CONFIG_SOUND_ENROLLMENT_THRESHOLD)
+ * @return ESP_OK on success, ESP_ERR_INVALID_STATE if not running
+ *
+ * @note One dsps_dotprod_f32() per enrolled sound
+ */
+esp_err_t sound_enrollment_match(const float *embedding, sound_match_t *match);
+
+/**
+ * @brief Copies the enrolled sounds
+ * @param classes Output array
+ * @param max_classes Capacity of classes
+ * @return Number of sounds copied
+ */
+size_t sound_enrollment_list(sound_class_t *classes, size_t max_classes);
+
+/**
+ * @brief Copies the enrollment progress and matching statistics
+ * @param status Output status
+ */
+void sound_enrollment_get_status(sound_enrollment_status_t *status);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SOUND_ENROLLMENT_H
@@ -0,0 +1,91 @@
+#pragma once
+
+#ifndef TEMPORAL_POOLING_H
+#define TEMPORAL_POOLING_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "model_predictor.h"
+
+#define TEMPORAL_POOLING_MAX_WINDOWS 640   ///< Capacity of the pooling ring (5 s at an 8 ms hop)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief How the per-window scores of a span are combined
+ */
+typedef enum {
+    TEMPORAL_POOLING_MAX,         ///< Highest score of each class in the span (short events)
+    TEMPORAL_POOLING_MEAN,        ///< Mean score of each class (sustained sounds)
+    TEMPORAL_POOLING_WEIGHTED,    ///< Mean weighted by each window's top-1/top-2 margin
+} temporal_pooling_mode_t;
+
+typedef struct {
+    temporal_pooling_mode_t mode;
+    uint32_t span_ms;             ///< Time span pooled into one decision
+    uint32_t hop_ms;              ///< Time between windows; the span counts as covered one hop early
+    float detection_threshold;    ///< Minimum pooled score to report a detection
+    uint32_t suppression_ms;      ///< Hold-off before the same class is reported again
+} temporal_pooling_config_t;
+
+typedef struct {
+    temporal_pooling_config_t config;
+    int64_t timestamps_ms[TEMPORAL_POOLING_MAX_WINDOWS];
+    uint8_t scores[TEMPORAL_POOLING_MAX_WINDOWS][MODEL_NUM_CLASSES]; ///< Scores in 1/255 steps
+    int head;                     ///< Index of the oldest window
+    int count;                    ///< Number of windows held
+    uint32_t sums[MODEL_NUM_CLASSES];          ///< Sum of the held scores
+    uint32_t weighted_sums[MODEL_NUM_CLASSES]; ///< Sum of the held scores times their window weight
+    uint32_t weight_sum;                       ///< Sum of the held window weights
+    int previous_top_class;       ///< Last reported class, -1 before the first detection
+    int64_t previous_top_time_ms; ///< Time of the last reported detection
+} temporal_pooling_t;
+
+typedef struct {
+    int top_class;                ///< Class with the highest pooled score, -1 until the span is covered
+    float score;                  ///< Pooled score of top_class
+    bool is_new_detection;        ///< True when this decision crossed the threshold anew
+    uint32_t windows;             ///< Windows pooled into the decision
+    uint32_t covered_ms;          ///< Time from the oldest to the newest pooled window
+    float pooled_scores[MODEL_NUM_CLASSES];
+} temporal_pooling_decision_t;
+
+/**
+ * @brief Initializes a temporal pooling stage
+ * @param pooling Pooling instance to initialize
+ * @param config Pooling mode, span and detection parameters
+ * @return ESP_OK on success, ESP_ERR_INVALID_ARG on bad parameters
+ *
+ * @note A span longer than TEMPORAL_POOLING_MAX_WINDOWS hops is shortened
+ * to the ring capacity
+ */
+esp_err_t temporal_pooling_init(temporal_pooling_t *pooling, const temporal_pooling_config_t *config);
+
+/**
+ * @brief Adds the latest per-window scores and computes the span decision
+ * @param pooling Pooling instance
+ * @param scores MODEL_NUM_CLASSES scores for the latest window
+ * @param timestamp_ms Capture time of the latest window
+ * @param decision Output decision
+ * @return ESP_OK on success, ESP_ERR_INVALID_ARG if windows arrive out of order
+ *
+ * @note Mean and weighted pooling keep running sums, so their cost per
+ * window does not depend on the span; max pooling scans the ring. No model
+ * inference is involved either way
+ */
+esp_err_t temporal_pooling_process(temporal_pooling_t *pooling, const float *scores,
+                                   int64_t timestamp_ms, temporal_pooling_decision_t *decision);
+
+/**
+ * @brief Returns the name of a pooling mode ("max", "mean" or "weighted")
+ */
+const char *temporal_pooling_mode_name(temporal_pooling_mode_t mode);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TEMPORAL_POOLING_H
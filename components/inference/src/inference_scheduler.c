@@ -0,0 +1,601 @@
+/**
+ * @file inference_scheduler.c
+ * @brief Continuous classification of overlapping audio windows
+ *
+ * This file implements a two stage pipeline:
+ * - Front-end task: slides a MODEL_INPUT_SIZE sample window over the
+ *   microphone stream every CONFIG_INFERENCE_HOP_MS and quantizes it to the model input
+ * - Inference task: classifies the window, smooths the posteriors over time
+ *   (see posterior_smoother.c) and publishes a stable current-state result
+ *
+ * On dual-core parts the two tasks are pinned to different cores so
+ * throughput approaches the cost of the slower stage rather than the sum.
+ * Feature windows are handed over by pointer through a bounded pool of
+ * CONFIG_INFERENCE_PIPELINE_DEPTH buffers; when the pool is exhausted, or the
+ * CPU budget is spent, the front end drops the window instead of queueing.
+ *
+ * With CONFIG_MODEL_CASCADE_ENABLE the front end first runs the stage-one
+ * detector (see cascade_gate.c); rejected windows skip normalization and the
+ * CNN and reach the smoother as background, so silence costs one small FFT.
+ *
+ * Streaming models keep recurrent state from window to window; every window
+ * the model does not see (dropped, skipped, gated or lost to a restarted
+ * capture) leaves a gap in the window ids, and predict_stream() clears the
+ * state before the next one.
+ *
+ * With CONFIG_MODEL_SHADOW_ENABLE every classified window is also offered
+ * to the shadow model (see shadow_evaluator.c), which never changes results.
+ *
+ * With CONFIG_SOUND_ENROLLMENT_ENABLE the embedding of every classified
+ * window is matched against the enrolled custom sounds (see sound_enrollment.c).
+ *
+ * With CONFIG_INFERENCE_POOLING_ENABLE the scores of every window also feed a
+ * 1-5 s ring pooled into a long-span decision (see temporal_pooling.c).
+ */
+
+#include <string.h>
+#include "inference_scheduler.h"
+#include "result_snapshot.h"
+#include "posterior_smoother.h"
+#include "temporal_pooling.h"
+#include "cascade_gate.h"
+#include "shadow_evaluator.h"
+#include "sound_enrollment.h"
+#include "i2s_recorder_main.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+
+static const char *TAG = "inference_scheduler";
+
+// Hop between consecutive windows, clamped so windows always overlap or touch
+#define HOP_SAMPLES_RAW ((SAMPLE_RATE * CONFIG_INFERENCE_HOP_MS) / 1000)
+#define HOP_SAMPLES (HOP_SAMPLES_RAW < 1 ? 1 : (HOP_SAMPLES_RAW > MODEL_INPUT_SIZE ? MODEL_INPUT_SIZE : HOP_SAMPLES_RAW))
+#define PAUSE_ACK_TIMEOUT_MS (CONFIG_INFERENCE_HOP_MS * 2 + 1000)
+#define FRONTEND_TASK_STACK_SIZE 4096
+
+// Core placement of the two pipeline stages
+#if CONFIG_INFERENCE_PIPELINE_DUAL_CORE
+#define FRONTEND_CORE CONFIG_INFERENCE_FRONTEND_CORE
+#define MODEL_CORE CONFIG_INFERENCE_MODEL_CORE
+#else
+#define FRONTEND_CORE tskNO_AFFINITY
+#define MODEL_CORE tskNO_AFFINITY
+#endif
+
+// Exponential moving average with a 1/8 weight for the newest sample
+#define STAGE_AVERAGE(avg, sample) ((avg) == 0 ? (sample) : (avg) - ((avg) >> 3) + ((sample) >> 3))
+
+/**
+ * @brief Model input window handed from the front end to the inference task
+ */
+typedef struct {
+    union {
+        int8_t features[MODEL_INPUT_SIZE]; ///< Window quantized to the model input
+        int16_t samples[MODEL_INPUT_SIZE]; ///< Raw window, for models that take PCM (s_pcm_input)
+    };
+    uint32_t window_id;
+    bool gated_out;                   ///< Rejected by the stage-one detector, features not filled
+    int64_t ready_at_us;              ///< Time the window was queued for inference
+    prediction_result_t result;       ///< Capture and feature timings, filled by the front end
+} feature_window_t;
+
+static TaskHandle_t s_frontend_task = NULL;           ///< Capture and front-end task handle
+static TaskHandle_t s_model_task = NULL;              ///< Inference task handle
+static SemaphoreHandle_t s_pause_ack = NULL;          ///< Given by the front end once capture stopped
+static QueueHandle_t s_free_windows = NULL;           ///< Pool of unused feature windows
+static QueueHandle_t s_ready_windows = NULL;          ///< Windows waiting for inference
+static volatile bool s_paused = false;                ///< Capture suspended by another mic user
+static bool s_pcm_input = false;                      ///< The model normalizes in its graph and takes raw PCM
+static int64_t s_unbilled_us = 0;                     ///< Inference time not yet charged to the budget (guarded by s_unbilled_lock)
+static portMUX_TYPE s_unbilled_lock = portMUX_INITIALIZER_UNLOCKED;
+static StaticSemaphore_t s_state_lock_buffer;
+static SemaphoreHandle_t s_state_lock = NULL;         ///< Mutex, the state is too large to copy with interrupts off
+static inference_state_t s_state;                     ///< Published state (guarded by s_state_lock)
+
+// Pipeline buffers: the sliding window is owned by the front end,
+// feature windows circulate between the two tasks by pointer
+static int16_t window_samples[MODEL_INPUT_SIZE];
+static feature_window_t feature_windows[CONFIG_INFERENCE_PIPELINE_DEPTH];
+
+#if CONFIG_INFERENCE_POOLING_ENABLE
+#if CONFIG_INFERENCE_POOLING_MAX
+#define POOLING_MODE TEMPORAL_POOLING_MAX
+#elif CONFIG_INFERENCE_POOLING_WEIGHTED
+#define POOLING_MODE TEMPORAL_POOLING_WEIGHTED
+#else
+#define POOLING_MODE TEMPORAL_POOLING_MEAN
+#endif
+
+// Owned by the inference task; too large for its stack
+static temporal_pooling_t s_pooling;
+#endif
+
+/**
+ * @brief Parks the front end while paused and acknowledges the pause request
+ */
+static void wait_while_paused(void) {
+    xSemaphoreGive(s_pause_ack);
+    while (s_paused) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    }
+}
+
+/**
+ * @brief Advances the sliding window by one hop
+ * @param window_filled Whether the window already holds a full set of samples
+ * @return ESP_OK when the window holds MODEL_INPUT_SIZE fresh samples
+ */
+static esp_err_t advance_window(bool window_filled) {
+    if (!window_filled) {
+        return collect_audio_frames(window_samples, MODEL_INPUT_SIZE);
+    }
+
+    memmove(window_samples, window_samples + HOP_SAMPLES,
+            (MODEL_INPUT_SIZE - HOP_SAMPLES) * sizeof(int16_t));
+    return collect_audio_frames(window_samples + MODEL_INPUT_SIZE - HOP_SAMPLES, HOP_SAMPLES);
+}
+
+/**
+ * @brief Counts a window that was not classified
+ * @param dropped true when the pipeline was full, false when the CPU budget was spent
+ */
+static void count_unclassified_window(bool dropped) {
+    xSemaphoreTake(s_state_lock, portMAX_DELAY);
+    if (dropped) {
+        s_state.windows_dropped++;
+    } else {
+        s_state.windows_skipped++;
+    }
+    xSemaphoreGive(s_state_lock);
+}
+
+/**
+ * @brief Front-end task body
+ *
+ * Workflow per hop:
+ * 1. Reads HOP_SAMPLES new samples (blocks for one hop)
+ * 2. With the cascade enabled, hands rejected windows on as background
+ * 3. Refills the CPU budget credit and charges the inferences finished since
+ *    the last hop, skips the window if the credit is exhausted
+ * 4. Takes a free feature window, drops the hop if none is available
+ * 5. Normalizes and quantizes the sliding window into it and queues it for inference
+ */
+static void frontend_task(void *arg) {
+    // Token bucket: every hop earns budget_us of CPU time, each inference spends
+    // its measured duration once the model task reports it after Invoke()
+    const int64_t hop_us = (int64_t)HOP_SAMPLES * 1000000 / SAMPLE_RATE;
+    const int64_t budget_us = hop_us * CONFIG_INFERENCE_CPU_BUDGET_PERCENT / 100;
+    int64_t credit_us = budget_us;
+
+    bool window_filled = false;
+    uint32_t window_id = 0;
+
+    ESP_LOGI(TAG, "Classifying every %d samples (%lld us), CPU budget %d%%",
+             HOP_SAMPLES, hop_us, CONFIG_INFERENCE_CPU_BUDGET_PERCENT);
+
+    while (true) {
+        if (s_paused) {
+            wait_while_paused();
+            window_filled = false;
+            continue;
+        }
+
+        if (!window_filled && window_id != 0) {
+            // A restarted capture does not continue the previous window;
+            // leaving an id out makes streaming models start from a clear state
+            window_id++;
+        }
+
+        const int64_t capture_start_us = esp_timer_get_time();
+        if (advance_window(window_filled) != ESP_OK) {
+            window_filled = false;
+            vTaskDelay(pdMS_TO_TICKS(100));
+            continue;
+        }
+        window_filled = true;
+        window_id++;
+        const int64_t captured_at_us = esp_timer_get_time();
+
+#if CONFIG_MODEL_CASCADE_ENABLE
+        if (!cascade_stage1(window_samples, MODEL_INPUT_SIZE, NULL)) {
+            feature_window_t *window = NULL;
+            if (xQueueReceive(s_free_windows, &window, 0) != pdTRUE) {
+                count_unclassified_window(true);
+                continue;
+            }
+            memset(&window->result, 0, sizeof(window->result));
+            window->window_id = window_id;
+            window->gated_out = true;
+            window->result.gated = true;
+            window->result.capture_timestamp_us = captured_at_us;
+            window->result.capture_us = (uint32_t)(captured_at_us - capture_start_us);
+            window->ready_at_us = esp_timer_get_time();
+            xQueueSend(s_ready_windows, &window, portMAX_DELAY);
+            continue;
+        }
+#endif
+
+        portENTER_CRITICAL(&s_unbilled_lock);
+        credit_us += budget_us - s_unbilled_us;
+        s_unbilled_us = 0;
+        portEXIT_CRITICAL(&s_unbilled_lock);
+        if (credit_us > hop_us) {
+            credit_us = hop_us;
+        }
+        if (credit_us <= 0) {
+            count_unclassified_window(false);
+            continue;
+        }
+
+        feature_window_t *window = NULL;
+        if (xQueueReceive(s_free_windows, &window, 0) != pdTRUE) {
+            count_unclassified_window(true);
+            continue;
+        }
+
+        memset(&window->result, 0, sizeof(window->result));
+        window->window_id = window_id;
+        window->gated_out = false;
+        window->result.capture_timestamp_us = captured_at_us;
+        window->result.capture_us = (uint32_t)(captured_at_us - capture_start_us);
+
+        const int64_t features_start_us = esp_timer_get_time();
+        if (s_pcm_input) {
+            memcpy(window->samples, window_samples, sizeof(window->samples));
+        } else {
+            const esp_err_t quantize_ret = quantize_audio_window(window_samples, window->features, MODEL_INPUT_SIZE);
+            if (quantize_ret != ESP_OK) {
+                ESP_LOGE(TAG, "Window %lu not quantized: %s", window_id, esp_err_to_name(quantize_ret));
+                xQueueSend(s_free_windows, &window, 0);
+                continue;
+            }
+        }
+        window->ready_at_us = esp_timer_get_time();
+        window->result.features_us = (uint32_t)(window->ready_at_us - features_start_us);
+
+        xQueueSend(s_ready_windows, &window, portMAX_DELAY);
+    }
+}
+
+/**
+ * @brief Pools the scores of one window into the long-span decision
+ * @param scores MODEL_NUM_CLASSES scores of the window
+ * @param captured_at_ms Capture time of the window
+ *
+ * @note Called by the inference task for every classified or gated window
+ */
+static void pool_window(const float *scores, int64_t captured_at_ms) {
+#if CONFIG_INFERENCE_POOLING_ENABLE
+    temporal_pooling_decision_t decision;
+    if (temporal_pooling_process(&s_pooling, scores, captured_at_ms, &decision) != ESP_OK) {
+        return;
+    }
+
+    if (decision.is_new_detection) {
+        ESP_LOGI(TAG, "Detected %s over %lu ms (%s %.2f)", model_class_name(decision.top_class),
+                 decision.covered_ms, temporal_pooling_mode_name(POOLING_MODE), decision.score);
+    }
+
+    xSemaphoreTake(s_state_lock, portMAX_DELAY);
+    s_state.pooled = decision;
+    if (decision.is_new_detection) {
+        s_state.last_pooled_detection_class = decision.top_class;
+        s_state.last_pooled_detection_ms = captured_at_ms;
+    }
+    xSemaphoreGive(s_state_lock);
+#endif
+}
+
+/**
+ * @brief Feeds a window rejected by the stage-one detector to the smoother
+ * @param smoother Posterior smoother owned by the inference task
+ * @param window Gated-out window (returned to the pool here)
+ *
+ * The background class gets the full posterior so averages decay during
+ * silence exactly as if the classifier had seen it.
+ */
+static void process_gated_window(posterior_smoother_t *smoother, feature_window_t *window) {
+    const int64_t captured_at_ms = window->result.capture_timestamp_us / 1000;
+    const uint32_t window_id = window->window_id;
+    prediction_result_t result = window->result;
+    xQueueSend(s_free_windows, &window, portMAX_DELAY);
+
+    float scores[MODEL_NUM_CLASSES] = { 0 };
+    scores[MODEL_BACKGROUND_CLASS] = 1.0f;
+
+    // Keeps the snapshot fresh through silence, as a confident background
+    // result that result.gated tells apart from a real inference
+    memcpy(result.scores, scores, sizeof(result.scores));
+    memset(result.raw_scores, INT8_MIN, sizeof(result.raw_scores));
+    result.raw_scores[MODEL_BACKGROUND_CLASS] = INT8_MAX;
+    result.top_class = MODEL_BACKGROUND_CLASS;
+    result.top_k[0] = MODEL_BACKGROUND_CLASS;
+    for (int k = 1, c = 0; k < MODEL_TOP_K; k++, c++) {
+        if (c == MODEL_BACKGROUND_CLASS) {
+            c++;
+        }
+        result.top_k[k] = c;
+    }
+    result_snapshot_publish(&result, window_id);
+    pool_window(scores, captured_at_ms);
+    posterior_decision_t decision;
+    if (posterior_smoother_process(smoother, scores, captured_at_ms, &decision) != ESP_OK) {
+        return;
+    }
+
+    xSemaphoreTake(s_state_lock, portMAX_DELAY);
+    s_state.window_id = window_id;
+    s_state.updated_at_ms = captured_at_ms;
+    s_state.top_class = decision.top_class;
+    s_state.score = decision.score;
+    memcpy(s_state.average_scores, decision.average_scores, sizeof(s_state.average_scores));
+    s_state.windows_gated++;
+    xSemaphoreGive(s_state_lock);
+}
+
+/**
+ * @brief Inference task body
+ *
+ * Workflow per feature window:
+ * 1. Waits for a window from the front end
+ * 2. Classifies it and returns the buffer to the pool
+ * 3. Smooths the posteriors and publishes the state
+ */
+static void model_task(void *arg) {
+    posterior_smoother_t smoother;
+    const posterior_smoother_config_t smoother_config = {
+        .average_window_ms = CONFIG_INFERENCE_AVERAGE_WINDOW_MS,
+        .detection_threshold = CONFIG_INFERENCE_DETECTION_THRESHOLD / 100.0f,
+        .suppression_ms = CONFIG_INFERENCE_SUPPRESSION_MS,
+        .minimum_count = CONFIG_INFERENCE_MINIMUM_COUNT,
+    };
+    ESP_ERROR_CHECK(posterior_smoother_init(&smoother, &smoother_config));
+
+#if CONFIG_INFERENCE_POOLING_ENABLE
+    const uint32_t hop_ms = (uint32_t)HOP_SAMPLES * 1000 / SAMPLE_RATE;
+    const temporal_pooling_config_t pooling_config = {
+        .mode = POOLING_MODE,
+        .span_ms = CONFIG_INFERENCE_POOLING_SPAN_MS,
+        .hop_ms = hop_ms > 0 ? hop_ms : 1,
+        .detection_threshold = CONFIG_INFERENCE_POOLING_THRESHOLD / 100.0f,
+        .suppression_ms = CONFIG_INFERENCE_SUPPRESSION_MS,
+    };
+    ESP_ERROR_CHECK(temporal_pooling_init(&s_pooling, &pooling_config));
+#endif
+
+    model_stream_t stream;
+    model_stream_init(&stream);
+    bool head_detected[MODEL_MAX_HEADS] = { false };
+
+    posterior_decision_t decision;
+    feature_window_t *window = NULL;
+#if CONFIG_SOUND_ENROLLMENT_ENABLE
+    float embedding[MODEL_EMBEDDING_MAX_SIZE];
+    float *window_embedding = sound_enrollment_is_running() ? embedding : NULL;
+#else
+    float *window_embedding = NULL;
+#endif
+
+    while (true) {
+        xQueueReceive(s_ready_windows, &window, portMAX_DELAY);
+
+        if (window->gated_out) {
+            process_gated_window(&smoother, window);
+            continue;
+        }
+
+        const int64_t start_us = esp_timer_get_time();
+        const uint32_t handoff_us = (uint32_t)(start_us - window->ready_at_us);
+        prediction_result_t result = window->result;
+        const uint32_t window_id = window->window_id;
+#if CONFIG_MODEL_CASCADE_ENABLE
+        int predicted_class = cascade_stage2(&stream, window_id, window->features,
+                                             s_pcm_input ? window->samples : NULL, &result, window_embedding);
+#else
+        int predicted_class = s_pcm_input ?
+                              predict_pcm(&stream, window_id, window->samples, &result, window_embedding) :
+                              predict_stream_embedding(&stream, window_id, window->features, &result,
+                                                       window_embedding);
+#endif
+        const int64_t end_us = esp_timer_get_time();
+        portENTER_CRITICAL(&s_unbilled_lock);
+        s_unbilled_us += end_us - start_us;
+        portEXIT_CRITICAL(&s_unbilled_lock);
+
+        // Copied into the shadow slot only if the shadow is idle; the shadow
+        // slot needs int8 windows, so PCM models run without it
+        if (!s_pcm_input) {
+            shadow_evaluator_offer(window->features, &result);
+        }
+
+        // The features are no longer needed once Invoke() returned
+        xQueueSend(s_free_windows, &window, portMAX_DELAY);
+
+        if (predicted_class < 0) {
+            ESP_LOGE(TAG, "Inference failed on window %lu", window_id);
+            continue;
+        }
+        result_snapshot_publish(&result, window_id);
+        if (window_embedding != NULL) {
+            sound_enrollment_process(window_id, window_embedding);
+        }
+
+        const int64_t captured_at_ms = result.capture_timestamp_us / 1000;
+        pool_window(result.scores, captured_at_ms);
+        if (posterior_smoother_process(&smoother, result.scores, captured_at_ms, &decision) != ESP_OK) {
+            continue;
+        }
+
+        if (decision.is_new_detection) {
+            ESP_LOGI(TAG, "Detected %s (%.2f)", model_class_name(decision.top_class), decision.score);
+        }
+        // Heads come from the same Invoke(); log when one starts detecting
+        for (int h = 0; h < MODEL_MAX_HEADS; h++) {
+            if (result.heads[h].detected && !head_detected[h]) {
+                ESP_LOGI(TAG, "Head %s detected (%.2f)", model_head_name(h), result.heads[h].score);
+            }
+            head_detected[h] = result.heads[h].detected;
+        }
+
+        const uint32_t inference_us = (uint32_t)(end_us - start_us);
+        const uint32_t end_to_end_us = (uint32_t)(end_us - result.capture_timestamp_us);
+
+        xSemaphoreTake(s_state_lock, portMAX_DELAY);
+        s_state.window_id = window_id;
+        s_state.updated_at_ms = captured_at_ms;
+        s_state.top_class = decision.top_class;
+        s_state.score = decision.score;
+        memcpy(s_state.average_scores, decision.average_scores, sizeof(s_state.average_scores));
+        if (decision.is_new_detection) {
+            s_state.last_detection_class = decision.top_class;
+            s_state.last_detection_ms = captured_at_ms;
+        }
+        s_state.windows_classified++;
+        s_state.state_resets = stream.resets;
+        s_state.stage_avg_us.capture = STAGE_AVERAGE(s_state.stage_avg_us.capture, result.capture_us);
+        s_state.stage_avg_us.features = STAGE_AVERAGE(s_state.stage_avg_us.features, result.features_us);
+        s_state.stage_avg_us.handoff = STAGE_AVERAGE(s_state.stage_avg_us.handoff, handoff_us);
+        s_state.stage_avg_us.inference = STAGE_AVERAGE(s_state.stage_avg_us.inference, inference_us);
+        s_state.stage_avg_us.end_to_end = STAGE_AVERAGE(s_state.stage_avg_us.end_to_end, end_to_end_us);
+        xSemaphoreGive(s_state_lock);
+    }
+}
+
+/**
+ * @brief Deletes whatever inference_scheduler_start() created before it failed
+ *
+ * @note Leaves the scheduler as if it never started, so the start can be retried
+ */
+static void scheduler_teardown(void) {
+    if (s_frontend_task != NULL) {
+        vTaskDelete(s_frontend_task);
+        s_frontend_task = NULL;
+    }
+    if (s_model_task != NULL) {
+        vTaskDelete(s_model_task);
+        s_model_task = NULL;
+    }
+    if (s_ready_windows != NULL) {
+        vQueueDelete(s_ready_windows);
+        s_ready_windows = NULL;
+    }
+    if (s_free_windows != NULL) {
+        vQueueDelete(s_free_windows);
+        s_free_windows = NULL;
+    }
+    if (s_pause_ack != NULL) {
+        vSemaphoreDelete(s_pause_ack);
+        s_pause_ack = NULL;
+    }
+    s_paused = false;
+    s_unbilled_us = 0;
+}
+
+esp_err_t inference_scheduler_start(void) {
+    if (s_frontend_task != NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    result_snapshot_init();
+    if (s_state_lock == NULL) {
+        // Static, so it survives a teardown and cannot fail
+        s_state_lock = xSemaphoreCreateMutexStatic(&s_state_lock_buffer);
+    }
+    s_pause_ack = xSemaphoreCreateBinary();
+    s_free_windows = xQueueCreate(CONFIG_INFERENCE_PIPELINE_DEPTH, sizeof(feature_window_t *));
+    s_ready_windows = xQueueCreate(CONFIG_INFERENCE_PIPELINE_DEPTH, sizeof(feature_window_t *));
+    if (s_pause_ack == NULL || s_free_windows == NULL || s_ready_windows == NULL) {
+        ESP_LOGE(TAG, "Failed to create pipeline queues");
+        scheduler_teardown();
+        return ESP_ERR_NO_MEM;
+    }
+
+    for (int i = 0; i < CONFIG_INFERENCE_PIPELINE_DEPTH; i++) {
+        feature_window_t *window = &feature_windows[i];
+        xQueueSend(s_free_windows, &window, 0);
+    }
+
+    memset(&s_state, 0, sizeof(s_state));
+    s_state.top_class = -1;
+    s_state.last_detection_class = -1;
+    s_state.pooled.top_class = -1;
+    s_state.last_pooled_detection_class = -1;
+
+    // Loads the model; decides what the front end writes into the windows
+    s_pcm_input = model_takes_pcm();
+
+#if CONFIG_SOUND_ENROLLMENT_ENABLE
+    // Before the model task starts, which decides once whether to fetch embeddings
+    if (sound_enrollment_start() != ESP_OK) {
+        ESP_LOGW(TAG, "Custom sound matching not started");
+    }
+#endif
+
+    if (xTaskCreatePinnedToCore(model_task, "inference_model", CONFIG_INFERENCE_TASK_STACK_SIZE,
+                                NULL, CONFIG_INFERENCE_TASK_PRIORITY, &s_model_task, MODEL_CORE) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create inference task");
+        scheduler_teardown();
+        return ESP_ERR_NO_MEM;
+    }
+
+#if CONFIG_MODEL_SHADOW_ENABLE
+    // The candidate model is evaluation only, continuous inference runs without it
+    if (shadow_evaluator_start() != ESP_OK) {
+        ESP_LOGW(TAG, "Shadow model evaluation not started");
+    }
+#endif
+
+    // Capture runs one priority above inference so the I2S DMA never overflows
+    if (xTaskCreatePinnedToCore(frontend_task, "inference_frontend", FRONTEND_TASK_STACK_SIZE,
+                                NULL, CONFIG_INFERENCE_TASK_PRIORITY + 1, &s_frontend_task, FRONTEND_CORE) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create front-end task");
+        scheduler_teardown();
+        return ESP_ERR_NO_MEM;
+    }
+
+    ESP_LOGI(TAG, "Continuous inference started (front end on core %d, model on core %d)",
+             FRONTEND_CORE, MODEL_CORE);
+    return ESP_OK;
+}
+
+bool inference_scheduler_is_running(void) {
+    return s_frontend_task != NULL;
+}
+
+esp_err_t inference_scheduler_get_state(inference_state_t *state) {
+    if (state == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (s_frontend_task == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    xSemaphoreTake(s_state_lock, portMAX_DELAY);
+    *state = s_state;
+    xSemaphoreGive(s_state_lock);
+    return ESP_OK;
+}
+
+void inference_scheduler_pause(void) {
+    if (s_frontend_task == NULL || s_paused) {
+        return;
+    }
+
+    s_paused = true;
+    if (xSemaphoreTake(s_pause_ack, pdMS_TO_TICKS(PAUSE_ACK_TIMEOUT_MS)) != pdTRUE) {
+        ESP_LOGW(TAG, "Front-end task did not acknowledge pause");
+    }
+}
+
+void inference_scheduler_resume(void) {
+    if (s_frontend_task == NULL || !s_paused) {
+        return;
+    }
+
+    s_paused = false;
+    xTaskNotifyGive(s_frontend_task);
+}
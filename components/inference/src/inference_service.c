@@ -0,0 +1,268 @@
+/**
+ * @file inference_service.c
+ * @brief Single-owner on-demand inference with request coalescing
+ *
+ * One task owns the capture and feature buffers and is the only on-demand
+ * user of the interpreter. Callers register in a fixed table of waiter
+ * slots, each with its own binary semaphore, and wait for a window id:
+ * - while a window is being captured, new callers wait for that window
+ * - otherwise they wait for the next one, and the task is woken to capture it
+ * When a window is classified, every caller waiting for it (or an older one)
+ * is released with the same result.
+ */
+
+#include <stdbool.h>
+#include <string.h>
+#include "inference_service.h"
+#include "result_snapshot.h"
+#include "i2s_recorder_main.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+
+static const char *TAG = "inference_service";
+
+#define SERVICE_TASK_STACK_SIZE 4096
+#define MAX_WAITERS CONFIG_INFERENCE_SERVICE_MAX_WAITERS
+#define PAUSE_TIMEOUT_MS 3000         ///< Longest wait for an in-flight capture to finish
+
+/**
+ * @brief One caller blocked in inference_service_predict()
+ */
+typedef struct {
+    bool in_use;
+    uint32_t window_id;               ///< Window the caller waits for
+    SemaphoreHandle_t done;           ///< Given when a window >= window_id is classified
+} waiter_t;
+
+static TaskHandle_t s_task = NULL;
+static portMUX_TYPE s_lock = portMUX_INITIALIZER_UNLOCKED;
+static waiter_t s_waiters[MAX_WAITERS];       ///< Guarded by s_lock
+static uint32_t s_started_id = 0;             ///< Latest window whose capture started (guarded by s_lock)
+static uint32_t s_completed_id = 0;           ///< Latest classified window (guarded by s_lock)
+static uint32_t s_capturing_id = 0;           ///< Window being captured, 0 when idle (guarded by s_lock)
+static prediction_result_t s_latest;          ///< Result of s_completed_id (guarded by s_lock)
+static bool s_latest_ok = false;              ///< Whether s_latest is a valid prediction
+static inference_service_stats_t s_stats;     ///< Guarded by s_lock
+static SemaphoreHandle_t s_mic_free = NULL;   ///< Taken for every capture, and held between pause and resume
+static bool s_paused = false;                 ///< Whether inference_service_pause() holds s_mic_free
+
+// Only touched by the service task
+static int16_t s_samples[MODEL_INPUT_SIZE];
+
+/**
+ * @brief Tells whether a registered caller waits for a window not yet classified
+ * @note Caller holds s_lock
+ */
+static bool has_pending_waiters_locked(void) {
+    for (int i = 0; i < MAX_WAITERS; i++) {
+        if (s_waiters[i].in_use && (int32_t)(s_waiters[i].window_id - s_completed_id) > 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Captures and classifies one window
+ * @param result Output result with every stage latency
+ * @return Predicted class, or -1 on failure
+ */
+static int classify_window(prediction_result_t *result) {
+    memset(result, 0, sizeof(*result));
+
+    // Blocks while a recording owns the microphone
+    xSemaphoreTake(s_mic_free, portMAX_DELAY);
+    const int64_t stage_start_us = esp_timer_get_time();
+    const esp_err_t capture_ret = collect_audio_frames(s_samples, MODEL_INPUT_SIZE);
+    xSemaphoreGive(s_mic_free);
+    result->capture_timestamp_us = esp_timer_get_time();
+    result->capture_us = (uint32_t)(result->capture_timestamp_us - stage_start_us);
+
+    // Callers arriving from now on need audio newer than this window
+    portENTER_CRITICAL(&s_lock);
+    s_capturing_id = 0;
+    portEXIT_CRITICAL(&s_lock);
+
+    // A window with missing samples fails the requests waiting for it
+    if (capture_ret != ESP_OK) {
+        ESP_LOGE(TAG, "Audio capture failed: %s", esp_err_to_name(capture_ret));
+        return -1;
+    }
+
+    // The capture buffer goes straight into the input tensor: its
+    // normalization is reported as quantize_us, features_us stays 0
+    return predict_pcm(NULL, 0, s_samples, result, NULL);
+}
+
+/**
+ * @brief Service task body
+ *
+ * Sleeps until a caller registers, then classifies windows until nobody
+ * waits for a newer one.
+ */
+static void service_task(void *arg) {
+    bool mic_initialized = false;
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        if (!mic_initialized) {
+            xSemaphoreTake(s_mic_free, portMAX_DELAY);
+            init_microphone();
+            mic_initialized = true;
+
+            // Warm-up read to stabilize the microphone
+            collect_audio_frames(s_samples, MODEL_INPUT_SIZE);
+            xSemaphoreGive(s_mic_free);
+        }
+
+        for (;;) {
+            portENTER_CRITICAL(&s_lock);
+            if (!has_pending_waiters_locked()) {
+                portEXIT_CRITICAL(&s_lock);
+                break;
+            }
+            const uint32_t window_id = ++s_started_id;
+            s_capturing_id = window_id;
+            s_stats.captures++;
+            portEXIT_CRITICAL(&s_lock);
+
+            prediction_result_t result;
+            const int predicted_class = classify_window(&result);
+            if (predicted_class < 0) {
+                ESP_LOGE(TAG, "Inference failed for window %lu", window_id);
+            } else {
+                result_snapshot_publish(&result, window_id);
+            }
+
+            // Semaphores are given outside the critical section
+            SemaphoreHandle_t ready[MAX_WAITERS];
+            int ready_count = 0;
+            portENTER_CRITICAL(&s_lock);
+            s_latest = result;
+            s_latest_ok = predicted_class >= 0;
+            s_completed_id = window_id;
+            for (int i = 0; i < MAX_WAITERS; i++) {
+                if (s_waiters[i].in_use && (int32_t)(s_waiters[i].window_id - window_id) <= 0) {
+                    ready[ready_count++] = s_waiters[i].done;
+                }
+            }
+            portEXIT_CRITICAL(&s_lock);
+
+            for (int i = 0; i < ready_count; i++) {
+                xSemaphoreGive(ready[i]);
+            }
+        }
+    }
+}
+
+esp_err_t inference_service_start(void) {
+    if (s_task != NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    result_snapshot_init();
+    s_mic_free = xSemaphoreCreateBinary();
+    if (s_mic_free == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    xSemaphoreGive(s_mic_free);
+    for (int i = 0; i < MAX_WAITERS; i++) {
+        s_waiters[i].done = xSemaphoreCreateBinary();
+        if (s_waiters[i].done == NULL) {
+            return ESP_ERR_NO_MEM;
+        }
+    }
+
+    if (xTaskCreate(service_task, "inference_service", SERVICE_TASK_STACK_SIZE, NULL,
+                    CONFIG_INFERENCE_TASK_PRIORITY, &s_task) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create the service task");
+        return ESP_FAIL;
+    }
+    return ESP_OK;
+}
+
+esp_err_t inference_service_predict(prediction_result_t *result, uint32_t *window_id, uint32_t timeout_ms) {
+    if (s_task == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    waiter_t *waiter = NULL;
+    portENTER_CRITICAL(&s_lock);
+    s_stats.requests++;
+    for (int i = 0; i < MAX_WAITERS && waiter == NULL; i++) {
+        if (!s_waiters[i].in_use) {
+            waiter = &s_waiters[i];
+        }
+    }
+    if (waiter != NULL) {
+        waiter->in_use = true;
+        waiter->window_id = s_capturing_id != 0 ? s_capturing_id : s_started_id + 1;
+    }
+    portEXIT_CRITICAL(&s_lock);
+
+    if (waiter == NULL) {
+        ESP_LOGW(TAG, "More than %d callers waiting", MAX_WAITERS);
+        return ESP_ERR_NO_MEM;
+    }
+    xTaskNotifyGive(s_task);
+
+    // A give left over from a previous user of the slot only causes one extra check
+    const int64_t deadline_us = esp_timer_get_time() + timeout_ms * 1000LL;
+    bool ready = false;
+    for (;;) {
+        portENTER_CRITICAL(&s_lock);
+        ready = (int32_t)(s_completed_id - waiter->window_id) >= 0;
+        portEXIT_CRITICAL(&s_lock);
+
+        const int64_t remaining_us = deadline_us - esp_timer_get_time();
+        if (ready || remaining_us <= 0) {
+            break;
+        }
+        xSemaphoreTake(waiter->done, pdMS_TO_TICKS(remaining_us / 1000) + 1);
+    }
+
+    esp_err_t ret = ESP_ERR_TIMEOUT;
+    portENTER_CRITICAL(&s_lock);
+    if (ready) {
+        *result = s_latest;
+        if (window_id != NULL) {
+            *window_id = s_completed_id;
+        }
+        ret = s_latest_ok ? ESP_OK : ESP_FAIL;
+    } else {
+        s_stats.timeouts++;
+    }
+    waiter->in_use = false;
+    portEXIT_CRITICAL(&s_lock);
+    return ret;
+}
+
+void inference_service_pause(void) {
+    if (s_task == NULL || s_paused) {
+        return;
+    }
+
+    // A binary semaphore rather than a mutex: resume comes from another task
+    if (xSemaphoreTake(s_mic_free, pdMS_TO_TICKS(PAUSE_TIMEOUT_MS)) != pdTRUE) {
+        ESP_LOGW(TAG, "Capture did not finish before the pause");
+        return;
+    }
+    s_paused = true;
+}
+
+void inference_service_resume(void) {
+    if (!s_paused) {
+        return;
+    }
+    s_paused = false;
+    xSemaphoreGive(s_mic_free);
+}
+
+void inference_service_get_stats(inference_service_stats_t *stats) {
+    portENTER_CRITICAL(&s_lock);
+    *stats = s_stats;
+    portEXIT_CRITICAL(&s_lock);
+}
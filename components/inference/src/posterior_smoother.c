@@ -0,0 +1,102 @@
+/**
+ * @file posterior_smoother.c
+ * @brief Time averaging of classifier posteriors
+ *
+ * Single windows are noisy, so the streaming scheduler averages the scores of
+ * every window inside a sliding time span and only reports a detection when:
+ * - The averaged top score is above the detection threshold
+ * - Either the class changed or the suppression time has elapsed
+ */
+
+#include <string.h>
+#include "posterior_smoother.h"
+#include "esp_log.h"
+
+static const char *TAG = "posterior_smoother";
+
+esp_err_t posterior_smoother_init(posterior_smoother_t *smoother, const posterior_smoother_config_t *config) {
+    if (smoother == NULL || config == NULL || config->minimum_count == 0 ||
+        config->minimum_count > POSTERIOR_SMOOTHER_MAX_RESULTS) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    memset(smoother, 0, sizeof(*smoother));
+    smoother->config = *config;
+    smoother->previous_top_class = -1;
+    smoother->previous_top_time_ms = INT64_MIN;
+    return ESP_OK;
+}
+
+esp_err_t posterior_smoother_process(posterior_smoother_t *smoother, const float *scores,
+                                     int64_t timestamp_ms, posterior_decision_t *decision) {
+    if (smoother == NULL || scores == NULL || decision == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    // Results must arrive in capture order
+    if (smoother->count > 0) {
+        int newest = (smoother->head + smoother->count - 1) % POSTERIOR_SMOOTHER_MAX_RESULTS;
+        if (timestamp_ms < smoother->results[newest].timestamp_ms) {
+            ESP_LOGE(TAG, "Results must be fed in increasing time order");
+            return ESP_ERR_INVALID_ARG;
+        }
+    }
+
+    // Append the latest result, overwriting the oldest one when full
+    if (smoother->count == POSTERIOR_SMOOTHER_MAX_RESULTS) {
+        smoother->head = (smoother->head + 1) % POSTERIOR_SMOOTHER_MAX_RESULTS;
+        smoother->count--;
+    }
+    posterior_result_t *latest = &smoother->results[(smoother->head + smoother->count) % POSTERIOR_SMOOTHER_MAX_RESULTS];
+    latest->timestamp_ms = timestamp_ms;
+    memcpy(latest->scores, scores, sizeof(latest->scores));
+    smoother->count++;
+
+    // Drop results that fell out of the averaging window
+    const int64_t window_start_ms = timestamp_ms - smoother->config.average_window_ms;
+    while (smoother->count > 1 && smoother->results[smoother->head].timestamp_ms < window_start_ms) {
+        smoother->head = (smoother->head + 1) % POSTERIOR_SMOOTHER_MAX_RESULTS;
+        smoother->count--;
+    }
+
+    // Not enough history yet to make a reliable decision
+    decision->is_new_detection = false;
+    if ((uint32_t)smoother->count < smoother->config.minimum_count) {
+        decision->top_class = smoother->previous_top_class;
+        decision->score = 0.0f;
+        memset(decision->average_scores, 0, sizeof(decision->average_scores));
+        return ESP_OK;
+    }
+
+    // Average every class over the window
+    memset(decision->average_scores, 0, sizeof(decision->average_scores));
+    for (int i = 0; i < smoother->count; i++) {
+        const posterior_result_t *result = &smoother->results[(smoother->head + i) % POSTERIOR_SMOOTHER_MAX_RESULTS];
+        for (int c = 0; c < MODEL_NUM_CLASSES; c++) {
+            decision->average_scores[c] += result->scores[c];
+        }
+    }
+
+    int top_class = 0;
+    for (int c = 0; c < MODEL_NUM_CLASSES; c++) {
+        decision->average_scores[c] /= smoother->count;
+        if (decision->average_scores[c] > decision->average_scores[top_class]) {
+            top_class = c;
+        }
+    }
+
+    // Report a new detection only when it is confident and not suppressed
+    const float top_score = decision->average_scores[top_class];
+    const bool suppressed = (top_class == smoother->previous_top_class) &&
+        (timestamp_ms - smoother->previous_top_time_ms <= (int64_t)smoother->config.suppression_ms);
+
+    if (top_score > smoother->config.detection_threshold && !suppressed) {
+        smoother->previous_top_class = top_class;
+        smoother->previous_top_time_ms = timestamp_ms;
+        decision->is_new_detection = true;
+    }
+
+    decision->top_class = top_class;
+    decision->score = top_score;
+    return ESP_OK;
+}
@@ -0,0 +1,373 @@
+/**
+ * @file reclassify_job.c
+ * @brief Background reclassification of recordings stored on the SD card
+ *
+ * The job walks every category directory, streams each WAV file through the
+ * same front end as the live pipeline (min-max normalization straight into int8
+ * MODEL_INPUT_SIZE sample windows) and classifies the windows in batches
+ * with predict_batch(). Files are read through a large stdio buffer so the
+ * SD card sees few, long transfers instead of one access per window.
+ */
+
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include "reclassify_job.h"
+#include "model_predictor.h"
+#include "model_memory.h"
+#include "i2s_recorder_main.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+static const char *TAG = "reclassify_job";
+
+#define BATCH_WINDOWS CONFIG_RECLASSIFY_BATCH_WINDOWS
+#define READ_BUFFER_SIZE CONFIG_RECLASSIFY_READ_BUFFER_SIZE
+#define RECLASSIFY_TASK_STACK_SIZE 6144
+#define MAX_PATH_LENGTH 256
+
+/**
+ * @brief Buffers owned by one run, released when it finishes
+ */
+typedef struct {
+    char *read_buffer;                ///< stdio buffer of the WAV being read (audio history memory)
+    int16_t *samples;                 ///< BATCH_WINDOWS raw windows (audio history memory)
+    int8_t *features;                 ///< BATCH_WINDOWS quantized windows
+    prediction_result_t results[BATCH_WINDOWS];
+} reclassify_buffers_t;
+
+static TaskHandle_t s_task = NULL;
+static portMUX_TYPE s_status_lock = portMUX_INITIALIZER_UNLOCKED;
+static reclassify_status_t s_status;
+
+/**
+ * @brief Locates the PCM data of a WAV file
+ * @param f File positioned at the start
+ * @param sample_rate Output sample rate
+ * @param data_bytes Output size of the data chunk
+ * @return ESP_OK when f is positioned at 16-bit mono PCM data
+ */
+static esp_err_t read_wav_header(FILE *f, uint32_t *sample_rate, uint32_t *data_bytes) {
+    uint8_t riff[12];
+    if (fread(riff, sizeof(riff), 1, f) != 1 ||
+        memcmp(riff, "RIFF", 4) != 0 || memcmp(riff + 8, "WAVE", 4) != 0) {
+        return ESP_ERR_INVALID_RESPONSE;
+    }
+
+    bool format_ok = false;
+    uint8_t chunk[8];
+    while (fread(chunk, sizeof(chunk), 1, f) == 1) {
+        uint32_t chunk_size = chunk[4] | (chunk[5] << 8) | (chunk[6] << 16) | ((uint32_t)chunk[7] << 24);
+
+        if (memcmp(chunk, "fmt ", 4) == 0 && chunk_size >= 16) {
+            uint8_t fmt[16];
+            if (fread(fmt, sizeof(fmt), 1, f) != 1) {
+                return ESP_ERR_INVALID_SIZE;
+            }
+            uint16_t audio_format = fmt[0] | (fmt[1] << 8);
+            uint16_t channels = fmt[2] | (fmt[3] << 8);
+            uint16_t bits_per_sample = fmt[14] | (fmt[15] << 8);
+            *sample_rate = fmt[4] | (fmt[5] << 8) | (fmt[6] << 16) | ((uint32_t)fmt[7] << 24);
+            format_ok = audio_format == 1 && channels == 1 && bits_per_sample == 16;
+            chunk_size -= sizeof(fmt);
+        } else if (memcmp(chunk, "data", 4) == 0) {
+            *data_bytes = chunk_size;
+            return format_ok ? ESP_OK : ESP_ERR_NOT_SUPPORTED;
+        }
+
+        // Chunks are word aligned
+        if (fseek(f, chunk_size + (chunk_size & 1), SEEK_CUR) != 0) {
+            break;
+        }
+    }
+    return ESP_ERR_NOT_FOUND;
+}
+
+/**
+ * @brief Writes the result lines of one classified batch
+ * @param out Result file
+ * @param results Results of the batch
+ * @param count Number of windows in the batch
+ * @param first_window Index of the first window in the recording
+ * @param sample_rate Sample rate of the recording
+ */
+static void write_results(FILE *out, const prediction_result_t *results, int count,
+                          uint32_t first_window, uint32_t sample_rate) {
+    for (int i = 0; i < count; i++) {
+        const uint32_t window = first_window + i;
+        const uint32_t start_ms = (uint32_t)((uint64_t)window * MODEL_INPUT_SIZE * 1000 / sample_rate);
+        fprintf(out, "%lu,%lu,%s", window, start_ms, model_class_name(results[i].top_class));
+        for (int c = 0; c < MODEL_NUM_CLASSES; c++) {
+            fprintf(out, ",%.4f", results[i].scores[c]);
+        }
+        fputc('\n', out);
+    }
+}
+
+/**
+ * @brief Classifies the windows read into the batch buffers
+ * @param stream Stream of the recording
+ * @param buffers Run buffers, samples holding the windows
+ * @param windows Number of windows read
+ * @param window_index Index of the first window in the recording
+ * @return Number of windows classified before the first failure
+ *
+ * @note Models that take PCM get each window straight from the read
+ * buffer; the others are quantized first and classified as one batch
+ */
+static int classify_batch(model_stream_t *stream, reclassify_buffers_t *buffers, size_t windows,
+                          uint32_t window_index) {
+    if (model_takes_pcm()) {
+        for (size_t i = 0; i < windows; i++) {
+            // Consecutive ids keep a streaming model's state across the batch
+            if (predict_pcm(stream, window_index + i + 1, buffers->samples + i * MODEL_INPUT_SIZE,
+                            &buffers->results[i], NULL) < 0) {
+                return (int)i;
+            }
+        }
+        return (int)windows;
+    }
+
+    for (size_t i = 0; i < windows; i++) {
+        const esp_err_t ret = quantize_audio_window(buffers->samples + i * MODEL_INPUT_SIZE,
+                                                    buffers->features + i * MODEL_INPUT_SIZE, MODEL_INPUT_SIZE);
+        if (ret != ESP_OK) {
+            ESP_LOGE(TAG, "Window not quantized: %s", esp_err_to_name(ret));
+            return 0;
+        }
+    }
+    return predict_batch(stream, buffers->features, windows, buffers->results);
+}
+
+/**
+ * @brief Classifies one recording and writes its result file
+ * @param wav_path Path of the WAV file
+ * @param buffers Run buffers
+ * @return ESP_OK on success
+ *
+ * @note Windows do not overlap; a trailing partial window is ignored
+ */
+static esp_err_t reclassify_file(const char *wav_path, reclassify_buffers_t *buffers) {
+    char csv_path[MAX_PATH_LENGTH];
+    size_t stem_len = strlen(wav_path) - strlen(".wav");
+    if (snprintf(csv_path, sizeof(csv_path), "%.*s.csv", (int)stem_len, wav_path) >= sizeof(csv_path)) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    FILE *in = fopen(wav_path, "rb");
+    if (in == NULL) {
+        ESP_LOGE(TAG, "Failed to open %s", wav_path);
+        return ESP_FAIL;
+    }
+    setvbuf(in, buffers->read_buffer, _IOFBF, READ_BUFFER_SIZE);
+
+    uint32_t sample_rate = 0;
+    uint32_t data_bytes = 0;
+    esp_err_t ret = read_wav_header(in, &sample_rate, &data_bytes);
+    if (ret != ESP_OK || sample_rate == 0) {
+        ESP_LOGW(TAG, "Skipping %s: not 16-bit mono PCM", wav_path);
+        fclose(in);
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+    if (sample_rate != SAMPLE_RATE) {
+        ESP_LOGW(TAG, "%s recorded at %lu Hz, model expects %d Hz", wav_path, sample_rate, SAMPLE_RATE);
+    }
+
+    FILE *out = fopen(csv_path, "w");
+    if (out == NULL) {
+        ESP_LOGE(TAG, "Failed to create %s", csv_path);
+        fclose(in);
+        return ESP_FAIL;
+    }
+    fprintf(out, "window,start_ms,class");
+    for (int c = 0; c < MODEL_NUM_CLASSES; c++) {
+        fprintf(out, ",%s", model_class_name(c));
+    }
+    fputc('\n', out);
+
+    uint32_t windows_left = data_bytes / (MODEL_INPUT_SIZE * sizeof(int16_t));
+    uint32_t window_index = 0;
+    ret = ESP_OK;
+
+    // Each recording is one uninterrupted stream for streaming models
+    model_stream_t stream;
+    model_stream_init(&stream);
+
+    while (windows_left > 0) {
+        const size_t batch = windows_left < BATCH_WINDOWS ? windows_left : BATCH_WINDOWS;
+        const size_t read = fread(buffers->samples, MODEL_INPUT_SIZE * sizeof(int16_t), batch, in);
+        if (read == 0) {
+            break;
+        }
+
+        const int classified = classify_batch(&stream, buffers, read, window_index);
+        if (classified < (int)read) {
+            ESP_LOGE(TAG, "Inference failed in %s at window %lu", wav_path, window_index);
+            ret = ESP_FAIL;
+            break;
+        }
+        write_results(out, buffers->results, classified, window_index, sample_rate);
+
+        window_index += read;
+        windows_left -= read;
+
+        portENTER_CRITICAL(&s_status_lock);
+        s_status.windows_classified += read;
+        portEXIT_CRITICAL(&s_status_lock);
+    }
+
+    fclose(in);
+    if (fclose(out) != 0) {
+        ret = ESP_FAIL;
+    }
+    ESP_LOGI(TAG, "%s: %lu windows -> %s", wav_path, window_index, csv_path);
+    return ret;
+}
+
+/**
+ * @brief Reports whether a directory entry is a WAV recording
+ */
+static bool is_wav_file(const char *name) {
+    size_t len = strlen(name);
+    return len > 4 && strcasecmp(name + len - 4, ".wav") == 0;
+}
+
+/**
+ * @brief Classifies every recording of one category directory
+ * @param category Category directory name
+ * @param buffers Run buffers
+ */
+static void reclassify_category(const char *category, reclassify_buffers_t *buffers) {
+    char dir_path[MAX_PATH_LENGTH];
+    snprintf(dir_path, sizeof(dir_path), "%s/%s", SD_MOUNT_POINT, category);
+
+    DIR *dir = opendir(dir_path);
+    if (dir == NULL) {
+        return;
+    }
+
+    struct dirent *entry;
+    while ((entry = readdir(dir)) != NULL) {
+        if (entry->d_type != DT_REG || !is_wav_file(entry->d_name)) {
+            continue;
+        }
+
+        char wav_path[MAX_PATH_LENGTH];
+        if (snprintf(wav_path, sizeof(wav_path), "%s/%s", dir_path, entry->d_name) >= sizeof(wav_path)) {
+            continue;
+        }
+
+        portENTER_CRITICAL(&s_status_lock);
+        snprintf(s_status.current_file, sizeof(s_status.current_file), "%s/%s", category, entry->d_name);
+        portEXIT_CRITICAL(&s_status_lock);
+
+        esp_err_t ret = reclassify_file(wav_path, buffers);
+
+        portENTER_CRITICAL(&s_status_lock);
+        if (ret == ESP_OK) {
+            s_status.files_done++;
+        } else {
+            s_status.files_failed++;
+        }
+        portEXIT_CRITICAL(&s_status_lock);
+    }
+    closedir(dir);
+}
+
+/**
+ * @brief Reclassification task body
+ *
+ * Workflow:
+ * 1. Mounts the SD card if needed and allocates the run buffers
+ * 2. Visits every category directory under SD_MOUNT_POINT
+ * 3. Classifies each WAV file and writes its result file
+ * 4. Releases the buffers and deletes itself
+ */
+static void reclassify_task(void *arg) {
+    reclassify_buffers_t *buffers = calloc(1, sizeof(reclassify_buffers_t));
+    if (buffers != NULL) {
+        // Bulk audio is read once, front to back: keep it out of internal SRAM when PSRAM is placed for it
+        buffers->read_buffer = model_region_alloc(MODEL_REGION_AUDIO_HISTORY, READ_BUFFER_SIZE);
+        buffers->samples = model_region_alloc(MODEL_REGION_AUDIO_HISTORY, BATCH_WINDOWS * MODEL_INPUT_SIZE * sizeof(int16_t));
+        buffers->features = malloc(BATCH_WINDOWS * MODEL_INPUT_SIZE * sizeof(int8_t));
+    }
+
+    if (buffers == NULL || !buffers->read_buffer || !buffers->samples || !buffers->features) {
+        ESP_LOGE(TAG, "Failed to allocate reclassification buffers");
+    } else {
+        if (!sd_card_mounted) {
+            mount_sdcard();
+        }
+
+        DIR *root = opendir(SD_MOUNT_POINT);
+        if (root == NULL) {
+            ESP_LOGE(TAG, "Failed to open %s", SD_MOUNT_POINT);
+        } else {
+            struct dirent *entry;
+            while ((entry = readdir(root)) != NULL) {
+                if (entry->d_type == DT_DIR && entry->d_name[0] != '.') {
+                    reclassify_category(entry->d_name, buffers);
+                }
+            }
+            closedir(root);
+        }
+    }
+
+    if (buffers != NULL) {
+        model_memory_free(buffers->read_buffer);
+        model_memory_free(buffers->samples);
+        free(buffers->features);
+        free(buffers);
+    }
+
+    portENTER_CRITICAL(&s_status_lock);
+    s_status.running = false;
+    s_status.finished_at_ms = esp_timer_get_time() / 1000;
+    s_status.current_file[0] = '\0';
+    portEXIT_CRITICAL(&s_status_lock);
+
+    ESP_LOGI(TAG, "Reclassification finished: %lu files, %lu failed, %lu windows",
+             s_status.files_done, s_status.files_failed, s_status.windows_classified);
+
+    s_task = NULL;
+    vTaskDelete(NULL);
+}
+
+esp_err_t reclassify_start(void) {
+    portENTER_CRITICAL(&s_status_lock);
+    if (s_status.running) {
+        portEXIT_CRITICAL(&s_status_lock);
+        return ESP_ERR_INVALID_STATE;
+    }
+    memset(&s_status, 0, sizeof(s_status));
+    s_status.running = true;
+    s_status.started_at_ms = esp_timer_get_time() / 1000;
+    portEXIT_CRITICAL(&s_status_lock);
+
+    // Below the live pipeline so reclassification only uses idle CPU time
+    if (xTaskCreate(reclassify_task, "reclassify", RECLASSIFY_TASK_STACK_SIZE,
+                    NULL, CONFIG_RECLASSIFY_TASK_PRIORITY, &s_task) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create reclassification task");
+        portENTER_CRITICAL(&s_status_lock);
+        s_status.running = false;
+        portEXIT_CRITICAL(&s_status_lock);
+        return ESP_ERR_NO_MEM;
+    }
+
+    ESP_LOGI(TAG, "Reclassifying recordings under %s", SD_MOUNT_POINT);
+    return ESP_OK;
+}
+
+bool reclassify_is_running(void) {
+    return s_status.running;
+}
+
+void reclassify_get_status(reclassify_status_t *status) {
+    portENTER_CRITICAL(&s_status_lock);
+    *status = s_status;
+    portEXIT_CRITICAL(&s_status_lock);
+}
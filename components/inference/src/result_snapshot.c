@@ -0,0 +1,149 @@
+/**
+ * @file result_snapshot.c
+ * @brief Lock-free latest-result snapshot
+ *
+ * A sequence lock: the writer makes the sequence odd, copies the result and
+ * makes it even again. Readers copy the result between two reads of the
+ * sequence and retry if it was odd or changed, so polling /predict never
+ * waits on the inference task. Publishers are ordered by a mutex, so the
+ * copy never runs with interrupts masked.
+ *
+ * Waiters register in a fixed table of slots, each with its own binary
+ * semaphore, before they compare the sequence. Every publish gives the
+ * semaphore of each registered slot, so a result published between a
+ * waiter's check and its wait is never missed.
+ */
+
+#include <stdatomic.h>
+#include "result_snapshot.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+
+static const char *TAG = "result_snapshot";
+
+// /predict callers are the waiters, as for the on-demand service
+#define MAX_WAITERS CONFIG_INFERENCE_SERVICE_MAX_WAITERS
+
+/**
+ * @brief One caller blocked in result_snapshot_wait()
+ */
+typedef struct {
+    bool in_use;
+    SemaphoreHandle_t published;      ///< Given by every publish while in_use
+} waiter_t;
+
+static portMUX_TYPE s_lock = portMUX_INITIALIZER_UNLOCKED;
+static bool s_initialized = false;            ///< Guarded by s_lock
+static waiter_t s_waiters[MAX_WAITERS];       ///< in_use guarded by s_lock
+static StaticSemaphore_t s_waiter_buffers[MAX_WAITERS];
+static StaticSemaphore_t s_writer_lock_buffer;
+static SemaphoreHandle_t s_writer_lock = NULL;
+static atomic_uint s_sequence = 0;            ///< Odd while a write is in progress
+static result_snapshot_t s_snapshot;          ///< Only written under s_writer_lock
+
+void result_snapshot_init(void) {
+    portENTER_CRITICAL(&s_lock);
+    const bool first = !s_initialized;
+    s_initialized = true;
+    portEXIT_CRITICAL(&s_lock);
+    if (!first) {
+        return;
+    }
+
+    // Static objects cannot fail, so publish and wait only check s_writer_lock
+    for (int i = 0; i < MAX_WAITERS; i++) {
+        s_waiters[i].published = xSemaphoreCreateBinaryStatic(&s_waiter_buffers[i]);
+    }
+    s_writer_lock = xSemaphoreCreateMutexStatic(&s_writer_lock_buffer);
+}
+
+void result_snapshot_publish(const prediction_result_t *result, uint32_t window_id) {
+    if (s_writer_lock == NULL) {
+        return;
+    }
+
+    xSemaphoreTake(s_writer_lock, portMAX_DELAY);
+    const unsigned sequence = atomic_load_explicit(&s_sequence, memory_order_relaxed);
+    atomic_store_explicit(&s_sequence, sequence + 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    s_snapshot.sequence = (sequence + 2) / 2;
+    s_snapshot.window_id = window_id;
+    s_snapshot.result = *result;
+    atomic_store_explicit(&s_sequence, sequence + 2, memory_order_release);
+    xSemaphoreGive(s_writer_lock);
+
+    // Semaphores are given outside the critical section
+    SemaphoreHandle_t waiting[MAX_WAITERS];
+    int waiting_count = 0;
+    portENTER_CRITICAL(&s_lock);
+    for (int i = 0; i < MAX_WAITERS; i++) {
+        if (s_waiters[i].in_use) {
+            waiting[waiting_count++] = s_waiters[i].published;
+        }
+    }
+    portEXIT_CRITICAL(&s_lock);
+
+    for (int i = 0; i < waiting_count; i++) {
+        xSemaphoreGive(waiting[i]);
+    }
+}
+
+bool result_snapshot_read(result_snapshot_t *snapshot) {
+    unsigned before;
+    unsigned after;
+    do {
+        before = atomic_load_explicit(&s_sequence, memory_order_acquire);
+        *snapshot = s_snapshot;
+        atomic_thread_fence(memory_order_acquire);
+        after = atomic_load_explicit(&s_sequence, memory_order_relaxed);
+    } while ((before & 1) != 0 || before != after);
+    return before != 0;
+}
+
+int64_t result_snapshot_age_ms(const result_snapshot_t *snapshot) {
+    return (esp_timer_get_time() - snapshot->result.capture_timestamp_us) / 1000;
+}
+
+esp_err_t result_snapshot_wait(uint32_t sequence, result_snapshot_t *snapshot, uint32_t timeout_ms) {
+    if (s_writer_lock == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    waiter_t *waiter = NULL;
+    portENTER_CRITICAL(&s_lock);
+    for (int i = 0; i < MAX_WAITERS && waiter == NULL; i++) {
+        if (!s_waiters[i].in_use) {
+            waiter = &s_waiters[i];
+            waiter->in_use = true;
+        }
+    }
+    portEXIT_CRITICAL(&s_lock);
+
+    if (waiter == NULL) {
+        ESP_LOGW(TAG, "More than %d callers waiting", MAX_WAITERS);
+        return ESP_ERR_NO_MEM;
+    }
+
+    // Registered before the first check, so every later publish gives the
+    // semaphore; a give left over from a previous user only costs one check
+    const int64_t deadline_us = esp_timer_get_time() + timeout_ms * 1000LL;
+    esp_err_t ret = ESP_ERR_TIMEOUT;
+    for (;;) {
+        if (result_snapshot_read(snapshot) && snapshot->sequence != sequence) {
+            ret = ESP_OK;
+            break;
+        }
+        const int64_t remaining_us = deadline_us - esp_timer_get_time();
+        if (remaining_us <= 0) {
+            break;
+        }
+        xSemaphoreTake(waiter->published, pdMS_TO_TICKS(remaining_us / 1000) + 1);
+    }
+
+    portENTER_CRITICAL(&s_lock);
+    waiter->in_use = false;
+    portEXIT_CRITICAL(&s_lock);
+    return ret;
+}
@@ -0,0 +1,146 @@
+/**
+ * @file shadow_evaluator.c
+ * @brief Evaluates a candidate model on the live windows of the active one
+ *
+ * The inference task offers every window it classified. If the shadow task
+ * is idle, the window and the active result are copied into its single slot
+ * and the task is woken; otherwise the window is skipped. The shadow task
+ * runs below the inference pipeline, so it never delays capture and only
+ * delays the active model by the one shadow Invoke() holding the predictor
+ * lock. Responses are never affected: shadow results only feed the counters.
+ */
+
+#include <string.h>
+#include "shadow_evaluator.h"
+#include "model_shadow.h"
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+static const char *TAG = "shadow_evaluator";
+
+#define SHADOW_TASK_STACK_SIZE 4096
+#define LOG_EVERY_WINDOWS 500
+
+// Exponential moving average with a 1/8 weight for the newest sample
+#define STAGE_AVERAGE(avg, sample) ((avg) == 0 ? (sample) : (avg) - ((avg) >> 3) + ((sample) >> 3))
+
+static TaskHandle_t s_task = NULL;
+static portMUX_TYPE s_lock = portMUX_INITIALIZER_UNLOCKED;
+static bool s_busy = false;                   ///< Slot owned by the shadow task (guarded by s_lock)
+static shadow_stats_t s_stats;                ///< Guarded by s_lock
+
+// The slot, written by the offering task while !s_busy, then read by the shadow task
+static int8_t s_features[MODEL_INPUT_SIZE];
+static prediction_result_t s_active;
+
+/**
+ * @brief Logs the agreement rate and latency delta
+ */
+static void log_summary(const shadow_stats_t *stats) {
+    ESP_LOGI(TAG, "Agreement %lu/%lu (%.1f%%), %lu skipped, invoke %lu us vs %lu us active",
+             stats->agreements, stats->windows_evaluated,
+             100.0f * stats->agreements / stats->windows_evaluated, stats->windows_skipped,
+             stats->shadow_invoke_avg_us, stats->active_invoke_avg_us);
+}
+
+/**
+ * @brief Shadow task body: classifies the slot whenever it is filled
+ */
+static void shadow_task(void *arg) {
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        prediction_result_t shadow;
+        memset(&shadow, 0, sizeof(shadow));
+        const int shadow_class = model_shadow_predict(s_features, &shadow);
+        const int active_class = s_active.top_class;
+
+        shadow_stats_t snapshot;
+        portENTER_CRITICAL(&s_lock);
+        if (shadow_class < 0) {
+            s_stats.failures++;
+        } else {
+            s_stats.windows_evaluated++;
+            if (shadow_class == active_class) {
+                s_stats.agreements++;
+            }
+            s_stats.confusion[active_class][shadow_class]++;
+            s_stats.active_invoke_avg_us = STAGE_AVERAGE(s_stats.active_invoke_avg_us, s_active.invoke_us);
+            s_stats.shadow_invoke_avg_us = STAGE_AVERAGE(s_stats.shadow_invoke_avg_us, shadow.invoke_us);
+        }
+        snapshot = s_stats;
+        s_busy = false;
+        portEXIT_CRITICAL(&s_lock);
+
+        if (shadow_class < 0) {
+            ESP_LOGW(TAG, "Shadow inference failed");
+        } else if (snapshot.windows_evaluated % LOG_EVERY_WINDOWS == 0) {
+            log_summary(&snapshot);
+        }
+    }
+}
+
+esp_err_t shadow_evaluator_start(void) {
+#if CONFIG_MODEL_SHADOW_ENABLE
+    if (s_task != NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    // Load both models up front so the first offered window is not spent on it
+    model_info_t active_info;
+    model_info_t shadow_info;
+    if (model_get_info(&active_info) != 0 || model_shadow_get_info(&shadow_info) != 0) {
+        ESP_LOGE(TAG, "Failed to load the shadow model");
+        return ESP_FAIL;
+    }
+
+    memset(&s_stats, 0, sizeof(s_stats));
+    s_stats.active_arena_used_bytes = active_info.arena_used_bytes;
+    s_stats.shadow_arena_used_bytes = shadow_info.arena_used_bytes;
+
+    if (xTaskCreate(shadow_task, "shadow_model", SHADOW_TASK_STACK_SIZE, NULL,
+                    CONFIG_MODEL_SHADOW_TASK_PRIORITY, &s_task) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create the shadow task");
+        return ESP_ERR_NO_MEM;
+    }
+
+    ESP_LOGI(TAG, "Shadow model running: arena used %u bytes vs %u bytes active",
+             (unsigned)shadow_info.arena_used_bytes, (unsigned)active_info.arena_used_bytes);
+    return ESP_OK;
+#else
+    return ESP_ERR_NOT_SUPPORTED;
+#endif
+}
+
+void shadow_evaluator_offer(const int8_t *features, const prediction_result_t *active) {
+    if (s_task == NULL || active->top_class < 0) {
+        return;
+    }
+
+    portENTER_CRITICAL(&s_lock);
+    s_stats.windows_offered++;
+    const bool busy = s_busy;
+    if (busy) {
+        s_stats.windows_skipped++;
+    } else {
+        s_busy = true;
+    }
+    portEXIT_CRITICAL(&s_lock);
+
+    if (!busy) {
+        memcpy(s_features, features, sizeof(s_features));
+        s_active = *active;
+        xTaskNotifyGive(s_task);
+    }
+}
+
+bool shadow_evaluator_is_running(void) {
+    return s_task != NULL;
+}
+
+void shadow_evaluator_get_stats(shadow_stats_t *stats) {
+    portENTER_CRITICAL(&s_lock);
+    *stats = s_stats;
+    portEXIT_CRITICAL(&s_lock);
+}
@@ -0,0 +1,563 @@
+/**
+ * @file sound_enrollment.c
+ * @brief Custom sounds enrolled on the device and matched by embedding
+ *
+ * A custom sound is the normalized mean of the embeddings (the classifier's
+ * penultimate dense layer) of a few windows recorded while it plays. Every
+ * live window's unit-length embedding is compared with all centroids by
+ * cosine similarity, one dsps_dotprod_f32() each, so dozens of sounds cost
+ * a few microseconds on top of the Invoke() that produced the embedding.
+ *
+ * The centroids live in RAM and in a database file on the SD card laid out
+ * like esp-dl's dl::recognition::DataBase: a header, then one fixed-size
+ * record per enrollment in the order they were made. Deleting a sound only
+ * clears the id of its record, so ids stay stable and a record's offset
+ * follows from its id. The inference task never touches the card: a
+ * completed enrollment is written by a short-lived store task.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sound_enrollment.h"
+#include "i2s_recorder_main.h"
+#include "dsps_dotprod.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+static const char *TAG = "sound_enrollment";
+
+#define DB_PATH SD_MOUNT_POINT "/sounds.db"
+#define STORE_TASK_STACK_SIZE 4096
+
+#if CONFIG_SOUND_ENROLLMENT_ENABLE
+#define MAX_CLASSES CONFIG_SOUND_ENROLLMENT_MAX_CLASSES
+#define MATCH_THRESHOLD (CONFIG_SOUND_ENROLLMENT_THRESHOLD / 100.0f)
+#else
+#define MAX_CLASSES 1
+#define MATCH_THRESHOLD 1.0f
+#endif
+
+// An embedding of ReLU outputs that are all zero has no direction to compare
+#define MIN_SQUARED_NORM 0.5f
+
+// Exponential moving average with a 1/8 weight for the newest sample
+#define STAGE_AVERAGE(avg, sample) ((avg) == 0 ? (sample) : (avg) - ((avg) >> 3) + ((sample) >> 3))
+
+/**
+ * @brief Start of the database file
+ */
+typedef struct {
+    uint16_t records;                 ///< Records in the file, deleted ones included
+    uint16_t classes;                 ///< Records still enrolled
+    uint16_t embedding_size;          ///< Floats per centroid
+    uint16_t label_size;              ///< Bytes per label
+} db_header_t;
+
+/**
+ * @brief One enrollment, followed in the file by its embedding_size float centroid
+ */
+typedef struct {
+    uint16_t id;                      ///< 0 once deleted
+    uint16_t examples;
+    char label[SOUND_ENROLLMENT_LABEL_SIZE];
+} db_record_t;
+
+static SemaphoreHandle_t s_db_lock = NULL;    ///< Guards the database, its file and the enrollment below
+static db_header_t s_header;
+static sound_class_t s_classes[MAX_CLASSES];  ///< Enrolled sounds, in enrollment order
+static float *s_centroids = NULL;             ///< One row of s_header.embedding_size floats per sound
+static uint32_t s_class_count = 0;
+static float s_example_sum[MODEL_EMBEDDING_MAX_SIZE]; ///< Sum of the examples collected so far
+static bool s_storing = false;                ///< The store task owns s_example_sum (guarded by s_db_lock)
+
+static portMUX_TYPE s_status_lock = portMUX_INITIALIZER_UNLOCKED;
+static sound_enrollment_status_t s_status;    ///< Guarded by s_status_lock
+
+/**
+ * @brief Mounts the SD card unless it already is
+ * @return true if the card is mounted
+ *
+ * @note Never remounts: mount_sdcard() would unmount a card another task is reading
+ */
+static bool database_card_ready(void) {
+    if (!sd_card_mounted) {
+        mount_sdcard();
+    }
+    return sd_card_mounted;
+}
+
+/**
+ * @brief Bytes of one record in the file, centroid included
+ */
+static long record_size(void) {
+    return (long)(sizeof(db_record_t) + s_header.embedding_size * sizeof(float));
+}
+
+/**
+ * @brief Rewrites the header of an open database file
+ */
+static bool write_header(FILE *f) {
+    return fseek(f, 0, SEEK_SET) == 0 && fwrite(&s_header, sizeof(s_header), 1, f) == 1;
+}
+
+/**
+ * @brief Replaces the database file with an empty one
+ * @param embedding_size Floats per centroid
+ * @return ESP_OK on success
+ *
+ * @note Caller holds s_db_lock (or runs before the database is shared)
+ */
+static esp_err_t create_database(size_t embedding_size) {
+    s_header.records = 0;
+    s_header.classes = 0;
+    s_header.embedding_size = (uint16_t)embedding_size;
+    s_header.label_size = SOUND_ENROLLMENT_LABEL_SIZE;
+    s_class_count = 0;
+
+    if (!database_card_ready()) {
+        ESP_LOGE(TAG, "SD card not mounted");
+        return ESP_FAIL;
+    }
+    FILE *f = fopen(DB_PATH, "wb");
+    if (f == NULL) {
+        ESP_LOGE(TAG, "Failed to create %s", DB_PATH);
+        return ESP_FAIL;
+    }
+    const bool written = write_header(f);
+    fclose(f);
+    return written ? ESP_OK : ESP_FAIL;
+}
+
+/**
+ * @brief Reads the enrolled sounds from the database file
+ * @param embedding_size Floats per centroid of the deployed model
+ * @return ESP_OK on success
+ */
+static esp_err_t load_database(size_t embedding_size) {
+    if (!database_card_ready()) {
+        ESP_LOGE(TAG, "SD card not mounted");
+        return ESP_FAIL;
+    }
+    FILE *f = fopen(DB_PATH, "rb");
+    if (f == NULL) {
+        return create_database(embedding_size);
+    }
+
+    if (fread(&s_header, sizeof(s_header), 1, f) != 1 ||
+        s_header.embedding_size != embedding_size || s_header.label_size != SOUND_ENROLLMENT_LABEL_SIZE) {
+        ESP_LOGW(TAG, "%s was written for another model, starting an empty database", DB_PATH);
+        fclose(f);
+        return create_database(embedding_size);
+    }
+
+    s_class_count = 0;
+    db_record_t record;
+    for (uint32_t r = 0; r < s_header.records; r++) {
+        if (fread(&record, sizeof(record), 1, f) != 1) {
+            ESP_LOGE(TAG, "%s is truncated at record %lu", DB_PATH, r);
+            fclose(f);
+            return ESP_FAIL;
+        }
+        if (record.id == 0 || s_class_count == MAX_CLASSES) {
+            if (record.id != 0) {
+                ESP_LOGW(TAG, "Skipping %.*s: CONFIG_SOUND_ENROLLMENT_MAX_CLASSES reached",
+                         SOUND_ENROLLMENT_LABEL_SIZE, record.label);
+            }
+            fseek(f, embedding_size * sizeof(float), SEEK_CUR);
+            continue;
+        }
+        float *centroid = &s_centroids[s_class_count * embedding_size];
+        if (fread(centroid, sizeof(float), embedding_size, f) != embedding_size) {
+            ESP_LOGE(TAG, "%s is truncated at record %lu", DB_PATH, r);
+            fclose(f);
+            return ESP_FAIL;
+        }
+        sound_class_t *sound = &s_classes[s_class_count++];
+        sound->id = record.id;
+        sound->examples = record.examples;
+        memcpy(sound->label, record.label, sizeof(sound->label));
+        sound->label[SOUND_ENROLLMENT_LABEL_SIZE - 1] = '\0';
+    }
+    fclose(f);
+    return ESP_OK;
+}
+
+/**
+ * @brief Appends a sound to the database file and to the RAM copy
+ * @param label Label of the sound
+ * @param examples Windows averaged into the centroid
+ * @param centroid Unit-length centroid
+ * @return ESP_OK on success
+ *
+ * @note Caller holds s_db_lock
+ */
+static esp_err_t append_sound(const char *label, uint16_t examples, const float *centroid) {
+    db_record_t record = {
+        .id = (uint16_t)(s_header.records + 1),
+        .examples = examples,
+    };
+    strlcpy(record.label, label, sizeof(record.label));
+
+    if (!database_card_ready()) {
+        ESP_LOGE(TAG, "SD card not mounted");
+        return ESP_FAIL;
+    }
+    FILE *f = fopen(DB_PATH, "rb+");
+    if (f == NULL) {
+        ESP_LOGE(TAG, "Failed to open %s", DB_PATH);
+        return ESP_FAIL;
+    }
+    s_header.records++;
+    s_header.classes++;
+    const bool written = fseek(f, 0, SEEK_END) == 0 &&
+                         fwrite(&record, sizeof(record), 1, f) == 1 &&
+                         fwrite(centroid, sizeof(float), s_header.embedding_size, f) == s_header.embedding_size &&
+                         write_header(f);
+    fclose(f);
+    if (!written) {
+        s_header.records--;
+        s_header.classes--;
+        ESP_LOGE(TAG, "Failed to write %s", DB_PATH);
+        return ESP_FAIL;
+    }
+
+    sound_class_t *sound = &s_classes[s_class_count];
+    sound->id = record.id;
+    sound->examples = examples;
+    memcpy(sound->label, record.label, sizeof(sound->label));
+    memcpy(&s_centroids[s_class_count * s_header.embedding_size], centroid,
+           s_header.embedding_size * sizeof(float));
+    s_class_count++;
+    return ESP_OK;
+}
+
+/**
+ * @brief Updates the enrollment fields of the status
+ */
+static void publish_enrollment(bool enrolling, const char *label, uint32_t collected, uint32_t target) {
+    portENTER_CRITICAL(&s_status_lock);
+    s_status.enrolling = enrolling;
+    strlcpy(s_status.enrolling_label, label, sizeof(s_status.enrolling_label));
+    s_status.examples_collected = collected;
+    s_status.examples_target = target;
+    s_status.classes = s_class_count;
+    portEXIT_CRITICAL(&s_status_lock);
+}
+
+/**
+ * @brief Store task body: writes the completed enrollment to the database
+ *
+ * @note Runs below the inference task; windows that arrive while it holds
+ * s_db_lock are counted as busy instead of waiting for the card
+ */
+static void store_task(void *arg) {
+    xSemaphoreTake(s_db_lock, portMAX_DELAY);
+    sound_enrollment_status_t status;
+    portENTER_CRITICAL(&s_status_lock);
+    status = s_status;
+    portEXIT_CRITICAL(&s_status_lock);
+
+    // sound_enrollment_cancel() may have abandoned it in the meantime
+    if (status.enrolling &&
+        append_sound(status.enrolling_label, (uint16_t)status.examples_collected, s_example_sum) == ESP_OK) {
+        ESP_LOGI(TAG, "Enrolled %s (id %u) from %lu windows", status.enrolling_label,
+                 s_classes[s_class_count - 1].id, status.examples_collected);
+    }
+    s_storing = false;
+    publish_enrollment(false, "", 0, 0);
+    xSemaphoreGive(s_db_lock);
+    vTaskDelete(NULL);
+}
+
+/**
+ * @brief Adds one window to the sound being enrolled and hands it to the store task once complete
+ * @param embedding Unit-length embedding of the window
+ *
+ * @note Caller holds s_db_lock
+ */
+static void collect_example(const float *embedding) {
+    if (s_storing) {
+        return;
+    }
+    const size_t size = s_header.embedding_size;
+    float squared_norm = 0.0f;
+    dsps_dotprod_f32(embedding, embedding, &squared_norm, size);
+    if (squared_norm < MIN_SQUARED_NORM) {
+        return;
+    }
+    for (size_t i = 0; i < size; i++) {
+        s_example_sum[i] += embedding[i];
+    }
+
+    sound_enrollment_status_t status;
+    portENTER_CRITICAL(&s_status_lock);
+    s_status.examples_collected++;
+    status = s_status;
+    portEXIT_CRITICAL(&s_status_lock);
+    if (status.examples_collected < status.examples_target) {
+        return;
+    }
+
+    // The mean direction of the examples, back to unit length
+    float sum_norm = 0.0f;
+    dsps_dotprod_f32(s_example_sum, s_example_sum, &sum_norm, size);
+    const float inverse_norm = sum_norm > 0.0f ? 1.0f / sqrtf(sum_norm) : 0.0f;
+    for (size_t i = 0; i < size; i++) {
+        s_example_sum[i] *= inverse_norm;
+    }
+
+    // Below the live pipeline: the card write never delays a window
+    s_storing = true;
+    if (xTaskCreate(store_task, "sound_store", STORE_TASK_STACK_SIZE, NULL,
+                    tskIDLE_PRIORITY + 1, NULL) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create store task, %s not enrolled", status.enrolling_label);
+        s_storing = false;
+        publish_enrollment(false, "", 0, 0);
+    }
+}
+
+/**
+ * @brief Compares an embedding with every centroid
+ *
+ * @note Caller holds s_db_lock
+ */
+static void match_locked(const float *embedding, sound_match_t *match) {
+    const size_t size = s_header.embedding_size;
+    int best = -1;
+    float best_similarity = -1.0f;
+    for (uint32_t c = 0; c < s_class_count; c++) {
+        float similarity = 0.0f;
+        dsps_dotprod_f32(embedding, &s_centroids[c * size], &similarity, size);
+        if (similarity > best_similarity) {
+            best_similarity = similarity;
+            best = (int)c;
+        }
+    }
+
+    match->similarity = best < 0 ? 0.0f : best_similarity;
+    if (best >= 0 && best_similarity >= MATCH_THRESHOLD) {
+        match->id = s_classes[best].id;
+        memcpy(match->label, s_classes[best].label, sizeof(match->label));
+    } else {
+        match->id = -1;
+        match->label[0] = '\0';
+    }
+}
+
+esp_err_t sound_enrollment_start(void) {
+#if CONFIG_SOUND_ENROLLMENT_ENABLE
+    if (s_db_lock != NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    const size_t embedding_size = model_embedding_size();
+    if (embedding_size == 0) {
+        ESP_LOGW(TAG, "The model has no embedding output (tools/simplify_tflite_graph.py --expose-embedding)");
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+
+    s_centroids = malloc(MAX_CLASSES * embedding_size * sizeof(float));
+    if (s_centroids == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    esp_err_t ret = load_database(embedding_size);
+    if (ret != ESP_OK) {
+        free(s_centroids);
+        s_centroids = NULL;
+        return ret;
+    }
+
+    memset(&s_status, 0, sizeof(s_status));
+    s_status.embedding_size = embedding_size;
+    s_status.classes = s_class_count;
+    s_status.latest.id = -1;
+    s_db_lock = xSemaphoreCreateMutex();
+    if (s_db_lock == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    portENTER_CRITICAL(&s_status_lock);
+    s_status.running = true;
+    portEXIT_CRITICAL(&s_status_lock);
+    ESP_LOGI(TAG, "%lu enrolled sounds loaded from %s (%u-element embeddings)",
+             s_class_count, DB_PATH, (unsigned)embedding_size);
+    return ESP_OK;
+#else
+    return ESP_ERR_NOT_SUPPORTED;
+#endif
+}
+
+bool sound_enrollment_is_running(void) {
+    portENTER_CRITICAL(&s_status_lock);
+    const bool running = s_status.running;
+    portEXIT_CRITICAL(&s_status_lock);
+    return running;
+}
+
+esp_err_t sound_enrollment_begin(const char *label, uint32_t examples) {
+    if (label == NULL || label[0] == '\0' || strlen(label) >= SOUND_ENROLLMENT_LABEL_SIZE ||
+        examples == 0 || examples > SOUND_ENROLLMENT_MAX_EXAMPLES) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!sound_enrollment_is_running()) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    esp_err_t ret = ESP_OK;
+    xSemaphoreTake(s_db_lock, portMAX_DELAY);
+    portENTER_CRITICAL(&s_status_lock);
+    const bool enrolling = s_status.enrolling;
+    portEXIT_CRITICAL(&s_status_lock);
+    if (enrolling || s_storing) {
+        ret = ESP_ERR_INVALID_STATE;
+    } else if (s_class_count == MAX_CLASSES || s_header.records == UINT16_MAX) {
+        ret = ESP_ERR_NO_MEM;
+    } else {
+        memset(s_example_sum, 0, sizeof(s_example_sum));
+        publish_enrollment(true, label, 0, examples);
+        ESP_LOGI(TAG, "Enrolling %s from the next %lu windows", label, examples);
+    }
+    xSemaphoreGive(s_db_lock);
+    return ret;
+}
+
+void sound_enrollment_cancel(void) {
+    if (!sound_enrollment_is_running()) {
+        return;
+    }
+    xSemaphoreTake(s_db_lock, portMAX_DELAY);
+    publish_enrollment(false, "", 0, 0);
+    xSemaphoreGive(s_db_lock);
+}
+
+esp_err_t sound_enrollment_delete(uint16_t id) {
+    if (!sound_enrollment_is_running()) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    xSemaphoreTake(s_db_lock, portMAX_DELAY);
+    uint32_t index = 0;
+    while (index < s_class_count && s_classes[index].id != id) {
+        index++;
+    }
+    if (id == 0 || index == s_class_count) {
+        xSemaphoreGive(s_db_lock);
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    esp_err_t ret = ESP_FAIL;
+    FILE *f = database_card_ready() ? fopen(DB_PATH, "rb+") : NULL;
+    if (f != NULL) {
+        const uint16_t deleted = 0;
+        const long offset = (long)sizeof(db_header_t) + (long)(id - 1) * record_size();
+        s_header.classes--;
+        if (fseek(f, offset, SEEK_SET) == 0 && fwrite(&deleted, sizeof(deleted), 1, f) == 1 && write_header(f)) {
+            ret = ESP_OK;
+        } else {
+            s_header.classes++;
+        }
+        fclose(f);
+    }
+
+    if (ret == ESP_OK) {
+        const size_t size = s_header.embedding_size;
+        const uint32_t following = s_class_count - index - 1;
+        memmove(&s_classes[index], &s_classes[index + 1], following * sizeof(s_classes[0]));
+        memmove(&s_centroids[index * size], &s_centroids[(index + 1) * size], following * size * sizeof(float));
+        s_class_count--;
+        portENTER_CRITICAL(&s_status_lock);
+        s_status.classes = s_class_count;
+        portEXIT_CRITICAL(&s_status_lock);
+    } else {
+        ESP_LOGE(TAG, "Failed to delete sound %u from %s", id, DB_PATH);
+    }
+    xSemaphoreGive(s_db_lock);
+    return ret;
+}
+
+esp_err_t sound_enrollment_clear(void) {
+    if (!sound_enrollment_is_running()) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    xSemaphoreTake(s_db_lock, portMAX_DELAY);
+    if (database_card_ready()) {
+        remove(DB_PATH);
+    }
+    esp_err_t ret = create_database(s_header.embedding_size);
+    portENTER_CRITICAL(&s_status_lock);
+    s_status.classes = 0;
+    portEXIT_CRITICAL(&s_status_lock);
+    xSemaphoreGive(s_db_lock);
+    return ret;
+}
+
+void sound_enrollment_process(uint32_t window_id, const float *embedding) {
+    if (!sound_enrollment_is_running()) {
+        return;
+    }
+    if (xSemaphoreTake(s_db_lock, 0) != pdTRUE) {
+        portENTER_CRITICAL(&s_status_lock);
+        s_status.windows_busy++;
+        portEXIT_CRITICAL(&s_status_lock);
+        return;
+    }
+
+    portENTER_CRITICAL(&s_status_lock);
+    const bool enrolling = s_status.enrolling;
+    portEXIT_CRITICAL(&s_status_lock);
+    if (enrolling) {
+        collect_example(embedding);
+    }
+
+    sound_match_t match;
+    const int64_t start_us = esp_timer_get_time();
+    match_locked(embedding, &match);
+    const uint32_t match_us = (uint32_t)(esp_timer_get_time() - start_us);
+    match.window_id = window_id;
+    xSemaphoreGive(s_db_lock);
+
+    portENTER_CRITICAL(&s_status_lock);
+    const int previous_id = s_status.latest.id;
+    s_status.latest = match;
+    s_status.windows_matched++;
+    s_status.match_avg_us = STAGE_AVERAGE(s_status.match_avg_us, match_us);
+    portEXIT_CRITICAL(&s_status_lock);
+
+    if (match.id >= 0 && match.id != previous_id) {
+        ESP_LOGI(TAG, "Heard %s (similarity %.2f)", match.label, match.similarity);
+    }
+}
+
+esp_err_t sound_enrollment_match(const float *embedding, sound_match_t *match) {
+    if (!sound_enrollment_is_running()) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    xSemaphoreTake(s_db_lock, portMAX_DELAY);
+    match_locked(embedding, match);
+    xSemaphoreGive(s_db_lock);
+    match->window_id = 0;
+    return ESP_OK;
+}
+
+size_t sound_enrollment_list(sound_class_t *classes, size_t max_classes) {
+    if (!sound_enrollment_is_running()) {
+        return 0;
+    }
+    xSemaphoreTake(s_db_lock, portMAX_DELAY);
+    const size_t count = s_class_count < max_classes ? s_class_count : max_classes;
+    memcpy(classes, s_classes, count * sizeof(classes[0]));
+    xSemaphoreGive(s_db_lock);
+    return count;
+}
+
+void sound_enrollment_get_status(sound_enrollment_status_t *status) {
+    portENTER_CRITICAL(&s_status_lock);
+    *status = s_status;
+    portEXIT_CRITICAL(&s_status_lock);
+}
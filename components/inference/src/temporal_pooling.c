@@ -0,0 +1,200 @@
+/**
+ * @file temporal_pooling.c
+ * @brief Long-span decisions pooled from per-window scores
+ *
+ * One window covers 64 ms, too little to tell a rooster from an alarm with
+ * confidence, and a longer model input multiplies the CNN cost. Instead the
+ * scores the classifier already produced are kept in a ring covering the
+ * last 1-5 s and pooled into one decision per window:
+ * - Max: each class scores its best window, so short events are not diluted
+ * - Mean: sustained sounds win over isolated spikes
+ * - Weighted: a mean where each window counts by how clearly the model
+ *   separated its top two classes, so ambiguous windows barely count
+ *
+ * Scores are stored as 8-bit codes (1/255 steps, the resolution of the
+ * int8 softmax output) with running sums for the mean and weighted modes.
+ */
+
+#include <string.h>
+#include "temporal_pooling.h"
+#include "esp_log.h"
+
+static const char *TAG = "temporal_pooling";
+
+#define SCORE_CODE_MAX 255
+
+/**
+ * @brief Converts a score in [0, 1] to its 8-bit code
+ */
+static uint8_t score_code(float score) {
+    if (score <= 0.0f) {
+        return 0;
+    }
+    if (score >= 1.0f) {
+        return SCORE_CODE_MAX;
+    }
+    return (uint8_t)(score * SCORE_CODE_MAX + 0.5f);
+}
+
+/**
+ * @brief Weight of a window in weighted pooling: its top-1/top-2 margin plus one
+ */
+static uint32_t window_weight(const uint8_t *scores) {
+    uint8_t first = 0;
+    uint8_t second = 0;
+    for (int c = 0; c < MODEL_NUM_CLASSES; c++) {
+        if (scores[c] > first) {
+            second = first;
+            first = scores[c];
+        } else if (scores[c] > second) {
+            second = scores[c];
+        }
+    }
+    return (uint32_t)(first - second) + 1;
+}
+
+/**
+ * @brief Adds (sign 1) or removes (sign -1) a window from the running sums
+ */
+static void update_sums(temporal_pooling_t *pooling, const uint8_t *scores, int sign) {
+    const uint32_t weight = window_weight(scores);
+    for (int c = 0; c < MODEL_NUM_CLASSES; c++) {
+        pooling->sums[c] += sign * (int32_t)scores[c];
+        pooling->weighted_sums[c] += sign * (int32_t)(scores[c] * weight);
+    }
+    pooling->weight_sum += sign * (int32_t)weight;
+}
+
+/**
+ * @brief Drops the oldest window of the ring
+ */
+static void drop_oldest(temporal_pooling_t *pooling) {
+    update_sums(pooling, pooling->scores[pooling->head], -1);
+    pooling->head = (pooling->head + 1) % TEMPORAL_POOLING_MAX_WINDOWS;
+    pooling->count--;
+}
+
+esp_err_t temporal_pooling_init(temporal_pooling_t *pooling, const temporal_pooling_config_t *config) {
+    if (pooling == NULL || config == NULL || config->span_ms == 0 || config->hop_ms == 0 ||
+        config->mode > TEMPORAL_POOLING_WEIGHTED) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    memset(pooling, 0, sizeof(*pooling));
+    pooling->config = *config;
+    pooling->previous_top_class = -1;
+    pooling->previous_top_time_ms = INT64_MIN;
+
+    if (config->span_ms / config->hop_ms >= TEMPORAL_POOLING_MAX_WINDOWS) {
+        pooling->config.span_ms = (TEMPORAL_POOLING_MAX_WINDOWS - 1) * config->hop_ms;
+        ESP_LOGW(TAG, "Span shortened to %lu ms (%d windows)", pooling->config.span_ms,
+                 TEMPORAL_POOLING_MAX_WINDOWS);
+    }
+    return ESP_OK;
+}
+
+esp_err_t temporal_pooling_process(temporal_pooling_t *pooling, const float *scores,
+                                   int64_t timestamp_ms, temporal_pooling_decision_t *decision) {
+    if (pooling == NULL || scores == NULL || decision == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    // Windows must arrive in capture order
+    if (pooling->count > 0) {
+        int newest = (pooling->head + pooling->count - 1) % TEMPORAL_POOLING_MAX_WINDOWS;
+        if (timestamp_ms < pooling->timestamps_ms[newest]) {
+            ESP_LOGE(TAG, "Windows must be fed in increasing time order");
+            return ESP_ERR_INVALID_ARG;
+        }
+    }
+
+    // Append the latest window, overwriting the oldest one when full
+    if (pooling->count == TEMPORAL_POOLING_MAX_WINDOWS) {
+        drop_oldest(pooling);
+    }
+    const int latest = (pooling->head + pooling->count) % TEMPORAL_POOLING_MAX_WINDOWS;
+    pooling->timestamps_ms[latest] = timestamp_ms;
+    for (int c = 0; c < MODEL_NUM_CLASSES; c++) {
+        pooling->scores[latest][c] = score_code(scores[c]);
+    }
+    update_sums(pooling, pooling->scores[latest], 1);
+    pooling->count++;
+
+    // Drop windows that fell out of the span
+    const int64_t span_start_ms = timestamp_ms - pooling->config.span_ms;
+    while (pooling->count > 1 && pooling->timestamps_ms[pooling->head] < span_start_ms) {
+        drop_oldest(pooling);
+    }
+
+    decision->is_new_detection = false;
+    decision->windows = (uint32_t)pooling->count;
+    decision->covered_ms = (uint32_t)(timestamp_ms - pooling->timestamps_ms[pooling->head]);
+
+    // Decide only once the ring holds a full span (after start or a capture gap)
+    if (decision->covered_ms + pooling->config.hop_ms < pooling->config.span_ms) {
+        decision->top_class = -1;
+        decision->score = 0.0f;
+        memset(decision->pooled_scores, 0, sizeof(decision->pooled_scores));
+        return ESP_OK;
+    }
+
+    uint32_t pooled[MODEL_NUM_CLASSES];
+    uint32_t divisor = 1;
+    switch (pooling->config.mode) {
+    case TEMPORAL_POOLING_MAX:
+        memset(pooled, 0, sizeof(pooled));
+        for (int i = 0; i < pooling->count; i++) {
+            const uint8_t *window = pooling->scores[(pooling->head + i) % TEMPORAL_POOLING_MAX_WINDOWS];
+            for (int c = 0; c < MODEL_NUM_CLASSES; c++) {
+                if (window[c] > pooled[c]) {
+                    pooled[c] = window[c];
+                }
+            }
+        }
+        break;
+    case TEMPORAL_POOLING_MEAN:
+        memcpy(pooled, pooling->sums, sizeof(pooled));
+        divisor = (uint32_t)pooling->count;
+        break;
+    case TEMPORAL_POOLING_WEIGHTED:
+        memcpy(pooled, pooling->weighted_sums, sizeof(pooled));
+        divisor = pooling->weight_sum;
+        break;
+    }
+
+    int top_class = 0;
+    const float scale = 1.0f / ((float)divisor * SCORE_CODE_MAX);
+    for (int c = 0; c < MODEL_NUM_CLASSES; c++) {
+        decision->pooled_scores[c] = pooled[c] * scale;
+        if (pooled[c] > pooled[top_class]) {
+            top_class = c;
+        }
+    }
+
+    // Report a new detection only when it is confident and not suppressed
+    const float top_score = decision->pooled_scores[top_class];
+    const bool suppressed = (top_class == pooling->previous_top_class) &&
+        (timestamp_ms - pooling->previous_top_time_ms <= (int64_t)pooling->config.suppression_ms);
+
+    if (top_score > pooling->config.detection_threshold && !suppressed) {
+        pooling->previous_top_class = top_class;
+        pooling->previous_top_time_ms = timestamp_ms;
+        decision->is_new_detection = true;
+    }
+
+    decision->top_class = top_class;
+    decision->score = top_score;
+    return ESP_OK;
+}
+
+const char *temporal_pooling_mode_name(temporal_pooling_mode_t mode) {
+    switch (mode) {
+    case TEMPORAL_POOLING_MAX:
+        return "max";
+    case TEMPORAL_POOLING_MEAN:
+        return "mean";
+    case TEMPORAL_POOLING_WEIGHTED:
+        return "weighted";
+    }
+    return "unknown";
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#ifndef CASCADE_GATE_H
+#define CASCADE_GATE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "model_predictor.h"
+
+#define CASCADE_NUM_BANDS 8     ///< Band energies fed to the stage-one detector
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Hit counts and latencies of both cascade stages
+ */
+typedef struct {
+    uint32_t stage1_runs;        ///< Windows evaluated by the always-on detector
+    uint32_t stage1_hits;        ///< Windows the detector passed on as candidate events
+    uint32_t stage1_avg_us;      ///< Moving average of the detector latency
+    uint32_t stage2_runs;        ///< Windows classified by the full CNN
+    uint32_t stage2_avg_us;      ///< Moving average of the full classifier latency
+    float threshold;             ///< Current stage-one candidate threshold
+} cascade_stats_t;
+
+/**
+ * @brief Runs the stage-one detector on a raw window
+ * @param samples Raw 16-bit PCM samples (the newest 512 are used)
+ * @param num_samples Number of samples in the window
+ * @param probability Output event probability (may be NULL)
+ * @return true if the window is a candidate event for the full classifier
+ *
+ * @note Logistic regression on log band energies, a few hundred bytes of
+ * coefficients and one FFT per hop
+ */
+bool cascade_stage1(const int16_t *samples, size_t num_samples, float *probability);
+
+/**
+ * @brief Runs the full classifier on a window that passed stage one
+ * @param stream Stream of the window (see predict_stream())
+ * @param window_id Sequence number of the window; gated windows leave gaps
+ * @param input_data Quantized input window (MODEL_INPUT_SIZE int8 values), used when samples is NULL
+ * @param samples Raw PCM window for predict_pcm(), or NULL
+ * @param result Filled as by predict_class_quantized()
+ * @param embedding Output embedding as by predict_stream_embedding(), or NULL
+ * @return Predicted class index (0-5), or -1 on failure
+ */
+int cascade_stage2(model_stream_t *stream, uint32_t window_id, const int8_t *input_data,
+                   const int16_t *samples, prediction_result_t *result, float *embedding);
+
+/**
+ * @brief Sets the stage-one candidate threshold
+ * @param threshold Event probability in [0, 1] above which stage two runs
+ * @return ESP_OK on success, ESP_ERR_INVALID_ARG when out of range
+ */
+esp_err_t cascade_set_threshold(float threshold);
+
+/**
+ * @brief Copies the hit counts and latencies of both stages
+ * @param stats Output statistics
+ */
+void cascade_get_stats(cascade_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // CASCADE_GATE_H
@@ -1,2602 +0,0 @@
-#pragma once
-
-
-unsigned char mfcc_model_tflite[] = {
-  0x1c, 0x00, 0x00, 0x00, 0x54, 0x46, 0x4c, 0x33, 0x14, 0x00, 0x20, 0x00,
-  0x1c, 0x00, 0x18, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0x08, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-  0x8c, 0x00, 0x00, 0x00, 0x0c, 0x01, 0x00, 0x00, 0x4c, 0x5c, 0x00, 0x00,
-  0x5c, 0x5c, 0x00, 0x00, 0xc8, 0x78, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x3a, 0xa0, 0xff, 0xff,
-  0x0c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
-  0x0f, 0x00, 0x00, 0x00, 0x73, 0x65, 0x72, 0x76, 0x69, 0x6e, 0x67, 0x5f,
-  0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x68, 0xff, 0xff, 0xff, 0x20, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x6f, 0x75, 0x74, 0x70,
-  0x75, 0x74, 0x5f, 0x30, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x42, 0xa0, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x0f, 0x00, 0x00, 0x00, 0x6b, 0x65, 0x72, 0x61, 0x73, 0x5f, 0x74, 0x65,
-  0x6e, 0x73, 0x6f, 0x72, 0x5f, 0x31, 0x32, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x5c, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0xb8, 0xff, 0xff, 0xff, 0x24, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x13, 0x00, 0x00, 0x00, 0x43, 0x4f, 0x4e, 0x56, 0x45, 0x52, 0x53, 0x49,
-  0x4f, 0x4e, 0x5f, 0x4d, 0x45, 0x54, 0x41, 0x44, 0x41, 0x54, 0x41, 0x00,
-  0xdc, 0xff, 0xff, 0xff, 0x23, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x13, 0x00, 0x00, 0x00, 0x6d, 0x69, 0x6e, 0x5f, 0x72, 0x75, 0x6e, 0x74,
-  0x69, 0x6d, 0x65, 0x5f, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x00,
-  0x08, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00,
-  0x22, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
-  0x6d, 0x69, 0x6e, 0x5f, 0x72, 0x75, 0x6e, 0x74, 0x69, 0x6d, 0x65, 0x5f,
-  0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x00, 0x25, 0x00, 0x00, 0x00,
-  0x3c, 0x5b, 0x00, 0x00, 0x34, 0x5b, 0x00, 0x00, 0x20, 0x5b, 0x00, 0x00,
-  0x0c, 0x5b, 0x00, 0x00, 0xf8, 0x5a, 0x00, 0x00, 0xf0, 0x5a, 0x00, 0x00,
-  0xdc, 0x5a, 0x00, 0x00, 0xb4, 0x5a, 0x00, 0x00, 0xe4, 0x59, 0x00, 0x00,
-  0x54, 0x59, 0x00, 0x00, 0x44, 0x19, 0x00, 0x00, 0xb4, 0x18, 0x00, 0x00,
-  0xa4, 0x06, 0x00, 0x00, 0x54, 0x06, 0x00, 0x00, 0xc4, 0x01, 0x00, 0x00,
-  0x94, 0x01, 0x00, 0x00, 0x3c, 0x01, 0x00, 0x00, 0x34, 0x01, 0x00, 0x00,
-  0x2c, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0x00, 0x1c, 0x01, 0x00, 0x00,
-  0x14, 0x01, 0x00, 0x00, 0x0c, 0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00,
-  0xfc, 0x00, 0x00, 0x00, 0xf4, 0x00, 0x00, 0x00, 0xec, 0x00, 0x00, 0x00,
-  0xe4, 0x00, 0x00, 0x00, 0xdc, 0x00, 0x00, 0x00, 0xd4, 0x00, 0x00, 0x00,
-  0xcc, 0x00, 0x00, 0x00, 0xc4, 0x00, 0x00, 0x00, 0xbc, 0x00, 0x00, 0x00,
-  0xb4, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x7a, 0xa1, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x60, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0e, 0x00,
-  0x08, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x04, 0x00,
-  0x06, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0xeb, 0x03, 0x00, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x14, 0x00, 0x10, 0x00,
-  0x0c, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x7e, 0x12, 0x3b, 0x8b,
-  0x68, 0x65, 0xd6, 0xf6, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x32, 0x2e, 0x31, 0x39,
-  0x2e, 0x30, 0x00, 0x00, 0xe6, 0xa1, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xa2, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x31, 0x2e, 0x31, 0x34,
-  0x2e, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x3c, 0x8a, 0xff, 0xff, 0x40, 0x8a, 0xff, 0xff, 0x44, 0x8a, 0xff, 0xff,
-  0x48, 0x8a, 0xff, 0xff, 0x4c, 0x8a, 0xff, 0xff, 0x50, 0x8a, 0xff, 0xff,
-  0x54, 0x8a, 0xff, 0xff, 0x58, 0x8a, 0xff, 0xff, 0x5c, 0x8a, 0xff, 0xff,
-  0x60, 0x8a, 0xff, 0xff, 0x64, 0x8a, 0xff, 0xff, 0x68, 0x8a, 0xff, 0xff,
-  0x6c, 0x8a, 0xff, 0xff, 0x70, 0x8a, 0xff, 0xff, 0x74, 0x8a, 0xff, 0xff,
-  0x78, 0x8a, 0xff, 0xff, 0x7c, 0x8a, 0xff, 0xff, 0x62, 0xa2, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x77, 0x7e, 0x04, 0xd2,
-  0xee, 0x81, 0xbe, 0x9a, 0x1a, 0xa7, 0xfc, 0xea, 0x14, 0xbd, 0x7b, 0x7f,
-  0x40, 0x88, 0x6d, 0x1e, 0x9e, 0x76, 0xe0, 0x1c, 0x81, 0x3a, 0xc8, 0x78,
-  0x57, 0x9b, 0x0f, 0x01, 0xbb, 0x81, 0x2b, 0x29, 0x81, 0x34, 0x74, 0xf3,
-  0x7b, 0xf1, 0x42, 0xa7, 0xa0, 0xeb, 0xa5, 0x81, 0x08, 0x17, 0x11, 0x3e,
-  0x27, 0x5b, 0x08, 0xd6, 0x02, 0xda, 0x7f, 0xa8, 0xf7, 0xce, 0xdd, 0x7f,
-  0xd5, 0x02, 0x45, 0x49, 0x31, 0xd2, 0x83, 0xdc, 0xb6, 0xa2, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x9e, 0xfd, 0xff, 0xff,
-  0x9d, 0xf1, 0xff, 0xff, 0xf4, 0xf3, 0xff, 0xff, 0x6e, 0x00, 0x00, 0x00,
-  0x14, 0xf9, 0xff, 0xff, 0x1c, 0xf6, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xff,
-  0xd8, 0xdd, 0xff, 0xff, 0xe2, 0xa2, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x80, 0x04, 0x00, 0x00, 0xe2, 0xf8, 0x18, 0xcc, 0xe2, 0xc2, 0x11, 0xf9,
-  0xf5, 0x14, 0x2e, 0x54, 0x24, 0xe5, 0xd4, 0x09, 0xe7, 0x17, 0xc7, 0xb4,
-  0xe6, 0xbe, 0xad, 0x19, 0x8d, 0xe9, 0xf4, 0x00, 0xf0, 0x0e, 0xc4, 0x0e,
-  0xd4, 0x11, 0xe0, 0xee, 0x00, 0xe4, 0x21, 0x2f, 0x81, 0x07, 0x1a, 0x40,
-  0xf7, 0xfd, 0xdc, 0xd2, 0xdf, 0x29, 0xc8, 0xc6, 0x12, 0xac, 0x15, 0xf1,
-  0xd5, 0xe7, 0x33, 0x30, 0xd8, 0xe1, 0xfa, 0x0f, 0xb5, 0x2a, 0x0c, 0xe5,
-  0x4e, 0xcc, 0x1c, 0xe3, 0xe1, 0xe7, 0x58, 0x02, 0xea, 0x09, 0xf5, 0x14,
-  0x7b, 0xff, 0xdd, 0x13, 0x02, 0xfb, 0x02, 0x1b, 0xa7, 0xc4, 0x42, 0x49,
-  0x4f, 0x30, 0xf4, 0x2f, 0x66, 0xfc, 0x3d, 0x3b, 0xd2, 0xf4, 0xfe, 0xb1,
-  0x08, 0xdf, 0x24, 0x39, 0x24, 0x2d, 0xca, 0x1f, 0x07, 0xef, 0xb6, 0xff,
-  0x1b, 0xad, 0x15, 0x18, 0x9b, 0x23, 0xc4, 0xea, 0x2b, 0x46, 0x81, 0xc9,
-  0x73, 0x20, 0x30, 0x57, 0x2a, 0xe3, 0xe9, 0xef, 0x3c, 0x25, 0xd5, 0xaa,
-  0xfa, 0x50, 0x95, 0x13, 0x81, 0x16, 0xd5, 0x1a, 0x25, 0x09, 0xb5, 0xe3,
-  0xec, 0xf4, 0x2c, 0x3f, 0xf9, 0xff, 0xd8, 0x05, 0xbd, 0xef, 0x06, 0xdf,
-  0xfd, 0xfa, 0xc5, 0x06, 0xa6, 0xd0, 0x1f, 0x0d, 0xcc, 0x04, 0xbe, 0x1b,
-  0xdc, 0x27, 0xbd, 0xb5, 0x1c, 0xe7, 0xe3, 0xea, 0xab, 0xc3, 0x3c, 0x35,
-  0xe0, 0xea, 0xda, 0x05, 0xc9, 0x26, 0xcf, 0xaf, 0xfc, 0xb7, 0xdd, 0x10,
-  0xe5, 0xf5, 0x38, 0x44, 0xe7, 0x0c, 0x06, 0x27, 0xaa, 0x28, 0xc9, 0xd6,
-  0x32, 0xcc, 0x10, 0xde, 0x1d, 0x2d, 0xee, 0x53, 0x4c, 0x26, 0xcf, 0x3c,
-  0xec, 0xdb, 0x23, 0xe9, 0xff, 0xe0, 0x1f, 0x18, 0xc7, 0x30, 0x10, 0xd3,
-  0x09, 0xf7, 0x16, 0x25, 0x53, 0x2a, 0x43, 0xdd, 0x45, 0xd2, 0xfe, 0xec,
-  0xbe, 0x0a, 0xcc, 0xf2, 0xf2, 0xf6, 0x21, 0xc4, 0xdb, 0x05, 0xd4, 0x44,
-  0x18, 0x30, 0x98, 0xf1, 0xe8, 0xec, 0x53, 0x5f, 0x19, 0x23, 0xf6, 0x1e,
-  0xd8, 0xd1, 0x27, 0x0c, 0x70, 0xeb, 0x19, 0xc5, 0x81, 0xf1, 0xfb, 0xdf,
-  0x1a, 0x0c, 0xc7, 0x1d, 0xc5, 0xe5, 0xce, 0xcc, 0x53, 0xfe, 0xb9, 0xe8,
-  0xad, 0xee, 0xf8, 0x25, 0xce, 0x19, 0xd5, 0x26, 0x15, 0x40, 0x45, 0x1c,
-  0x4f, 0x94, 0xbf, 0xb2, 0xe2, 0xdc, 0x08, 0x69, 0xe0, 0x19, 0xbe, 0x1f,
-  0xd2, 0x60, 0x41, 0xda, 0x73, 0xda, 0xb0, 0x05, 0xd5, 0xc7, 0xf1, 0x30,
-  0xd0, 0x0c, 0x2f, 0x2f, 0x81, 0xd6, 0xe7, 0x9e, 0x2c, 0x10, 0xdf, 0xa8,
-  0xb9, 0x06, 0x38, 0x7f, 0x34, 0x43, 0xbd, 0x0b, 0xdd, 0xec, 0x08, 0x25,
-  0x5a, 0xcd, 0xda, 0x17, 0xb9, 0xdd, 0x01, 0x45, 0x55, 0xe6, 0xf7, 0xac,
-  0x28, 0x9e, 0xb3, 0x44, 0xd4, 0x4a, 0x4a, 0x1b, 0x54, 0x17, 0x02, 0xf5,
-  0xed, 0xcd, 0x33, 0x04, 0x74, 0x3f, 0x95, 0x0f, 0x6a, 0x1a, 0xf3, 0x31,
-  0x03, 0xd6, 0x30, 0x05, 0x3f, 0x23, 0xcf, 0x9c, 0x18, 0x42, 0xed, 0x21,
-  0xb6, 0x96, 0x6d, 0xeb, 0xd4, 0x53, 0x8c, 0xb4, 0x0d, 0xd4, 0x46, 0x81,
-  0xb4, 0xa7, 0x24, 0x19, 0xc6, 0xdc, 0x46, 0xa5, 0xf7, 0xf3, 0xe4, 0x0a,
-  0x43, 0x52, 0x38, 0xe8, 0xc7, 0x06, 0x07, 0xbe, 0x11, 0xbd, 0xf7, 0x0a,
-  0xde, 0xfe, 0x5c, 0x0b, 0xc0, 0x2c, 0x2e, 0xfd, 0xef, 0xe8, 0xdd, 0xe3,
-  0x6a, 0x92, 0xf6, 0xf5, 0xb4, 0x14, 0x26, 0x5c, 0x64, 0x0c, 0xff, 0x22,
-  0xb6, 0xb4, 0xc1, 0x8c, 0x99, 0x09, 0x14, 0xb4, 0x22, 0x1f, 0x46, 0xc4,
-  0x27, 0x22, 0x0c, 0x2e, 0xe8, 0x25, 0x0c, 0x2b, 0x97, 0x10, 0xe9, 0x15,
-  0x81, 0x5a, 0xdb, 0xf4, 0x2f, 0x1e, 0xed, 0xf4, 0xce, 0xef, 0x26, 0x17,
-  0xb8, 0xff, 0xd5, 0x3d, 0xd8, 0xc6, 0xbe, 0xe8, 0xca, 0xb5, 0xf7, 0xe2,
-  0xd8, 0xe0, 0xe7, 0xba, 0xee, 0xba, 0xc8, 0xfa, 0x46, 0xc1, 0xf8, 0xdf,
-  0xa4, 0x81, 0xef, 0xe5, 0x0b, 0xdb, 0xf9, 0x0f, 0xe9, 0x19, 0xec, 0xf2,
-  0x13, 0x2e, 0x04, 0x07, 0x16, 0xef, 0xd8, 0x22, 0x0d, 0xe2, 0xf0, 0x1b,
-  0xdd, 0x02, 0xf0, 0x14, 0x32, 0x49, 0xe7, 0x00, 0x44, 0xfe, 0xf3, 0xee,
-  0x11, 0x2e, 0x26, 0x18, 0x06, 0x0a, 0xe9, 0xfb, 0xef, 0xf8, 0xf2, 0x27,
-  0x25, 0x07, 0x11, 0xdf, 0x00, 0x12, 0x3b, 0x3d, 0x01, 0x07, 0x04, 0xe0,
-  0x0b, 0x03, 0x1e, 0x1b, 0x11, 0xfe, 0x0c, 0x29, 0x36, 0x1f, 0x3a, 0xf9,
-  0x15, 0xfc, 0xf3, 0x2a, 0x04, 0x34, 0xf1, 0xf1, 0x29, 0xfe, 0x0b, 0xcf,
-  0x9d, 0xdb, 0xea, 0x15, 0xf4, 0x22, 0xf1, 0xe5, 0x24, 0x08, 0x1d, 0x12,
-  0x7f, 0x00, 0x31, 0xd3, 0x33, 0xc8, 0x32, 0x5b, 0xfa, 0xf2, 0xdb, 0x05,
-  0x9d, 0x14, 0xe9, 0xc6, 0x1a, 0xf0, 0x33, 0x23, 0xe7, 0x13, 0x05, 0x1f,
-  0xb1, 0x05, 0xe3, 0x19, 0x58, 0xef, 0xbc, 0xd8, 0xe3, 0xfa, 0xd4, 0x81,
-  0xe0, 0xf2, 0x1d, 0xb1, 0x3c, 0x0a, 0x1e, 0xd1, 0x04, 0x49, 0xfd, 0xb6,
-  0xdc, 0xfa, 0x1c, 0x2f, 0xe4, 0x50, 0xc0, 0xe9, 0x1c, 0xe8, 0x05, 0xfb,
-  0x1c, 0xdf, 0x12, 0x0a, 0x0f, 0xc3, 0xdc, 0xdc, 0x2b, 0xe4, 0xfa, 0x3d,
-  0xa1, 0x4d, 0x43, 0xed, 0x26, 0xf6, 0x29, 0xeb, 0x99, 0x69, 0x42, 0x06,
-  0xc4, 0x49, 0xdc, 0xdb, 0xe8, 0x55, 0x34, 0xf5, 0xf7, 0x27, 0xca, 0xe3,
-  0x04, 0x57, 0x03, 0x2d, 0xda, 0xc9, 0x1a, 0x02, 0x0d, 0x13, 0x3a, 0x2c,
-  0x19, 0xee, 0x25, 0x25, 0x09, 0x28, 0xf3, 0x0f, 0x34, 0x11, 0xed, 0xfb,
-  0x20, 0xed, 0x28, 0x27, 0xe7, 0x09, 0xf7, 0x27, 0x25, 0xe9, 0xf7, 0x15,
-  0x45, 0xd5, 0x1f, 0x2c, 0xda, 0x16, 0xe9, 0x01, 0xe7, 0xe3, 0xda, 0x0c,
-  0xc0, 0x31, 0xbe, 0x02, 0x45, 0xe7, 0xee, 0x2e, 0xb9, 0x58, 0x43, 0xc9,
-  0xdf, 0x44, 0xce, 0x98, 0x12, 0x56, 0x15, 0xbd, 0x2a, 0x4a, 0x31, 0xe9,
-  0x5b, 0x7f, 0x28, 0x2c, 0xca, 0xfe, 0x20, 0x0d, 0xfb, 0x81, 0x12, 0x27,
-  0x50, 0xd6, 0x44, 0x06, 0x0c, 0x97, 0xb8, 0x30, 0x50, 0xd3, 0x51, 0x31,
-  0x1d, 0xe9, 0x11, 0x2c, 0x4c, 0x2d, 0xdc, 0xd1, 0x3f, 0xf9, 0x4a, 0xe6,
-  0xfe, 0x24, 0x1a, 0x20, 0x10, 0x06, 0xff, 0xab, 0xe9, 0xda, 0xf1, 0x08,
-  0x1f, 0x06, 0xe1, 0xb5, 0x3a, 0x10, 0x28, 0x14, 0x07, 0xae, 0x37, 0x33,
-  0x12, 0xef, 0x3d, 0xe9, 0x0e, 0xdf, 0xd8, 0x37, 0x0c, 0x0b, 0x0d, 0x07,
-  0xe7, 0xd9, 0xfe, 0x29, 0x85, 0x09, 0x01, 0x88, 0x13, 0x45, 0xbe, 0xc2,
-  0x3b, 0x41, 0x10, 0x37, 0x4f, 0xce, 0x3d, 0x27, 0x02, 0xa0, 0x67, 0x5f,
-  0xa9, 0xf3, 0x1a, 0x32, 0x33, 0xc4, 0x29, 0x73, 0x99, 0xf6, 0xf8, 0x41,
-  0xc2, 0xe9, 0xfe, 0x15, 0x8c, 0x14, 0xea, 0x10, 0x7f, 0x10, 0xc4, 0x8a,
-  0x14, 0x16, 0xec, 0x9d, 0x94, 0x01, 0xed, 0xe0, 0xe9, 0xfb, 0xf0, 0xf6,
-  0x19, 0x4b, 0xf6, 0x38, 0xfe, 0x39, 0xe8, 0x0f, 0x0e, 0xe8, 0x00, 0xe8,
-  0xf7, 0x2a, 0xb5, 0xdb, 0x7f, 0xf2, 0xfd, 0xd8, 0xc1, 0x35, 0x0d, 0x0f,
-  0x0b, 0x1b, 0xc3, 0xe7, 0x0d, 0x2c, 0x37, 0xf0, 0x29, 0x1b, 0xad, 0xea,
-  0xec, 0x19, 0x1a, 0xc2, 0xd6, 0xde, 0x33, 0xfe, 0xe9, 0x04, 0xd6, 0x20,
-  0xc6, 0x16, 0x10, 0xda, 0xe9, 0x4a, 0xd9, 0x30, 0xaa, 0x16, 0x12, 0xcf,
-  0xfa, 0x29, 0xfc, 0x27, 0xe5, 0x07, 0xdb, 0xab, 0xee, 0x51, 0xfb, 0xf6,
-  0xf2, 0x12, 0xe1, 0x07, 0x0f, 0x4a, 0xda, 0xf4, 0x5a, 0x29, 0x01, 0x12,
-  0xdc, 0x56, 0x2b, 0xec, 0xad, 0x19, 0xf4, 0xd2, 0x0a, 0x35, 0x17, 0x0f,
-  0xe2, 0x07, 0xf0, 0xe4, 0x52, 0x00, 0xb6, 0x05, 0x59, 0x02, 0x43, 0x52,
-  0x05, 0x36, 0xf4, 0x21, 0x36, 0xa0, 0x66, 0x7f, 0x1a, 0x44, 0x00, 0x38,
-  0xfc, 0xfb, 0xe3, 0x11, 0x8a, 0x38, 0xe4, 0xbe, 0x16, 0x54, 0xa8, 0xad,
-  0x5c, 0x0c, 0x11, 0xd5, 0xd5, 0x21, 0xa9, 0x8e, 0x47, 0x09, 0xe9, 0xc9,
-  0xd8, 0x2e, 0xd4, 0x02, 0x39, 0x52, 0x1c, 0x13, 0x42, 0xbd, 0x22, 0xea,
-  0x17, 0x19, 0x1b, 0x2b, 0x40, 0x58, 0xaa, 0xc8, 0xe3, 0xf0, 0xb2, 0xe8,
-  0xdb, 0xbb, 0xfa, 0x21, 0xeb, 0x21, 0x99, 0xd5, 0x7c, 0x1d, 0xb1, 0xf8,
-  0x27, 0xd1, 0xdf, 0xf9, 0x11, 0xc2, 0x7f, 0x52, 0x00, 0x07, 0x5a, 0x12,
-  0xab, 0xfa, 0x18, 0x02, 0x4f, 0xe5, 0x27, 0xfc, 0xb7, 0xe1, 0x06, 0xe0,
-  0xc2, 0x32, 0x5a, 0x4c, 0xa6, 0x2e, 0xaf, 0xa6, 0x46, 0x07, 0xff, 0xd8,
-  0x10, 0xed, 0x1b, 0x54, 0x32, 0x15, 0xc3, 0xe7, 0x91, 0x55, 0xd5, 0xd7,
-  0x7c, 0xc0, 0x34, 0xb5, 0x6e, 0xa7, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x3d, 0x01, 0x00, 0x00, 0x52, 0xd5, 0xff, 0xff,
-  0x81, 0x01, 0x00, 0x00, 0x0c, 0xe7, 0xff, 0xff, 0x79, 0xf1, 0xff, 0xff,
-  0xec, 0xc4, 0xff, 0xff, 0xc2, 0xfe, 0xff, 0xff, 0x7c, 0x00, 0x00, 0x00,
-  0x33, 0xe7, 0xff, 0xff, 0x0f, 0x0e, 0x00, 0x00, 0x46, 0xfd, 0xff, 0xff,
-  0xea, 0xed, 0xff, 0xff, 0x65, 0x03, 0x00, 0x00, 0x08, 0x05, 0x00, 0x00,
-  0xee, 0x00, 0x00, 0x00, 0xb7, 0xfc, 0xff, 0xff, 0xba, 0xa7, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x05, 0x03, 0x16, 0xfa,
-  0x12, 0xf6, 0xff, 0xe5, 0xfa, 0x13, 0x1b, 0xea, 0x11, 0xfb, 0x10, 0xf8,
-  0x02, 0x23, 0x21, 0xfe, 0x03, 0x05, 0x06, 0xe7, 0xf8, 0x16, 0x0b, 0xdd,
-  0x18, 0xff, 0x14, 0xda, 0x09, 0xf7, 0x1f, 0x06, 0x05, 0xfb, 0x06, 0xdb,
-  0xf7, 0xff, 0x05, 0x03, 0x1f, 0xf2, 0x17, 0xfb, 0x04, 0x08, 0x1a, 0xfd,
-  0x02, 0x06, 0x08, 0xcf, 0x0d, 0x12, 0x02, 0xe2, 0x20, 0xf2, 0x12, 0xf5,
-  0x02, 0x1b, 0x07, 0x0d, 0x0a, 0x04, 0x04, 0x81, 0x09, 0x19, 0x19, 0xdf,
-  0x2c, 0xcb, 0x30, 0xdb, 0x01, 0xfe, 0x03, 0xf7, 0xf9, 0x0a, 0x1a, 0xa2,
-  0x13, 0x08, 0x21, 0x02, 0x1e, 0xc5, 0x09, 0xef, 0xfe, 0xf7, 0xfc, 0x1c,
-  0x07, 0xfa, 0x10, 0xd9, 0x0c, 0xff, 0x12, 0xf5, 0x23, 0xf6, 0x10, 0xed,
-  0x17, 0xfe, 0x02, 0x04, 0x09, 0x03, 0x02, 0xb7, 0xfe, 0x08, 0x09, 0x08,
-  0x44, 0xef, 0x27, 0xf4, 0xfd, 0xfc, 0x0c, 0x11, 0x0a, 0x0a, 0xf9, 0xdb,
-  0x0d, 0xfa, 0x09, 0x0f, 0x12, 0x03, 0x2d, 0x11, 0x1b, 0x56, 0x6e, 0x20,
-  0x2c, 0x16, 0x24, 0x50, 0x1b, 0x1a, 0x06, 0xd7, 0xed, 0xff, 0x10, 0x47,
-  0x2b, 0x0b, 0x78, 0x27, 0x25, 0xed, 0x0e, 0x4c, 0x36, 0x0b, 0xf3, 0xf6,
-  0xd2, 0xdd, 0xd1, 0x30, 0x1a, 0x1b, 0x18, 0x45, 0x1a, 0x09, 0x44, 0x13,
-  0x3c, 0xd8, 0xe6, 0x1f, 0xf7, 0xf3, 0xd8, 0x7f, 0x47, 0x62, 0x56, 0xf3,
-  0x02, 0x1a, 0x40, 0x26, 0x32, 0xfe, 0xe1, 0xe6, 0xfe, 0xdf, 0xcf, 0x1d,
-  0x6e, 0xf6, 0x4e, 0x17, 0x30, 0xfd, 0x13, 0xec, 0x39, 0xfe, 0xff, 0xcd,
-  0xe3, 0xa8, 0x01, 0x45, 0x28, 0xf4, 0x69, 0x14, 0x18, 0xfe, 0xf9, 0x50,
-  0x3e, 0xf3, 0xd7, 0x12, 0x0b, 0x04, 0xc5, 0x39, 0x30, 0x11, 0x51, 0xeb,
-  0x3c, 0x09, 0xf7, 0x06, 0x21, 0x01, 0xed, 0x18, 0xd5, 0xdb, 0xdf, 0x2d,
-  0x45, 0x22, 0x28, 0x15, 0xfa, 0x24, 0x2f, 0xd3, 0x41, 0xd4, 0x01, 0xd8,
-  0xbb, 0xdd, 0xf2, 0x05, 0x22, 0x1e, 0x61, 0x45, 0x0b, 0x17, 0x2d, 0x2c,
-  0x34, 0xd6, 0xdd, 0xf2, 0xfe, 0xe7, 0xeb, 0x2f, 0x19, 0x27, 0x45, 0x18,
-  0xef, 0xf1, 0xea, 0xe0, 0x19, 0x0e, 0xdf, 0xb1, 0x31, 0xa1, 0x01, 0x12,
-  0x2a, 0xdf, 0x2c, 0x0a, 0xfe, 0x1e, 0xf2, 0xc2, 0xf6, 0x10, 0xdc, 0xdd,
-  0x03, 0x81, 0xe7, 0x23, 0x23, 0x09, 0x2f, 0x04, 0x04, 0x0e, 0x03, 0xb8,
-  0x11, 0x14, 0xfe, 0xd6, 0x0a, 0xa0, 0x02, 0x1e, 0x42, 0x1b, 0x55, 0x05,
-  0x0e, 0x02, 0x25, 0x2b, 0x03, 0xf6, 0x05, 0xe5, 0x20, 0xea, 0xfb, 0x40,
-  0x22, 0xfa, 0x4c, 0x00, 0x0b, 0x03, 0x08, 0xea, 0x07, 0xf5, 0x02, 0xee,
-  0x2c, 0xf4, 0x24, 0x32, 0x1d, 0xfc, 0x34, 0xfc, 0x1c, 0xf9, 0x02, 0x3d,
-  0x31, 0x0b, 0x07, 0xc4, 0x22, 0xce, 0x26, 0x23, 0x39, 0x0b, 0x59, 0x06,
-  0x19, 0xfc, 0x21, 0x0f, 0x0b, 0x08, 0xda, 0x04, 0x1c, 0x04, 0x02, 0x16,
-  0x25, 0xfe, 0x47, 0xe7, 0x1c, 0x06, 0x25, 0xfb, 0x20, 0x10, 0xfa, 0xfc,
-  0x0d, 0xcd, 0x05, 0x1a, 0x01, 0xc0, 0x2d, 0x19, 0xfd, 0x08, 0x1d, 0xd8,
-  0xff, 0x09, 0xeb, 0xf2, 0x1e, 0xf0, 0xed, 0xfc, 0x3b, 0x53, 0x2e, 0x44,
-  0x48, 0xe9, 0x38, 0x60, 0x52, 0xf6, 0xe9, 0x0f, 0xe1, 0xf7, 0xf5, 0x71,
-  0x11, 0xe1, 0x2f, 0x45, 0x33, 0x10, 0x05, 0x2c, 0x3c, 0xd2, 0xe9, 0x21,
-  0xdd, 0x06, 0xed, 0x59, 0x13, 0xd6, 0x29, 0x4b, 0x4a, 0x15, 0x18, 0x32,
-  0x1d, 0xed, 0xdd, 0x3b, 0xde, 0x1d, 0xfd, 0x49, 0x39, 0x43, 0x23, 0x09,
-  0x01, 0x0a, 0x1f, 0x43, 0x18, 0xe5, 0xf0, 0x04, 0xcb, 0x08, 0x06, 0x2f,
-  0xfa, 0xdf, 0x09, 0x1f, 0x14, 0xff, 0x04, 0x7f, 0x2c, 0xc1, 0xfb, 0xe7,
-  0xfa, 0xbf, 0x08, 0x11, 0xff, 0xe7, 0xf7, 0x33, 0x00, 0x14, 0x15, 0x67,
-  0x09, 0xc9, 0x13, 0x1e, 0xde, 0x33, 0xe9, 0x23, 0x2a, 0x01, 0x2d, 0x04,
-  0xfa, 0x14, 0x08, 0x13, 0x24, 0xcf, 0xd3, 0xf2, 0xc5, 0xf0, 0xef, 0x24,
-  0x27, 0xee, 0x3e, 0x15, 0xfa, 0x07, 0x05, 0x4c, 0x14, 0xda, 0xd5, 0x15,
-  0xdd, 0x00, 0x0e, 0x26, 0x20, 0xb7, 0x29, 0x2d, 0x14, 0xfb, 0xfd, 0x4c,
-  0x0b, 0xd4, 0xea, 0x02, 0xf7, 0x5b, 0xfd, 0x3b, 0x02, 0x01, 0xd8, 0xda,
-  0xec, 0x04, 0x09, 0xb4, 0xdf, 0x04, 0xa6, 0xee, 0xb1, 0xf5, 0xbc, 0xee,
-  0xde, 0x0f, 0xb5, 0xe0, 0xe4, 0x10, 0xe0, 0x93, 0xe2, 0xfa, 0xa9, 0xe5,
-  0x81, 0xfa, 0x9a, 0xab, 0x0a, 0xfe, 0x0d, 0xca, 0x08, 0x0c, 0xf0, 0xe1,
-  0xfa, 0x01, 0xd2, 0x17, 0x15, 0xe6, 0x9b, 0x09, 0xf3, 0xf9, 0x08, 0x02,
-  0x14, 0xf4, 0xfc, 0xef, 0x09, 0xf7, 0xf5, 0xf1, 0xe4, 0x0a, 0x06, 0x14,
-  0xf5, 0xf6, 0xda, 0xf6, 0xff, 0xf3, 0x03, 0xfa, 0x10, 0xe7, 0xf1, 0x12,
-  0xdf, 0x0b, 0xfd, 0xf3, 0x0b, 0x02, 0x13, 0x02, 0x08, 0x03, 0x07, 0xe3,
-  0xf5, 0xe9, 0x1d, 0x15, 0x19, 0x09, 0xf7, 0xfa, 0xed, 0x11, 0xd6, 0xfc,
-  0xe9, 0xff, 0xec, 0xcd, 0xf4, 0xf9, 0x97, 0xe1, 0xb0, 0x0e, 0xc0, 0xfc,
-  0xfe, 0xf0, 0x99, 0xce, 0xbe, 0xed, 0xee, 0xc6, 0xfa, 0xf3, 0xb3, 0xf5,
-  0x8f, 0xff, 0x98, 0xb0, 0xfd, 0xfc, 0xf2, 0xe5, 0xfd, 0x10, 0xf8, 0xd0,
-  0x11, 0xf1, 0xd4, 0x04, 0xf6, 0xfc, 0xc3, 0xe9, 0x19, 0x03, 0xee, 0x01,
-  0xee, 0x19, 0xf4, 0xb7, 0xf9, 0x09, 0xc6, 0xe3, 0xba, 0xfc, 0xbd, 0x09,
-  0x0d, 0xfd, 0xc7, 0xf8, 0xee, 0x08, 0x0c, 0xbc, 0xea, 0x10, 0xb1, 0xea,
-  0x96, 0xf5, 0x8b, 0xa9, 0x1f, 0xf3, 0xfe, 0xee, 0x04, 0x0d, 0xf7, 0xd1,
-  0x0e, 0x00, 0xea, 0xfc, 0x04, 0xe5, 0x87, 0xf2, 0xf3, 0xf3, 0xf8, 0xeb,
-  0x09, 0x15, 0x16, 0xeb, 0x08, 0x16, 0xd2, 0x04, 0xdb, 0x03, 0xf4, 0xf3,
-  0xf0, 0x0a, 0xd9, 0xde, 0xdd, 0x13, 0x12, 0xfc, 0x10, 0x0c, 0xc3, 0xf4,
-  0xbd, 0x01, 0xeb, 0xd0, 0x1c, 0xf5, 0x04, 0xe2, 0xec, 0x09, 0xf1, 0xfd,
-  0xfe, 0x0d, 0xec, 0x17, 0x02, 0xfa, 0xf2, 0xf7, 0x06, 0xed, 0xf4, 0xf3,
-  0xe5, 0x07, 0x07, 0xb5, 0xed, 0x13, 0xb3, 0xd5, 0xa0, 0x17, 0xc2, 0xed,
-  0x05, 0xfe, 0xd5, 0xdc, 0xd7, 0xf3, 0xfc, 0xec, 0xe8, 0x0c, 0x91, 0xfc,
-  0x8f, 0x0b, 0x81, 0xad, 0xf6, 0x07, 0xee, 0xe3, 0xef, 0x0f, 0xeb, 0xdb,
-  0xef, 0xef, 0xba, 0xfd, 0xe4, 0xf7, 0x92, 0xf0, 0x36, 0x1d, 0x10, 0x0e,
-  0x1b, 0xe6, 0x1f, 0x2e, 0x32, 0xf3, 0xe9, 0x0d, 0xed, 0x02, 0xe1, 0x18,
-  0x0b, 0x3b, 0x3d, 0xfb, 0x02, 0xf9, 0x0b, 0xf8, 0x26, 0xd5, 0xdb, 0x01,
-  0xdd, 0xf0, 0xe8, 0x37, 0x16, 0xe7, 0x0c, 0x1b, 0x20, 0x13, 0xfe, 0x1e,
-  0x28, 0xda, 0x00, 0x12, 0xfb, 0x1e, 0xfd, 0x6a, 0x2f, 0x09, 0x3b, 0xff,
-  0x06, 0xe6, 0x0c, 0x70, 0x05, 0x01, 0xf1, 0xff, 0xd3, 0xe9, 0xff, 0x2c,
-  0x3d, 0xf8, 0x53, 0x29, 0x21, 0xe2, 0x23, 0x4c, 0x22, 0xf0, 0xea, 0xe3,
-  0x01, 0xd0, 0xd8, 0x24, 0x21, 0xd8, 0x2c, 0x3f, 0x27, 0x13, 0x03, 0x7f,
-  0x22, 0xd4, 0xf1, 0x14, 0xe7, 0x02, 0xe5, 0x52, 0x16, 0x25, 0x53, 0x22,
-  0x13, 0xfe, 0x02, 0xd5, 0x21, 0xf8, 0xfb, 0x00, 0xe1, 0xf4, 0xf4, 0x2c,
-  0x4a, 0xfc, 0x4a, 0x10, 0x2d, 0x19, 0xfd, 0x1d, 0x31, 0xfd, 0xd6, 0x15,
-  0xec, 0xd5, 0xf6, 0x2c, 0x2c, 0x04, 0x13, 0x0b, 0x2a, 0x02, 0x11, 0x21,
-  0x24, 0x02, 0xe6, 0xff, 0xfd, 0xf6, 0xf5, 0x32, 0x0b, 0xd9, 0xfe, 0x1b,
-  0x03, 0x10, 0xfa, 0xf4, 0xfe, 0xe3, 0xfb, 0x26, 0xe4, 0x22, 0xf0, 0x29,
-  0x02, 0xb7, 0x10, 0x10, 0xe8, 0x13, 0x0f, 0x0d, 0x0d, 0xf5, 0xe3, 0x1d,
-  0xe4, 0x13, 0xff, 0x35, 0xf7, 0xd3, 0xe4, 0x1d, 0x0a, 0x0f, 0x02, 0x1c,
-  0x01, 0xeb, 0x03, 0x0b, 0xf5, 0x1a, 0xed, 0x2e, 0x20, 0x09, 0x2b, 0x31,
-  0x0d, 0x01, 0x16, 0x5f, 0x21, 0xe7, 0x01, 0x35, 0xe7, 0xfe, 0xfb, 0x2a,
-  0xf2, 0xc5, 0xfe, 0x15, 0x11, 0xe9, 0x18, 0x65, 0x03, 0xf7, 0x19, 0x03,
-  0xf3, 0x0d, 0xf2, 0x20, 0x0d, 0xf5, 0x11, 0x2a, 0x24, 0xf9, 0x04, 0x4e,
-  0x08, 0xe2, 0x11, 0x22, 0xfc, 0x14, 0xe8, 0x24, 0x26, 0xf3, 0x18, 0x33,
-  0x05, 0x18, 0xff, 0x47, 0x2b, 0xfa, 0xe8, 0x12, 0x09, 0x17, 0xe8, 0x1c,
-  0x06, 0xe1, 0x06, 0x13, 0x21, 0xf8, 0xed, 0x7f, 0x08, 0xf9, 0xfd, 0x1d,
-  0xf7, 0x1a, 0x01, 0x25, 0x0f, 0xe3, 0x13, 0x19, 0xfe, 0xe9, 0xf8, 0x6a,
-  0xf6, 0xf9, 0x07, 0x12, 0xeb, 0x66, 0xfa, 0x10, 0x98, 0x1a, 0xbf, 0xf8,
-  0xf9, 0x02, 0x0b, 0xdd, 0x0a, 0x27, 0x4a, 0x10, 0x22, 0x20, 0x14, 0xca,
-  0x00, 0x10, 0xe0, 0x02, 0x00, 0x0b, 0xf4, 0x05, 0x17, 0xeb, 0x27, 0x40,
-  0x1f, 0x69, 0x16, 0x06, 0x9b, 0xc6, 0xbe, 0x02, 0xdb, 0x15, 0xf6, 0x0c,
-  0xeb, 0x02, 0x32, 0x42, 0x20, 0x2a, 0xf8, 0xd6, 0xa5, 0x0d, 0xd2, 0xe7,
-  0xf2, 0xe3, 0x12, 0x1f, 0x0d, 0xed, 0x47, 0xee, 0x1e, 0x1f, 0x2b, 0xa9,
-  0xf8, 0x0f, 0xfc, 0xf3, 0x04, 0xfa, 0xf1, 0x40, 0x14, 0xf4, 0x2f, 0x38,
-  0x33, 0x36, 0x01, 0x01, 0x9e, 0xd2, 0xd0, 0xef, 0xf1, 0x05, 0xf6, 0x34,
-  0xe4, 0xfb, 0x40, 0x04, 0x09, 0x3e, 0x16, 0xb7, 0xd0, 0x21, 0xcd, 0xf0,
-  0x1b, 0x00, 0xee, 0x33, 0x03, 0x0e, 0x30, 0xf2, 0x37, 0x1b, 0x10, 0xc3,
-  0xf9, 0x06, 0xfa, 0x07, 0xdf, 0x0f, 0xf7, 0xf0, 0x15, 0xfe, 0x3b, 0x27,
-  0x27, 0x7f, 0x22, 0xe3, 0x99, 0xde, 0xbb, 0xe7, 0xef, 0xf6, 0x11, 0x31,
-  0xd7, 0x04, 0x23, 0x02, 0x14, 0x52, 0x07, 0xbb, 0x09, 0xe8, 0xfc, 0xfe,
-  0x10, 0xf3, 0x05, 0x06, 0x22, 0xf4, 0x00, 0x10, 0xe8, 0x20, 0xdb, 0x44,
-  0x02, 0xc6, 0x13, 0xff, 0x01, 0xff, 0x05, 0x2b, 0x00, 0xde, 0xe3, 0x0e,
-  0xd4, 0xea, 0xf9, 0x3b, 0xff, 0xe8, 0x17, 0x09, 0x00, 0xfb, 0x0a, 0xf8,
-  0x19, 0xeb, 0xe6, 0x06, 0xd8, 0x1a, 0xff, 0x34, 0x34, 0xf0, 0x23, 0x04,
-  0x05, 0x14, 0xfb, 0x5f, 0x15, 0xf0, 0xeb, 0x2a, 0xeb, 0x13, 0xe9, 0x57,
-  0x24, 0xa8, 0x24, 0x1d, 0x00, 0xf9, 0x05, 0x30, 0x1f, 0xf1, 0xfd, 0xfc,
-  0xd0, 0xd0, 0x04, 0x2b, 0x1c, 0xd2, 0x10, 0x21, 0x1b, 0x1d, 0xf6, 0x4a,
-  0xfa, 0xf0, 0xf0, 0x0e, 0xf1, 0x0b, 0x07, 0x2f, 0x39, 0xf1, 0x2c, 0x01,
-  0x23, 0x17, 0x18, 0x58, 0x20, 0xdd, 0xe1, 0x10, 0xe0, 0x05, 0xf2, 0x39,
-  0xfe, 0xbf, 0x0f, 0x16, 0x1a, 0x15, 0x0d, 0x6d, 0x26, 0xd5, 0x06, 0xf8,
-  0xec, 0xe8, 0xf6, 0x37, 0x04, 0xdc, 0x17, 0x2d, 0xf7, 0x05, 0x0a, 0x7f,
-  0x0b, 0xe2, 0xfc, 0x06, 0xf3, 0x0c, 0xf4, 0x31, 0xf3, 0xcf, 0x2f, 0x10,
-  0x16, 0x44, 0x98, 0xed, 0x20, 0x10, 0xfb, 0x47, 0x02, 0x45, 0xc9, 0x2e,
-  0xc4, 0xe6, 0xfe, 0x32, 0xbc, 0xbc, 0xd0, 0x90, 0x01, 0xdb, 0xbc, 0xd4,
-  0x15, 0xdb, 0x9e, 0xd4, 0x0f, 0xcb, 0x29, 0x25, 0xbd, 0x0a, 0x00, 0x1c,
-  0xd9, 0x21, 0x37, 0xaf, 0x03, 0xe2, 0xd2, 0x36, 0xa1, 0xc3, 0xaf, 0x03,
-  0xa9, 0x14, 0x1f, 0xb8, 0xbb, 0xf8, 0x0b, 0xa0, 0xed, 0x10, 0xfc, 0xb6,
-  0xeb, 0xe8, 0xe3, 0x93, 0xba, 0x10, 0x96, 0x19, 0xf7, 0x51, 0x03, 0xa8,
-  0xf3, 0x46, 0xd2, 0xa5, 0x37, 0x42, 0xc9, 0xac, 0x02, 0x5c, 0x11, 0xd1,
-  0x9c, 0xf5, 0xec, 0x90, 0xbf, 0x28, 0xb9, 0x2f, 0x2b, 0xcf, 0xc3, 0x10,
-  0xbe, 0x45, 0xde, 0x55, 0xe2, 0xf3, 0xf2, 0x33, 0x0f, 0x60, 0xe4, 0xc3,
-  0xcb, 0xad, 0xeb, 0xfa, 0x8c, 0x48, 0xb4, 0xac, 0xa2, 0x25, 0x81, 0xd4,
-  0x91, 0xe4, 0x9b, 0xb4, 0x08, 0xc5, 0x22, 0x04, 0x9b, 0x2f, 0xd3, 0xb1,
-  0xe2, 0xaf, 0xb8, 0xe7, 0xf7, 0x48, 0xcf, 0x03, 0xc2, 0x04, 0xb0, 0xbe,
-  0xa3, 0xd2, 0x1c, 0x86, 0x26, 0xfb, 0x29, 0x15, 0xaa, 0x21, 0x11, 0x8c,
-  0x09, 0x24, 0xfd, 0xcb, 0xe1, 0x24, 0xf3, 0x81, 0x25, 0xf3, 0xb3, 0xed,
-  0x9d, 0xe7, 0xde, 0xb2, 0xf1, 0x07, 0x25, 0x15, 0xfe, 0xcf, 0xc5, 0xb4,
-  0xe6, 0xf5, 0xd1, 0xe9, 0x20, 0xf7, 0xb9, 0x11, 0xb9, 0x1c, 0x17, 0x05,
-  0x05, 0xfc, 0xce, 0x15, 0xe1, 0xc9, 0x2d, 0xda, 0x0d, 0x0d, 0xe5, 0x18,
-  0x15, 0x01, 0xf9, 0x1e, 0xe8, 0x01, 0xf0, 0x52, 0xf2, 0xf1, 0x05, 0x34,
-  0xd5, 0x17, 0xd7, 0xbb, 0x08, 0x2c, 0xd2, 0x26, 0x2a, 0x26, 0xd2, 0x2a,
-  0xb6, 0x0f, 0xf4, 0x05, 0x2a, 0xe2, 0x02, 0xbc, 0x19, 0x11, 0x06, 0xa2,
-  0xe9, 0xe1, 0xb6, 0x29, 0x1c, 0xd2, 0x3e, 0x28, 0xc3, 0x20, 0x00, 0xd6,
-  0xdd, 0x4d, 0xcd, 0xab, 0xdc, 0xd6, 0xfb, 0x3e, 0xe1, 0x16, 0xec, 0xe7,
-  0xcc, 0xcb, 0x38, 0xf5, 0xb8, 0x3d, 0xca, 0x9a, 0x28, 0xdc, 0xbd, 0x2c,
-  0xfe, 0x1d, 0x21, 0x27, 0xe1, 0xe0, 0x30, 0x04, 0xec, 0x01, 0x13, 0xf5,
-  0xf3, 0x15, 0x13, 0xe6, 0xea, 0x0e, 0x2d, 0xcf, 0x26, 0x1c, 0x0a, 0xee,
-  0x01, 0x10, 0xff, 0x0e, 0x03, 0xea, 0x0e, 0xe3, 0x0c, 0x20, 0x3e, 0xc6,
-  0x28, 0xee, 0x39, 0xd7, 0x12, 0x16, 0x24, 0xf8, 0x1d, 0x15, 0x06, 0xf6,
-  0x06, 0x05, 0x29, 0x02, 0x18, 0xfc, 0x20, 0x02, 0x00, 0xff, 0xe3, 0xfe,
-  0x0d, 0xf0, 0x03, 0xc3, 0xf9, 0x0e, 0x34, 0x11, 0x11, 0xea, 0x30, 0xf9,
-  0xe1, 0xfc, 0xfb, 0x18, 0xf6, 0x04, 0x10, 0x81, 0x15, 0x29, 0x3c, 0xea,
-  0x47, 0xee, 0x42, 0xe9, 0x13, 0x02, 0x07, 0x09, 0xf3, 0x0e, 0xf7, 0xa7,
-  0x0d, 0x20, 0x33, 0x0b, 0x11, 0xe7, 0x42, 0xf6, 0xea, 0x42, 0xff, 0x0a,
-  0x01, 0xee, 0xfb, 0xd3, 0xe8, 0x43, 0x3e, 0xde, 0x47, 0xe2, 0x3d, 0xd0,
-  0x09, 0x1a, 0x05, 0xfb, 0xf3, 0x15, 0x10, 0x8e, 0x00, 0x1f, 0x21, 0xc5,
-  0x44, 0xb7, 0x41, 0xb5, 0x04, 0x02, 0x04, 0xe9, 0x0c, 0x14, 0x00, 0xc6,
-  0x08, 0x05, 0x25, 0xee, 0x27, 0xd9, 0x21, 0xfc, 0xe7, 0x10, 0x07, 0x2b,
-  0x13, 0xf8, 0x22, 0xf2, 0x15, 0x2b, 0x29, 0xea, 0x5d, 0xea, 0x4d, 0xfe,
-  0xe9, 0x12, 0x15, 0xff, 0xf0, 0xfd, 0x05, 0xb5, 0xf9, 0x34, 0x24, 0xd7,
-  0x51, 0xd0, 0x31, 0xcc, 0xe7, 0xe3, 0xe3, 0xf8, 0xe1, 0x0b, 0xea, 0xb9,
-  0xd6, 0x16, 0x10, 0xbf, 0x37, 0xe1, 0x17, 0xb2, 0xf7, 0xfb, 0xf8, 0x19,
-  0x09, 0x03, 0x15, 0xe7, 0x16, 0xfc, 0x3e, 0x22, 0x4d, 0xfd, 0x2c, 0xeb,
-  0xe9, 0xeb, 0xeb, 0xf3, 0x00, 0xef, 0x05, 0x99, 0x0d, 0x11, 0x35, 0xe1,
-  0x51, 0xe9, 0x30, 0xb7, 0xfb, 0xf1, 0xf8, 0xea, 0xf0, 0x00, 0xe7, 0x81,
-  0xec, 0x30, 0x04, 0xe2, 0x37, 0xd9, 0x38, 0xd4, 0x13, 0xf3, 0xe9, 0x13,
-  0x0b, 0x14, 0x10, 0xe0, 0xfb, 0xf1, 0x1a, 0x0b, 0x54, 0x00, 0x30, 0x22,
-  0xe7, 0xe8, 0xe2, 0x03, 0xec, 0x03, 0x09, 0xc9, 0xe5, 0x00, 0x13, 0xfc,
-  0x35, 0x03, 0x35, 0x08, 0x06, 0xcd, 0xef, 0x0d, 0x0d, 0xf6, 0xf1, 0xc6,
-  0xff, 0x15, 0xfc, 0xf3, 0x13, 0x12, 0x0c, 0x05, 0x2f, 0x0f, 0x32, 0x05,
-  0x00, 0xfe, 0xf6, 0x10, 0x1c, 0x0a, 0x01, 0x01, 0xfe, 0x0a, 0xfe, 0x49,
-  0x30, 0xfc, 0x25, 0x0c, 0x19, 0x12, 0xf9, 0x02, 0x1e, 0xec, 0xf2, 0xeb,
-  0xe5, 0x0e, 0xe5, 0x50, 0x3c, 0xdd, 0x40, 0x24, 0xfe, 0x02, 0x0e, 0x18,
-  0xff, 0xfe, 0xea, 0x0d, 0xee, 0xfb, 0x08, 0x35, 0x40, 0xf9, 0x38, 0x0d,
-  0x07, 0x0b, 0x08, 0x05, 0xf9, 0xf8, 0xf5, 0xf6, 0x01, 0xf6, 0xe9, 0x2d,
-  0x1a, 0xe0, 0x0c, 0xf4, 0x0b, 0x07, 0x1b, 0x1a, 0x15, 0xf0, 0xf1, 0x0d,
-  0xe8, 0xda, 0xf2, 0x2f, 0x28, 0x92, 0x24, 0xf3, 0xf2, 0x0e, 0x00, 0x26,
-  0x0e, 0xe2, 0xe4, 0x09, 0xf0, 0xfc, 0xfb, 0x2e, 0x1b, 0xe9, 0x15, 0x0a,
-  0xf2, 0xfb, 0xec, 0x5a, 0x03, 0xf1, 0xf0, 0x01, 0xef, 0xeb, 0xf7, 0x26,
-  0x1f, 0xc8, 0x16, 0x11, 0x0d, 0x02, 0xf2, 0x56, 0xfe, 0xe2, 0xf0, 0xf3,
-  0xf2, 0xfe, 0xe0, 0x11, 0x2f, 0x99, 0x3a, 0x14, 0x15, 0xed, 0x15, 0x7f,
-  0x0e, 0xe8, 0xe6, 0xed, 0xea, 0xfd, 0xe2, 0x2d, 0x0f, 0xc2, 0x14, 0xee,
-  0xf7, 0x0a, 0x11, 0x1b, 0xf5, 0x0c, 0xdc, 0xf6, 0xf7, 0xfd, 0xfa, 0x35,
-  0x17, 0xd8, 0x0a, 0xe8, 0xfa, 0xf1, 0x01, 0xff, 0xfd, 0xf0, 0xef, 0xfe,
-  0xec, 0xf8, 0x07, 0x20, 0x24, 0xdb, 0x2b, 0x06, 0xf4, 0x07, 0xfb, 0x12,
-  0x0b, 0xf8, 0x00, 0x10, 0xf5, 0x19, 0xe3, 0x53, 0x2b, 0xe9, 0x2e, 0xed,
-  0x04, 0xfa, 0x0d, 0x3f, 0x0c, 0xfd, 0xfd, 0x0b, 0xf5, 0xfc, 0xea, 0x2e,
-  0x0e, 0xd9, 0x18, 0xf7, 0x04, 0x02, 0xfe, 0x22, 0x1f, 0xf1, 0xf1, 0xf2,
-  0xee, 0xea, 0xf3, 0x3e, 0x29, 0xea, 0x40, 0x1c, 0x07, 0x11, 0x19, 0x4e,
-  0x11, 0xf8, 0xed, 0x15, 0xfb, 0x12, 0xe0, 0x45, 0x15, 0xec, 0x15, 0x0b,
-  0x04, 0xff, 0xff, 0x44, 0x0a, 0x06, 0xe7, 0x1b, 0x02, 0xec, 0xe2, 0x1d,
-  0x1d, 0xd9, 0x28, 0xff, 0x00, 0xf4, 0x13, 0x4d, 0x11, 0xe5, 0xf1, 0x08,
-  0xf8, 0xdc, 0xe1, 0x2c, 0x33, 0xd1, 0x27, 0x13, 0x04, 0x10, 0xf3, 0x7f,
-  0x19, 0xfb, 0xe8, 0x1b, 0xf9, 0xff, 0x02, 0x2e, 0xe9, 0x02, 0xda, 0xea,
-  0xfb, 0x1a, 0xe9, 0xc3, 0xd2, 0x06, 0xb6, 0xe8, 0x92, 0x00, 0xea, 0x02,
-  0xf2, 0xe2, 0xeb, 0xe9, 0xfc, 0x10, 0x03, 0xc9, 0xed, 0x00, 0xd1, 0x07,
-  0xda, 0xda, 0xab, 0xe4, 0xdb, 0x06, 0xb0, 0xd2, 0xbd, 0xf8, 0xee, 0xb7,
-  0xc6, 0x07, 0xaf, 0xe2, 0x87, 0xed, 0x81, 0xe1, 0x00, 0xf5, 0xe1, 0xe6,
-  0xe2, 0x15, 0x17, 0x02, 0xe9, 0x19, 0xcf, 0xdd, 0xc5, 0xfb, 0xfd, 0xfe,
-  0x11, 0x12, 0x02, 0xd6, 0x05, 0x11, 0x14, 0x1a, 0xfc, 0xff, 0xec, 0xf0,
-  0xf5, 0x10, 0xda, 0xec, 0xef, 0xfe, 0xaa, 0xcf, 0xc6, 0x15, 0xfe, 0x10,
-  0xf8, 0xfa, 0xb2, 0xdf, 0xb8, 0xf4, 0xe8, 0xd5, 0xff, 0xef, 0xea, 0xeb,
-  0xf4, 0xf7, 0xf1, 0xa3, 0xeb, 0x07, 0xc8, 0x08, 0xb8, 0xf1, 0xf0, 0xfd,
-  0xf9, 0x03, 0x08, 0xda, 0xeb, 0x17, 0xf4, 0xbc, 0xf7, 0xfc, 0xdd, 0x13,
-  0xf7, 0xdf, 0xa7, 0xfd, 0xed, 0x05, 0xb0, 0xd6, 0xc8, 0x05, 0xe5, 0xaf,
-  0xd5, 0xf1, 0xb0, 0xe7, 0x82, 0xf9, 0x9f, 0xdb, 0xd3, 0x10, 0xe6, 0x28,
-  0xe9, 0x0e, 0x15, 0xa4, 0xf6, 0x0b, 0x40, 0xe0, 0x2a, 0x0a, 0x2f, 0xcb,
-  0xdb, 0xed, 0xed, 0xe4, 0x06, 0xfa, 0x18, 0x93, 0xdf, 0xfd, 0x0c, 0x08,
-  0x16, 0xe6, 0x0f, 0xb2, 0x01, 0x1e, 0xf0, 0xf2, 0xe7, 0xdc, 0x09, 0xe1,
-  0xf0, 0x2b, 0x34, 0x03, 0x0a, 0x06, 0x0c, 0xde, 0xdd, 0xf3, 0xf5, 0x05,
-  0x1f, 0xff, 0x2b, 0xd1, 0xf6, 0x0c, 0x46, 0xf7, 0x30, 0x1f, 0x44, 0xd7,
-  0xd3, 0x12, 0xdc, 0x13, 0xf8, 0x0c, 0x21, 0xa9, 0xed, 0x12, 0x51, 0xd3,
-  0x2e, 0x13, 0x3b, 0xb1, 0x0e, 0xf1, 0xe2, 0xde, 0xeb, 0xfd, 0x15, 0xc8,
-  0x01, 0x1c, 0x1c, 0x02, 0x26, 0x17, 0x17, 0xd3, 0xfd, 0x1c, 0x17, 0x18,
-  0xec, 0xf8, 0x15, 0xa3, 0xe5, 0x39, 0x49, 0xc3, 0x7f, 0xd9, 0x67, 0xbe,
-  0x09, 0x12, 0x2a, 0xf6, 0x09, 0x16, 0x1f, 0x84, 0x02, 0x42, 0x2f, 0xe4,
-  0x3b, 0xdd, 0x58, 0x86, 0xee, 0x30, 0xf4, 0x1a, 0x02, 0xf2, 0x07, 0xd5,
-  0x0f, 0x1b, 0x21, 0xcc, 0x2c, 0xbd, 0x31, 0xde, 0xe7, 0xf1, 0xe2, 0xe6,
-  0xfd, 0xed, 0x08, 0x81, 0xf4, 0xea, 0xfe, 0xe4, 0xc3, 0x00, 0xfc, 0xe5,
-  0x01, 0x01, 0xfe, 0x0f, 0x06, 0x08, 0xfc, 0xe5, 0xea, 0xe7, 0xf9, 0xff,
-  0x03, 0xe9, 0xc7, 0x09, 0xde, 0xe1, 0xc8, 0x05, 0x09, 0xfc, 0xf1, 0xd4,
-  0xd9, 0xdd, 0xdf, 0xf2, 0x81, 0x11, 0xce, 0xda, 0xf8, 0xff, 0xe1, 0xf3,
-  0xf3, 0xf7, 0x02, 0xe4, 0xea, 0x18, 0x10, 0xdc, 0xcf, 0x18, 0xf9, 0xea,
-  0xf8, 0x0c, 0x0c, 0xe8, 0x02, 0x00, 0xf9, 0x08, 0x0c, 0xdd, 0x10, 0x0f,
-  0xf9, 0x12, 0xf3, 0x15, 0xdb, 0xcc, 0xd4, 0xec, 0xef, 0x0c, 0xf2, 0x24,
-  0xd7, 0x09, 0xd5, 0x19, 0x94, 0x13, 0xd8, 0x1c, 0x1c, 0x0f, 0x18, 0x15,
-  0x2d, 0x0b, 0x0e, 0x2c, 0x0b, 0x1c, 0x18, 0xf8, 0x16, 0x0f, 0x2e, 0x04,
-  0x12, 0x1c, 0xfb, 0x1e, 0x14, 0x11, 0x02, 0x48, 0x14, 0xf2, 0x16, 0x18,
-  0x12, 0x06, 0x21, 0x2e, 0x06, 0x03, 0x1f, 0x08, 0x30, 0x0b, 0x30, 0x70,
-  0x17, 0x0a, 0x31, 0xf6, 0xe8, 0x0c, 0x2e, 0x1e, 0xae, 0xbb, 0x9f, 0x9f,
-  0xd0, 0x2a, 0x37, 0x16, 0xb2, 0x29, 0xc4, 0x13, 0x13, 0xe3, 0x0a, 0x1d,
-  0x37, 0x28, 0x31, 0xbd, 0x19, 0xea, 0xad, 0x2b, 0x40, 0x99, 0xd8, 0x08,
-  0xdb, 0xef, 0xa3, 0x37, 0xfd, 0x0e, 0x24, 0x9c, 0xba, 0xb7, 0x19, 0xc9,
-  0x01, 0xdb, 0xd8, 0x3a, 0xe7, 0x0b, 0x05, 0xc6, 0xe2, 0xf4, 0x0e, 0x35,
-  0x8f, 0x1b, 0x01, 0x58, 0xd8, 0x11, 0xf6, 0x0b, 0x0c, 0x16, 0x1b, 0x09,
-  0xd8, 0x09, 0xe5, 0xee, 0xe5, 0xb5, 0xdc, 0x66, 0x1f, 0x29, 0xb1, 0xa3,
-  0xc5, 0xd6, 0xbd, 0xe1, 0xc2, 0xd4, 0xd4, 0x9e, 0x8b, 0xb6, 0xea, 0x2a,
-  0xaf, 0xc4, 0x3e, 0xba, 0xfe, 0xc2, 0x4b, 0xb9, 0xf6, 0xd6, 0xec, 0xf8,
-  0x01, 0x03, 0xf7, 0x03, 0xce, 0x2d, 0xfe, 0xc6, 0x97, 0xd9, 0xd5, 0x21,
-  0xb7, 0xf3, 0x29, 0x16, 0xb4, 0xbd, 0xd9, 0x0a, 0x03, 0xf1, 0xbe, 0xdd,
-  0x40, 0x1f, 0x92, 0xfe, 0x01, 0xab, 0x21, 0xed, 0x81, 0xd4, 0xeb, 0xcb,
-  0x23, 0x26, 0x05, 0xe6, 0x13, 0x38, 0x0b, 0x0c, 0x2c, 0xd3, 0x1c, 0x24,
-  0x0f, 0xeb, 0x2b, 0x17, 0x26, 0xd2, 0x0b, 0x20, 0xd7, 0x0d, 0xe9, 0x62,
-  0x20, 0xed, 0x41, 0xfd, 0x2b, 0x02, 0x07, 0x34, 0x2b, 0xd0, 0x0b, 0x1a,
-  0xf6, 0x0e, 0xe6, 0x55, 0x2d, 0xba, 0x17, 0x38, 0x1b, 0x05, 0x26, 0x3d,
-  0x26, 0xcf, 0xfc, 0x3b, 0xca, 0x0e, 0x0b, 0x60, 0x20, 0xdb, 0xfc, 0xed,
-  0xf4, 0x0d, 0x03, 0x24, 0x24, 0xeb, 0xfa, 0x17, 0xc7, 0x08, 0xff, 0x4a,
-  0x42, 0xd4, 0x40, 0x16, 0x01, 0x0b, 0xf6, 0x66, 0x02, 0xd9, 0xe3, 0x18,
-  0xf6, 0xe3, 0xe0, 0x2b, 0x10, 0xaa, 0x05, 0xfe, 0x15, 0x12, 0xff, 0x66,
-  0x07, 0xcc, 0xfd, 0x0b, 0xbf, 0x38, 0x04, 0x4c, 0x1f, 0xca, 0xfb, 0x07,
-  0x1e, 0xf3, 0xe6, 0x3e, 0x0c, 0xdb, 0xd4, 0x1a, 0xe9, 0x0c, 0xe6, 0x4b,
-  0x2e, 0xea, 0x3d, 0xf6, 0x1c, 0x10, 0x09, 0x28, 0x15, 0xf4, 0xe0, 0x07,
-  0xfe, 0xf2, 0xf4, 0x08, 0x13, 0xb8, 0x03, 0xf7, 0x2e, 0x19, 0xfd, 0x7f,
-  0x1e, 0xf4, 0xdc, 0x2b, 0xf4, 0x16, 0xce, 0x27, 0xe6, 0x0c, 0xef, 0xfb,
-  0xe1, 0xf9, 0xfc, 0xd7, 0xe7, 0xff, 0xdb, 0xe1, 0xe1, 0xe2, 0xfd, 0xd0,
-  0x0f, 0x0f, 0x0f, 0xfd, 0xff, 0xfe, 0x0b, 0x02, 0x0d, 0x02, 0xd1, 0xf4,
-  0xf8, 0xe4, 0xb2, 0x1e, 0xe8, 0xf1, 0xaa, 0xdb, 0xda, 0x09, 0x02, 0xcb,
-  0xef, 0x06, 0xc0, 0x00, 0x81, 0xf9, 0x9c, 0xbd, 0xee, 0xe7, 0xe7, 0x02,
-  0xfb, 0x11, 0xfc, 0xf0, 0xfe, 0x06, 0xf9, 0x0a, 0xc6, 0x11, 0x07, 0xe1,
-  0x0f, 0xfe, 0x11, 0xe5, 0x08, 0x0b, 0x07, 0xe3, 0x05, 0xff, 0x01, 0xfc,
-  0xed, 0xfc, 0xe1, 0x1c, 0xf2, 0x0e, 0xb2, 0xdc, 0xd1, 0xf6, 0x09, 0x04,
-  0xee, 0xfb, 0xc5, 0xe9, 0xb5, 0x02, 0xd9, 0xc8, 0x0c, 0x08, 0xd5, 0x08,
-  0x05, 0x07, 0x01, 0xf7, 0xe8, 0x17, 0xf9, 0x07, 0xc8, 0x01, 0x03, 0x0a,
-  0x1c, 0xf1, 0xf1, 0xf9, 0xf8, 0x13, 0xee, 0xe4, 0x03, 0xef, 0xe4, 0xff,
-  0xd7, 0xef, 0x95, 0xfe, 0xf8, 0xec, 0xad, 0x05, 0x0c, 0x02, 0xf8, 0xf0,
-  0xea, 0xe9, 0xd9, 0xf8, 0x9b, 0x09, 0x8d, 0x05, 0x00, 0xe9, 0xe9, 0xfd,
-  0xce, 0xe0, 0xfa, 0xfb, 0xe6, 0xf5, 0x09, 0xf4, 0x15, 0x2e, 0x15, 0xda,
-  0xee, 0xe4, 0xf3, 0x05, 0xf7, 0x13, 0xd1, 0xd7, 0xee, 0x1b, 0xfd, 0x07,
-  0xbc, 0xc4, 0xe5, 0xc0, 0xf0, 0xd6, 0xf3, 0x07, 0xc4, 0x05, 0xe4, 0xd9,
-  0xf8, 0xdc, 0xf0, 0xfa, 0x05, 0x09, 0x07, 0xe5, 0xfc, 0x02, 0xb8, 0x1f,
-  0x1f, 0xd5, 0xf5, 0x30, 0xef, 0x34, 0x36, 0x04, 0x48, 0x30, 0x2f, 0xd3,
-  0xf5, 0x3d, 0x08, 0xff, 0xd8, 0x35, 0x23, 0x05, 0xf1, 0x17, 0x3d, 0x0e,
-  0xf4, 0xee, 0x0b, 0xb5, 0xc7, 0xbf, 0xb9, 0xcc, 0xdf, 0x13, 0xf1, 0x13,
-  0xd1, 0xd3, 0xe7, 0xff, 0xf9, 0x07, 0x05, 0xa1, 0xe0, 0x00, 0x01, 0xfd,
-  0x03, 0xe8, 0x23, 0xfb, 0xdb, 0xce, 0x32, 0x44, 0xde, 0x40, 0x01, 0x81,
-  0xf1, 0x39, 0xd4, 0x03, 0x09, 0x03, 0xf9, 0xe6, 0xf9, 0x21, 0x30, 0xd2,
-  0x2c, 0x2b, 0x2e, 0xe8, 0xa5, 0xed, 0x0b, 0xf1, 0xe7, 0x03, 0xd3, 0xcd,
-  0xec, 0xf9, 0xef, 0x1d, 0x10, 0xe7, 0x08, 0x8f, 0x2b, 0x0d, 0x92, 0xb9,
-  0x84, 0xd5, 0x21, 0x50, 0x45, 0x33, 0x10, 0xc9, 0x9f, 0xe3, 0xd5, 0x50,
-  0x9d, 0xa1, 0xdb, 0xb8, 0x39, 0xf1, 0x04, 0xee, 0x20, 0x38, 0x54, 0x2b,
-  0xfc, 0x97, 0x07, 0x48, 0x44, 0x37, 0x2c, 0xe2, 0x29, 0x20, 0xb6, 0x16,
-  0x2e, 0xfe, 0x9a, 0xc7, 0xbe, 0x4a, 0xaf, 0x38, 0x47, 0x07, 0xd6, 0xb2,
-  0xb7, 0x58, 0xb4, 0x39, 0x83, 0x88, 0xb1, 0xc6, 0x9b, 0x9c, 0x2b, 0xae,
-  0x14, 0xd0, 0xeb, 0xab, 0xa8, 0xa7, 0x16, 0x23, 0xc6, 0x81, 0xfb, 0xdb,
-  0x32, 0x45, 0xb6, 0xb7, 0x90, 0xcf, 0x1f, 0xff, 0xf8, 0xd4, 0xa4, 0x0a,
-  0x04, 0x9b, 0xd2, 0x28, 0x17, 0x25, 0x95, 0xb2, 0x06, 0x9e, 0x22, 0xee,
-  0xf6, 0xf3, 0x93, 0xee, 0x43, 0xd6, 0x14, 0xce, 0x26, 0xd1, 0xf2, 0xf0,
-  0x56, 0x0f, 0x2c, 0xea, 0x02, 0xf2, 0xde, 0x59, 0xf7, 0xb0, 0x91, 0xc7,
-  0x9e, 0x29, 0x33, 0xb3, 0xbc, 0xe0, 0xdc, 0x34, 0xfb, 0xd9, 0xec, 0x4a,
-  0x38, 0xfb, 0x96, 0xc9, 0x06, 0xc2, 0x2c, 0xec, 0xe3, 0xf7, 0xb7, 0xe3,
-  0xd0, 0x11, 0x0b, 0x01, 0xf8, 0x07, 0xd1, 0xe1, 0xc7, 0x10, 0xe0, 0xdf,
-  0x0d, 0x01, 0x01, 0xf1, 0xe9, 0x03, 0x04, 0x09, 0x02, 0x13, 0x00, 0xfd,
-  0xf8, 0x07, 0xef, 0xdb, 0x05, 0x0a, 0xcd, 0xdd, 0xc6, 0x03, 0x13, 0xf5,
-  0xf3, 0xff, 0xdd, 0xdf, 0xce, 0x16, 0xdf, 0xdd, 0xfa, 0xfb, 0xa5, 0xc4,
-  0xd8, 0xfe, 0xf0, 0xb1, 0xdc, 0xfe, 0x9c, 0xdd, 0x9a, 0xe8, 0x81, 0xd8,
-  0xf6, 0xfc, 0xfd, 0xe6, 0x01, 0x03, 0x12, 0xb5, 0x0e, 0xee, 0xcc, 0xf8,
-  0x01, 0xf2, 0x9d, 0xe3, 0x02, 0x0b, 0xc0, 0xe4, 0xc0, 0xef, 0x04, 0xb2,
-  0xe0, 0x03, 0xba, 0xe5, 0xa0, 0xe3, 0xad, 0xe4, 0x05, 0x10, 0xd3, 0xeb,
-  0xfd, 0xff, 0xef, 0xe9, 0x05, 0xee, 0xe1, 0x14, 0xa3, 0x01, 0x8a, 0x0d,
-  0x05, 0xfb, 0x0a, 0x10, 0x08, 0x04, 0x00, 0xe5, 0xfa, 0x02, 0xf6, 0x00,
-  0xfa, 0x02, 0xc8, 0xff, 0xe5, 0xf7, 0xd6, 0x07, 0xea, 0x01, 0x0b, 0xfd,
-  0x03, 0xfa, 0xe5, 0x10, 0xac, 0x11, 0xa3, 0x08, 0xf0, 0x1f, 0xea, 0x1f,
-  0x22, 0xf9, 0x03, 0x17, 0x13, 0xea, 0x0a, 0x46, 0xe8, 0x3c, 0xea, 0x2a,
-  0x08, 0xd2, 0xf7, 0x1f, 0x09, 0x11, 0xfe, 0xef, 0x15, 0xe0, 0x19, 0x04,
-  0xc6, 0x29, 0xf5, 0x27, 0x03, 0xf7, 0xff, 0x21, 0x06, 0xf4, 0xfb, 0x09,
-  0x0b, 0xe3, 0x02, 0x1a, 0xf6, 0x4d, 0xe5, 0x35, 0x21, 0x01, 0xfd, 0x23,
-  0x14, 0xf7, 0xf6, 0x7f, 0x3a, 0xce, 0x03, 0x3b, 0xe1, 0x27, 0xfb, 0x35,
-  0x09, 0xc2, 0xf6, 0xff, 0x26, 0xfd, 0x02, 0x5c, 0x02, 0xf4, 0x15, 0x2e,
-  0xf3, 0x14, 0xfb, 0x2c, 0xf0, 0xe1, 0xf3, 0x3a, 0x1c, 0x0d, 0x1e, 0x6f,
-  0x0d, 0x02, 0x05, 0x15, 0xeb, 0x2c, 0xef, 0x2a, 0x07, 0xf7, 0xf9, 0x20,
-  0x1c, 0xf4, 0xfb, 0x3e, 0x1c, 0xcf, 0xff, 0x35, 0xf9, 0x35, 0xfd, 0x3e,
-  0xe9, 0xdf, 0x00, 0x1c, 0x20, 0xf8, 0x06, 0x70, 0x0f, 0xcd, 0x1f, 0x28,
-  0xfe, 0x06, 0x00, 0x0b, 0x02, 0xf2, 0xff, 0x2b, 0x17, 0xf7, 0x0e, 0x63,
-  0x13, 0x00, 0x05, 0x1e, 0xdf, 0x73, 0x0f, 0x0f, 0x2c, 0x29, 0x27, 0x0c,
-  0x24, 0xf0, 0x1e, 0xdc, 0x0b, 0xf9, 0x2d, 0xda, 0x21, 0xeb, 0x25, 0xeb,
-  0x01, 0x11, 0x19, 0x11, 0xf8, 0x1c, 0xfc, 0xbb, 0x21, 0x09, 0x20, 0xae,
-  0x22, 0xba, 0x41, 0xe6, 0x12, 0x26, 0x07, 0x27, 0xff, 0xf3, 0x17, 0xbe,
-  0xfa, 0x0f, 0x08, 0xd6, 0x1b, 0xb2, 0x2d, 0x0b, 0x06, 0x34, 0x0c, 0xf2,
-  0xf3, 0x06, 0x15, 0xa0, 0x0b, 0x01, 0x09, 0xd5, 0x39, 0xc9, 0x16, 0xd1,
-  0x16, 0xe3, 0x18, 0xeb, 0x0c, 0xff, 0x20, 0x81, 0x0f, 0x17, 0x22, 0xdc,
-  0x31, 0xaa, 0x2d, 0xb6, 0xfc, 0x19, 0x28, 0xf2, 0x03, 0x22, 0x20, 0xc7,
-  0x0c, 0x1f, 0x19, 0xe7, 0x0d, 0xc6, 0x3e, 0xef, 0x00, 0x0b, 0x1d, 0x0e,
-  0x0d, 0x12, 0xf3, 0xdc, 0xfc, 0x17, 0x04, 0x10, 0x23, 0xfa, 0x1f, 0x06,
-  0x19, 0xed, 0x1e, 0xf5, 0xed, 0xeb, 0x19, 0xf1, 0xf7, 0x2e, 0x0e, 0xe8,
-  0x49, 0xec, 0x49, 0xff, 0x1a, 0xf8, 0x16, 0x1c, 0x20, 0x12, 0x14, 0xea,
-  0x08, 0x19, 0x05, 0xef, 0x1a, 0xd6, 0x1b, 0x06, 0xf2, 0x94, 0xfe, 0x04,
-  0x89, 0x12, 0x57, 0xf7, 0xbd, 0xee, 0x98, 0x9f, 0x5c, 0xe2, 0x1d, 0x69,
-  0x84, 0x5a, 0x3b, 0x8a, 0xc3, 0x6d, 0xbd, 0x3a, 0x55, 0xa2, 0xc1, 0xfa,
-  0x59, 0xb4, 0xa8, 0x1f, 0x97, 0xa3, 0xda, 0xc4, 0xef, 0x27, 0x41, 0xa0,
-  0xd4, 0xfc, 0x0e, 0x66, 0x56, 0xa4, 0xc9, 0x55, 0xd9, 0x18, 0x37, 0xe5,
-  0x3e, 0x90, 0xf3, 0x5b, 0x81, 0xba, 0xc4, 0x05, 0x3d, 0x91, 0xac, 0xc8,
-  0xbc, 0x16, 0xf6, 0xaa, 0xf1, 0x01, 0xda, 0xf7, 0x3e, 0xe1, 0xb9, 0x04,
-  0x1e, 0x29, 0x0e, 0xbe, 0xf9, 0xc6, 0x0e, 0x82, 0x2f, 0xa0, 0xac, 0x4b,
-  0x0a, 0xaa, 0x9b, 0x52, 0x4b, 0x2d, 0xc7, 0x4f, 0x96, 0x2f, 0x92, 0xb2,
-  0xb0, 0x6a, 0xa9, 0x4d, 0xfd, 0x08, 0xcc, 0xa7, 0x32, 0x07, 0x2e, 0xd0,
-  0x36, 0xb3, 0xce, 0xf5, 0x9b, 0xfb, 0xdb, 0xc4, 0xe6, 0xa5, 0x39, 0x53,
-  0xfd, 0xe0, 0xe2, 0x04, 0xf1, 0xd7, 0xa7, 0x03, 0x2f, 0xc7, 0x29, 0xf4,
-  0x06, 0xec, 0x14, 0x8a, 0x14, 0x06, 0xa8, 0x36, 0x1d, 0x1c, 0x2e, 0xea,
-  0xe0, 0xec, 0x17, 0xdd, 0x0e, 0x1d, 0x0d, 0xde, 0x00, 0xdd, 0x00, 0x03,
-  0x35, 0x28, 0x4d, 0xff, 0xf4, 0x03, 0x11, 0xc9, 0xfa, 0x0f, 0xfb, 0xc9,
-  0x09, 0xe6, 0xeb, 0xd9, 0x0c, 0x11, 0x1f, 0x15, 0x16, 0xfe, 0x0d, 0xf2,
-  0x1a, 0x05, 0xf0, 0xe5, 0x14, 0xd0, 0x18, 0xff, 0x03, 0x35, 0x1e, 0xf8,
-  0x19, 0x03, 0x07, 0xb2, 0x0e, 0x29, 0xf1, 0xc2, 0x27, 0xc4, 0x1d, 0x0d,
-  0x0f, 0x51, 0x0e, 0xfe, 0xef, 0xf1, 0x1d, 0x92, 0x10, 0xfe, 0x0d, 0xc8,
-  0x17, 0x83, 0x0a, 0xe6, 0x1e, 0x12, 0x32, 0xf9, 0x0e, 0x09, 0x29, 0xbd,
-  0x17, 0xfd, 0x0a, 0xdc, 0x1d, 0x81, 0xfe, 0x04, 0x07, 0xfe, 0x36, 0x1d,
-  0x18, 0x11, 0xfe, 0xa7, 0x01, 0x10, 0xfb, 0xea, 0x03, 0xef, 0xf8, 0xf3,
-  0x35, 0x10, 0x4e, 0x1d, 0x25, 0x06, 0x2e, 0xa0, 0x0c, 0x10, 0xf3, 0xf3,
-  0x2e, 0xc0, 0x1c, 0xec, 0x2c, 0x09, 0x4b, 0x15, 0x27, 0x00, 0x26, 0xb4,
-  0x0b, 0xfd, 0xf8, 0x0b, 0x28, 0xd1, 0xfc, 0x17, 0xf2, 0x00, 0xf9, 0xfd,
-  0x06, 0xf5, 0x11, 0x10, 0x07, 0xf0, 0xde, 0xf2, 0xdc, 0xff, 0xf7, 0xff,
-  0x04, 0xf2, 0xd7, 0xec, 0x11, 0xfa, 0x02, 0xf7, 0xfd, 0xee, 0xed, 0xe8,
-  0xb0, 0x02, 0xdb, 0x11, 0x00, 0x03, 0xfa, 0x01, 0x11, 0xf8, 0xf5, 0xf7,
-  0x06, 0xd9, 0xe6, 0xec, 0x08, 0xf2, 0xfb, 0xff, 0x00, 0xfb, 0xf0, 0xf1,
-  0x01, 0xfd, 0xff, 0x37, 0xfb, 0xf4, 0xd9, 0xf2, 0xad, 0xf1, 0xd7, 0xe4,
-  0xed, 0xee, 0xe3, 0xe7, 0x0f, 0x0d, 0x02, 0x22, 0x05, 0xf9, 0xd8, 0xf2,
-  0x81, 0xe3, 0xbd, 0x07, 0x03, 0x08, 0x11, 0x0f, 0x02, 0x06, 0x07, 0x2a,
-  0xf0, 0xe2, 0x05, 0x10, 0xfe, 0xd3, 0xc0, 0x0e, 0x00, 0x14, 0x16, 0x18,
-  0x22, 0xf6, 0x2a, 0x50, 0x06, 0xff, 0x2a, 0x0d, 0xee, 0x0d, 0x04, 0x15,
-  0x04, 0x14, 0xfb, 0x0f, 0xfe, 0x06, 0x08, 0x4e, 0x14, 0xfc, 0x30, 0x0e,
-  0xd2, 0xed, 0xef, 0x11, 0x19, 0xfe, 0x06, 0x19, 0x22, 0x0c, 0x2b, 0x78,
-  0x00, 0x18, 0x37, 0xfa, 0x0b, 0xf0, 0x2a, 0xf7, 0xf1, 0xf3, 0xd1, 0xf3,
-  0xe7, 0x1b, 0xe6, 0x9d, 0xd2, 0x04, 0xdf, 0xd2, 0xcc, 0xf8, 0xef, 0xd3,
-  0x19, 0x1b, 0x08, 0xcd, 0xe9, 0xf4, 0xf8, 0xc6, 0xfd, 0xe2, 0xcc, 0x17,
-  0x01, 0xf2, 0xa3, 0xf6, 0xd8, 0x15, 0x9f, 0xcc, 0xc5, 0x08, 0xe8, 0xd8,
-  0xc8, 0xf2, 0x99, 0xdb, 0x8b, 0xf1, 0x81, 0xc1, 0xf2, 0xf9, 0xdb, 0xfc,
-  0xe8, 0xfd, 0x18, 0x07, 0xe9, 0x15, 0x06, 0x09, 0xfa, 0x12, 0x09, 0x13,
-  0x0a, 0x13, 0x0e, 0xe1, 0xfb, 0xfa, 0x10, 0xfb, 0x10, 0x04, 0xf5, 0x1b,
-  0xf4, 0x03, 0xfe, 0x03, 0xfc, 0x0a, 0xc5, 0xec, 0xfa, 0xf7, 0x03, 0x14,
-  0xe7, 0xf8, 0xdf, 0x02, 0xb6, 0x15, 0xf1, 0xfd, 0xe5, 0xfe, 0xd6, 0xe4,
-  0xe1, 0x0c, 0xfb, 0xb8, 0xdb, 0x0e, 0x00, 0xd4, 0xe1, 0x03, 0x0e, 0xd1,
-  0x04, 0x15, 0x11, 0xd5, 0xfa, 0xf4, 0xf0, 0xe8, 0x0e, 0xef, 0xdc, 0x16,
-  0x09, 0xe0, 0xca, 0x05, 0xee, 0x00, 0x97, 0xd2, 0xd0, 0xf7, 0xe2, 0xee,
-  0xdf, 0x0e, 0xae, 0xf3, 0x9b, 0xf7, 0xad, 0xd6, 0x0a, 0x09, 0xe0, 0xf4,
-  0xff, 0x10, 0x0f, 0xc1, 0xe4, 0x04, 0xb6, 0xd9, 0xa3, 0x01, 0xca, 0xff,
-  0xfe, 0x18, 0xf3, 0xe1, 0x0e, 0x03, 0xff, 0xcf, 0x01, 0xf1, 0xc9, 0x01,
-  0xf1, 0xf7, 0x93, 0xdb, 0xe4, 0x0e, 0xad, 0xd6, 0xc4, 0x01, 0xf6, 0xc9,
-  0xd8, 0xf3, 0xb2, 0xd9, 0x8e, 0xed, 0xa9, 0xc5, 0xf2, 0xf6, 0xf4, 0x02,
-  0xfb, 0x0e, 0x15, 0x05, 0xed, 0x01, 0xa8, 0xe3, 0x81, 0x16, 0xb8, 0xf8,
-  0x15, 0x22, 0xf7, 0xf3, 0xfb, 0xfb, 0x12, 0x26, 0x08, 0x04, 0xca, 0x07,
-  0xf2, 0xff, 0x9b, 0xe6, 0xf1, 0xee, 0xa2, 0xdd, 0xde, 0x0e, 0xf8, 0xf8,
-  0xe3, 0x0f, 0xac, 0xf0, 0x97, 0xe6, 0x9b, 0xc4, 0x0e, 0xed, 0x0b, 0x16,
-  0x16, 0x05, 0x05, 0x03, 0xfd, 0x0e, 0x04, 0xf5, 0xcc, 0xe9, 0xfe, 0x07,
-  0x15, 0x27, 0x0f, 0x13, 0x11, 0xf7, 0x09, 0x26, 0xfc, 0x00, 0x17, 0x13,
-  0xf6, 0x00, 0xd9, 0x0d, 0xef, 0x0e, 0xe1, 0xed, 0x04, 0x0d, 0x0a, 0x04,
-  0xef, 0x17, 0xf7, 0xeb, 0xa7, 0xff, 0xb8, 0x05, 0xc6, 0xb9, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0xad, 0xfc, 0xff, 0xff,
-  0x9a, 0xfd, 0xff, 0xff, 0x2a, 0xfd, 0xff, 0xff, 0x32, 0xfb, 0xff, 0xff,
-  0x71, 0x05, 0x00, 0x00, 0x47, 0x0e, 0x00, 0x00, 0x09, 0xfe, 0xff, 0xff,
-  0x4b, 0xfb, 0xff, 0xff, 0xe5, 0xe6, 0xff, 0xff, 0xd8, 0xfc, 0xff, 0xff,
-  0xa8, 0xf6, 0xff, 0xff, 0x6a, 0xe0, 0xff, 0xff, 0xc9, 0x00, 0x00, 0x00,
-  0xce, 0xfe, 0xff, 0xff, 0xf0, 0x02, 0x00, 0x00, 0xa3, 0x02, 0x00, 0x00,
-  0xad, 0x0f, 0x00, 0x00, 0x69, 0xfc, 0xff, 0xff, 0xc9, 0xff, 0xff, 0xff,
-  0x96, 0xf1, 0xff, 0xff, 0x25, 0x03, 0x00, 0x00, 0xe7, 0x0b, 0x00, 0x00,
-  0x27, 0xf6, 0xff, 0xff, 0x21, 0xe2, 0xff, 0xff, 0x83, 0x0f, 0x00, 0x00,
-  0xea, 0xf7, 0xff, 0xff, 0xd9, 0xfd, 0xff, 0xff, 0x6b, 0xe9, 0xff, 0xff,
-  0xb1, 0xfe, 0xff, 0xff, 0x9c, 0x03, 0x00, 0x00, 0x85, 0x0c, 0x00, 0x00,
-  0x0f, 0x0e, 0x00, 0x00, 0x52, 0xba, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x00, 0x40, 0x00, 0x00, 0x57, 0xbe, 0xe6, 0xc5, 0xc3, 0x96, 0xb1, 0xd5,
-  0x91, 0xce, 0x4a, 0xbb, 0x10, 0x64, 0x44, 0xbd, 0x41, 0x3c, 0xc0, 0xa9,
-  0x01, 0xcf, 0xda, 0x36, 0x1a, 0x66, 0x70, 0x20, 0x55, 0x66, 0xdf, 0x4f,
-  0xc4, 0x1b, 0xac, 0xfb, 0xe1, 0xe7, 0xcd, 0x30, 0x28, 0x89, 0xce, 0x3f,
-  0x01, 0x15, 0x6d, 0xe4, 0xb5, 0xf9, 0x6c, 0xc8, 0x87, 0x91, 0xd2, 0x57,
-  0xca, 0xa8, 0xc9, 0x18, 0x14, 0x0b, 0x3e, 0xf2, 0xdc, 0xed, 0xb0, 0xcd,
-  0xe7, 0xcf, 0x56, 0xf0, 0x90, 0xc0, 0x71, 0xec, 0x6c, 0x44, 0x1e, 0xfc,
-  0x31, 0x8a, 0x25, 0x6f, 0xad, 0xfb, 0x54, 0x37, 0x61, 0x8b, 0xdc, 0x98,
-  0x06, 0x64, 0xe2, 0x37, 0x8f, 0x05, 0x6c, 0xc1, 0xf4, 0x5e, 0x53, 0x5f,
-  0xa7, 0x29, 0x1c, 0x26, 0xe2, 0xd2, 0xa5, 0x17, 0x01, 0xa4, 0x4a, 0xe9,
-  0x20, 0xf2, 0x29, 0x97, 0xc0, 0xb7, 0x41, 0xf6, 0x9b, 0xbb, 0xe8, 0x72,
-  0x33, 0x61, 0xee, 0x11, 0x43, 0x70, 0x20, 0x67, 0x36, 0xc7, 0x5f, 0x09,
-  0x8b, 0xf7, 0xc2, 0x27, 0x6d, 0x1a, 0x54, 0xb6, 0xa0, 0xc6, 0xc5, 0x9b,
-  0xbc, 0xa4, 0x1e, 0x44, 0xa8, 0xee, 0xd5, 0x3d, 0x9f, 0xaf, 0x99, 0x13,
-  0xbe, 0xd9, 0x0c, 0xc9, 0xa3, 0xbd, 0x9e, 0x43, 0xc3, 0xb8, 0x3c, 0xbb,
-  0x8e, 0xaf, 0xff, 0x08, 0xcf, 0x25, 0x3d, 0xc5, 0x1a, 0x9b, 0xde, 0x6e,
-  0x3d, 0xaa, 0x65, 0x0c, 0x8e, 0x59, 0xfb, 0x05, 0xd0, 0xb5, 0x46, 0x94,
-  0xba, 0xd1, 0x45, 0xfb, 0x47, 0xee, 0xa1, 0x59, 0x37, 0x52, 0xc4, 0xb8,
-  0x41, 0xb0, 0xaf, 0x60, 0xce, 0xbe, 0xc0, 0xa2, 0x26, 0x3e, 0x90, 0xbc,
-  0x52, 0xd7, 0xdc, 0x32, 0xdf, 0x46, 0x8c, 0x2b, 0xc2, 0x2c, 0x99, 0x75,
-  0xa5, 0x56, 0xb2, 0xf0, 0xbb, 0x5c, 0x4f, 0xf6, 0x46, 0xd7, 0x41, 0xd2,
-  0xce, 0x17, 0xd5, 0x95, 0x94, 0x38, 0x70, 0x06, 0xee, 0xf6, 0x05, 0xe7,
-  0x7f, 0xd7, 0xac, 0xfe, 0x64, 0x71, 0x35, 0xdd, 0x1d, 0x29, 0xb2, 0x19,
-  0x76, 0x14, 0x09, 0xca, 0xb9, 0x8b, 0x4d, 0x5a, 0xf3, 0xfa, 0x08, 0x21,
-  0x44, 0xaa, 0x46, 0x9e, 0x47, 0xd7, 0x73, 0xd4, 0x05, 0x06, 0xe1, 0xe6,
-  0xdf, 0x9d, 0x9e, 0x42, 0x3a, 0x47, 0x59, 0xab, 0xf2, 0xc8, 0x46, 0x92,
-  0xed, 0xed, 0x58, 0x00, 0x07, 0xce, 0x12, 0x15, 0xc7, 0xf9, 0xdd, 0xd3,
-  0x89, 0xda, 0x5c, 0x4b, 0x4d, 0x05, 0xc6, 0x60, 0xe9, 0xd8, 0xb4, 0x46,
-  0xe6, 0x6b, 0x61, 0xe2, 0x03, 0xf0, 0xb8, 0x58, 0x8c, 0xdf, 0xa0, 0xc6,
-  0xec, 0xfa, 0xe0, 0xac, 0x6f, 0xf0, 0xa7, 0x33, 0xba, 0x25, 0x2e, 0xf6,
-  0x92, 0x5f, 0xcf, 0x59, 0x90, 0xc3, 0x22, 0x62, 0xa6, 0x00, 0x27, 0x91,
-  0x34, 0x14, 0x57, 0xde, 0xb0, 0x6b, 0x67, 0x3a, 0xce, 0x30, 0xd4, 0x5b,
-  0xca, 0xf6, 0xaf, 0xb9, 0xfa, 0xd1, 0x36, 0xbb, 0x2b, 0xb4, 0xcd, 0x98,
-  0x45, 0x2e, 0xde, 0x0d, 0x29, 0x02, 0xdb, 0x54, 0x6d, 0x31, 0x3a, 0xeb,
-  0x9f, 0xf2, 0x1e, 0xb0, 0x02, 0x62, 0xdf, 0x50, 0xbb, 0x0d, 0xd8, 0x36,
-  0xc3, 0x07, 0x18, 0x13, 0x43, 0x15, 0xb4, 0xbf, 0xdc, 0x2a, 0x8c, 0x6e,
-  0x02, 0xd9, 0x5f, 0x2f, 0xd7, 0xd7, 0x52, 0xa1, 0xc4, 0xe9, 0x35, 0x5a,
-  0x30, 0xee, 0x95, 0x0d, 0xec, 0xf3, 0xa7, 0x04, 0xb6, 0xd8, 0xb3, 0x32,
-  0x1d, 0xd7, 0xd2, 0x1f, 0x1f, 0x5b, 0xdd, 0xf3, 0xbe, 0x65, 0x69, 0x1b,
-  0x2a, 0xc1, 0xd5, 0x0f, 0xac, 0x27, 0xe1, 0x57, 0xc5, 0x2f, 0x08, 0x4d,
-  0x3c, 0x87, 0x6f, 0x3d, 0xc6, 0xe1, 0xc8, 0xfe, 0x93, 0xed, 0x23, 0xaa,
-  0x51, 0x15, 0x73, 0xd6, 0x13, 0x94, 0x53, 0x29, 0xc6, 0x50, 0xd7, 0x19,
-  0x25, 0x6c, 0x07, 0xbb, 0xe1, 0x88, 0xde, 0x94, 0xe4, 0x99, 0x66, 0x10,
-  0x07, 0x3a, 0xfa, 0x2d, 0xca, 0xe2, 0x2f, 0x09, 0x0d, 0x45, 0x13, 0x1c,
-  0xf4, 0xec, 0x4c, 0x65, 0xdf, 0x07, 0x00, 0xe6, 0x31, 0xa6, 0xec, 0x10,
-  0xe3, 0x1f, 0x06, 0x0e, 0xf6, 0x1c, 0xfa, 0xde, 0xed, 0x45, 0x09, 0x31,
-  0xc8, 0xb7, 0x43, 0x3d, 0xe1, 0x63, 0x09, 0x04, 0xe7, 0xe6, 0x51, 0x52,
-  0xc2, 0xdb, 0xef, 0xf2, 0x49, 0xbf, 0x06, 0xec, 0xa0, 0x38, 0xfa, 0x01,
-  0xfd, 0xf4, 0xda, 0x06, 0x03, 0x3a, 0x1b, 0x46, 0xdb, 0xdc, 0x41, 0x4c,
-  0x05, 0x56, 0x15, 0x09, 0xdc, 0xe6, 0x7c, 0x5a, 0xc4, 0x05, 0xf9, 0x09,
-  0x49, 0xa7, 0xf5, 0xf5, 0xaf, 0x35, 0xea, 0x12, 0xf6, 0x23, 0xd1, 0x12,
-  0xfb, 0x13, 0x07, 0x08, 0xe8, 0xf6, 0x15, 0x11, 0xe7, 0x1b, 0xed, 0xf9,
-  0xde, 0x10, 0x0b, 0xf3, 0xd4, 0xef, 0xfd, 0x03, 0xf2, 0x08, 0x0d, 0xfd,
-  0xc6, 0x16, 0xfd, 0x02, 0xe7, 0xe5, 0xd2, 0x12, 0x13, 0x2b, 0x03, 0x33,
-  0x0f, 0xcc, 0x27, 0x0b, 0xe0, 0x2c, 0x0e, 0x00, 0xda, 0xd8, 0x23, 0x3e,
-  0xa6, 0xfa, 0x08, 0x05, 0x38, 0xc3, 0xf3, 0x04, 0xd9, 0x0e, 0xf2, 0x0a,
-  0x1b, 0x39, 0xc3, 0xed, 0xfb, 0x3e, 0x0f, 0x23, 0x01, 0xc6, 0x12, 0x15,
-  0xfb, 0x2c, 0x0c, 0xfb, 0xe9, 0xf3, 0x52, 0x3e, 0xa2, 0xfe, 0x01, 0x0b,
-  0x58, 0xaf, 0x0d, 0x06, 0xca, 0x19, 0x01, 0x11, 0x1c, 0xee, 0xc4, 0xc2,
-  0xfd, 0x34, 0x35, 0x43, 0x06, 0xd9, 0x3c, 0x2b, 0xeb, 0x3c, 0xff, 0x03,
-  0xfc, 0xd9, 0x6f, 0x60, 0xae, 0xeb, 0x04, 0xf8, 0x57, 0xbf, 0x10, 0xeb,
-  0xbb, 0x1b, 0xe8, 0xf4, 0x20, 0xf8, 0xce, 0xbd, 0xef, 0xf0, 0xfe, 0x24,
-  0xae, 0xd3, 0xf7, 0x19, 0xf4, 0x21, 0xe6, 0xed, 0xea, 0xfd, 0x05, 0xef,
-  0xcf, 0xe1, 0xfa, 0x1c, 0xed, 0xe0, 0xf2, 0xf9, 0xd8, 0x2c, 0x03, 0xf1,
-  0x01, 0xf8, 0xcc, 0x5b, 0x13, 0x3c, 0x1b, 0x34, 0x0d, 0xe0, 0x33, 0x14,
-  0xd6, 0x29, 0xfb, 0xff, 0xe4, 0xcf, 0x45, 0x5d, 0xb6, 0xf1, 0x31, 0xfc,
-  0x29, 0xb7, 0x08, 0xed, 0xdd, 0x0f, 0x08, 0x03, 0x27, 0x5b, 0xb8, 0xea,
-  0xfc, 0x28, 0x22, 0x27, 0x0a, 0xd6, 0x1f, 0x3e, 0xe6, 0x50, 0x09, 0x0d,
-  0xf8, 0xe8, 0x6d, 0x5b, 0xb1, 0xe1, 0x26, 0x14, 0x71, 0xcd, 0x00, 0xea,
-  0xc7, 0x20, 0x01, 0xfa, 0x0c, 0x00, 0xd6, 0xe7, 0x04, 0x39, 0x08, 0x3b,
-  0x16, 0xe0, 0x4b, 0x3c, 0xf2, 0x54, 0x02, 0x08, 0xdd, 0xe5, 0x49, 0x7f,
-  0xc1, 0xe2, 0x34, 0xf1, 0x65, 0xa5, 0x00, 0x04, 0xc2, 0x3b, 0xec, 0xf0,
-  0x1b, 0x19, 0xdf, 0xe0, 0xea, 0x07, 0x00, 0x12, 0xba, 0xb7, 0x10, 0x2c,
-  0xd6, 0x20, 0xf6, 0x07, 0xd3, 0xee, 0xf3, 0xf9, 0xd7, 0xde, 0xdf, 0xfb,
-  0x00, 0xfe, 0x1b, 0x14, 0xf6, 0x17, 0x0d, 0xf9, 0xe1, 0x1b, 0xcf, 0x52,
-  0xf5, 0x17, 0xf7, 0x0f, 0xf7, 0xee, 0x1d, 0xff, 0xde, 0x06, 0x15, 0x0a,
-  0x06, 0xc2, 0x07, 0x09, 0xf4, 0xc8, 0x05, 0x01, 0x1b, 0xd3, 0x1a, 0x0c,
-  0x0a, 0x15, 0x03, 0xe9, 0xe7, 0x27, 0x0f, 0xce, 0xef, 0x1e, 0x00, 0x19,
-  0x0d, 0xf1, 0x12, 0x01, 0xdf, 0x11, 0xf5, 0xf3, 0xed, 0xc1, 0x21, 0x2b,
-  0xfe, 0xf2, 0x06, 0xf6, 0x27, 0xc4, 0xf4, 0x00, 0xfd, 0x0f, 0x0b, 0x0b,
-  0xfb, 0x09, 0x1c, 0xf7, 0x0a, 0x2e, 0x10, 0x20, 0x1c, 0x06, 0x01, 0x0b,
-  0xca, 0x1c, 0x09, 0xee, 0x01, 0xca, 0x29, 0x2d, 0xe5, 0xe5, 0xef, 0x1d,
-  0x2d, 0xd6, 0xe1, 0x07, 0xe4, 0x2f, 0xe7, 0xf4, 0xeb, 0x07, 0x1f, 0xe8,
-  0xe5, 0xf1, 0xeb, 0x22, 0xd3, 0xfa, 0x17, 0x0e, 0xef, 0xfc, 0x11, 0xe9,
-  0xde, 0xfb, 0xf0, 0xee, 0xe1, 0xee, 0xee, 0x1a, 0xe3, 0xfb, 0xf9, 0x0c,
-  0xef, 0x11, 0xf0, 0x10, 0xfb, 0xea, 0xdd, 0x06, 0xe7, 0xe2, 0xbd, 0xfd,
-  0x11, 0x2d, 0xed, 0xfa, 0xf2, 0xf2, 0x0b, 0xfe, 0xe7, 0xf5, 0x10, 0xe3,
-  0x10, 0x0d, 0x05, 0x0a, 0x07, 0x2d, 0x11, 0xf8, 0x06, 0xe7, 0x0b, 0x0f,
-  0x02, 0xf6, 0x1f, 0x02, 0xdc, 0xdc, 0xc4, 0xe8, 0x37, 0x2f, 0xe1, 0xf1,
-  0xc5, 0xd8, 0x09, 0x00, 0xe5, 0xeb, 0x13, 0x00, 0x0f, 0xf9, 0xeb, 0x08,
-  0xf4, 0x17, 0xf5, 0xf1, 0x30, 0xcb, 0xeb, 0xf2, 0xe5, 0x08, 0x16, 0x09,
-  0xde, 0xfa, 0xc2, 0xfb, 0x22, 0x29, 0xe0, 0xe7, 0xb2, 0xec, 0x0e, 0x00,
-  0xde, 0x06, 0x0f, 0x00, 0x21, 0xfc, 0xdd, 0x09, 0x12, 0x1a, 0xf7, 0x02,
-  0x28, 0xf1, 0xf1, 0x0e, 0x00, 0xfc, 0x13, 0xf5, 0x04, 0x02, 0x09, 0x08,
-  0x1d, 0xfa, 0x04, 0xe5, 0xfa, 0xff, 0x10, 0xf8, 0x01, 0xe9, 0x05, 0x01,
-  0x02, 0xfe, 0xfb, 0x00, 0xf8, 0xf8, 0x1b, 0x03, 0x21, 0xe2, 0xfb, 0xf1,
-  0x19, 0x2c, 0x04, 0xdb, 0xd0, 0xf5, 0xda, 0xc8, 0xf8, 0x1c, 0xe8, 0xdd,
-  0x09, 0xe2, 0x05, 0xfd, 0xb4, 0xdb, 0xfc, 0xe2, 0x27, 0xf4, 0x11, 0x04,
-  0xf4, 0x43, 0x0a, 0x0a, 0x1e, 0xe6, 0xe3, 0x06, 0xda, 0xef, 0x2e, 0x26,
-  0xaa, 0xe9, 0xb4, 0xdb, 0xe9, 0x2b, 0xe2, 0x01, 0xf3, 0xe0, 0x08, 0x00,
-  0xb9, 0x81, 0x04, 0xfb, 0x2b, 0xa1, 0xf9, 0x07, 0xfa, 0x14, 0x0e, 0x0c,
-  0x26, 0xe2, 0xb6, 0xf7, 0xcf, 0x36, 0x16, 0x30, 0xa4, 0xe5, 0xd7, 0xd6,
-  0xfd, 0x1c, 0xfd, 0xe3, 0x08, 0x07, 0x10, 0xfa, 0xbc, 0xa4, 0xf9, 0x14,
-  0x32, 0xc9, 0x10, 0xf6, 0xfc, 0x29, 0x11, 0x0a, 0x3e, 0xe0, 0xb9, 0x10,
-  0xd5, 0x09, 0x19, 0x2e, 0xf0, 0x05, 0x09, 0xf3, 0x30, 0x1d, 0x0c, 0xfb,
-  0xf7, 0x01, 0x0a, 0x02, 0xf3, 0xc3, 0x09, 0x01, 0x16, 0xbf, 0x09, 0xfa,
-  0x04, 0xfe, 0x03, 0xef, 0x2c, 0xdd, 0xda, 0xff, 0x10, 0x2b, 0x00, 0x0a,
-  0xcf, 0xf5, 0xd5, 0xd9, 0xe4, 0x2e, 0xdb, 0xd5, 0xf6, 0xdf, 0xff, 0x01,
-  0xc2, 0xdd, 0xf0, 0xfa, 0x2a, 0xeb, 0x06, 0x11, 0x06, 0x32, 0x01, 0x00,
-  0x0a, 0xd6, 0xea, 0x0a, 0xe7, 0xc7, 0x39, 0x1f, 0x98, 0xe3, 0xb7, 0xe7,
-  0xfa, 0x2c, 0xd1, 0xe1, 0xf5, 0xd8, 0x04, 0xf4, 0xbb, 0x86, 0x09, 0xf2,
-  0x20, 0x98, 0xe5, 0xf6, 0xed, 0x1a, 0x11, 0x07, 0x36, 0xda, 0xc3, 0xf8,
-  0xdf, 0x13, 0x1b, 0x21, 0xbb, 0xec, 0xc5, 0xdb, 0xe3, 0x2f, 0xea, 0xee,
-  0xf0, 0xf0, 0x00, 0x06, 0xbe, 0xb7, 0x0d, 0xf4, 0x31, 0xb1, 0xe7, 0x04,
-  0xfe, 0x2e, 0xfe, 0xfb, 0x27, 0xde, 0xc2, 0xfd, 0xcd, 0xef, 0x2a, 0x34,
-  0xf8, 0x00, 0x01, 0xe2, 0x33, 0x1b, 0x01, 0xf7, 0xfc, 0xf9, 0x11, 0x0b,
-  0xfc, 0xd8, 0xf0, 0x0c, 0x0b, 0xb9, 0x08, 0x16, 0x0d, 0xfe, 0x01, 0x10,
-  0x1d, 0xe9, 0xde, 0x00, 0x01, 0x2b, 0x04, 0x06, 0xfd, 0xf6, 0x0f, 0xfc,
-  0x0c, 0x03, 0x06, 0x17, 0xf0, 0x10, 0x0f, 0x0b, 0xeb, 0x07, 0x08, 0xf8,
-  0x07, 0x11, 0x06, 0x13, 0x01, 0x1d, 0x0b, 0xfd, 0x06, 0x07, 0xee, 0xfa,
-  0x12, 0x10, 0x1e, 0x32, 0xe6, 0x04, 0x01, 0xe8, 0x10, 0xf8, 0x02, 0xfb,
-  0xf9, 0xf9, 0xfd, 0x08, 0xe4, 0xca, 0x13, 0xfc, 0xf4, 0xf9, 0x12, 0x17,
-  0x10, 0x1a, 0x0e, 0x01, 0x27, 0x00, 0xe3, 0x03, 0x0a, 0x24, 0x0f, 0x2c,
-  0xe6, 0xf0, 0x00, 0x03, 0x24, 0x07, 0x12, 0x12, 0xfc, 0xfe, 0x0a, 0x0d,
-  0xeb, 0xe1, 0x05, 0xfd, 0xf6, 0x02, 0x16, 0x0c, 0x12, 0x1a, 0xf1, 0xf3,
-  0x15, 0xfd, 0xdb, 0x02, 0xfe, 0x22, 0x1c, 0x28, 0x0d, 0x14, 0x0a, 0xeb,
-  0x25, 0xf1, 0x09, 0x0b, 0x0c, 0xfe, 0x01, 0x16, 0xf5, 0xfc, 0x0c, 0x1b,
-  0x01, 0xf1, 0x0e, 0xfd, 0xfe, 0x15, 0x16, 0x02, 0x2d, 0x0e, 0x04, 0xf8,
-  0x1b, 0x1b, 0x07, 0x21, 0x3d, 0xd0, 0xb8, 0xe4, 0xa9, 0xce, 0x1c, 0xab,
-  0xfc, 0xfd, 0x4b, 0x35, 0x24, 0xf7, 0xca, 0xbf, 0xea, 0xbf, 0x0a, 0xcb,
-  0xd3, 0x04, 0x27, 0xf2, 0xb1, 0x27, 0xfb, 0x26, 0xce, 0xcf, 0x0c, 0xa8,
-  0xc3, 0x99, 0xda, 0xb0, 0xde, 0x21, 0xa0, 0xbc, 0x05, 0xab, 0x0b, 0x1b,
-  0x2d, 0x3e, 0xa9, 0x10, 0xcf, 0x08, 0xf4, 0xb1, 0xab, 0xfd, 0xda, 0xbd,
-  0xfa, 0xd7, 0x14, 0x3d, 0x19, 0x30, 0x35, 0x35, 0xd4, 0x37, 0xf5, 0x1e,
-  0xd5, 0xb2, 0xa7, 0xef, 0xf5, 0x17, 0x13, 0x17, 0xb2, 0xee, 0xa5, 0xd9,
-  0xf7, 0xdf, 0xed, 0xba, 0x20, 0xf1, 0xd1, 0x17, 0xe9, 0x13, 0x30, 0x27,
-  0xc2, 0x32, 0xef, 0xaf, 0xb2, 0xcd, 0x34, 0x37, 0x16, 0xb1, 0xdf, 0xde,
-  0xdc, 0xd1, 0x2b, 0x0e, 0x05, 0xfc, 0xef, 0xc8, 0xf5, 0x06, 0x2e, 0x40,
-  0x26, 0x2a, 0xe3, 0xd3, 0xe0, 0xb6, 0xae, 0xbf, 0xee, 0xbd, 0x44, 0x2a,
-  0xf6, 0x0a, 0xd3, 0x18, 0xc0, 0x02, 0x23, 0x02, 0xc9, 0xb3, 0xb2, 0x10,
-  0xd8, 0xfa, 0xd4, 0x24, 0x90, 0x19, 0xc6, 0xcd, 0x3f, 0xfe, 0x47, 0x31,
-  0xec, 0x9f, 0xf1, 0x25, 0x09, 0x26, 0xa3, 0xb2, 0xf7, 0xfe, 0xc7, 0xd7,
-  0xdc, 0xc1, 0xf9, 0xc6, 0x1c, 0x19, 0xfb, 0x2f, 0xde, 0xeb, 0xb3, 0x36,
-  0xe0, 0xf9, 0x0a, 0xc0, 0xbf, 0x96, 0x34, 0x0a, 0x29, 0x22, 0x28, 0x04,
-  0xc3, 0xde, 0x0b, 0xcc, 0xca, 0xf4, 0x2c, 0x9e, 0x20, 0xc3, 0xdb, 0xab,
-  0x01, 0xf4, 0xcf, 0xb4, 0x1c, 0x14, 0xd6, 0x23, 0xfd, 0x1c, 0xca, 0xf5,
-  0x3e, 0xe1, 0xb3, 0xf3, 0x2a, 0x22, 0xa9, 0xfa, 0xce, 0x3c, 0xec, 0x9c,
-  0x33, 0x33, 0xd3, 0xb0, 0x17, 0xa5, 0xd9, 0xc9, 0xd9, 0x2e, 0x3c, 0xfd,
-  0xd4, 0x1d, 0x10, 0x3c, 0x08, 0xcb, 0x23, 0x16, 0xd3, 0xcb, 0xd2, 0x22,
-  0x13, 0xc8, 0xba, 0x23, 0x1d, 0x11, 0xd0, 0xcc, 0x13, 0xde, 0xd9, 0xd2,
-  0x19, 0x94, 0x3d, 0xb0, 0x07, 0xd4, 0x40, 0xd1, 0xf8, 0x24, 0x06, 0xac,
-  0xba, 0xb7, 0x26, 0xd7, 0xfc, 0x17, 0x28, 0xc2, 0x9a, 0x02, 0x02, 0xc7,
-  0x23, 0x1b, 0x03, 0xa5, 0xf5, 0x03, 0x20, 0xd6, 0xb3, 0x1b, 0x25, 0x08,
-  0xa2, 0xd1, 0x2f, 0xe5, 0xa2, 0xe6, 0x16, 0xe4, 0x9d, 0xde, 0x14, 0x38,
-  0xca, 0x93, 0xb4, 0x14, 0x19, 0x06, 0x1e, 0x47, 0x35, 0xe3, 0xe4, 0x9c,
-  0x2e, 0x22, 0xfe, 0xe0, 0xbc, 0xac, 0x31, 0x29, 0x9c, 0xbc, 0xf4, 0xb4,
-  0xbc, 0x20, 0x2b, 0xd9, 0xc9, 0x23, 0xd7, 0xc7, 0xb6, 0x09, 0xe4, 0xb4,
-  0xcd, 0xe2, 0x20, 0xdc, 0xfa, 0x10, 0xc8, 0xf2, 0x2a, 0xfe, 0xc4, 0x26,
-  0xc6, 0xaf, 0xca, 0x07, 0xb7, 0xbb, 0x1e, 0xbd, 0xc3, 0xc8, 0xb0, 0xdd,
-  0x24, 0xd7, 0xcc, 0xc1, 0xa6, 0x18, 0xfe, 0xef, 0xd1, 0xf7, 0xb8, 0x1e,
-  0x15, 0xbf, 0xb0, 0xc9, 0x20, 0xe5, 0xed, 0xaa, 0xa5, 0x3a, 0x17, 0x1b,
-  0x25, 0xe1, 0xb7, 0xb6, 0xd0, 0x0a, 0xf3, 0x3f, 0x28, 0xd1, 0x28, 0x20,
-  0x35, 0x2d, 0x24, 0x2e, 0x1d, 0x2a, 0xe6, 0x4c, 0x26, 0x1d, 0xea, 0xef,
-  0xe7, 0x1c, 0xfd, 0x34, 0xeb, 0x25, 0x21, 0xf8, 0xb3, 0x0c, 0xb7, 0x19,
-  0x9c, 0xca, 0x21, 0x2a, 0xc0, 0x9e, 0xb9, 0xc9, 0xed, 0x27, 0xbc, 0xc9,
-  0x8a, 0xcd, 0xd6, 0xc3, 0xb7, 0x10, 0xf1, 0xfb, 0xd0, 0xf7, 0xde, 0x08,
-  0xae, 0xf9, 0xc6, 0xe9, 0xa3, 0xfa, 0xc8, 0xfd, 0xfe, 0xf9, 0xb5, 0x15,
-  0xf3, 0x12, 0x0b, 0x3c, 0xf1, 0x07, 0x09, 0x04, 0x92, 0xea, 0xbc, 0x02,
-  0xe8, 0x24, 0xb1, 0x81, 0xe5, 0xe9, 0xf6, 0xc7, 0xf5, 0xdc, 0xe2, 0xea,
-  0xbf, 0xda, 0x0b, 0xd1, 0x28, 0xe3, 0x08, 0x10, 0x02, 0xab, 0xb7, 0xb3,
-  0x00, 0x25, 0x11, 0xc0, 0xd8, 0x3d, 0xf8, 0x40, 0xbf, 0xa0, 0x1f, 0xe2,
-  0x31, 0x49, 0x08, 0x47, 0x84, 0x4c, 0x45, 0x0b, 0x9f, 0x3c, 0xcc, 0x2e,
-  0xca, 0xf5, 0x08, 0xe6, 0xb1, 0x26, 0x98, 0x27, 0xe7, 0x54, 0xf7, 0x2a,
-  0xc4, 0xbc, 0x15, 0xfa, 0xf4, 0xc4, 0xc7, 0x2e, 0xa4, 0x2d, 0x08, 0x5f,
-  0xee, 0xd5, 0xfa, 0x34, 0xe1, 0x15, 0x3e, 0xf5, 0x97, 0xe5, 0xa7, 0xe7,
-  0xad, 0x45, 0x5e, 0x63, 0xb5, 0xc7, 0x41, 0x35, 0x0d, 0xd4, 0x2e, 0x1d,
-  0xc9, 0x5a, 0x08, 0xe2, 0x4f, 0xfc, 0x32, 0xac, 0x53, 0x44, 0x30, 0x90,
-  0xf2, 0xca, 0xef, 0x4c, 0x64, 0x3e, 0xf1, 0x49, 0xd3, 0x8f, 0x5e, 0xef,
-  0xc5, 0x4f, 0x01, 0x4f, 0xfe, 0xd6, 0x3a, 0x9a, 0x1d, 0x11, 0xe7, 0xee,
-  0x4a, 0xab, 0x8f, 0xf3, 0xac, 0xc4, 0x97, 0xa8, 0x4a, 0x8f, 0x9b, 0xf0,
-  0x30, 0xc9, 0x41, 0x54, 0x54, 0xcd, 0x51, 0xbb, 0xdb, 0x37, 0xa8, 0xba,
-  0xe5, 0x3c, 0x22, 0x96, 0xa8, 0xaa, 0x30, 0xff, 0xd4, 0x1b, 0xcf, 0xb5,
-  0x90, 0xda, 0xe6, 0x10, 0xc7, 0x59, 0xbe, 0xcb, 0x38, 0xa4, 0xaf, 0xbe,
-  0xde, 0x20, 0xac, 0xd1, 0x10, 0xa3, 0x1f, 0xa2, 0x34, 0x25, 0x13, 0xbb,
-  0x1b, 0xf7, 0x56, 0xc0, 0xbb, 0x43, 0xeb, 0x51, 0x0f, 0x2d, 0x29, 0xcb,
-  0xf9, 0x1b, 0xec, 0x62, 0xc6, 0x06, 0xee, 0xf7, 0x51, 0xfb, 0x4c, 0x98,
-  0xda, 0x5f, 0x4f, 0xc6, 0xa1, 0x35, 0xf7, 0x1e, 0x22, 0xcd, 0xe8, 0x67,
-  0x4e, 0xc7, 0xdc, 0xd4, 0x9e, 0x56, 0x6b, 0x56, 0xbb, 0xb7, 0x22, 0x90,
-  0xe7, 0xcd, 0x37, 0x37, 0x2d, 0x8f, 0xe9, 0xbd, 0x04, 0x95, 0xe4, 0xa7,
-  0xca, 0xb8, 0x89, 0x9c, 0x5a, 0x3a, 0x3c, 0xc7, 0xee, 0x16, 0xd0, 0xc3,
-  0x13, 0x0b, 0x90, 0x88, 0x5a, 0xcf, 0xf2, 0x97, 0xde, 0x4d, 0xa6, 0x19,
-  0xce, 0x44, 0x93, 0xfd, 0x4e, 0xd6, 0x1d, 0xc5, 0x3a, 0x35, 0x98, 0x33,
-  0x4c, 0x3f, 0xd6, 0x57, 0x8f, 0xf2, 0x00, 0x65, 0xb1, 0x46, 0x2c, 0xab,
-  0xfe, 0x9c, 0x4e, 0x1e, 0x2c, 0x22, 0x14, 0xdf, 0xa7, 0x57, 0xf5, 0xf4,
-  0x52, 0x44, 0x4e, 0x05, 0x4a, 0x35, 0xa5, 0x59, 0xc7, 0xaa, 0x27, 0x21,
-  0xb3, 0x9e, 0xff, 0xe8, 0x4b, 0xc2, 0xac, 0x28, 0x98, 0x95, 0x13, 0x04,
-  0x62, 0xdd, 0xd8, 0x42, 0x13, 0x92, 0x40, 0x94, 0xdf, 0xb5, 0xc8, 0x4e,
-  0xd3, 0x94, 0xd9, 0xe5, 0x31, 0x8c, 0x0b, 0xa9, 0xa8, 0xc6, 0xcf, 0x99,
-  0xe8, 0x24, 0xee, 0xc3, 0xc0, 0x17, 0xfd, 0xde, 0x00, 0xf0, 0x00, 0x21,
-  0x5e, 0xdb, 0xe8, 0x51, 0xad, 0xb9, 0x96, 0x35, 0xfd, 0x56, 0xb8, 0xfc,
-  0x22, 0x08, 0x43, 0x25, 0xab, 0x92, 0x56, 0x0e, 0x19, 0x43, 0x34, 0x45,
-  0xa7, 0xa9, 0x60, 0xf9, 0x08, 0x3e, 0xfb, 0xe1, 0x51, 0x2b, 0x2a, 0x0d,
-  0xb4, 0x0e, 0xb8, 0x61, 0x95, 0x48, 0x66, 0xf0, 0xfe, 0x33, 0xbe, 0x60,
-  0x97, 0x98, 0x52, 0x12, 0xae, 0xf9, 0x38, 0xbe, 0x1d, 0x84, 0x98, 0x8f,
-  0x02, 0xc4, 0x30, 0x16, 0x66, 0x48, 0x3e, 0x46, 0x23, 0x3a, 0x17, 0xf1,
-  0x25, 0x26, 0x28, 0xc6, 0x1f, 0xcc, 0xa8, 0x25, 0xe2, 0x0d, 0x1e, 0x9a,
-  0xfc, 0x4b, 0xa8, 0xdf, 0x50, 0x8f, 0xa2, 0x5c, 0xa0, 0x3c, 0xe0, 0x31,
-  0xed, 0x19, 0xed, 0x8f, 0x1e, 0xe9, 0x28, 0x04, 0x8d, 0x3b, 0x66, 0xe8,
-  0xcb, 0xb7, 0xfd, 0x47, 0xcf, 0xfd, 0x15, 0xfb, 0xd9, 0xab, 0xcf, 0xc4,
-  0x29, 0x40, 0x4a, 0xac, 0x1e, 0xaf, 0xa5, 0xd7, 0xb2, 0xd4, 0xbf, 0x71,
-  0xb5, 0xf9, 0x35, 0xa6, 0xfc, 0x81, 0x52, 0x9d, 0xf6, 0xea, 0x30, 0xf8,
-  0x04, 0x50, 0x23, 0xfd, 0x46, 0x03, 0xde, 0x92, 0xeb, 0xb8, 0xdc, 0x5b,
-  0x8d, 0x65, 0xd4, 0x3a, 0x40, 0x17, 0xd2, 0x22, 0x48, 0xf7, 0xd6, 0x1c,
-  0xf9, 0xd7, 0xb7, 0x1e, 0x04, 0xb8, 0x84, 0x21, 0x37, 0x34, 0xdf, 0x45,
-  0xd4, 0x34, 0xfd, 0x20, 0x48, 0xe5, 0x13, 0x43, 0x35, 0xf5, 0x69, 0x3a,
-  0xc5, 0x26, 0x6b, 0xd9, 0xc6, 0xb1, 0xe8, 0xbb, 0xae, 0x8f, 0xff, 0x42,
-  0x10, 0x20, 0x11, 0x38, 0x92, 0x44, 0x60, 0x1f, 0x02, 0x0c, 0x51, 0xab,
-  0x17, 0xb5, 0x40, 0x28, 0x2f, 0xda, 0xd3, 0xe8, 0x53, 0xd2, 0x3b, 0x60,
-  0x13, 0x34, 0xa1, 0xc8, 0x38, 0x83, 0xfe, 0xf7, 0x8f, 0x0b, 0x37, 0x4b,
-  0xac, 0xcd, 0xd4, 0x2e, 0xdc, 0xf2, 0x9e, 0x33, 0xd9, 0x0b, 0xb4, 0x6a,
-  0xe8, 0xbc, 0xb7, 0x3e, 0x9f, 0x44, 0x12, 0x3c, 0x3c, 0x0c, 0xc5, 0x5d,
-  0x01, 0x81, 0x4c, 0x59, 0xbb, 0x99, 0x2a, 0x01, 0x9a, 0xec, 0xf7, 0xaf,
-  0x0f, 0x15, 0x27, 0x54, 0x5a, 0xc2, 0x62, 0x63, 0x58, 0xdd, 0x4a, 0xd8,
-  0x14, 0xcb, 0xe0, 0x52, 0xae, 0x24, 0x70, 0xb1, 0xda, 0xe5, 0x92, 0x33,
-  0x13, 0x4c, 0xf6, 0xb9, 0x0d, 0x46, 0x13, 0x17, 0x63, 0xb4, 0xfd, 0x2b,
-  0xeb, 0xd4, 0x2b, 0xa4, 0xa7, 0xe8, 0x2f, 0xa2, 0x23, 0x29, 0x45, 0xa2,
-  0xef, 0xe7, 0xb9, 0xe3, 0xdf, 0x3f, 0x0d, 0x1c, 0xc0, 0x93, 0xb8, 0xff,
-  0x00, 0x5c, 0xeb, 0xcd, 0x2c, 0x3f, 0xb8, 0xca, 0xae, 0xbf, 0x4e, 0x59,
-  0xe4, 0x2f, 0x95, 0xb9, 0x46, 0x63, 0x26, 0x0e, 0x43, 0xf4, 0x5f, 0x0d,
-  0x25, 0xae, 0xd4, 0xaa, 0x96, 0x10, 0xf0, 0xec, 0x35, 0x1f, 0x07, 0x3e,
-  0x2b, 0xe0, 0x97, 0x3f, 0x50, 0x09, 0xb0, 0xfd, 0x08, 0xb5, 0x1c, 0x04,
-  0xb5, 0x42, 0x29, 0xfb, 0x17, 0xb0, 0x2f, 0x99, 0x24, 0xed, 0xb6, 0xab,
-  0xd1, 0xf6, 0x15, 0xbc, 0xa3, 0x1c, 0xaa, 0xdf, 0x57, 0x45, 0xb8, 0xe9,
-  0xbd, 0xbc, 0x27, 0x1b, 0xca, 0x48, 0x5a, 0x0c, 0x50, 0xd1, 0x90, 0xa6,
-  0x67, 0x11, 0x5c, 0x1b, 0x62, 0x8e, 0xeb, 0xa2, 0x5c, 0x20, 0x96, 0xd8,
-  0xec, 0xfc, 0xd1, 0xad, 0x0a, 0x5a, 0xa7, 0xb2, 0x99, 0xdd, 0xcb, 0xfa,
-  0xb9, 0x42, 0xf8, 0xc8, 0x01, 0xf7, 0xec, 0xd8, 0x28, 0xcd, 0x5f, 0x5b,
-  0xe2, 0x61, 0x59, 0xfb, 0xe1, 0xcb, 0x1b, 0x51, 0x3c, 0xbd, 0x3e, 0xc9,
-  0x5b, 0x2b, 0xfb, 0x9f, 0x30, 0x56, 0x30, 0xb2, 0xc1, 0xe3, 0x67, 0xd9,
-  0xdd, 0xa0, 0x31, 0xbb, 0x16, 0xdd, 0x2b, 0x93, 0x9c, 0xb1, 0x2c, 0xdc,
-  0xd5, 0x5a, 0xbe, 0x57, 0x31, 0x5f, 0x0d, 0x3d, 0x3d, 0xbb, 0xa4, 0x31,
-  0x01, 0xe0, 0x3f, 0x9c, 0xd2, 0x42, 0xb3, 0x0d, 0xa0, 0x01, 0xa1, 0xca,
-  0x65, 0xb0, 0xe0, 0x6a, 0x12, 0x8e, 0xe9, 0xb5, 0x92, 0xa1, 0xf4, 0x8b,
-  0xf1, 0x94, 0xae, 0xfd, 0xfc, 0xe9, 0x09, 0x19, 0xe0, 0x6a, 0xc9, 0x22,
-  0x4f, 0xa1, 0x4e, 0x5d, 0x1b, 0x15, 0x5b, 0x19, 0xfb, 0xfe, 0x9d, 0x20,
-  0xe9, 0xd5, 0xdd, 0xe3, 0x17, 0x10, 0x41, 0x00, 0x9d, 0xe4, 0x6f, 0x90,
-  0xb5, 0x4e, 0x01, 0x2d, 0x27, 0xf5, 0xd9, 0x56, 0xf6, 0xac, 0x63, 0x44,
-  0x73, 0x62, 0x09, 0x42, 0xc0, 0x11, 0xaa, 0x4b, 0xa3, 0x1a, 0x0a, 0xca,
-  0xb7, 0x30, 0xe1, 0xb3, 0xec, 0xe4, 0xc8, 0xd8, 0x1c, 0x6a, 0x84, 0x44,
-  0xfb, 0xbd, 0xef, 0xd7, 0xb6, 0x51, 0x2b, 0xb4, 0x57, 0xb1, 0x40, 0x08,
-  0x2e, 0x14, 0x00, 0x01, 0x2e, 0x85, 0xcf, 0xb6, 0x09, 0x65, 0xa4, 0xa7,
-  0x95, 0x39, 0xd0, 0x68, 0xab, 0xc7, 0xe8, 0x5c, 0x11, 0xa3, 0x36, 0x6d,
-  0xd0, 0x64, 0xf6, 0xd0, 0xa0, 0x20, 0xb9, 0x5d, 0x47, 0x36, 0xaf, 0x22,
-  0x40, 0x35, 0xf0, 0xac, 0xd1, 0x96, 0xba, 0xa9, 0xe1, 0xef, 0x2b, 0x85,
-  0x16, 0xfa, 0x11, 0xfd, 0x49, 0xf1, 0xf0, 0xd3, 0xac, 0x38, 0x3d, 0x95,
-  0x1b, 0xec, 0xf2, 0xaa, 0x49, 0xa4, 0x10, 0x1c, 0x95, 0xfd, 0x90, 0x0f,
-  0x61, 0xda, 0x2e, 0xe6, 0x4b, 0x83, 0x99, 0x02, 0x0a, 0x21, 0xf4, 0x85,
-  0xac, 0x82, 0x48, 0xba, 0xba, 0x35, 0xa5, 0xca, 0xa5, 0xee, 0xf2, 0xd2,
-  0xba, 0x15, 0x67, 0x3b, 0x55, 0x8e, 0xd7, 0x92, 0xd9, 0x12, 0xc9, 0x9c,
-  0x31, 0xf6, 0xa4, 0x81, 0xb4, 0xec, 0x4f, 0xb4, 0xb9, 0xe9, 0x3f, 0x41,
-  0x5c, 0x6c, 0x8e, 0xd0, 0xca, 0x18, 0xe3, 0xc2, 0xb2, 0xf0, 0xdc, 0x53,
-  0x5a, 0xf7, 0xc2, 0xba, 0x96, 0xd0, 0xf8, 0xdf, 0xc1, 0xbc, 0x24, 0x04,
-  0xfc, 0x9a, 0xb5, 0x16, 0x36, 0x00, 0x96, 0xc6, 0xd3, 0xcc, 0x2f, 0xdd,
-  0x1c, 0xb2, 0xc9, 0xeb, 0x51, 0x59, 0x47, 0xcc, 0x56, 0xe9, 0x05, 0xb6,
-  0x62, 0x28, 0xa3, 0xb5, 0x00, 0x16, 0xfe, 0x1f, 0xe4, 0xc1, 0x3b, 0xb0,
-  0x8d, 0x02, 0x2d, 0x30, 0x8b, 0xad, 0xe8, 0xd1, 0x09, 0xad, 0x2f, 0x34,
-  0x35, 0x5c, 0x6e, 0x57, 0x1d, 0xd9, 0x87, 0x97, 0x30, 0xad, 0x2a, 0x58,
-  0xb2, 0x59, 0xb9, 0x15, 0xfb, 0x53, 0x45, 0xe1, 0x13, 0xf3, 0x57, 0xf6,
-  0xcb, 0x6f, 0xd9, 0x2a, 0x9c, 0xf9, 0x21, 0x6c, 0xfd, 0x6a, 0x5e, 0x3d,
-  0xc7, 0xb3, 0xdf, 0xa2, 0xb7, 0xd3, 0x13, 0x67, 0x00, 0xf7, 0xee, 0x03,
-  0x2c, 0x98, 0x27, 0xe4, 0xc4, 0x2b, 0xa5, 0xe3, 0x99, 0x19, 0xff, 0x8b,
-  0x11, 0xbb, 0x9a, 0xb2, 0xef, 0xf8, 0x5c, 0xec, 0x49, 0xb9, 0x14, 0x46,
-  0xa5, 0x2e, 0x8f, 0xe7, 0x0e, 0x31, 0xa5, 0xf6, 0xf5, 0xd7, 0x19, 0x38,
-  0xfc, 0x20, 0xfe, 0xb7, 0x25, 0x23, 0xca, 0xd3, 0x6e, 0xcf, 0x1f, 0xf9,
-  0x05, 0xfd, 0xab, 0xa4, 0x4d, 0xe4, 0x91, 0x9d, 0xc3, 0x48, 0x1c, 0x64,
-  0x81, 0xb0, 0xbb, 0x9c, 0x18, 0x00, 0x4d, 0x9c, 0x93, 0xc1, 0x19, 0x66,
-  0x63, 0xc0, 0x4f, 0x07, 0x59, 0xa0, 0xdc, 0x37, 0x4e, 0x54, 0x01, 0x49,
-  0x95, 0xfa, 0x4d, 0x3e, 0x43, 0x24, 0xc4, 0xa1, 0xb2, 0x60, 0x63, 0xa5,
-  0x8f, 0x6d, 0xe3, 0x23, 0xdf, 0xa3, 0xb8, 0x61, 0x9a, 0xea, 0xe6, 0xaa,
-  0xcf, 0x21, 0xcb, 0x5f, 0x42, 0xba, 0x4b, 0xec, 0xc3, 0x0a, 0xc3, 0x8f,
-  0x8d, 0x68, 0x9e, 0xca, 0xf6, 0x51, 0x15, 0x8b, 0x46, 0x13, 0xd5, 0xb1,
-  0x35, 0xa0, 0x2e, 0xfe, 0x17, 0x55, 0xf4, 0xe2, 0x40, 0xe6, 0x3d, 0x07,
-  0xdc, 0xc8, 0x17, 0xf0, 0x4b, 0x3d, 0xef, 0x3c, 0xd0, 0x09, 0xa6, 0xe1,
-  0x5e, 0xf5, 0x3e, 0x22, 0x6b, 0x17, 0x22, 0x9f, 0x65, 0x21, 0x35, 0x06,
-  0x27, 0x1b, 0x42, 0xee, 0x83, 0x10, 0xb1, 0x41, 0x5a, 0x4b, 0xf1, 0x92,
-  0xf9, 0xb4, 0x8d, 0xa8, 0x4b, 0x52, 0xf9, 0x44, 0xb5, 0xcc, 0x50, 0xe2,
-  0x3d, 0xad, 0x04, 0x0b, 0x1d, 0x94, 0x37, 0x39, 0x11, 0xe1, 0x5c, 0x43,
-  0xe3, 0xe4, 0xc9, 0xa5, 0xf0, 0x9c, 0xec, 0xdf, 0x86, 0xb4, 0xd6, 0x0a,
-  0xb2, 0xbe, 0xd7, 0x21, 0x31, 0xcf, 0x16, 0x27, 0xc3, 0x6e, 0x0e, 0x1b,
-  0xc5, 0x37, 0x50, 0x9a, 0xb0, 0x3d, 0x35, 0xa9, 0x5d, 0x50, 0x05, 0x38,
-  0x43, 0x93, 0xdc, 0xbd, 0x97, 0x15, 0xe7, 0x0d, 0xa5, 0x9e, 0x65, 0x43,
-  0x9f, 0xd5, 0xfc, 0x4a, 0x0e, 0xa0, 0x61, 0x96, 0xae, 0xf5, 0x33, 0xb0,
-  0x3f, 0xa0, 0xdb, 0x94, 0x9a, 0xa3, 0x35, 0x3a, 0x13, 0xec, 0x65, 0xd7,
-  0xeb, 0x39, 0xb1, 0x42, 0xf1, 0xcf, 0xd5, 0x14, 0x88, 0xa3, 0xde, 0x13,
-  0xd3, 0x90, 0xb8, 0xbe, 0x6d, 0xe6, 0x96, 0x10, 0x1e, 0x5a, 0xd7, 0x06,
-  0xb8, 0x41, 0xa0, 0x0b, 0xe3, 0x1a, 0x67, 0xf8, 0x23, 0x97, 0xee, 0x0f,
-  0x0d, 0x34, 0x6e, 0xad, 0x8e, 0xb4, 0x47, 0x02, 0x61, 0x61, 0xf1, 0x15,
-  0x8c, 0xd2, 0x1f, 0x65, 0x0c, 0xc6, 0x8f, 0x4a, 0x5b, 0x6d, 0xd7, 0x35,
-  0x01, 0xfd, 0xec, 0xea, 0x38, 0x34, 0x02, 0xfd, 0xa9, 0x15, 0x64, 0xff,
-  0xc7, 0x1d, 0x30, 0xe4, 0x46, 0xe7, 0xbc, 0x2d, 0xce, 0x03, 0x4a, 0x2d,
-  0x41, 0xf6, 0x1b, 0x36, 0x88, 0x8f, 0xd2, 0x9b, 0xb3, 0x23, 0x00, 0xe3,
-  0x25, 0x2b, 0x02, 0x10, 0xe3, 0x3b, 0xf7, 0xe5, 0xb3, 0x25, 0x11, 0xc0,
-  0x45, 0xc7, 0xec, 0x1d, 0x3b, 0xec, 0xb2, 0x3c, 0x44, 0x56, 0xb7, 0x3e,
-  0x8d, 0x01, 0xf2, 0xa2, 0x2f, 0xcb, 0x3b, 0x04, 0xc8, 0xf3, 0xf1, 0xe1,
-  0x59, 0x3d, 0xdb, 0x47, 0x3b, 0xed, 0xdf, 0xa7, 0x0d, 0xde, 0xad, 0xdd,
-  0xa8, 0x54, 0xcf, 0xba, 0xe9, 0x98, 0x2e, 0xf0, 0xb0, 0x42, 0x97, 0xf8,
-  0xcf, 0xc8, 0xda, 0xdc, 0x13, 0x22, 0x0e, 0xb8, 0x58, 0x12, 0xa0, 0x4e,
-  0x1d, 0x42, 0xbd, 0x57, 0xc5, 0xcb, 0xdf, 0xc6, 0xd2, 0x1d, 0xc1, 0x52,
-  0x2c, 0xd2, 0xe8, 0x4b, 0xba, 0xf1, 0x25, 0xd4, 0x0e, 0x1e, 0xcd, 0xe3,
-  0x82, 0xd2, 0xd0, 0xde, 0xba, 0xa1, 0x8b, 0x2d, 0xfe, 0xcc, 0xea, 0xf8,
-  0xd4, 0xd3, 0xdb, 0x33, 0xc7, 0x50, 0x0b, 0x53, 0xda, 0x50, 0x31, 0xa8,
-  0x0e, 0xb1, 0xb4, 0x39, 0xcf, 0x1a, 0xd6, 0xe8, 0xb9, 0xe1, 0x9e, 0x46,
-  0x13, 0xd1, 0xe4, 0x29, 0xda, 0x10, 0x47, 0x3f, 0x95, 0xf9, 0x1a, 0xbb,
-  0x24, 0xef, 0x1c, 0x48, 0xa9, 0x25, 0x07, 0xcf, 0x2c, 0x4d, 0x43, 0xad,
-  0xf4, 0x49, 0x35, 0xe0, 0x23, 0x53, 0x43, 0xad, 0x3e, 0x03, 0xd3, 0xfd,
-  0x2e, 0x37, 0xf7, 0xd7, 0x34, 0x24, 0xe6, 0x53, 0xfb, 0xb2, 0xbd, 0x57,
-  0xe7, 0x06, 0xfc, 0x26, 0x39, 0xef, 0xdf, 0x19, 0xbb, 0x3d, 0x57, 0xa3,
-  0x8f, 0x34, 0xe2, 0xcb, 0x05, 0x5d, 0x03, 0xcf, 0x28, 0x03, 0xeb, 0x16,
-  0x40, 0xf0, 0xbd, 0x1f, 0xd5, 0x1c, 0x02, 0x50, 0x54, 0x32, 0x34, 0x16,
-  0xc5, 0xa5, 0xae, 0xa2, 0xaf, 0xc0, 0x30, 0x09, 0x8a, 0x49, 0x47, 0x5c,
-  0x3a, 0xb2, 0x24, 0xd2, 0x12, 0xa4, 0x32, 0xb3, 0x3e, 0xd1, 0x30, 0x01,
-  0xf2, 0x18, 0x45, 0x9a, 0x34, 0x0a, 0xbe, 0xfa, 0xee, 0x4b, 0xee, 0x29,
-  0xe9, 0xb2, 0x53, 0xd1, 0xcd, 0xc7, 0xdf, 0x48, 0x1d, 0x1c, 0x06, 0xc2,
-  0xd6, 0xf8, 0x0f, 0x2c, 0xab, 0x37, 0xb7, 0xc8, 0xa6, 0x3b, 0x25, 0x57,
-  0xf3, 0x95, 0xa0, 0xf7, 0x38, 0x96, 0xed, 0xae, 0x07, 0xdf, 0xf3, 0x3c,
-  0xc6, 0x2d, 0xde, 0x22, 0xe5, 0xda, 0x97, 0x1a, 0xe1, 0x3d, 0x48, 0x60,
-  0x16, 0x27, 0xca, 0xa7, 0xed, 0x41, 0x56, 0xc4, 0xa9, 0xbc, 0x11, 0xc3,
-  0xe6, 0x9d, 0x47, 0xba, 0xf4, 0xf9, 0x0a, 0x06, 0x02, 0xd5, 0xe8, 0x38,
-  0x11, 0x61, 0x28, 0xf1, 0x96, 0x3e, 0x15, 0x1e, 0xcb, 0x35, 0x47, 0xc4,
-  0x29, 0x5d, 0xf2, 0xd1, 0x49, 0x19, 0x42, 0x93, 0x28, 0xcf, 0x26, 0x48,
-  0x27, 0xa0, 0x36, 0x48, 0xc1, 0x33, 0x23, 0xd2, 0xd7, 0xc4, 0x24, 0x00,
-  0xc9, 0x0d, 0xb5, 0x3a, 0x35, 0xe3, 0x0b, 0xcf, 0x0d, 0x1d, 0xc2, 0x4b,
-  0x9c, 0x11, 0xd5, 0xc1, 0x0d, 0xf3, 0x15, 0xef, 0x4c, 0x44, 0x1f, 0x24,
-  0x05, 0xea, 0x29, 0xbd, 0x08, 0x3e, 0xaa, 0xbe, 0xda, 0xa7, 0x2c, 0xde,
-  0x9b, 0x00, 0x32, 0xe6, 0x2b, 0x15, 0x2d, 0xf8, 0x26, 0xa3, 0xb7, 0xd5,
-  0xc9, 0x09, 0x25, 0x4c, 0x22, 0x01, 0xfa, 0xb5, 0x2b, 0xc9, 0x02, 0x2b,
-  0x1b, 0xf3, 0x2f, 0x32, 0xf8, 0x18, 0x0f, 0x65, 0x3a, 0xc9, 0x0d, 0xb4,
-  0xa2, 0xc5, 0x0f, 0x20, 0xea, 0xea, 0x20, 0xd3, 0xa7, 0x4a, 0xd1, 0xdb,
-  0xe9, 0xb6, 0x0a, 0xe6, 0x24, 0x24, 0x08, 0xb4, 0x27, 0x90, 0x81, 0xb8,
-  0x38, 0x38, 0x09, 0xb9, 0x2c, 0x1a, 0xb0, 0x37, 0xd7, 0xfe, 0x47, 0xa2,
-  0xa8, 0x2c, 0x12, 0xeb, 0x89, 0xea, 0x9c, 0x2f, 0xfe, 0xcf, 0x2d, 0x05,
-  0x98, 0xd3, 0x3f, 0x13, 0x29, 0xa1, 0x38, 0x29, 0xda, 0x22, 0xf4, 0x2b,
-  0xe0, 0xe0, 0x23, 0x17, 0xfc, 0x19, 0xf0, 0x09, 0xe4, 0xf4, 0xff, 0x28,
-  0xd1, 0xfd, 0x2b, 0xf1, 0x2f, 0xbe, 0xfa, 0xfc, 0xd5, 0x3f, 0xdb, 0xfe,
-  0xd2, 0x24, 0xcd, 0xdc, 0xda, 0x0e, 0xfd, 0x21, 0xda, 0xc8, 0x13, 0x17,
-  0x09, 0x21, 0xec, 0x18, 0xe4, 0xf0, 0x32, 0x0d, 0x03, 0x03, 0x11, 0x02,
-  0x22, 0xc8, 0xf1, 0xf5, 0x02, 0x1e, 0xd7, 0xe6, 0xb9, 0x29, 0xfa, 0xe2,
-  0xea, 0x24, 0xfc, 0x13, 0xfa, 0xfd, 0x15, 0x20, 0x1a, 0x3a, 0x16, 0x10,
-  0xfe, 0xe7, 0x30, 0x21, 0xfc, 0xf7, 0x16, 0x14, 0x53, 0xdc, 0xfa, 0xf9,
-  0xfa, 0x3f, 0xec, 0x12, 0xd1, 0x46, 0xd1, 0x0f, 0xdf, 0xe8, 0x04, 0x2c,
-  0xda, 0xfc, 0x09, 0x2a, 0x0f, 0x09, 0xfb, 0x0b, 0x02, 0x19, 0x04, 0xfe,
-  0xf6, 0xe1, 0x0b, 0xed, 0x02, 0xd1, 0x12, 0xf1, 0xdd, 0x33, 0xee, 0xea,
-  0xd7, 0xf9, 0xef, 0xe4, 0x0d, 0xfe, 0xf7, 0x25, 0xf9, 0xe8, 0xf6, 0x14,
-  0x02, 0x0c, 0xe2, 0x21, 0xd7, 0xe8, 0x1c, 0x0c, 0xd4, 0xcf, 0x73, 0xe8,
-  0x1f, 0xdf, 0xed, 0x11, 0xef, 0x08, 0xda, 0xe8, 0xe4, 0x38, 0xe5, 0xd4,
-  0x01, 0x06, 0xd9, 0x27, 0x22, 0xda, 0x0e, 0x16, 0x18, 0x35, 0x02, 0x19,
-  0xf9, 0xbf, 0x32, 0x1f, 0xf8, 0xea, 0x60, 0xfd, 0x24, 0xfe, 0xe3, 0x05,
-  0xdf, 0x18, 0xff, 0xf7, 0xd7, 0x13, 0xeb, 0xff, 0xf7, 0x0a, 0xdf, 0x0a,
-  0xfd, 0xfe, 0x0a, 0x1c, 0x37, 0x32, 0xe5, 0x1e, 0xe7, 0xdc, 0xfe, 0x27,
-  0xdc, 0xe1, 0x7f, 0xff, 0x30, 0xe3, 0xff, 0xfd, 0xde, 0x35, 0xeb, 0x0c,
-  0xc8, 0x18, 0xcd, 0xfc, 0xdc, 0x0c, 0xeb, 0xf4, 0xce, 0xe6, 0x0a, 0xed,
-  0xfe, 0x02, 0xde, 0xf5, 0xfa, 0xf9, 0xe7, 0x11, 0xfc, 0xde, 0xe1, 0x08,
-  0x1a, 0xd1, 0x0c, 0x0f, 0xf8, 0x21, 0xde, 0xea, 0xdd, 0x27, 0xdb, 0x1d,
-  0xee, 0x0a, 0x08, 0x27, 0x09, 0xd4, 0xf5, 0x06, 0xec, 0x31, 0x22, 0x17,
-  0xd7, 0xeb, 0xf9, 0x09, 0xe1, 0xf7, 0x6d, 0xe6, 0x29, 0xf3, 0xec, 0x03,
-  0xf4, 0x38, 0x08, 0xf0, 0xb7, 0x3f, 0xf9, 0x02, 0x05, 0x13, 0xe4, 0xff,
-  0xfb, 0xe2, 0x0d, 0x00, 0x12, 0x26, 0xf4, 0x05, 0xe0, 0xfb, 0x07, 0x16,
-  0xf2, 0xcf, 0x77, 0x04, 0x13, 0xda, 0xfa, 0x13, 0xe8, 0x38, 0xe2, 0xe8,
-  0xaa, 0x3e, 0xda, 0x04, 0xf3, 0xe2, 0xf9, 0xfe, 0x0c, 0xf6, 0x00, 0x24,
-  0x1d, 0x37, 0x0d, 0x0c, 0xe8, 0x02, 0x2f, 0x15, 0xff, 0xe2, 0x71, 0x1c,
-  0x2b, 0xcc, 0xe1, 0x07, 0xd0, 0x21, 0xf0, 0xfb, 0xb7, 0x53, 0xd4, 0x0f,
-  0xeb, 0xe7, 0xf4, 0x14, 0xef, 0xda, 0xf1, 0x25, 0xe8, 0x32, 0xe4, 0xfd,
-  0xe2, 0x12, 0x06, 0x04, 0xe5, 0xe2, 0x01, 0xf4, 0x1c, 0xda, 0xfa, 0x1c,
-  0xf1, 0x2b, 0x01, 0x1b, 0xda, 0x2a, 0xed, 0x34, 0x07, 0xef, 0x14, 0x0c,
-  0xb6, 0xf5, 0xed, 0x07, 0x18, 0x06, 0xfd, 0xf6, 0x00, 0xcd, 0xeb, 0x26,
-  0xee, 0xe4, 0xf6, 0x04, 0x15, 0xd6, 0xf7, 0xe8, 0xc7, 0x24, 0x0a, 0xef,
-  0xd5, 0xf3, 0xd1, 0xb1, 0xd7, 0xe9, 0xe8, 0x12, 0xdd, 0x15, 0x17, 0x1d,
-  0xf7, 0x31, 0x10, 0x0c, 0xe6, 0xdb, 0x25, 0x24, 0x0b, 0xd8, 0x14, 0x1c,
-  0xf7, 0xe6, 0x04, 0x08, 0xe5, 0x14, 0xcb, 0xf7, 0xb2, 0x1c, 0xcc, 0xe7,
-  0xd9, 0xfa, 0xf6, 0x21, 0xcb, 0x10, 0x23, 0xfe, 0x24, 0xff, 0x0f, 0x2b,
-  0xfd, 0xc2, 0x15, 0x00, 0xea, 0xdc, 0x01, 0xe8, 0x0f, 0xec, 0xf6, 0xeb,
-  0xd2, 0xfd, 0xdd, 0x04, 0xd4, 0x24, 0xdb, 0xd1, 0xe9, 0xfa, 0x14, 0x1b,
-  0xc8, 0x14, 0x06, 0x04, 0xf1, 0x2a, 0xe6, 0x26, 0x07, 0xe2, 0xe7, 0xf9,
-  0xf4, 0xcc, 0xde, 0x25, 0x15, 0xe1, 0xff, 0xf1, 0xb5, 0x2a, 0xe8, 0xed,
-  0xea, 0xea, 0xd3, 0xec, 0xf0, 0xe8, 0xf6, 0xdc, 0xd0, 0xd4, 0xea, 0xe9,
-  0xb6, 0xea, 0x02, 0xf3, 0x06, 0xe6, 0xf5, 0xec, 0xfe, 0x06, 0x27, 0x17,
-  0xdf, 0xdf, 0x17, 0x09, 0xf2, 0xbc, 0xf8, 0xff, 0x1e, 0xd8, 0x20, 0x18,
-  0x0f, 0x05, 0xd0, 0xdd, 0xe0, 0xe4, 0x11, 0xd7, 0xa3, 0xed, 0x01, 0xfb,
-  0x06, 0xfb, 0xe9, 0xf9, 0x02, 0x0c, 0x24, 0xef, 0xd9, 0xd5, 0xf6, 0xfb,
-  0xae, 0xc0, 0xfe, 0x10, 0x24, 0xbc, 0x2e, 0x06, 0x02, 0x15, 0xd5, 0xd1,
-  0xcf, 0xea, 0x16, 0xd4, 0xad, 0x02, 0x18, 0xf3, 0x23, 0xf4, 0x02, 0x15,
-  0x20, 0x1b, 0x30, 0x0a, 0xda, 0xd9, 0x06, 0x0f, 0xc4, 0xb4, 0x09, 0xf4,
-  0x18, 0xda, 0x1b, 0x17, 0x19, 0x16, 0x0c, 0xf5, 0xff, 0xfc, 0xfa, 0xe0,
-  0x03, 0xf4, 0xfe, 0x10, 0x21, 0xcf, 0x0d, 0x22, 0x16, 0xef, 0x1f, 0xf2,
-  0x1e, 0x27, 0xd4, 0x16, 0xcd, 0xc6, 0xfd, 0x01, 0x0c, 0xaf, 0x2c, 0x2e,
-  0x15, 0xf1, 0x11, 0xe0, 0x03, 0xcb, 0xe6, 0xd4, 0x9f, 0xf2, 0xff, 0x0a,
-  0x0a, 0x11, 0x11, 0xed, 0xcd, 0x04, 0xa1, 0x07, 0xf9, 0xbd, 0x14, 0xf6,
-  0x0d, 0xdc, 0x05, 0xf3, 0x26, 0x81, 0xb5, 0xae, 0x1f, 0x06, 0x2c, 0xf6,
-  0xf0, 0xa6, 0xfb, 0xdc, 0xb7, 0x09, 0x0b, 0x08, 0x0f, 0x25, 0x0c, 0x01,
-  0xc9, 0x1f, 0x9a, 0xf0, 0xe7, 0xbe, 0x09, 0x02, 0xa5, 0xbc, 0x2b, 0x10,
-  0x21, 0x95, 0xd9, 0xb3, 0x08, 0xf8, 0x32, 0xe0, 0xe9, 0xa6, 0xfd, 0xdc,
-  0xaa, 0xf1, 0xfa, 0xfe, 0x28, 0x10, 0x17, 0x16, 0xdc, 0x05, 0x91, 0x00,
-  0xda, 0xb7, 0x05, 0x0e, 0xb1, 0xb0, 0x2f, 0xfe, 0x31, 0xa0, 0xc5, 0x9e,
-  0x03, 0x12, 0x1f, 0x1a, 0xc3, 0xd7, 0x22, 0xef, 0xf5, 0xed, 0x17, 0x18,
-  0x13, 0xd6, 0x1d, 0x1f, 0x0b, 0x00, 0x1b, 0x0c, 0x08, 0x34, 0xe1, 0xf3,
-  0xc6, 0xca, 0x0b, 0x13, 0x13, 0xac, 0x0e, 0xda, 0x1c, 0x07, 0x19, 0xf0,
-  0x0c, 0xba, 0xf4, 0xe3, 0xc8, 0x0a, 0xf8, 0xfb, 0x10, 0x01, 0x10, 0xea,
-  0xb4, 0x1a, 0xa9, 0x04, 0x03, 0xac, 0x20, 0x02, 0xf1, 0xba, 0x18, 0x13,
-  0x1b, 0x8e, 0xb7, 0xa2, 0x07, 0xfc, 0x17, 0xe5, 0xf5, 0x96, 0xfe, 0xcd,
-  0xb7, 0x07, 0xf7, 0x14, 0x21, 0x12, 0x17, 0xef, 0xc1, 0x10, 0xbe, 0xff,
-  0xfd, 0xa7, 0x15, 0xee, 0xa2, 0xb1, 0x2d, 0xfd, 0x43, 0x95, 0xc5, 0x93,
-  0x11, 0xf6, 0x2b, 0xe4, 0xe4, 0xbc, 0x0e, 0xde, 0xc5, 0xe5, 0x20, 0xff,
-  0x36, 0x12, 0x12, 0xe6, 0xd9, 0x12, 0xbf, 0xf0, 0xf0, 0xbd, 0xfb, 0x01,
-  0xa7, 0xbf, 0x2d, 0x13, 0x41, 0x95, 0xc2, 0x8e, 0x16, 0x17, 0x1d, 0x16,
-  0xa1, 0xaf, 0x21, 0xe5, 0x10, 0xdd, 0x20, 0xf9, 0x09, 0xe0, 0x1f, 0x1c,
-  0x17, 0x00, 0x2b, 0x10, 0x03, 0x11, 0xef, 0xf5, 0xb7, 0xc6, 0x1e, 0x04,
-  0x2a, 0xa7, 0x1f, 0xc1, 0x0d, 0x15, 0xfe, 0xfd, 0xc9, 0x11, 0x08, 0xfa,
-  0xb7, 0x19, 0x1f, 0x0d, 0xf1, 0x11, 0x07, 0x0e, 0xfb, 0xbe, 0xea, 0x06,
-  0x0f, 0xca, 0xfb, 0xf6, 0xee, 0xff, 0xfd, 0x0e, 0xf0, 0xd3, 0xc9, 0xbd,
-  0x23, 0x02, 0x0d, 0xe0, 0xbe, 0x06, 0x17, 0xf2, 0xbd, 0xf7, 0x0f, 0xfb,
-  0xde, 0x3d, 0x0f, 0x20, 0x0d, 0xb0, 0xe9, 0x02, 0xff, 0xe2, 0xe3, 0xee,
-  0xc1, 0xe2, 0x0a, 0xff, 0x2b, 0xc8, 0xe3, 0xcf, 0x0f, 0x17, 0x23, 0x01,
-  0xb7, 0x04, 0xf5, 0x0c, 0xb0, 0x18, 0xf8, 0x00, 0xdc, 0x0e, 0x17, 0x16,
-  0xfd, 0xd0, 0xc8, 0xf1, 0xf5, 0xe0, 0xe7, 0x07, 0xd2, 0xf8, 0x29, 0x16,
-  0x24, 0xd9, 0xd7, 0xb2, 0x12, 0x19, 0x14, 0x09, 0xef, 0x00, 0x1b, 0x1d,
-  0x03, 0x15, 0x03, 0x13, 0x09, 0xf9, 0x1e, 0x1d, 0xf4, 0xc1, 0x0b, 0x0b,
-  0x02, 0x27, 0x1b, 0x11, 0xc0, 0xf9, 0xf8, 0x0a, 0x15, 0xfe, 0x1a, 0xd6,
-  0x0e, 0xdf, 0xe3, 0xf0, 0xa0, 0x2e, 0xdd, 0x19, 0xdb, 0xa8, 0x4c, 0xb5,
-  0xd1, 0xf3, 0x1a, 0x22, 0x7b, 0x01, 0x3e, 0x62, 0xdb, 0xf0, 0x31, 0xa3,
-  0xb9, 0xeb, 0x01, 0x42, 0xdd, 0xcc, 0xac, 0x0a, 0xd2, 0x47, 0xa6, 0xf2,
-  0x32, 0x3b, 0x16, 0x4e, 0xb9, 0xb4, 0xcc, 0x0c, 0xd6, 0x0f, 0x28, 0x91,
-  0x73, 0x9f, 0xbd, 0x0f, 0xf4, 0x1f, 0xf2, 0xf2, 0xfd, 0xcb, 0xaa, 0x3b,
-  0x97, 0x35, 0x22, 0xe9, 0xb9, 0xdc, 0x46, 0x0b, 0xce, 0x64, 0xe9, 0xcb,
-  0x29, 0x00, 0xed, 0x0c, 0xcc, 0xde, 0x56, 0x39, 0xdd, 0xa1, 0xae, 0xdc,
-  0x3f, 0xbe, 0x9b, 0x3a, 0x76, 0x52, 0x3c, 0xb1, 0xdd, 0x41, 0xac, 0x6a,
-  0xff, 0x50, 0x4a, 0xca, 0xc8, 0x5e, 0x8e, 0xd1, 0xd7, 0xfa, 0x59, 0xc3,
-  0x95, 0x1b, 0xe4, 0x44, 0xf0, 0x10, 0x30, 0x42, 0xfc, 0x53, 0x5a, 0xa0,
-  0x28, 0x90, 0xd5, 0x09, 0xc8, 0x24, 0xdf, 0xd0, 0x01, 0xf5, 0xd1, 0xec,
-  0xf5, 0x0e, 0x2c, 0x96, 0x26, 0x9b, 0x01, 0x9f, 0x95, 0xe2, 0xbb, 0xa5,
-  0x10, 0xa4, 0xf4, 0x65, 0x2b, 0x2c, 0xe8, 0xa1, 0x15, 0x03, 0x96, 0x12,
-  0x91, 0x6e, 0x4d, 0xe9, 0xd2, 0xb9, 0x09, 0xea, 0x2b, 0xb3, 0x96, 0x97,
-  0x98, 0xb9, 0xa6, 0xc5, 0xac, 0x90, 0xdd, 0xd0, 0x0b, 0x90, 0x32, 0x12,
-  0xdf, 0x0c, 0x37, 0x5f, 0xf6, 0x89, 0xda, 0xfc, 0xd5, 0xcb, 0xd1, 0xee,
-  0x81, 0xb4, 0x8f, 0x45, 0x52, 0xe6, 0xd5, 0xfd, 0x13, 0xfc, 0x39, 0x2a,
-  0x45, 0xa9, 0x2d, 0xfd, 0xff, 0xbe, 0xf8, 0x09, 0xc1, 0x44, 0x5c, 0x4f,
-  0x31, 0xe6, 0x34, 0xc7, 0x25, 0x6a, 0x59, 0x55, 0xe2, 0xfc, 0x28, 0x11,
-  0x65, 0x45, 0x42, 0x51, 0xda, 0xd2, 0xa2, 0x4b, 0x2b, 0xdd, 0xfd, 0x1f,
-  0xd3, 0x9a, 0x51, 0x46, 0xf5, 0xdb, 0xe9, 0xb1, 0xcc, 0x02, 0x49, 0x3e,
-  0x15, 0xfc, 0x1f, 0x2d, 0x36, 0xb4, 0xc2, 0x42, 0x0d, 0xad, 0x21, 0x41,
-  0xce, 0xb3, 0x0a, 0xf6, 0xa0, 0x51, 0x2f, 0xbf, 0x25, 0xfc, 0x45, 0xe1,
-  0x91, 0x51, 0x0a, 0x59, 0x9d, 0xf0, 0x5b, 0x2d, 0xb0, 0x23, 0x1e, 0x3c,
-  0xa0, 0xc1, 0xf3, 0x4c, 0xa2, 0x29, 0xa3, 0x42, 0xf8, 0xf6, 0xd8, 0x25,
-  0x37, 0x90, 0xc9, 0x53, 0x35, 0xca, 0x74, 0x5a, 0xc3, 0xd8, 0xc1, 0xb0,
-  0xa5, 0xf7, 0x41, 0x11, 0xb4, 0xe2, 0x29, 0x4c, 0xa0, 0xf5, 0xc5, 0x12,
-  0x1a, 0x1f, 0xe5, 0x2c, 0xbd, 0x17, 0xec, 0xa7, 0xb4, 0xc6, 0x3a, 0xdf,
-  0xe6, 0xb3, 0x58, 0x44, 0x02, 0x5a, 0x16, 0x34, 0xb2, 0xfb, 0x02, 0x9b,
-  0x8d, 0x0c, 0xfc, 0x67, 0x34, 0x4c, 0xbe, 0x94, 0xb9, 0x5f, 0x05, 0x62,
-  0xd0, 0xc6, 0x0a, 0xb3, 0x06, 0xb8, 0x5f, 0xc8, 0x11, 0x08, 0xa8, 0xe5,
-  0xfc, 0x52, 0x02, 0xd5, 0xca, 0x5e, 0x3c, 0xfc, 0xb1, 0x6a, 0x4d, 0xe9,
-  0xaf, 0x30, 0x06, 0xc8, 0x14, 0xf8, 0xc3, 0xf2, 0x1c, 0xa9, 0xfa, 0x30,
-  0x9e, 0x2c, 0xc2, 0x5e, 0x28, 0x40, 0xc0, 0x64, 0xae, 0x0e, 0x0c, 0x35,
-  0xb9, 0xd6, 0x11, 0x0f, 0xb2, 0x2d, 0xe0, 0x44, 0x9b, 0x33, 0xb3, 0x34,
-  0x99, 0xf0, 0xae, 0xff, 0x13, 0x14, 0xb8, 0x0b, 0xfe, 0x2a, 0x09, 0x0e,
-  0x20, 0xb5, 0x26, 0xab, 0xcc, 0x47, 0xf3, 0xfc, 0x2c, 0x9f, 0xd4, 0x10,
-  0xe5, 0xa6, 0xde, 0xa1, 0x26, 0xd5, 0x5a, 0xde, 0x50, 0x3d, 0xc4, 0xa5,
-  0x02, 0xc7, 0xf6, 0xc7, 0x3d, 0xd7, 0x1d, 0xae, 0xf1, 0x28, 0xc8, 0x5b,
-  0x2b, 0x3f, 0x3d, 0x3e, 0x9d, 0xff, 0x0a, 0x5b, 0x26, 0xa9, 0xd3, 0xb8,
-  0x25, 0xe8, 0xce, 0xab, 0x0e, 0xac, 0x16, 0x15, 0x21, 0x9d, 0xa1, 0x54,
-  0x0b, 0xad, 0xaf, 0x13, 0xe1, 0x61, 0x37, 0xce, 0xa8, 0xe5, 0x1b, 0x3d,
-  0x51, 0x3c, 0xf5, 0x4f, 0xa4, 0x12, 0x20, 0xbe, 0x52, 0x52, 0x9f, 0x67,
-  0xd8, 0x1d, 0x09, 0xb9, 0x16, 0xbd, 0x57, 0xf5, 0xcf, 0x4f, 0xe7, 0xb7,
-  0xe0, 0x46, 0xf7, 0x23, 0xaa, 0x32, 0x44, 0x34, 0x11, 0xc5, 0x13, 0x08,
-  0x23, 0x96, 0xf1, 0x3a, 0xc3, 0xea, 0x96, 0x12, 0x55, 0xbd, 0x64, 0x98,
-  0x05, 0xf3, 0x25, 0x3b, 0xd9, 0x4b, 0x23, 0x3f, 0x4b, 0x37, 0xeb, 0x6e,
-  0x2d, 0x3c, 0x23, 0xe9, 0xa0, 0x31, 0x83, 0xe8, 0x83, 0x84, 0xe0, 0xa2,
-  0x95, 0x8c, 0x47, 0x17, 0xee, 0xee, 0xa5, 0x58, 0x6d, 0x95, 0x17, 0x05,
-  0x5b, 0xe7, 0xac, 0x98, 0x09, 0xa0, 0x47, 0xd5, 0xcc, 0x14, 0x0b, 0x4b,
-  0xa7, 0x4a, 0x87, 0xff, 0xe5, 0x0e, 0x04, 0xcc, 0x0c, 0xa7, 0xbc, 0xa4,
-  0xca, 0x60, 0x2a, 0x34, 0x9c, 0xa1, 0xe4, 0x56, 0x0a, 0x1e, 0xec, 0x8d,
-  0x0c, 0xf3, 0xc3, 0x10, 0xe2, 0xad, 0xe4, 0xd7, 0xb4, 0xce, 0x4e, 0xc5,
-  0x82, 0xb2, 0x41, 0xaf, 0xd7, 0x37, 0xef, 0x08, 0xbd, 0x41, 0xb7, 0x87,
-  0xb5, 0x82, 0x21, 0xdc, 0x02, 0xc8, 0x96, 0xa0, 0x28, 0xe8, 0x49, 0xe7,
-  0x01, 0xcb, 0xe0, 0x05, 0x2f, 0xb1, 0xdd, 0xfd, 0x01, 0x6f, 0x05, 0x14,
-  0xf0, 0xa7, 0xac, 0x8b, 0x8e, 0x19, 0x8e, 0xd8, 0x40, 0xca, 0xa3, 0x49,
-  0x9a, 0x5b, 0x35, 0xc1, 0x24, 0xf0, 0xcb, 0x23, 0xab, 0x54, 0x03, 0x0b,
-  0x05, 0x51, 0x1b, 0xa5, 0x08, 0xd9, 0x1a, 0x91, 0xbf, 0x82, 0x9f, 0xf6,
-  0x0f, 0xee, 0x10, 0xd8, 0xe8, 0xe1, 0x96, 0x17, 0x1a, 0xb9, 0x05, 0xdd,
-  0xa4, 0xd2, 0x53, 0x27, 0x63, 0x61, 0x35, 0xa2, 0x9d, 0xaa, 0xdc, 0xb8,
-  0xc8, 0x3d, 0x8e, 0x19, 0xaf, 0x3f, 0x8e, 0xac, 0xda, 0xc6, 0xc7, 0xad,
-  0xf9, 0xe5, 0x4b, 0xa7, 0x8e, 0x15, 0xcc, 0x19, 0xf2, 0xe3, 0xe1, 0x25,
-  0x09, 0xe4, 0xdc, 0x60, 0xf2, 0x18, 0xf1, 0xfb, 0x5d, 0xc0, 0xdb, 0x3e,
-  0x24, 0x41, 0x24, 0x1c, 0xe2, 0xe3, 0xde, 0x4a, 0xbe, 0xeb, 0xec, 0x59,
-  0x0f, 0xba, 0x9e, 0x3d, 0x9c, 0xe1, 0x33, 0x5d, 0x2b, 0x22, 0x57, 0xf3,
-  0x08, 0x17, 0x02, 0x97, 0xb6, 0xa0, 0xea, 0xc6, 0xe6, 0xc7, 0xf9, 0x5e,
-  0xcd, 0xc1, 0xfc, 0x81, 0x0c, 0x09, 0x51, 0x16, 0x02, 0x96, 0xe1, 0x1b,
-  0xd5, 0xaa, 0x5d, 0x14, 0x02, 0xd5, 0x05, 0x98, 0x2c, 0x9f, 0xdb, 0x5c,
-  0xd3, 0x53, 0xcd, 0x17, 0x32, 0xb2, 0x5c, 0x34, 0xe7, 0x6f, 0x3b, 0xda,
-  0x08, 0x4f, 0xe2, 0x5c, 0x64, 0x56, 0x2c, 0xed, 0x54, 0xdc, 0x66, 0x42,
-  0xcb, 0x26, 0x1e, 0x3a, 0xb6, 0xa1, 0xfe, 0xe5, 0xbb, 0x5a, 0xb0, 0x32,
-  0xe9, 0x26, 0x93, 0xae, 0xc3, 0x63, 0x33, 0x14, 0x5c, 0x5c, 0x5f, 0x30,
-  0xd0, 0x1d, 0x4a, 0xef, 0xab, 0xf0, 0xe7, 0x57, 0x38, 0x5b, 0xe0, 0x6c,
-  0x2a, 0xbf, 0xf7, 0xae, 0xd8, 0xe4, 0x32, 0xac, 0xee, 0x1d, 0x44, 0x9a,
-  0x50, 0x1d, 0x91, 0x91, 0x1b, 0x24, 0x10, 0x51, 0x45, 0xcd, 0xe9, 0xef,
-  0xac, 0xe3, 0xff, 0xd0, 0x36, 0xe8, 0x9a, 0x6a, 0x36, 0xa0, 0x47, 0x23,
-  0x29, 0x58, 0x36, 0x46, 0x4e, 0x5a, 0xcd, 0x5d, 0x6c, 0xd6, 0x3b, 0xed,
-  0x9d, 0xf1, 0xe9, 0x64, 0x99, 0x42, 0xdc, 0x9f, 0x12, 0x02, 0xca, 0x42,
-  0x0b, 0xae, 0xba, 0x47, 0x04, 0xc6, 0x10, 0xe3, 0x58, 0x1b, 0x5d, 0x33,
-  0xd1, 0x04, 0x03, 0x9c, 0xac, 0x15, 0x99, 0x83, 0x36, 0xfe, 0x14, 0xc6,
-  0x31, 0x24, 0x94, 0x1e, 0xbc, 0x9c, 0xd4, 0xd4, 0x03, 0x85, 0x3c, 0xa3,
-  0x29, 0x44, 0x14, 0xca, 0xc7, 0x6d, 0x54, 0x00, 0x34, 0x04, 0xa8, 0xb4,
-  0x37, 0xf8, 0xa1, 0x88, 0xae, 0xd8, 0x43, 0xcf, 0xec, 0x4d, 0xeb, 0xce,
-  0x2b, 0x21, 0xba, 0xae, 0x48, 0x9a, 0x57, 0xef, 0xa2, 0xaa, 0x18, 0x25,
-  0xa8, 0xf2, 0xb3, 0x2e, 0xf2, 0x1c, 0x37, 0x51, 0x22, 0x25, 0x23, 0x43,
-  0x5b, 0x26, 0x0c, 0x1a, 0x28, 0xf4, 0x04, 0xf7, 0x1a, 0xff, 0xff, 0x16,
-  0x3c, 0x19, 0x00, 0x19, 0xee, 0x33, 0xfc, 0x11, 0xe3, 0x23, 0x07, 0xff,
-  0xf0, 0x2b, 0x23, 0x46, 0x21, 0x2f, 0x14, 0x26, 0x64, 0x11, 0x27, 0xf6,
-  0xe3, 0x2a, 0xf5, 0x0c, 0xe2, 0xed, 0xee, 0xfb, 0x2d, 0xff, 0x08, 0x02,
-  0x3f, 0x51, 0xf7, 0xeb, 0xb3, 0xf3, 0xf2, 0xf5, 0x1b, 0x07, 0x2d, 0x4f,
-  0x08, 0x2e, 0x0a, 0x39, 0x62, 0x34, 0xf0, 0x0e, 0x1b, 0x1a, 0x17, 0xe6,
-  0xd7, 0x1a, 0xe1, 0xeb, 0x60, 0x36, 0x45, 0x00, 0x42, 0x51, 0x0e, 0xef,
-  0xc3, 0xf1, 0xff, 0xef, 0x0e, 0xf0, 0x11, 0x11, 0x13, 0x00, 0xe0, 0x05,
-  0x08, 0x31, 0xed, 0x25, 0x0c, 0x10, 0x0c, 0xe7, 0xf0, 0xf4, 0xf1, 0x09,
-  0xe8, 0xda, 0x1f, 0xee, 0x21, 0x3f, 0x1c, 0x12, 0xee, 0x03, 0xe5, 0xcd,
-  0xfd, 0x11, 0xd3, 0x3c, 0xfd, 0x6c, 0x07, 0x24, 0x32, 0x20, 0x0b, 0x18,
-  0xf8, 0xc8, 0xf9, 0xfb, 0x67, 0xfb, 0x48, 0xf4, 0x1f, 0x3a, 0x09, 0xe5,
-  0xf1, 0x4d, 0xce, 0x17, 0xde, 0x11, 0x64, 0x33, 0xfd, 0xe6, 0xc0, 0x1a,
-  0x0a, 0x50, 0xfb, 0x20, 0x71, 0x00, 0xea, 0x06, 0xd5, 0xc6, 0xe6, 0xe9,
-  0x35, 0xfe, 0x29, 0x05, 0x33, 0x4c, 0xfd, 0x09, 0x3f, 0x67, 0xe1, 0x19,
-  0xbf, 0x18, 0x62, 0x6c, 0xfe, 0xcf, 0xc6, 0x35, 0x16, 0x68, 0x08, 0x1b,
-  0x70, 0x1c, 0xf4, 0x09, 0xf6, 0xbb, 0xe6, 0xd3, 0x29, 0xf0, 0x28, 0x09,
-  0x3a, 0x4d, 0x1d, 0xf9, 0x31, 0x59, 0xf6, 0x03, 0xc2, 0xf9, 0x68, 0x6b,
-  0x05, 0xcd, 0x01, 0x07, 0x40, 0x59, 0xfd, 0x0e, 0xfc, 0x0d, 0x00, 0x12,
-  0xce, 0x17, 0xec, 0x02, 0x0a, 0x17, 0xec, 0x09, 0xe3, 0xd4, 0x20, 0xf9,
-  0x3b, 0x32, 0x04, 0x14, 0xc9, 0x2b, 0xde, 0x20, 0xe8, 0x09, 0xdb, 0x38,
-  0x0c, 0x7b, 0xf5, 0x3c, 0x48, 0x22, 0xeb, 0xee, 0xd7, 0xdd, 0x01, 0xfd,
-  0x4b, 0xd6, 0x4f, 0x08, 0xf8, 0x4e, 0x0e, 0x00, 0x1c, 0x46, 0xc9, 0xe6,
-  0xc6, 0x3e, 0x73, 0x68, 0xf8, 0xef, 0xca, 0x0d, 0x2b, 0x5d, 0xde, 0x21,
-  0x59, 0x17, 0x13, 0x05, 0xcb, 0xe5, 0x16, 0xe0, 0x4b, 0xe5, 0x42, 0xe7,
-  0x2b, 0x38, 0xf7, 0x16, 0x5f, 0x6e, 0xf7, 0x0d, 0xc2, 0x0c, 0x51, 0x7f,
-  0xdc, 0xf2, 0xc8, 0x07, 0x0a, 0x7d, 0xf6, 0x41, 0x38, 0x3e, 0x24, 0x13,
-  0xd6, 0xd0, 0xf7, 0x18, 0x65, 0xc7, 0x54, 0x11, 0x1e, 0x4f, 0x10, 0x05,
-  0x64, 0x72, 0xec, 0xe4, 0xab, 0x0d, 0x6f, 0x5e, 0xe6, 0x01, 0xe7, 0x16,
-  0x3f, 0x59, 0xea, 0xff, 0x15, 0x14, 0x08, 0x1a, 0xf1, 0x0d, 0xd0, 0xfc,
-  0xf4, 0xf2, 0xf3, 0x13, 0xe8, 0xf8, 0xef, 0xe7, 0x35, 0x23, 0xd4, 0x1d,
-  0xfc, 0x25, 0xe5, 0x32, 0xe4, 0x1e, 0xe1, 0x0d, 0x4a, 0x1e, 0x1e, 0xf7,
-  0x46, 0x1d, 0x21, 0xf5, 0x12, 0xe3, 0x0d, 0x14, 0x1c, 0x2d, 0x22, 0xea,
-  0x01, 0x4f, 0xfd, 0xfb, 0xff, 0xf5, 0xd1, 0xff, 0xce, 0x33, 0x30, 0x49,
-  0xfc, 0xfa, 0xd2, 0xfc, 0x2e, 0x16, 0x14, 0x28, 0x6d, 0x17, 0x08, 0xfd,
-  0x17, 0xb8, 0xdd, 0x1a, 0x15, 0x16, 0x46, 0xff, 0x0f, 0x2e, 0xea, 0xea,
-  0x4a, 0x35, 0xe8, 0xe6, 0xe0, 0x1e, 0x4f, 0x49, 0xe3, 0xf5, 0xc7, 0x27,
-  0x38, 0x21, 0x10, 0x19, 0x6e, 0xf9, 0x0a, 0x07, 0x0a, 0xd3, 0xd7, 0x1c,
-  0x03, 0x1b, 0x19, 0x17, 0xfd, 0x1b, 0x01, 0xe5, 0x35, 0x06, 0xed, 0xec,
-  0xd0, 0x20, 0x48, 0x34, 0xf2, 0xed, 0xe4, 0xf1, 0x07, 0x0f, 0xde, 0x05,
-  0xfe, 0x09, 0x14, 0x0e, 0x04, 0xfb, 0xe5, 0xf0, 0x07, 0x38, 0xf8, 0xf8,
-  0xfe, 0xd9, 0x20, 0x12, 0x12, 0x04, 0xfe, 0x11, 0xe6, 0x29, 0xe2, 0x3c,
-  0xd6, 0x20, 0xc6, 0xee, 0xbb, 0xba, 0x09, 0x23, 0xbc, 0x35, 0x2c, 0x34,
-  0x07, 0x93, 0xd7, 0xdc, 0x11, 0xc4, 0x99, 0xdd, 0x32, 0xc2, 0x10, 0xc8,
-  0x2f, 0x95, 0x95, 0x34, 0xd1, 0xc2, 0x94, 0x47, 0xa0, 0xa1, 0x4e, 0x40,
-  0xb6, 0x59, 0x17, 0x4d, 0xb1, 0xaf, 0xe2, 0x33, 0x11, 0xf0, 0xcd, 0xcf,
-  0xdd, 0xe4, 0x89, 0x16, 0xc9, 0xd4, 0xbd, 0xb9, 0xc3, 0xd1, 0x95, 0xbe,
-  0xc7, 0xd6, 0x19, 0x48, 0xf1, 0xc1, 0x21, 0x39, 0xe4, 0xe1, 0xad, 0x01,
-  0x1d, 0xe6, 0x24, 0xc7, 0xea, 0xdd, 0xf1, 0xbb, 0xcd, 0x33, 0x19, 0xa0,
-  0xca, 0x47, 0x04, 0xd9, 0x38, 0xff, 0x3b, 0x21, 0x42, 0xe5, 0x26, 0x0b,
-  0xda, 0xb9, 0x10, 0x1e, 0xd4, 0x3b, 0xec, 0xe7, 0xed, 0x19, 0x1c, 0xcf,
-  0x20, 0x91, 0x2b, 0x9b, 0x1b, 0xa0, 0xf5, 0xc2, 0xdd, 0xde, 0x58, 0xd4,
-  0x53, 0x34, 0x41, 0xe3, 0x9d, 0x4e, 0x01, 0x15, 0x1f, 0xb4, 0x09, 0xae,
-  0x45, 0xb8, 0xb9, 0x1b, 0xc6, 0x96, 0xed, 0x10, 0x32, 0x22, 0xef, 0xe5,
-  0x31, 0xf2, 0x1c, 0xaa, 0x37, 0xfa, 0x04, 0xce, 0x95, 0xc4, 0x89, 0xce,
-  0x3e, 0xb2, 0x87, 0xf3, 0x0f, 0x3d, 0x1e, 0xb6, 0x36, 0xfe, 0xec, 0xe1,
-  0x32, 0xeb, 0x06, 0xd8, 0x04, 0xab, 0x05, 0xc0, 0x41, 0xb1, 0xcc, 0x29,
-  0x1b, 0xc1, 0xd2, 0xc7, 0x43, 0x40, 0xb7, 0x2c, 0xe5, 0xd7, 0x0c, 0xaa,
-  0xcb, 0xc1, 0xba, 0x58, 0x39, 0x39, 0x2c, 0xc1, 0xc9, 0x11, 0xff, 0x57,
-  0xb1, 0xac, 0x0c, 0xa6, 0x3e, 0x1b, 0x96, 0x43, 0xa3, 0xb8, 0xf0, 0x5a,
-  0x9c, 0x23, 0xda, 0x57, 0xfc, 0x09, 0x10, 0xc7, 0xa5, 0xed, 0x2a, 0xaf,
-  0x2e, 0xdf, 0xd7, 0x31, 0xce, 0xc2, 0x58, 0xe4, 0x04, 0xd0, 0x16, 0xb9,
-  0xc3, 0x05, 0x0e, 0x17, 0x3b, 0x0b, 0xd8, 0x03, 0xac, 0xbc, 0x8f, 0xe7,
-  0xeb, 0xdf, 0x93, 0xe5, 0xcf, 0x14, 0x96, 0xe7, 0xcc, 0x86, 0x09, 0x20,
-  0x2f, 0xca, 0xe5, 0x39, 0x9f, 0x21, 0xeb, 0x86, 0x1c, 0xc1, 0xaf, 0xe5,
-  0xd0, 0xcd, 0xfb, 0xa4, 0xf3, 0xc0, 0xff, 0x5a, 0x9a, 0x12, 0xcc, 0xb0,
-  0xab, 0xab, 0xad, 0xdf, 0x17, 0xa8, 0x20, 0x04, 0xcb, 0x28, 0xe1, 0xa5,
-  0xff, 0xc4, 0x01, 0x16, 0xb5, 0x31, 0xf7, 0x03, 0x2a, 0xbf, 0xb5, 0x48,
-  0xb3, 0xe0, 0x99, 0xa2, 0xbe, 0x35, 0xa3, 0x24, 0xd0, 0x16, 0x1d, 0xf2,
-  0xf4, 0x43, 0x0e, 0x9f, 0xf0, 0xff, 0x56, 0x41, 0x8d, 0xc6, 0x83, 0x17,
-  0x1c, 0xf0, 0x95, 0xd0, 0x82, 0x15, 0x29, 0xcc, 0x3c, 0xeb, 0x99, 0x47,
-  0xeb, 0x09, 0xf2, 0xf0, 0xc7, 0xaa, 0x92, 0xef, 0xd4, 0x03, 0xe9, 0x8b,
-  0x1a, 0x9b, 0x0e, 0xd5, 0x39, 0xf4, 0xc4, 0x3a, 0x12, 0xbd, 0xb8, 0x1a,
-  0x9b, 0xd7, 0x1c, 0xea, 0x87, 0x1d, 0xdc, 0xf8, 0xeb, 0x2d, 0xc4, 0x09,
-  0xf5, 0xd5, 0xa0, 0xcb, 0xa3, 0xb8, 0xed, 0xc1, 0x52, 0xb6, 0x5a, 0xf3,
-  0xde, 0xc6, 0x16, 0xc7, 0xce, 0xb3, 0xf6, 0x36, 0xf2, 0x48, 0xa1, 0xcb,
-  0x18, 0x95, 0x25, 0x4e, 0xb4, 0x9f, 0x25, 0xe3, 0x1a, 0x25, 0x08, 0x9f,
-  0x26, 0x03, 0xc6, 0xfa, 0x06, 0x0d, 0xc3, 0xf2, 0x2d, 0x12, 0x98, 0x12,
-  0x1f, 0x0b, 0xc0, 0xbe, 0x9b, 0xa2, 0xd1, 0x18, 0x0d, 0x15, 0xaf, 0x4b,
-  0xa9, 0xf7, 0x20, 0xad, 0xc4, 0x95, 0x1f, 0x3e, 0xe0, 0xe5, 0x3d, 0x10,
-  0xa1, 0x38, 0xd9, 0x23, 0x81, 0xad, 0x95, 0x33, 0xa2, 0x02, 0xa2, 0x39,
-  0x22, 0xcb, 0xb0, 0xf9, 0xb3, 0x2c, 0x97, 0x3a, 0xeb, 0xba, 0xac, 0xf9,
-  0xb4, 0x83, 0x3d, 0xeb, 0xb5, 0x40, 0x0e, 0x87, 0x09, 0x81, 0xe1, 0x1d,
-  0x2c, 0xdb, 0xcb, 0xd9, 0x00, 0xb2, 0xbf, 0x00, 0xb7, 0xa3, 0x19, 0xbe,
-  0xf4, 0xd1, 0x0e, 0x10, 0x97, 0x3b, 0xdd, 0x2d, 0xaf, 0xe8, 0x2d, 0xf9,
-  0x31, 0x13, 0xdf, 0x14, 0xc6, 0xf9, 0xf1, 0x25, 0xcc, 0x1f, 0x9f, 0x30,
-  0x2e, 0xdd, 0x23, 0x06, 0xd5, 0xf2, 0xd0, 0x3e, 0x0c, 0x3a, 0x9c, 0xf8,
-  0xb1, 0x0a, 0x28, 0xe9, 0x2e, 0xee, 0x44, 0x06, 0xf5, 0x0e, 0x3c, 0xc5,
-  0x2a, 0x2c, 0x3c, 0xe1, 0x21, 0xbe, 0xbf, 0xb5, 0xd7, 0xc3, 0xe6, 0x4b,
-  0xc9, 0xf1, 0x20, 0xaf, 0x20, 0xa2, 0xe3, 0x4e, 0xdf, 0xc5, 0x45, 0xbb,
-  0x90, 0xc3, 0x4b, 0x34, 0x4f, 0x4c, 0xb0, 0xc6, 0x96, 0xdc, 0xb5, 0x52,
-  0xc5, 0xe7, 0xcb, 0xe5, 0xb5, 0x37, 0xf7, 0x53, 0x49, 0x2a, 0xad, 0x1c,
-  0x2f, 0x07, 0x0c, 0xfc, 0xff, 0xde, 0xa8, 0xe8, 0xe3, 0x9e, 0xde, 0x0c,
-  0x08, 0xe1, 0x17, 0xe0, 0xe2, 0x51, 0x0a, 0x54, 0x24, 0x19, 0xe5, 0x9f,
-  0xed, 0xc0, 0xde, 0xfd, 0xbe, 0xb9, 0x21, 0xc3, 0x1a, 0xe9, 0x07, 0xf1,
-  0xa3, 0xfe, 0x04, 0x16, 0xf5, 0x97, 0x3a, 0xcf, 0xf7, 0x52, 0xcc, 0xbb,
-  0xc2, 0xd7, 0x2e, 0xe1, 0x46, 0x26, 0x2b, 0x1f, 0x32, 0x10, 0x2d, 0x45,
-  0xf7, 0x4f, 0x2a, 0x47, 0xb8, 0xc5, 0x24, 0xfa, 0x28, 0x51, 0xbe, 0x43,
-  0xe7, 0x42, 0xb5, 0xf5, 0xbd, 0xba, 0x16, 0xa1, 0xfd, 0x05, 0xda, 0xdf,
-  0xec, 0x0e, 0xa5, 0xfc, 0xcc, 0x0b, 0xe2, 0xc0, 0xcb, 0xbd, 0xe7, 0xc8,
-  0x05, 0xf0, 0x18, 0xd2, 0xd8, 0xfb, 0x16, 0x34, 0x9c, 0xc0, 0xe6, 0x26,
-  0xd7, 0x27, 0xb5, 0x34, 0x47, 0xa6, 0x32, 0x5a, 0x54, 0x07, 0xde, 0xc8,
-  0xca, 0x3d, 0xd2, 0xff, 0xe0, 0x06, 0x20, 0x59, 0xd1, 0x11, 0xf2, 0xd2,
-  0xd4, 0xfb, 0x4e, 0xc8, 0x32, 0x0a, 0x9c, 0x23, 0xdd, 0xfa, 0xe4, 0xd9,
-  0x4b, 0xd7, 0xb0, 0x50, 0xe2, 0x1a, 0x03, 0x10, 0x2f, 0x4d, 0x33, 0xc6,
-  0xbd, 0x38, 0xbb, 0xb0, 0xd2, 0xe6, 0x9c, 0xb0, 0xf7, 0x2c, 0xfd, 0x0f,
-  0x1e, 0x19, 0xee, 0x2a, 0xf5, 0xe6, 0x30, 0x52, 0x08, 0x4c, 0xc1, 0x17,
-  0xb8, 0xc4, 0x44, 0xc3, 0x18, 0xd5, 0x23, 0xe4, 0x3c, 0x51, 0x00, 0x12,
-  0x0e, 0xf5, 0x1a, 0xdc, 0xb6, 0xf9, 0x56, 0x1c, 0x0f, 0x11, 0xa8, 0xb7,
-  0xd5, 0x34, 0xe9, 0x59, 0x18, 0xf8, 0x02, 0xd3, 0xad, 0xcd, 0x5a, 0xbf,
-  0x2a, 0x52, 0x25, 0xc8, 0x04, 0xcb, 0x2a, 0xee, 0xdc, 0x81, 0x2e, 0xb7,
-  0xfe, 0x23, 0x0d, 0x27, 0x09, 0xe0, 0xdb, 0xd9, 0x57, 0xc3, 0x9b, 0xa2,
-  0xa0, 0x3f, 0x31, 0x35, 0xd8, 0xa0, 0xa6, 0x4d, 0xd4, 0xe5, 0xe8, 0xf4,
-  0xf8, 0xec, 0xe8, 0xf9, 0x03, 0xbe, 0x40, 0x03, 0x2a, 0x55, 0x45, 0x15,
-  0x11, 0x23, 0x4d, 0xb7, 0xfd, 0xed, 0x9d, 0xeb, 0x36, 0x31, 0x19, 0x05,
-  0xbd, 0xe0, 0xaa, 0x23, 0xae, 0xda, 0x11, 0xc5, 0x39, 0xb5, 0xf1, 0xc3,
-  0x47, 0xf0, 0x3f, 0xce, 0x21, 0xa4, 0xee, 0x11, 0xfa, 0xe3, 0xb7, 0x97,
-  0x55, 0xbe, 0xaf, 0x40, 0x43, 0x48, 0xf2, 0x4a, 0xa1, 0x25, 0xd3, 0xc3,
-  0x39, 0xc5, 0x54, 0xcb, 0xb0, 0xf7, 0x25, 0x1a, 0xf5, 0xc8, 0xe6, 0xa8,
-  0x2b, 0xf9, 0xb2, 0x43, 0xd4, 0x37, 0x42, 0xaa, 0xe8, 0xc2, 0xff, 0xaf,
-  0xd2, 0x48, 0xd7, 0x0f, 0xc4, 0x2b, 0x35, 0x09, 0xe3, 0x23, 0x4b, 0x4f,
-  0xa2, 0x3b, 0x4f, 0x0e, 0xf2, 0x2e, 0xb6, 0x22, 0xf5, 0xa2, 0x59, 0x4e,
-  0x4d, 0xa7, 0x09, 0xfe, 0xfe, 0xf8, 0x0c, 0xc7, 0xc7, 0xfb, 0xf5, 0xb3,
-  0xed, 0x2d, 0x19, 0xad, 0x4d, 0x2e, 0x0b, 0x1e, 0xf3, 0xe9, 0xcc, 0x4d,
-  0xa4, 0xa7, 0x9a, 0x0d, 0x23, 0x1d, 0x1c, 0xb8, 0xa5, 0x09, 0xd7, 0x0c,
-  0xac, 0x0f, 0xec, 0xa7, 0xc6, 0xdd, 0x09, 0x54, 0xf5, 0xbb, 0x04, 0xb9,
-  0xba, 0x54, 0x42, 0xd1, 0xb5, 0xc5, 0x28, 0x53, 0xe2, 0xa2, 0xcf, 0x4a,
-  0xa5, 0x45, 0xd4, 0x29, 0x1e, 0x31, 0xf7, 0xc1, 0xff, 0x44, 0xf1, 0x98,
-  0xb6, 0x39, 0xfe, 0xa1, 0xcc, 0x29, 0xe4, 0x97, 0xe7, 0x98, 0x97, 0xe8,
-  0xd2, 0x52, 0x1a, 0xed, 0x9e, 0x25, 0x86, 0xf8, 0x8c, 0x53, 0xdc, 0x58,
-  0x04, 0xe9, 0xec, 0x5c, 0xae, 0x54, 0x95, 0x48, 0x92, 0xd3, 0xd6, 0xb8,
-  0x18, 0xc0, 0x60, 0xc6, 0x07, 0xe9, 0x33, 0xf8, 0x4c, 0xf3, 0x0a, 0x0e,
-  0x57, 0x96, 0x1c, 0x9a, 0x21, 0xd1, 0xaa, 0x87, 0xff, 0x10, 0xef, 0x2c,
-  0x51, 0xd2, 0xc7, 0xd5, 0xa7, 0x73, 0xee, 0xfc, 0x11, 0xa2, 0x01, 0x36,
-  0xc7, 0xa0, 0xf1, 0xcd, 0x78, 0xa9, 0x45, 0xb2, 0xe0, 0x8a, 0x0f, 0x9f,
-  0x62, 0x9e, 0xd2, 0xad, 0x46, 0x6d, 0x9f, 0xb3, 0x49, 0x5a, 0x9c, 0xe9,
-  0x11, 0x26, 0x4c, 0xb5, 0x4e, 0x84, 0xa8, 0x89, 0x8a, 0xe8, 0x97, 0xa8,
-  0x97, 0x26, 0x6e, 0x12, 0xc9, 0x8a, 0xa0, 0xe5, 0xd2, 0xd0, 0xe8, 0x29,
-  0xf2, 0x86, 0x4e, 0x65, 0x21, 0x5a, 0x14, 0x01, 0x5a, 0x1a, 0xf8, 0x21,
-  0xdc, 0x9a, 0x9a, 0xea, 0x52, 0x55, 0xb3, 0x8c, 0xc3, 0x9e, 0x6c, 0x38,
-  0x74, 0x64, 0xf3, 0xe8, 0x10, 0x2c, 0x3b, 0x90, 0x36, 0x34, 0x71, 0x2e,
-  0xe8, 0xca, 0xfc, 0x75, 0x0f, 0xaa, 0x08, 0x4d, 0x1c, 0xd3, 0xa2, 0x14,
-  0x75, 0x0e, 0xec, 0x24, 0x1a, 0xfc, 0x1d, 0x14, 0x94, 0xee, 0x42, 0xc1,
-  0x93, 0x33, 0xe2, 0x6e, 0xea, 0xdc, 0xec, 0xa9, 0xf5, 0x38, 0x1a, 0x5e,
-  0xf6, 0x3d, 0x1a, 0x6f, 0x65, 0xd7, 0xf2, 0x8b, 0x0f, 0x2b, 0x0f, 0x2f,
-  0x3b, 0x21, 0xa1, 0x61, 0xf2, 0x25, 0x21, 0xdb, 0xbb, 0xc9, 0xf2, 0xce,
-  0x63, 0xd8, 0x1a, 0x0c, 0xbf, 0xa2, 0x1e, 0xf6, 0xc9, 0xb3, 0x72, 0xa5,
-  0x1e, 0x67, 0x89, 0x27, 0x5f, 0x08, 0x91, 0xf7, 0x44, 0x71, 0xa0, 0xa2,
-  0x5d, 0x88, 0xf9, 0x28, 0xb1, 0x3c, 0x8b, 0xd8, 0xa2, 0x00, 0xc4, 0xd3,
-  0xce, 0x8d, 0xde, 0x15, 0xb7, 0xac, 0x6c, 0xd6, 0xfa, 0x97, 0xe4, 0x6b,
-  0x4d, 0xcc, 0x44, 0x18, 0xaf, 0xd0, 0x40, 0xa8, 0x1b, 0x20, 0x9f, 0x59,
-  0x0b, 0xb9, 0x64, 0xa2, 0x06, 0x24, 0xad, 0xa4, 0x1d, 0xa4, 0xac, 0x54,
-  0xd8, 0x34, 0x08, 0x9f, 0xb8, 0x8f, 0x48, 0x55, 0x90, 0xdb, 0x52, 0x75,
-  0xc5, 0xf7, 0x2d, 0x3c, 0x02, 0xfb, 0x2b, 0xf2, 0xf9, 0x4c, 0xfb, 0x0e,
-  0x2b, 0x0e, 0xc0, 0x63, 0x31, 0xb9, 0x1b, 0xbc, 0x61, 0xdd, 0xb1, 0xee,
-  0x20, 0x6e, 0x74, 0xe7, 0x42, 0x5e, 0xd0, 0x40, 0x59, 0x81, 0x89, 0x57,
-  0x4c, 0x70, 0x63, 0x0e, 0xa5, 0x1a, 0x36, 0xbd, 0xaa, 0x22, 0x19, 0x8c,
-  0xa2, 0xb6, 0x5b, 0x29, 0x38, 0x6b, 0xa3, 0x26, 0xbc, 0x44, 0x15, 0x88,
-  0x56, 0xc2, 0x8e, 0xd9, 0x36, 0xbf, 0x97, 0x49, 0x56, 0x41, 0x87, 0xf4,
-  0x1a, 0x83, 0x66, 0x6d, 0xc9, 0xa3, 0x2c, 0x0a, 0xf2, 0x8b, 0x20, 0xc0,
-  0xb2, 0xa1, 0xc1, 0x97, 0xbe, 0x5f, 0xe1, 0x2d, 0x6a, 0xd9, 0xf4, 0xc0,
-  0x2a, 0x71, 0xc5, 0xf8, 0x73, 0x1b, 0xfb, 0x2d, 0x44, 0xd8, 0x51, 0x8d,
-  0x02, 0x19, 0x5f, 0xaa, 0x67, 0xba, 0xe5, 0x53, 0xd8, 0x16, 0xab, 0x1d,
-  0xc6, 0x91, 0xaa, 0xb9, 0x92, 0xc1, 0xcc, 0x1b, 0xd6, 0x12, 0xfa, 0xe0,
-  0x70, 0xea, 0xd2, 0xc1, 0x2a, 0x4d, 0xb1, 0x14, 0xf7, 0xc9, 0x28, 0xf5,
-  0x15, 0x68, 0x65, 0x9e, 0xb0, 0xc7, 0xad, 0xb3, 0xd4, 0xde, 0xb9, 0xc1,
-  0xf1, 0xb0, 0x31, 0x16, 0xb1, 0x4c, 0x6d, 0x8b, 0x49, 0xb5, 0x26, 0x4f,
-  0x72, 0xd5, 0x34, 0x3d, 0x9e, 0xce, 0xf4, 0xa1, 0xf4, 0xd1, 0xbb, 0x4a,
-  0x5c, 0xc1, 0x95, 0x3f, 0xb6, 0x39, 0x00, 0x72, 0xca, 0x4c, 0x3c, 0xeb,
-  0xa1, 0x91, 0xf1, 0x46, 0x88, 0x1d, 0x6f, 0x3c, 0x07, 0xec, 0x7b, 0x4a,
-  0xd4, 0xc0, 0xa4, 0xd2, 0xaf, 0xbb, 0x5a, 0x20, 0xbc, 0xa7, 0xc5, 0xbe,
-  0x62, 0x40, 0x9d, 0xc0, 0x03, 0xa2, 0xa6, 0xf6, 0x99, 0xb5, 0x06, 0xc7,
-  0xc6, 0x3d, 0x1d, 0x33, 0xb4, 0xae, 0x1d, 0xd8, 0x55, 0x55, 0x54, 0xf5,
-  0xa0, 0x60, 0xcc, 0x3d, 0x22, 0xb3, 0x03, 0x32, 0xc3, 0x3f, 0xe1, 0x10,
-  0xdc, 0xdc, 0x44, 0xa5, 0xac, 0x59, 0x64, 0x54, 0xef, 0xe8, 0xb1, 0x6a,
-  0xb7, 0xfa, 0xe5, 0x22, 0xa2, 0x1c, 0x48, 0x04, 0xff, 0x3b, 0x0c, 0x15,
-  0xbf, 0xe3, 0x37, 0x37, 0x94, 0x1f, 0x12, 0x47, 0x36, 0x4c, 0x3e, 0x00,
-  0x47, 0xe7, 0x53, 0xa5, 0x3d, 0xd5, 0x10, 0xd4, 0x07, 0xb0, 0xe1, 0xeb,
-  0x88, 0xd9, 0x09, 0x35, 0xf9, 0xd7, 0x03, 0x19, 0x9b, 0x39, 0x59, 0x3b,
-  0x16, 0xcd, 0x96, 0xdb, 0xb5, 0xeb, 0xaa, 0x3d, 0xd1, 0x3b, 0x9e, 0x30,
-  0x17, 0x4c, 0x9c, 0xe8, 0xf7, 0xa3, 0x15, 0xe4, 0x19, 0xe8, 0xc8, 0xb2,
-  0x59, 0x4d, 0xea, 0xc4, 0x17, 0x30, 0x4a, 0xe3, 0xc4, 0x41, 0x97, 0x0b,
-  0x00, 0x00, 0xe8, 0xfb, 0x34, 0xb2, 0x36, 0x3e, 0xca, 0xff, 0xd6, 0xd7,
-  0x43, 0x45, 0xf9, 0x1d, 0x4b, 0xbd, 0x5b, 0x8c, 0xd3, 0xb1, 0x2f, 0xfc,
-  0x09, 0xaa, 0xc2, 0x18, 0xe7, 0x3f, 0x1f, 0xb3, 0xb1, 0x0f, 0xb7, 0xa1,
-  0xb3, 0x35, 0xca, 0xe1, 0xa0, 0x32, 0x20, 0x4a, 0xdc, 0x56, 0x9d, 0x18,
-  0x93, 0xc0, 0x22, 0x3c, 0x9a, 0x1b, 0x56, 0xa7, 0x2f, 0x4f, 0xb1, 0xd4,
-  0x57, 0x44, 0x81, 0xf7, 0x5c, 0x9d, 0x12, 0xdd, 0xa5, 0x8e, 0xc6, 0xcb,
-  0x55, 0xb2, 0x58, 0x64, 0xc9, 0x2b, 0x5a, 0xab, 0xb8, 0x5a, 0x0e, 0x07,
-  0x3f, 0xdc, 0x13, 0x14, 0xf1, 0xb3, 0x36, 0x21, 0x0b, 0x87, 0x1e, 0xe9,
-  0x4b, 0x3d, 0xdb, 0x9a, 0xae, 0x28, 0xf1, 0xa9, 0xe6, 0xe7, 0xcd, 0xee,
-  0x15, 0xaf, 0x0f, 0xcc, 0x8b, 0xee, 0xd0, 0x0c, 0x65, 0xfa, 0xe5, 0x95,
-  0x1d, 0x48, 0xbd, 0xae, 0xea, 0xf4, 0x3c, 0xe2, 0x9b, 0xcc, 0x96, 0x8f,
-  0x2c, 0xcf, 0x30, 0x56, 0xc5, 0x59, 0x93, 0xab, 0x15, 0xb8, 0x0d, 0x35,
-  0xab, 0x0d, 0x57, 0xe9, 0x15, 0x24, 0x51, 0x02, 0x11, 0xae, 0xba, 0x93,
-  0xe3, 0xc9, 0x31, 0x5f, 0x5d, 0xd1, 0xed, 0x2a, 0x0d, 0x38, 0x34, 0xb6,
-  0xe7, 0xe0, 0x5e, 0x62, 0xd9, 0xcb, 0x56, 0x50, 0x0b, 0xd2, 0x03, 0xd2,
-  0xc8, 0xb9, 0xa9, 0x50, 0x49, 0x22, 0xc0, 0xbd, 0x46, 0xf3, 0x2e, 0x0d,
-  0xaa, 0x2e, 0x29, 0x3c, 0x16, 0x95, 0x24, 0xdc, 0x40, 0x0b, 0xa8, 0x37,
-  0xd6, 0x5b, 0x5b, 0x1e, 0xb6, 0xcd, 0x11, 0xde, 0x23, 0xf7, 0x49, 0xb5,
-  0x46, 0xbc, 0x41, 0x3a, 0xc6, 0x22, 0xb4, 0xea, 0x1e, 0x22, 0xa6, 0x52,
-  0x4b, 0x1f, 0xf5, 0x0c, 0xc5, 0x38, 0x34, 0x9d, 0x9f, 0x66, 0x2e, 0xe2,
-  0x0c, 0x29, 0xfe, 0x0d, 0x05, 0x5e, 0x09, 0xa0, 0xb5, 0xc5, 0x29, 0x5d,
-  0xab, 0xcb, 0xed, 0xe6, 0xef, 0xfc, 0x86, 0x16, 0x4b, 0x54, 0xfb, 0x69,
-  0x9e, 0x92, 0x18, 0x14, 0xa6, 0xa2, 0x2d, 0x41, 0xbb, 0x3e, 0xe7, 0x93,
-  0x50, 0xac, 0xb7, 0xa4, 0xed, 0x8d, 0x0c, 0x2b, 0x54, 0xd7, 0x4c, 0xde,
-  0xd0, 0xa4, 0xda, 0xea, 0xb0, 0x0a, 0x05, 0xc9, 0x37, 0xf6, 0xad, 0xea,
-  0xf2, 0x97, 0xba, 0xf8, 0xca, 0x1f, 0xa5, 0xe2, 0xa4, 0xe5, 0x8c, 0x3f,
-  0x97, 0x28, 0x5a, 0x58, 0x1d, 0xbb, 0x02, 0xfa, 0x20, 0x58, 0x47, 0x09,
-  0xc3, 0x0d, 0xff, 0x1c, 0xb3, 0x2d, 0xe3, 0xa9, 0x0b, 0x1f, 0x3c, 0x40,
-  0x96, 0x34, 0xde, 0x9e, 0x5a, 0xb0, 0xe3, 0x5d, 0x27, 0x17, 0x46, 0x38,
-  0x2f, 0xa6, 0xcf, 0x46, 0x8f, 0xbe, 0x25, 0x2a, 0xb7, 0x57, 0xad, 0xf2,
-  0xbb, 0x07, 0x24, 0xa1, 0x22, 0xac, 0xc2, 0xd8, 0x9b, 0x3f, 0x65, 0xa1,
-  0xc5, 0x2a, 0x07, 0xd6, 0x98, 0xeb, 0xea, 0xdb, 0x67, 0x00, 0xfd, 0xbe,
-  0xbb, 0x3f, 0xa6, 0x66, 0xe4, 0x15, 0x91, 0xcb, 0xc0, 0xea, 0xfe, 0x66,
-  0x5a, 0x02, 0x06, 0x95, 0x29, 0x88, 0x53, 0x1a, 0xd3, 0xe2, 0x3e, 0xc2,
-  0xb2, 0x01, 0xe0, 0x28, 0x6c, 0x12, 0x13, 0x8e, 0xe1, 0x8b, 0x4c, 0xad,
-  0x2b, 0x40, 0xec, 0x48, 0x57, 0x48, 0xe1, 0x11, 0xdd, 0x46, 0x32, 0xcc,
-  0xcb, 0x13, 0xd8, 0x37, 0xb6, 0xb1, 0x52, 0xbd, 0x26, 0x00, 0x50, 0x5a,
-  0xd7, 0xea, 0x90, 0x06, 0xc9, 0x14, 0x10, 0xd5, 0x2e, 0x0f, 0x2b, 0x07,
-  0x61, 0x5f, 0x29, 0x62, 0xff, 0x1d, 0xa3, 0x5c, 0x3b, 0xd6, 0xbc, 0xdd,
-  0xcf, 0xe1, 0xed, 0xd3, 0xa0, 0x86, 0xdd, 0x5c, 0xee, 0xf5, 0x87, 0x46,
-  0x5b, 0x01, 0x50, 0x61, 0xe7, 0x5a, 0xae, 0x18, 0x0f, 0x0f, 0xe1, 0xea,
-  0xbb, 0xe9, 0xa4, 0x31, 0x50, 0xb9, 0xd7, 0x51, 0x11, 0xe7, 0xf7, 0x91,
-  0x64, 0x5b, 0xe9, 0x12, 0x01, 0x57, 0xa1, 0x83, 0xf6, 0x64, 0x64, 0xbe,
-  0x0d, 0x3f, 0xe6, 0x37, 0xa3, 0x8c, 0x1d, 0x41, 0xdc, 0xad, 0xda, 0xde,
-  0x2a, 0x2a, 0xb8, 0x45, 0x32, 0x05, 0x20, 0xbc, 0xa4, 0x04, 0xb0, 0xb9,
-  0xfe, 0x26, 0xdf, 0x41, 0xe6, 0x9b, 0x93, 0xc7, 0x31, 0x4b, 0xcf, 0x2e,
-  0xda, 0x5a, 0x5f, 0xcc, 0x8d, 0xe5, 0x29, 0x24, 0x8e, 0x02, 0x3a, 0x0d,
-  0xb8, 0x52, 0xc6, 0x26, 0xe4, 0xe7, 0x07, 0x3d, 0xf8, 0xf6, 0x14, 0xc9,
-  0x32, 0x62, 0xc3, 0x18, 0xa6, 0xb1, 0xd0, 0x98, 0x45, 0x48, 0x93, 0xf5,
-  0x35, 0xe2, 0x96, 0xf5, 0xed, 0x1e, 0x33, 0xcd, 0x4a, 0xcd, 0xd5, 0x9f,
-  0x36, 0x19, 0xd8, 0x29, 0x5b, 0x6c, 0xd6, 0xa4, 0xa1, 0xd6, 0x06, 0xef,
-  0xf3, 0xf2, 0x02, 0x09, 0xaf, 0xd4, 0x13, 0x0b, 0xf3, 0x31, 0x56, 0x0b,
-  0x49, 0xf3, 0x4b, 0xfc, 0xf1, 0xe8, 0xc2, 0x09, 0x08, 0xd6, 0x9c, 0xd7,
-  0xb9, 0xd1, 0xde, 0xdf, 0xdf, 0x2d, 0x08, 0x3e, 0x2b, 0xc3, 0x43, 0xc9,
-  0x8b, 0xf0, 0x12, 0x4e, 0xec, 0x23, 0x91, 0x68, 0x23, 0x47, 0x4d, 0x31,
-  0xb6, 0xb3, 0x0e, 0xf3, 0xdd, 0xdc, 0x22, 0xc0, 0x8a, 0xfe, 0x00, 0xf2,
-  0x4c, 0x46, 0x1a, 0x12, 0xdb, 0x36, 0x08, 0xdc, 0xa6, 0xe9, 0x4c, 0x94,
-  0xfa, 0xd6, 0x3a, 0x1d, 0xea, 0x1e, 0x65, 0x5a, 0x37, 0xaa, 0xad, 0xb9,
-  0x4d, 0x58, 0x47, 0xbe, 0xaa, 0xfb, 0x18, 0xc2, 0xc1, 0xa9, 0x4d, 0xf6,
-  0x9d, 0x97, 0x3c, 0xfd, 0xfb, 0x00, 0x47, 0x98, 0x8e, 0x23, 0x18, 0xf2,
-  0x88, 0xdd, 0xfe, 0x00, 0xd4, 0xde, 0xed, 0xcc, 0x58, 0xbd, 0xad, 0x48,
-  0xdb, 0xb2, 0x92, 0xe1, 0xcf, 0x95, 0x4f, 0xd8, 0x32, 0xaa, 0x5a, 0x1d,
-  0x28, 0xf8, 0x35, 0x44, 0x3c, 0xc0, 0xe9, 0x59, 0x52, 0x0e, 0x99, 0x8f,
-  0xf8, 0x02, 0xcd, 0x4e, 0x2a, 0x0f, 0x96, 0x13, 0x86, 0x3b, 0xb0, 0x1e,
-  0x9b, 0x18, 0x9b, 0x4e, 0xce, 0xf5, 0x07, 0xe8, 0xe8, 0x1d, 0x89, 0x9b,
-  0xd9, 0x41, 0x13, 0x50, 0x88, 0x8a, 0xfa, 0xaa, 0x03, 0xb0, 0xfa, 0x2a,
-  0x8c, 0x99, 0x13, 0x5f, 0x53, 0xd3, 0x8c, 0x54, 0xff, 0xaf, 0xbf, 0xd4,
-  0x39, 0x32, 0xaa, 0x59, 0x51, 0xc4, 0xfb, 0x54, 0x81, 0xb7, 0x9a, 0xf5,
-  0x1d, 0x1e, 0xa8, 0x36, 0xb2, 0xcb, 0x3e, 0x9a, 0xec, 0x02, 0x1d, 0xb0,
-  0xa9, 0x4a, 0xb1, 0x46, 0xfd, 0x5b, 0x40, 0x09, 0xfd, 0xff, 0xdf, 0x0b,
-  0xae, 0xca, 0x46, 0x14, 0xa6, 0xcc, 0x40, 0x60, 0xbf, 0xd0, 0xc3, 0x92,
-  0x0e, 0xc3, 0xf4, 0x4e, 0xeb, 0x53, 0x23, 0x2b, 0x16, 0xd8, 0xd3, 0x39,
-  0xb1, 0xbc, 0xfd, 0xf2, 0xba, 0xc9, 0x3d, 0xdb, 0xf7, 0x4e, 0xf3, 0x33,
-  0x23, 0x9b, 0x17, 0xc2, 0x0b, 0xb4, 0xfa, 0xb6, 0x1f, 0x32, 0xbe, 0xfb,
-  0x38, 0xd8, 0xf2, 0xfb, 0x0c, 0x43, 0xdb, 0xbd, 0x1b, 0x27, 0xff, 0x21,
-  0xe2, 0x0c, 0x09, 0x06, 0xf5, 0x0a, 0x1c, 0xf2, 0xc5, 0xeb, 0xe8, 0x16,
-  0xf5, 0x8f, 0xf2, 0xc7, 0x27, 0x02, 0x8a, 0xf0, 0x47, 0xac, 0x15, 0xf6,
-  0x2b, 0x26, 0xcd, 0xcb, 0x0f, 0x0d, 0xe9, 0x15, 0xd1, 0x23, 0x08, 0xf2,
-  0x3a, 0xfe, 0x1d, 0x16, 0xc1, 0x09, 0x05, 0xfb, 0x08, 0xae, 0xe9, 0x9f,
-  0x01, 0x0a, 0x9e, 0xf9, 0x35, 0xc0, 0x08, 0xf2, 0x30, 0x2e, 0xc8, 0xc1,
-  0xf9, 0x26, 0x13, 0x16, 0xc4, 0x17, 0x15, 0x11, 0x30, 0xdd, 0xfa, 0x07,
-  0xcb, 0x03, 0x09, 0x10, 0x28, 0xf6, 0x07, 0xda, 0x10, 0x1b, 0x0b, 0xfc,
-  0x21, 0xd2, 0xec, 0x05, 0x38, 0xfe, 0x0b, 0x08, 0x0e, 0x00, 0x28, 0xfa,
-  0x06, 0xf0, 0x17, 0x18, 0x08, 0xe2, 0x14, 0xfd, 0x17, 0x11, 0x1b, 0xe4,
-  0x1f, 0xc0, 0xff, 0xb7, 0x08, 0xfc, 0xbb, 0x12, 0x01, 0xb8, 0xf3, 0xf9,
-  0x0c, 0x45, 0xbe, 0xd6, 0x1c, 0x33, 0x09, 0x18, 0xe7, 0x1d, 0x09, 0x05,
-  0xe4, 0xf2, 0x0a, 0xe8, 0xdb, 0xe0, 0x17, 0x23, 0xfd, 0x8f, 0xc9, 0xc0,
-  0x02, 0xff, 0x9d, 0xec, 0x05, 0xd4, 0x05, 0x0d, 0x0c, 0x03, 0x96, 0xa6,
-  0x1a, 0x26, 0xfd, 0xf8, 0xcb, 0x11, 0x08, 0x0d, 0x2e, 0xe9, 0x05, 0x02,
-  0xd9, 0x29, 0xfe, 0x21, 0x05, 0x81, 0xed, 0xb8, 0xfa, 0x01, 0xbe, 0xe7,
-  0x20, 0xc6, 0x03, 0xfb, 0x03, 0x2e, 0x9e, 0xb6, 0x3d, 0x28, 0x00, 0x08,
-  0xaf, 0x0e, 0xf7, 0x0d, 0x26, 0xea, 0xed, 0x09, 0xbd, 0x17, 0x12, 0x16,
-  0x12, 0x02, 0x0b, 0xde, 0x34, 0xff, 0xf2, 0xe5, 0x0d, 0xe5, 0xfc, 0xea,
-  0x17, 0x3b, 0x01, 0x0b, 0xf3, 0x33, 0x09, 0x1a, 0x12, 0xf9, 0xe0, 0x07,
-  0x0f, 0xdd, 0x1b, 0x16, 0x00, 0xea, 0x1a, 0xb9, 0x14, 0xa9, 0xf2, 0xb4,
-  0xf8, 0x1c, 0xd8, 0xf2, 0x10, 0xdb, 0xed, 0xf9, 0x2b, 0x4a, 0xba, 0xb1,
-  0x1d, 0x0f, 0xfc, 0xf8, 0xe5, 0x11, 0xe9, 0xfc, 0xf9, 0xf5, 0x1d, 0x16,
-  0xb3, 0xdb, 0x22, 0x1a, 0x09, 0x84, 0xcd, 0x98, 0x13, 0x0d, 0xba, 0xd0,
-  0x1b, 0xa2, 0xef, 0x0c, 0x31, 0x3d, 0xad, 0xa3, 0x3b, 0x1f, 0xe1, 0x15,
-  0xb8, 0x07, 0xec, 0x0f, 0x1c, 0xcd, 0xed, 0xf2, 0xbd, 0x11, 0x0a, 0x25,
-  0xfc, 0xa8, 0xcb, 0xb9, 0x00, 0x15, 0x8c, 0xf4, 0x2f, 0xba, 0xf1, 0x04,
-  0x1d, 0x2d, 0xad, 0xae, 0x22, 0x13, 0x08, 0x00, 0xc8, 0x1b, 0x18, 0x0f,
-  0x02, 0xe6, 0xf6, 0x0b, 0xa4, 0x19, 0x2c, 0x0d, 0x08, 0x0e, 0xff, 0xda,
-  0x30, 0x1f, 0xfd, 0xe9, 0x2a, 0xc0, 0x12, 0x07, 0x23, 0x17, 0x13, 0x17,
-  0x16, 0x26, 0xfb, 0x1c, 0x1e, 0xf5, 0x00, 0x0b, 0xf1, 0xde, 0x05, 0xf4,
-  0x06, 0xec, 0x2a, 0xc9, 0x1d, 0x08, 0x06, 0x06, 0xf4, 0xfa, 0xec, 0x20,
-  0x0f, 0x0e, 0xf0, 0xed, 0x0f, 0x4a, 0x13, 0x11, 0x06, 0x14, 0x1f, 0xf6,
-  0x0b, 0x07, 0x0d, 0xef, 0xea, 0xfb, 0xf3, 0xf2, 0x00, 0x00, 0xdd, 0x0a,
-  0x0c, 0xec, 0xdd, 0xe0, 0xdb, 0x0c, 0xde, 0xec, 0xf9, 0x0d, 0x12, 0xf3,
-  0x05, 0x20, 0x0a, 0x01, 0xfa, 0xe4, 0xf3, 0x06, 0x0b, 0x0b, 0x15, 0xf8,
-  0xd0, 0xf4, 0xfe, 0x06, 0x04, 0xf2, 0xe7, 0xf9, 0x0a, 0xd6, 0x04, 0xf8,
-  0xdb, 0xe5, 0x05, 0x0b, 0xf9, 0xe2, 0xf9, 0xf5, 0xff, 0x23, 0xfa, 0xf0,
-  0xef, 0x0f, 0x1b, 0x09, 0xf9, 0x16, 0xfd, 0x09, 0xe0, 0xf9, 0xff, 0xfb,
-  0x03, 0xd6, 0xc5, 0xf6, 0x06, 0xf9, 0x1b, 0xe8, 0xec, 0xef, 0x0c, 0x0c,
-  0x25, 0xea, 0xf8, 0xfe, 0x14, 0x0e, 0xfb, 0x1c, 0x12, 0xec, 0x21, 0x0c,
-  0x16, 0x06, 0x1a, 0x13, 0xf0, 0x10, 0x1d, 0xee, 0x29, 0xff, 0x06, 0xcf,
-  0xc5, 0xef, 0x10, 0xe8, 0x9e, 0x01, 0x2a, 0xb3, 0x5d, 0xac, 0xc6, 0x40,
-  0x00, 0x06, 0xf9, 0x9d, 0xba, 0x59, 0x09, 0x33, 0xc7, 0xb8, 0x32, 0xab,
-  0xc2, 0xc0, 0x50, 0xcd, 0x12, 0x1b, 0x9e, 0x09, 0x08, 0xec, 0xcd, 0x36,
-  0x05, 0x23, 0xee, 0xb9, 0x22, 0xd1, 0xe8, 0x97, 0xe6, 0x02, 0x21, 0x1a,
-  0x9d, 0x22, 0x36, 0x96, 0x3c, 0xfc, 0xbd, 0xae, 0xf3, 0xf8, 0x01, 0x2a,
-  0x0f, 0x26, 0xb0, 0x5c, 0xe5, 0xa0, 0x22, 0xfb, 0x57, 0x48, 0xf6, 0xf5,
-  0xf3, 0x48, 0x43, 0x54, 0xb4, 0xc5, 0x05, 0x22, 0xa6, 0xc7, 0xb1, 0x31,
-  0xda, 0x09, 0xe0, 0xf7, 0xff, 0xe9, 0x0e, 0x9d, 0x1a, 0xcb, 0x53, 0x9b,
-  0xc9, 0x1d, 0xe1, 0xe4, 0xcf, 0xe7, 0x9b, 0xdb, 0x46, 0xff, 0x45, 0xbb,
-  0xf3, 0x49, 0xb0, 0x2a, 0xda, 0x02, 0x18, 0x3f, 0xf6, 0xb1, 0x40, 0x9e,
-  0x09, 0x47, 0x19, 0xfc, 0x3a, 0x27, 0x3a, 0x06, 0x94, 0x44, 0xab, 0xa5,
-  0x99, 0xa3, 0x04, 0x43, 0x35, 0x03, 0x1f, 0x18, 0xe2, 0xf8, 0x3c, 0xf9,
-  0x31, 0x2f, 0x14, 0xaf, 0xc2, 0x2d, 0x51, 0xa0, 0xaa, 0x5c, 0x18, 0x09,
-  0x5c, 0xd2, 0xf0, 0xc1, 0xb5, 0x01, 0x3c, 0x2f, 0x32, 0x4a, 0x09, 0x21,
-  0xec, 0xe6, 0x18, 0xf5, 0x87, 0xa7, 0x5c, 0x33, 0xaf, 0xef, 0x44, 0xe0,
-  0x4c, 0xee, 0x2b, 0x2d, 0x1a, 0x03, 0xe1, 0xca, 0xd1, 0xb0, 0x31, 0x04,
-  0xc5, 0x05, 0xef, 0x16, 0x48, 0xf5, 0x37, 0x40, 0xb3, 0xe1, 0x51, 0xee,
-  0xb9, 0xe1, 0x3d, 0xbc, 0x55, 0xbb, 0xae, 0x22, 0x97, 0xe2, 0xe1, 0x5e,
-  0xb5, 0xae, 0x15, 0x5f, 0xff, 0x91, 0xfc, 0x14, 0x52, 0x14, 0x1d, 0x44,
-  0x2a, 0x23, 0xce, 0x51, 0xf2, 0xf0, 0xd9, 0x5f, 0x90, 0xca, 0xeb, 0xdb,
-  0xb0, 0xc2, 0x0f, 0x50, 0x9e, 0x0e, 0x2c, 0xb2, 0xb2, 0x55, 0x4e, 0xb0,
-  0xc0, 0x9e, 0x2d, 0x1e, 0xfa, 0x22, 0x26, 0x1c, 0xb2, 0xa4, 0xc3, 0x3c,
-  0x36, 0xfc, 0xfe, 0x4e, 0x39, 0xa6, 0xda, 0xf2, 0xb7, 0xb0, 0x9c, 0x23,
-  0x13, 0xee, 0xcc, 0x60, 0xe2, 0xab, 0x41, 0x03, 0x99, 0x13, 0x25, 0xb3,
-  0x9a, 0xa9, 0x57, 0xee, 0x1a, 0x20, 0x56, 0x9a, 0x5b, 0xc2, 0x20, 0x09,
-  0x92, 0xa0, 0xf2, 0x22, 0x01, 0xff, 0xce, 0xbe, 0xd2, 0x10, 0xf0, 0xc7,
-  0x3b, 0x31, 0x53, 0x15, 0x0b, 0xe3, 0x03, 0x74, 0x2f, 0xa4, 0xaf, 0x45,
-  0x5e, 0x2a, 0xbb, 0x12, 0x02, 0xb9, 0x10, 0x39, 0x0b, 0xb4, 0x0b, 0x58,
-  0x34, 0x24, 0x1a, 0xd3, 0x17, 0x95, 0xc0, 0xf4, 0x27, 0x04, 0x26, 0x9f,
-  0xe8, 0xa2, 0x2d, 0x66, 0x14, 0xc9, 0xc0, 0xac, 0x42, 0xf6, 0xfd, 0x20,
-  0xfc, 0xa4, 0x01, 0xba, 0x81, 0xa2, 0x0d, 0x5c, 0xd7, 0xd6, 0x1b, 0x37,
-  0x45, 0x47, 0x2c, 0xa2, 0x97, 0x46, 0x02, 0xbf, 0xe0, 0x9d, 0xe1, 0xfe,
-  0xab, 0x4b, 0xfd, 0xd6, 0x43, 0x62, 0x17, 0x9f, 0xeb, 0x13, 0xe0, 0x20,
-  0x09, 0xb6, 0xca, 0xdc, 0xac, 0x26, 0x4b, 0x0f, 0x55, 0xe2, 0x39, 0xac,
-  0x40, 0x27, 0xcf, 0xc4, 0xf5, 0x04, 0x61, 0xde, 0x10, 0x09, 0xd5, 0xc2,
-  0x2a, 0x07, 0x16, 0x2c, 0x02, 0x07, 0x9f, 0x11, 0xe9, 0xa0, 0x1c, 0x93,
-  0xa1, 0xc1, 0x3f, 0xb0, 0xad, 0xa0, 0xa7, 0xf9, 0xcd, 0x9e, 0x5f, 0xec,
-  0x00, 0xf0, 0xe3, 0xc5, 0xa2, 0x59, 0x30, 0xcf, 0x18, 0x12, 0x16, 0xff,
-  0xf2, 0x4f, 0x23, 0xed, 0x97, 0xe9, 0xf0, 0x96, 0xf0, 0x0b, 0xf3, 0x0b,
-  0xe5, 0xb2, 0x25, 0x20, 0x5a, 0xb3, 0xc9, 0x4c, 0xd7, 0x3b, 0x13, 0x5f,
-  0x4b, 0x0c, 0x60, 0xa0, 0x18, 0x0d, 0xa6, 0xfc, 0x24, 0xcc, 0xbb, 0xaa,
-  0x09, 0xf7, 0x4b, 0x32, 0x2f, 0x58, 0xa7, 0x20, 0x3c, 0x12, 0xff, 0xa9,
-  0xd7, 0xa4, 0x30, 0x5a, 0x4b, 0x24, 0x01, 0x24, 0xff, 0x4d, 0xf2, 0x3b,
-  0xc4, 0xde, 0xf8, 0x24, 0xbc, 0x0b, 0xd7, 0x10, 0xab, 0xef, 0x06, 0x2c,
-  0xb6, 0xd6, 0x07, 0xf7, 0xdf, 0x06, 0x16, 0x4d, 0x02, 0xa8, 0x98, 0xaf,
-  0x11, 0x4b, 0x15, 0xee, 0x34, 0xfa, 0x2a, 0xe6, 0xd6, 0x31, 0x1b, 0xd8,
-  0xe9, 0xb8, 0xf8, 0xcb, 0x02, 0x0a, 0xde, 0xcd, 0xef, 0xb2, 0x17, 0x0b,
-  0x22, 0xab, 0xde, 0xda, 0xb4, 0xc8, 0xfc, 0xd0, 0x86, 0xfb, 0x28, 0x06,
-  0xf5, 0xde, 0xb1, 0x14, 0x25, 0x3c, 0x31, 0x0b, 0x13, 0x46, 0x26, 0xcc,
-  0xe3, 0xbf, 0xde, 0xdf, 0xe1, 0x29, 0xef, 0x2d, 0x33, 0xd7, 0xbe, 0x21,
-  0xb2, 0xba, 0xe2, 0x4a, 0x8d, 0xbd, 0xc3, 0x39, 0x12, 0x09, 0x26, 0xef,
-  0x1c, 0xcd, 0x46, 0xe2, 0xa5, 0xef, 0x32, 0x4a, 0xe9, 0x18, 0xd2, 0xab,
-  0x1c, 0xd0, 0xcb, 0xdb, 0x3e, 0x1e, 0x3b, 0xf9, 0xfc, 0x30, 0x98, 0xbe,
-  0x2e, 0xe2, 0xc8, 0xf0, 0xa2, 0x2b, 0xa9, 0xb6, 0x16, 0xd8, 0xfb, 0x20,
-  0xb1, 0xf3, 0xb1, 0x04, 0xf0, 0x15, 0x37, 0xdc, 0xc9, 0xf9, 0xb9, 0x44,
-  0x0e, 0x4a, 0x18, 0xb7, 0xbe, 0x3d, 0xd4, 0x50, 0xd7, 0xb2, 0x30, 0x04,
-  0x1e, 0xc1, 0x41, 0x0a, 0x00, 0x2f, 0x2b, 0xeb, 0x2d, 0x12, 0x1b, 0x24,
-  0x16, 0x0d, 0x46, 0x46, 0xf2, 0x28, 0x05, 0x1b, 0xb8, 0xd0, 0x1c, 0x40,
-  0xbe, 0xaf, 0x09, 0x1a, 0xc0, 0x1a, 0xeb, 0x32, 0xe3, 0xd5, 0xf3, 0xe4,
-  0x31, 0x40, 0xc5, 0x4b, 0x3e, 0xde, 0xb8, 0x4d, 0xf6, 0xcb, 0x13, 0x13,
-  0x15, 0xf5, 0x03, 0xc4, 0xad, 0x3c, 0x38, 0xb1, 0x20, 0xd0, 0x28, 0xb5,
-  0xaa, 0x1b, 0x13, 0x03, 0xea, 0x0a, 0x0e, 0x1a, 0xb8, 0xc8, 0xb0, 0x27,
-  0xf3, 0xce, 0xf5, 0x17, 0x8f, 0xbf, 0x47, 0x2c, 0x37, 0xa4, 0x81, 0xbf,
-  0x45, 0xad, 0x0a, 0xbd, 0xa3, 0xf1, 0x03, 0xd9, 0xef, 0x32, 0x42, 0xbd,
-  0xb8, 0xca, 0x35, 0xbd, 0xbc, 0x1a, 0x2b, 0xcc, 0x19, 0x2a, 0x07, 0x44,
-  0xb0, 0xb4, 0x1d, 0x12, 0xed, 0xf6, 0x1f, 0x11, 0x3a, 0xe2, 0xe3, 0xe8,
-  0x31, 0xb4, 0xd8, 0x0b, 0x06, 0xca, 0xc1, 0x09, 0xc6, 0xcd, 0x2b, 0x28,
-  0x26, 0xe8, 0xcb, 0xd4, 0x05, 0x3d, 0xe5, 0x39, 0xf2, 0x39, 0x25, 0xb5,
-  0x37, 0x34, 0x25, 0xb8, 0xfb, 0xb0, 0x45, 0xfe, 0x41, 0xd3, 0x26, 0x09,
-  0xee, 0xc7, 0x2f, 0xe5, 0xe1, 0xe0, 0xfe, 0x49, 0xb7, 0xf3, 0xd0, 0xeb,
-  0xf9, 0x16, 0xc5, 0xfa, 0x10, 0x19, 0x34, 0x05, 0xc1, 0xc8, 0x23, 0x09,
-  0xe1, 0xee, 0xd9, 0x44, 0xd2, 0x2b, 0x06, 0x48, 0xd9, 0x37, 0x3b, 0xd5,
-  0xd5, 0x20, 0x04, 0xb0, 0xef, 0xa7, 0xbb, 0x3f, 0x35, 0xa9, 0x3d, 0x04,
-  0xe7, 0xd1, 0xb6, 0xed, 0x3d, 0x2e, 0xd8, 0x4c, 0x33, 0xcd, 0x04, 0x42,
-  0x13, 0x03, 0xf7, 0x13, 0xe7, 0x37, 0xc0, 0x1f, 0xa5, 0xb7, 0x12, 0x10,
-  0xfc, 0xf6, 0xd6, 0xdd, 0xcc, 0xd3, 0xc2, 0x12, 0xbd, 0xbb, 0xb2, 0xdf,
-  0xe8, 0xd8, 0xf0, 0x0b, 0xe2, 0x44, 0xda, 0x45, 0x2f, 0xc9, 0xc1, 0xf9,
-  0x36, 0x0e, 0x05, 0x0f, 0xd3, 0xcd, 0x2c, 0xe9, 0xfc, 0x02, 0xf7, 0xac,
-  0xef, 0xe1, 0xf1, 0xcb, 0xac, 0x0c, 0x3d, 0x27, 0xbe, 0x15, 0x30, 0x28,
-  0x27, 0x37, 0x0e, 0x28, 0x14, 0x00, 0x11, 0xce, 0xb7, 0xe5, 0x30, 0x11,
-  0xd4, 0xd4, 0xab, 0xe9, 0x0b, 0xb5, 0xd6, 0xf1, 0xc7, 0xf2, 0x0d, 0xa9,
-  0x1c, 0xec, 0xbb, 0xbc, 0x23, 0x20, 0xa4, 0x0b, 0xc2, 0xba, 0x31, 0xf0,
-  0x35, 0x9c, 0x01, 0x31, 0x3e, 0xa8, 0x2c, 0xdd, 0x2b, 0xdb, 0xe5, 0x8c,
-  0xa7, 0x06, 0xcc, 0x0b, 0x01, 0x26, 0x12, 0x14, 0x0b, 0xc5, 0xcc, 0x0a,
-  0xf2, 0xea, 0xc6, 0x20, 0xf9, 0xd1, 0xbe, 0xbf, 0xaa, 0x21, 0xaa, 0x51,
-  0xe0, 0xa6, 0x05, 0x9a, 0xbf, 0x13, 0xd7, 0xf4, 0xa0, 0xe0, 0x3e, 0x2c,
-  0xbe, 0x38, 0x33, 0x34, 0x14, 0xee, 0x37, 0x07, 0x07, 0x3c, 0x0c, 0x25,
-  0x38, 0x47, 0xf4, 0x36, 0x14, 0x8b, 0x1d, 0x48, 0xf0, 0xc4, 0xca, 0xff,
-  0x81, 0xed, 0x9c, 0x3f, 0xc7, 0xd8, 0x45, 0x46, 0xff, 0x02, 0x06, 0x29,
-  0x9a, 0x3a, 0x52, 0x0d, 0xba, 0xed, 0x41, 0x2a, 0xfe, 0x13, 0xf0, 0xf6,
-  0x49, 0x1a, 0xb8, 0x37, 0xb2, 0x3b, 0x02, 0x30, 0x07, 0xac, 0xcb, 0x51,
-  0x37, 0xe5, 0xd4, 0xdd, 0xe8, 0x4f, 0xd6, 0xa3, 0x27, 0x03, 0xd5, 0xd6,
-  0xf5, 0xd5, 0xe3, 0xbc, 0xb8, 0xef, 0x0e, 0xd3, 0xa8, 0xf0, 0xbb, 0xd1,
-  0xea, 0x2e, 0x12, 0x35, 0xe0, 0xca, 0x04, 0xbe, 0xf2, 0xb0, 0xa0, 0xb5,
-  0x8b, 0xfa, 0x49, 0xaa, 0x8a, 0x8e, 0xb1, 0xa6, 0xcb, 0x10, 0xc8, 0xa7,
-  0xcc, 0xad, 0xdd, 0x1c, 0xf4, 0xc5, 0x1c, 0x5b, 0xbc, 0xba, 0xf9, 0x4a,
-  0xb2, 0x0e, 0xfa, 0xca, 0x3f, 0x33, 0x47, 0x39, 0xf7, 0x35, 0xc8, 0xc6,
-  0x95, 0x14, 0xa0, 0x40, 0x2d, 0x8e, 0x07, 0x0f, 0xfb, 0xd5, 0xc0, 0xea,
-  0xd7, 0x03, 0xa5, 0x00, 0xd5, 0x4c, 0xaa, 0x2c, 0xde, 0xe8, 0x9e, 0xd5,
-  0x34, 0x3c, 0xca, 0xa7, 0x1b, 0x46, 0xbf, 0x34, 0x2f, 0xd5, 0x46, 0xde,
-  0x27, 0xd8, 0x3f, 0x1d, 0x3f, 0x30, 0xb0, 0xe6, 0x50, 0x40, 0x2f, 0x19,
-  0x1b, 0xa2, 0xdf, 0xfa, 0x0e, 0x48, 0xba, 0x9c, 0x3f, 0xd2, 0x36, 0xa5,
-  0xe2, 0xbe, 0x0f, 0x0c, 0x93, 0xe5, 0xae, 0xb7, 0x34, 0x0f, 0xa0, 0x1f,
-  0xd6, 0x05, 0x9f, 0x01, 0xba, 0x93, 0x9f, 0xee, 0x31, 0xcf, 0xf1, 0xca,
-  0x9c, 0xa4, 0x2f, 0xc7, 0x42, 0x4c, 0xaa, 0x0a, 0x1f, 0xa3, 0xb8, 0xa7,
-  0x27, 0x0e, 0xfb, 0xd8, 0xe8, 0x1a, 0xe8, 0x1a, 0x39, 0xf1, 0x54, 0xac,
-  0xe8, 0x90, 0x39, 0x2d, 0x11, 0x29, 0x4d, 0x2f, 0x03, 0xb7, 0x14, 0xda,
-  0x49, 0xd7, 0xc1, 0xde, 0x3a, 0xae, 0xb3, 0x42, 0xa7, 0xff, 0x03, 0xa6,
-  0x40, 0x39, 0xfd, 0x22, 0xd5, 0xc0, 0xaa, 0x0e, 0x33, 0xaa, 0xeb, 0x0a,
-  0x39, 0x12, 0xe2, 0x48, 0x2e, 0xef, 0xa5, 0x0e, 0xd0, 0x32, 0xbd, 0xd8,
-  0xeb, 0x22, 0x4d, 0xf5, 0x07, 0x2e, 0xb8, 0xa7, 0xce, 0xcb, 0xd3, 0x36,
-  0xb1, 0x9e, 0x40, 0xd0, 0x4c, 0x15, 0x04, 0xff, 0xaf, 0x05, 0x45, 0x54,
-  0xdf, 0xed, 0xfe, 0xec, 0xf9, 0x09, 0x09, 0x2a, 0x0a, 0x2b, 0xc8, 0xaf,
-  0xec, 0x2f, 0x28, 0xf7, 0x52, 0xe1, 0x2c, 0x4c, 0x27, 0x4f, 0x31, 0xdb,
-  0xdb, 0x02, 0xad, 0xd1, 0xb6, 0xf1, 0x1c, 0xd4, 0x11, 0x40, 0xde, 0x89,
-  0x00, 0x37, 0x4d, 0x2a, 0xd9, 0x9c, 0xcd, 0xcb, 0x3e, 0xa0, 0xfe, 0x48,
-  0x26, 0xc0, 0x1a, 0x54, 0xf9, 0xa9, 0xfe, 0x3f, 0xec, 0xca, 0xf8, 0x2d,
-  0xd9, 0x2d, 0xa1, 0xe2, 0xef, 0x17, 0xb8, 0xb3, 0xac, 0xa4, 0xb7, 0x0e,
-  0xbd, 0x16, 0xef, 0x1e, 0xd2, 0xa7, 0x3e, 0x9f, 0x32, 0xa1, 0xcc, 0xde,
-  0x9b, 0xe6, 0x26, 0x51, 0x38, 0xce, 0xf2, 0xcd, 0x1c, 0x0f, 0x53, 0x3f,
-  0xb9, 0x9c, 0x0a, 0xa0, 0x03, 0x53, 0x1b, 0x47, 0x37, 0xf6, 0xfd, 0xfc,
-  0x29, 0x33, 0xc1, 0xb6, 0xbe, 0x37, 0x0c, 0xbc, 0x19, 0x3b, 0xc4, 0x46,
-  0x30, 0xca, 0xe8, 0xfd, 0x07, 0xfe, 0xcd, 0x08, 0x83, 0xe7, 0xb0, 0xd0,
-  0x0b, 0x9c, 0xeb, 0xb0, 0x9c, 0xda, 0x07, 0x11, 0x88, 0x25, 0xf2, 0x3a,
-  0xf5, 0xe6, 0xf2, 0x37, 0xaf, 0x1a, 0x55, 0x34, 0xd4, 0x06, 0x0f, 0xc5,
-  0x09, 0x28, 0x11, 0x03, 0xd0, 0xcb, 0x18, 0x1e, 0x45, 0x29, 0x0a, 0xa1,
-  0x2b, 0x9a, 0x4b, 0xd1, 0xc2, 0xfe, 0xd3, 0xff, 0x51, 0xb8, 0x41, 0x1e,
-  0xd3, 0xc7, 0xd4, 0xcb, 0xcd, 0x17, 0x02, 0x4d, 0xcc, 0xce, 0xf4, 0xad,
-  0x24, 0xd3, 0x23, 0xa6, 0x16, 0x2f, 0x9c, 0xea, 0xc2, 0xc6, 0x4b, 0x22,
-  0x03, 0x93, 0xb0, 0x4b, 0x9d, 0x1e, 0xf9, 0x35, 0xaa, 0x9f, 0x55, 0x47,
-  0x94, 0x01, 0x13, 0xa6, 0xdd, 0x42, 0xcc, 0xdb, 0xbd, 0x30, 0x23, 0xa0,
-  0x0c, 0x9f, 0xce, 0xa9, 0xd8, 0x2e, 0xb6, 0xb4, 0xbe, 0xaa, 0xfe, 0x35,
-  0xbd, 0x17, 0xb4, 0xb0, 0x42, 0xfd, 0xa3, 0xf0, 0x14, 0xe9, 0xb0, 0x21,
-  0xff, 0xfa, 0x9b, 0xd0, 0x28, 0x30, 0x36, 0x29, 0x0a, 0xea, 0x1b, 0x43,
-  0x3d, 0x20, 0xb2, 0x2b, 0x18, 0xa7, 0xe5, 0xcc, 0x36, 0x02, 0xbb, 0x50,
-  0x07, 0xef, 0xd0, 0xc3, 0x94, 0xdb, 0xeb, 0xe6, 0xf5, 0x2f, 0x12, 0xf5,
-  0x0e, 0x03, 0x25, 0xa7, 0x9e, 0x0a, 0xcd, 0xdd, 0xaf, 0x9f, 0xc0, 0xd4,
-  0x86, 0x0b, 0x1c, 0xea, 0x02, 0x9f, 0xe4, 0x29, 0xb7, 0x1a, 0x3f, 0x32,
-  0x04, 0x1e, 0xf3, 0x17, 0x81, 0x07, 0xd7, 0x9c, 0xf3, 0x0d, 0xf1, 0x38,
-  0xff, 0x94, 0xef, 0xe6, 0xb6, 0x3c, 0xd9, 0xe5, 0x91, 0xa0, 0x12, 0x91,
-  0x9a, 0x02, 0x9d, 0xeb, 0xb7, 0x2f, 0xb3, 0x3f, 0xea, 0xb9, 0xe9, 0xdf,
-  0xb2, 0xf0, 0xaf, 0xf9, 0xf3, 0x27, 0x1a, 0x0b, 0xe1, 0x8b, 0xa5, 0xba,
-  0x57, 0x0f, 0xe0, 0x51, 0xd5, 0xd3, 0x1a, 0x45, 0xe8, 0x3f, 0xd3, 0x15,
-  0x1f, 0xc7, 0xa8, 0xe5, 0xa3, 0x2d, 0xf3, 0xee, 0xd7, 0x16, 0xd6, 0x21,
-  0x8d, 0xc6, 0x1c, 0x3f, 0x33, 0x41, 0x24, 0xad, 0x4c, 0xa1, 0xbd, 0x13,
-  0xba, 0xed, 0xdc, 0xec, 0xe3, 0xa5, 0xb0, 0xa7, 0x4c, 0x1a, 0x20, 0x33,
-  0xdb, 0xde, 0x8a, 0xe2, 0xc7, 0xec, 0xf1, 0xd8, 0xab, 0xcb, 0xd3, 0xd5,
-  0xe0, 0xf1, 0xf0, 0xb5, 0x04, 0xa4, 0x29, 0x42, 0x94, 0xba, 0xc3, 0x0a,
-  0x0b, 0xa7, 0x0e, 0xf1, 0xf4, 0x36, 0xec, 0x11, 0xf7, 0xf9, 0x2a, 0xda,
-  0x89, 0x91, 0xe1, 0xc3, 0x0b, 0xf8, 0x36, 0x16, 0x25, 0x08, 0xfd, 0xd4,
-  0xe5, 0x39, 0x4e, 0x11, 0xf9, 0xeb, 0xb7, 0xdb, 0xb7, 0x09, 0x23, 0xf3,
-  0x1e, 0x45, 0x06, 0xb8, 0xeb, 0x8a, 0x12, 0x48, 0xbc, 0xf1, 0xf2, 0xe2,
-  0x19, 0x18, 0xda, 0x96, 0x4b, 0xf2, 0x17, 0xec, 0x31, 0xe6, 0xed, 0x22,
-  0x1e, 0x03, 0x23, 0xa7, 0xfd, 0xe0, 0xdb, 0xab, 0x9a, 0x04, 0x42, 0xbe,
-  0xc4, 0xee, 0xb1, 0x13, 0xf4, 0xd0, 0x22, 0xf8, 0xf6, 0x0a, 0xb8, 0x31,
-  0xc9, 0x54, 0xcf, 0x91, 0xcc, 0x90, 0x43, 0xbe, 0xf5, 0x12, 0x12, 0x0d,
-  0xbb, 0x13, 0xf6, 0xa7, 0x1d, 0xb2, 0x45, 0xe7, 0xf0, 0xc4, 0x81, 0xb5,
-  0xe9, 0x31, 0x39, 0x12, 0xf0, 0x24, 0x0c, 0x8e, 0xc0, 0xc2, 0xc2, 0xda,
-  0x9b, 0xc8, 0xea, 0xec, 0xb9, 0x9b, 0xed, 0x9a, 0xfc, 0x89, 0xf7, 0x10,
-  0xd1, 0x41, 0x1c, 0xce, 0x19, 0x02, 0x98, 0xcc, 0xd2, 0x03, 0xa1, 0x0f,
-  0x12, 0xd3, 0x9c, 0xd2, 0x40, 0x1d, 0x0c, 0xdd, 0xe9, 0x1d, 0xef, 0x4b,
-  0xfb, 0x40, 0xfe, 0x17, 0xa6, 0x1d, 0x04, 0x4c, 0x9a, 0xa9, 0xf7, 0xd4,
-  0x0d, 0x8e, 0xe1, 0xb9, 0x9d, 0xa8, 0x18, 0xf2, 0xcd, 0x21, 0xdc, 0xb8,
-  0xe4, 0xdb, 0xbd, 0x37, 0x35, 0x2d, 0x50, 0xf7, 0x10, 0x0f, 0xaf, 0x01,
-  0xd1, 0x92, 0x21, 0xd4, 0x36, 0x03, 0x3c, 0xaf, 0xf6, 0xd1, 0xdf, 0x54,
-  0xce, 0xd9, 0xf7, 0x35, 0x2a, 0x1d, 0xdb, 0xe1, 0x0d, 0x15, 0x2f, 0x90,
-  0xbd, 0x82, 0x0a, 0xf5, 0x8b, 0xaa, 0xc5, 0x94, 0xe2, 0x15, 0xc7, 0x3d,
-  0x1b, 0xe4, 0xcb, 0xcb, 0xfa, 0xa3, 0x06, 0x48, 0xe7, 0x51, 0x04, 0xef,
-  0x0f, 0x14, 0x30, 0x06, 0xfb, 0xa8, 0xc4, 0xcc, 0xea, 0x0b, 0xdd, 0xdb,
-  0xfc, 0x28, 0x03, 0x35, 0x1e, 0x1c, 0x19, 0x02, 0xab, 0x05, 0xb7, 0x34,
-  0xf7, 0x18, 0x13, 0x1e, 0xbf, 0xbd, 0x50, 0x3e, 0x56, 0x48, 0xfa, 0x4c,
-  0x1c, 0xf3, 0x44, 0x18, 0x3e, 0x29, 0xe3, 0xb3, 0x04, 0x61, 0x05, 0x96,
-  0xf0, 0x8e, 0x04, 0xe2, 0x54, 0x26, 0x1a, 0xe6, 0x2a, 0x26, 0x52, 0xb4,
-  0x48, 0xfd, 0x2b, 0x58, 0x53, 0x03, 0x13, 0x8b, 0x58, 0x91, 0x0a, 0x23,
-  0x97, 0xa1, 0xda, 0x3c, 0xd1, 0x08, 0x24, 0x8f, 0xd1, 0xb4, 0xf7, 0x54,
-  0x54, 0x4b, 0x45, 0x00, 0xda, 0xff, 0xf2, 0x4f, 0x00, 0x2c, 0xc3, 0xf2,
-  0x4c, 0xb6, 0xeb, 0xe3, 0xa7, 0x2f, 0xa9, 0x38, 0xc8, 0xcf, 0xa1, 0x06,
-  0x46, 0xd3, 0x2e, 0xaf, 0xd0, 0x0e, 0xb4, 0x94, 0x3e, 0x2e, 0xa7, 0x3f,
-  0xb9, 0xe6, 0xc2, 0xe9, 0xfd, 0xbe, 0x3b, 0xa3, 0x31, 0x04, 0x43, 0x81,
-  0x3a, 0x8b, 0xd1, 0x53, 0x0d, 0x5a, 0x04, 0x33, 0xfc, 0xc9, 0x9b, 0xc3,
-  0xf5, 0x13, 0xb7, 0x25, 0x26, 0xff, 0x12, 0xdc, 0x53, 0xce, 0x1f, 0x50,
-  0xe6, 0x02, 0x39, 0xd6, 0xb7, 0xaf, 0x1c, 0x4b, 0xe1, 0x4b, 0x96, 0x2a,
-  0xc5, 0xb2, 0xbd, 0x4d, 0x13, 0x5c, 0x22, 0xf9, 0x00, 0xd6, 0x56, 0xf7,
-  0xb6, 0x41, 0xa4, 0x27, 0xdf, 0x0d, 0x1e, 0x9e, 0xbe, 0x07, 0x37, 0x98,
-  0xdf, 0xba, 0x17, 0x37, 0xef, 0x62, 0x49, 0x38, 0x39, 0xae, 0xa6, 0xc5,
-  0x2a, 0x12, 0xe2, 0x4c, 0x62, 0x26, 0x64, 0xc7, 0x98, 0xe8, 0xce, 0xa0,
-  0xac, 0x66, 0xc4, 0xb7, 0x43, 0x44, 0x13, 0x2a, 0x2d, 0xc3, 0xd3, 0x57,
-  0x2d, 0xf6, 0xcb, 0x47, 0x50, 0x9f, 0x15, 0xa8, 0x95, 0xbc, 0xae, 0xbb,
-  0x39, 0x98, 0xda, 0x0a, 0xc9, 0xd0, 0x17, 0x2c, 0x31, 0xe9, 0xcb, 0x20,
-  0xb0, 0xf9, 0x66, 0x1d, 0x21, 0x27, 0xe8, 0xeb, 0xee, 0x24, 0xd9, 0xea,
-  0x9d, 0x4e, 0xf5, 0x16, 0x1d, 0x99, 0xea, 0xcc, 0xbf, 0x32, 0x43, 0x18,
-  0x06, 0x37, 0xd3, 0xfd, 0x94, 0xdf, 0xe8, 0xba, 0xd4, 0xc7, 0xcc, 0xb6,
-  0x99, 0x36, 0x4e, 0x3f, 0x5a, 0xc9, 0x48, 0xa0, 0x02, 0x3b, 0x4a, 0xaf,
-  0xf0, 0xd5, 0xfa, 0x47, 0xa0, 0x3d, 0xbc, 0x35, 0xbe, 0xd5, 0x3e, 0x0e,
-  0xb8, 0xe5, 0xac, 0x50, 0x93, 0x59, 0x37, 0x1b, 0x21, 0xe6, 0xa0, 0xd3,
-  0x1e, 0x23, 0x08, 0xb5, 0x55, 0x46, 0xf0, 0x9f, 0xe8, 0xcc, 0xc1, 0x30,
-  0x4c, 0x98, 0xb7, 0x92, 0xc2, 0xc2, 0x9a, 0x00, 0x4c, 0x41, 0xc9, 0xb6,
-  0x4f, 0xd1, 0xc6, 0x19, 0x42, 0x3b, 0xbf, 0x49, 0xb9, 0x64, 0x30, 0x0d,
-  0x11, 0xea, 0xec, 0xed, 0x99, 0xa4, 0x0c, 0x96, 0x68, 0x5a, 0xfb, 0x29,
-  0xd3, 0xd8, 0x50, 0x5c, 0xc2, 0x37, 0x0e, 0x23, 0x25, 0x2e, 0x4e, 0x9c,
-  0xfa, 0xcc, 0x9d, 0x26, 0xdc, 0x36, 0x53, 0xa4, 0xba, 0xa0, 0xf5, 0x29,
-  0x99, 0x4c, 0x3f, 0xc6, 0xe7, 0xd6, 0x17, 0xf6, 0xa6, 0xf3, 0x4b, 0x26,
-  0x00, 0x2c, 0xd4, 0xbc, 0x4c, 0x06, 0x8d, 0xa0, 0xc1, 0xaa, 0xaa, 0x20,
-  0x31, 0xf8, 0x50, 0xe1, 0xac, 0xf1, 0xd6, 0xe7, 0x11, 0x21, 0x1a, 0xab,
-  0x01, 0x1f, 0xee, 0x0e, 0x28, 0xe4, 0xe3, 0xf6, 0x8c, 0x10, 0x0b, 0x5b,
-  0x51, 0x97, 0xbd, 0xba, 0x08, 0x43, 0x35, 0xd7, 0x46, 0x65, 0xe8, 0x1a,
-  0xcd, 0xe3, 0xe0, 0xfb, 0xe3, 0xe9, 0xa1, 0x47, 0x54, 0xfc, 0xf3, 0x16,
-  0x07, 0x42, 0xe5, 0x9f, 0x01, 0xdb, 0x92, 0x0a, 0xdb, 0xff, 0x5d, 0xad,
-  0xec, 0xf1, 0x5f, 0x0d, 0xcb, 0xd9, 0x58, 0x0a, 0x05, 0xe4, 0x51, 0x0b,
-  0xd6, 0xd1, 0x27, 0x8f, 0x41, 0x5a, 0xbd, 0x90, 0xa7, 0x57, 0xe1, 0xf0,
-  0x41, 0x08, 0x0d, 0x50, 0xb7, 0x11, 0x45, 0x4a, 0x15, 0x3e, 0x01, 0xeb,
-  0xb8, 0x4d, 0xfa, 0xcd, 0xf7, 0xc6, 0x9c, 0x54, 0x05, 0xef, 0x12, 0xd5,
-  0x23, 0xa3, 0x53, 0xd1, 0xeb, 0xcc, 0x03, 0xab, 0x02, 0x05, 0xa8, 0xc0,
-  0x25, 0xcd, 0xb0, 0x51, 0x06, 0xe7, 0xc3, 0xb8, 0xd8, 0xc3, 0xdb, 0xcc,
-  0x24, 0xc2, 0x13, 0xf6, 0x2f, 0x2b, 0xd7, 0xbb, 0xf0, 0x13, 0x21, 0xfd,
-  0xb9, 0xdf, 0x0f, 0x09, 0xfb, 0xd0, 0xfb, 0xef, 0xe5, 0xe7, 0x07, 0xfc,
-  0x1a, 0xde, 0xb4, 0xbc, 0xd6, 0xe9, 0xe4, 0xd7, 0xeb, 0xc9, 0xf4, 0x15,
-  0x33, 0xfc, 0xaf, 0xc3, 0x1c, 0x31, 0x25, 0x10, 0xac, 0xeb, 0x18, 0x0b,
-  0xb1, 0xb7, 0x0a, 0xfb, 0x09, 0xf0, 0x27, 0x29, 0x24, 0xd3, 0xcc, 0xc9,
-  0xce, 0xdb, 0xea, 0xd0, 0x20, 0xc3, 0x14, 0xf5, 0x3c, 0xf9, 0xac, 0xa1,
-  0xf6, 0x08, 0x2c, 0xe3, 0x90, 0xe5, 0x1e, 0xfc, 0xa9, 0xb6, 0xf1, 0x16,
-  0xee, 0x07, 0x36, 0x18, 0x24, 0x1a, 0xf9, 0xf9, 0xf1, 0xfa, 0xfd, 0xe2,
-  0x29, 0xe7, 0xef, 0x11, 0x2b, 0xe7, 0xfb, 0xf0, 0x20, 0x18, 0x15, 0x0d,
-  0x04, 0x2b, 0x07, 0x0c, 0xe6, 0xc3, 0x08, 0x14, 0xf2, 0xd5, 0x1a, 0x12,
-  0x1b, 0xfe, 0x09, 0xd0, 0x10, 0xa0, 0x09, 0xe3, 0x15, 0xe3, 0x20, 0xea,
-  0x1f, 0x4f, 0xc5, 0xc2, 0xaa, 0x2c, 0xd8, 0x0d, 0xc6, 0xb8, 0x07, 0xfe,
-  0xe1, 0xfe, 0x02, 0x16, 0xe1, 0x81, 0xd4, 0xaf, 0x10, 0xe5, 0xfa, 0xc0,
-  0x0a, 0xca, 0xe8, 0xf0, 0x05, 0xd9, 0xf9, 0xf5, 0x36, 0x57, 0xab, 0xb2,
-  0xbd, 0x4a, 0xd3, 0x17, 0x98, 0xb6, 0x25, 0xf0, 0xb9, 0xc4, 0x33, 0x0e,
-  0x14, 0x96, 0xb1, 0x93, 0x09, 0xec, 0xc7, 0xdb, 0x0d, 0xb7, 0xe2, 0xc0,
-  0x22, 0xd2, 0x1c, 0xf3, 0x30, 0x1f, 0xb8, 0xa4, 0xae, 0x37, 0xd3, 0xe9,
-  0xa9, 0xd2, 0x15, 0x01, 0xb1, 0xab, 0x22, 0xff, 0xf8, 0xa6, 0xaf, 0xbf,
-  0x11, 0xf2, 0x03, 0xf5, 0xdb, 0xdc, 0x0e, 0xd8, 0x21, 0xc9, 0x05, 0xf8,
-  0x23, 0x03, 0xfe, 0x17, 0x19, 0x14, 0x29, 0x0b, 0x18, 0x20, 0x0d, 0x03,
-  0xd7, 0xf1, 0x1d, 0xeb, 0x13, 0xd8, 0x2f, 0xc0, 0x3a, 0xf7, 0x14, 0xf8,
-  0xf3, 0xc6, 0xe2, 0xfd, 0x3e, 0xd6, 0x0d, 0x0b, 0x3a, 0x47, 0xed, 0x97,
-  0x9f, 0x44, 0xc1, 0x18, 0xf7, 0xb2, 0x18, 0x18, 0xda, 0xf1, 0x37, 0x08,
-  0x1b, 0x81, 0xcb, 0xa8, 0x44, 0xdc, 0xdc, 0xe2, 0x07, 0x98, 0xea, 0xcc,
-  0x07, 0xb9, 0xe5, 0xfd, 0x68, 0x36, 0xaa, 0x99, 0xca, 0x58, 0xaf, 0x0f,
-  0xbc, 0xb6, 0x12, 0x1c, 0x97, 0xe3, 0x39, 0x04, 0x24, 0xa3, 0xb3, 0xb2,
-  0x10, 0xe5, 0xfb, 0xd3, 0xf9, 0xa3, 0xe8, 0xef, 0x2d, 0xc2, 0xef, 0xee,
-  0x3a, 0x44, 0xbe, 0xb5, 0xb3, 0x3d, 0xbc, 0x07, 0xaf, 0xa4, 0x2e, 0x1a,
-  0xb6, 0xba, 0x36, 0x0d, 0x03, 0xa9, 0xb8, 0xaa, 0x35, 0x0e, 0x15, 0xdf,
-  0xc0, 0xc7, 0xf8, 0xdb, 0x2f, 0xb6, 0x1d, 0x15, 0x51, 0xec, 0x0f, 0x03,
-  0x01, 0x4d, 0x35, 0x08, 0x0a, 0x17, 0x37, 0xf7, 0xc3, 0xd8, 0x28, 0xfa,
-  0x2a, 0xc5, 0x16, 0xa0, 0x1d, 0x01, 0x11, 0x17, 0xca, 0xe7, 0x07, 0xea,
-  0x4c, 0x06, 0x12, 0x04, 0x43, 0x37, 0xf4, 0x05, 0x15, 0x50, 0x12, 0xef,
-  0x0d, 0xd8, 0x10, 0x03, 0x01, 0x00, 0x34, 0x1b, 0xfc, 0xbd, 0xaa, 0xc3,
-  0x1e, 0x16, 0x05, 0x02, 0xd0, 0x02, 0x18, 0xea, 0x2c, 0x01, 0x12, 0x15,
-  0x3d, 0x65, 0x00, 0xe5, 0x03, 0x4f, 0x0f, 0xfe, 0x02, 0xb0, 0xf5, 0xf7,
-  0xa0, 0xdf, 0x15, 0xf4, 0x03, 0xea, 0xc8, 0xca, 0x36, 0x0c, 0x00, 0xfd,
-  0xc2, 0xec, 0xf8, 0xf2, 0x22, 0xdf, 0x23, 0x1a, 0x46, 0x42, 0xfa, 0xe6,
-  0xf9, 0x49, 0xf5, 0x05, 0xe6, 0xd5, 0x03, 0xe9, 0x94, 0xdb, 0x2f, 0xee,
-  0x20, 0xd4, 0xdd, 0xb0, 0x1c, 0x02, 0xee, 0xed, 0xf9, 0xed, 0xfb, 0xed,
-  0x42, 0xe2, 0x08, 0xe6, 0x30, 0x30, 0x1e, 0xf3, 0xff, 0x34, 0x1c, 0x03,
-  0x0d, 0x1c, 0xf2, 0xfe, 0xc8, 0x19, 0x2f, 0xf8, 0x1b, 0x1a, 0x22, 0xe6,
-  0xd2, 0xf8, 0x36, 0x31, 0x5a, 0x26, 0x4d, 0x0f, 0xd3, 0x4c, 0x3e, 0xea,
-  0x04, 0xba, 0xfb, 0x55, 0x57, 0xd9, 0xd3, 0xba, 0x1a, 0x2e, 0x42, 0xff,
-  0x4f, 0xd3, 0xbe, 0xd0, 0x17, 0x1e, 0xca, 0x2a, 0xb2, 0x9d, 0xaa, 0xae,
-  0x3d, 0x34, 0x16, 0xe3, 0xc6, 0xd3, 0xaa, 0xfb, 0x12, 0xa2, 0x3b, 0x1a,
-  0x0a, 0xf0, 0x32, 0x29, 0xc5, 0x2e, 0x09, 0xc8, 0xf5, 0xbf, 0xa3, 0x13,
-  0xf6, 0xc1, 0xce, 0x2b, 0xc6, 0x8f, 0x02, 0xbd, 0xf0, 0xea, 0xf2, 0x0e,
-  0x47, 0xd3, 0xe3, 0x2d, 0xfe, 0xcc, 0xf2, 0x41, 0x0a, 0xc0, 0xf5, 0x36,
-  0xa7, 0x11, 0x43, 0xcb, 0x0b, 0xa9, 0x0d, 0x3b, 0xd3, 0x00, 0xf9, 0x2c,
-  0xd2, 0x9a, 0x3e, 0xf7, 0x42, 0x57, 0x48, 0xd6, 0xad, 0x4e, 0xc7, 0x6d,
-  0xbd, 0xf7, 0x1a, 0xd5, 0xf9, 0xbd, 0xb9, 0x43, 0xd2, 0x35, 0xe3, 0x2f,
-  0x39, 0x05, 0x37, 0x13, 0xf8, 0xe8, 0xc3, 0x00, 0x14, 0x06, 0xd7, 0x09,
-  0x2d, 0x35, 0x18, 0xc4, 0xef, 0xec, 0xc3, 0x2b, 0xae, 0x9d, 0x19, 0xe2,
-  0xf9, 0x29, 0x25, 0xef, 0x1a, 0xc9, 0xcd, 0xf3, 0xb8, 0x0c, 0xf1, 0x37,
-  0xfd, 0x40, 0x3d, 0x09, 0x01, 0x28, 0xb7, 0xb4, 0xca, 0xd6, 0xf9, 0xd2,
-  0xe6, 0x1c, 0xeb, 0xf3, 0xa8, 0x17, 0x54, 0x1f, 0x4a, 0x3b, 0x0e, 0xe8,
-  0xf5, 0x07, 0xe9, 0xe4, 0xd3, 0xe9, 0xed, 0xca, 0xcf, 0xde, 0x2d, 0x34,
-  0xbd, 0xc7, 0xab, 0x17, 0x1d, 0x3d, 0xbb, 0xe7, 0xdf, 0xac, 0xdb, 0xd7,
-  0xc9, 0xcc, 0x22, 0x31, 0x31, 0x2a, 0x3b, 0xd4, 0xaa, 0xd8, 0xee, 0xfc,
-  0xc5, 0xf5, 0x00, 0xe0, 0x81, 0xdd, 0x40, 0x1c, 0xf1, 0x1e, 0x2c, 0xff,
-  0xdf, 0x4a, 0xc9, 0xf1, 0xfc, 0xb7, 0x0d, 0x56, 0xee, 0x13, 0xa8, 0x2b,
-  0xf8, 0xe2, 0xcb, 0x07, 0x9b, 0x22, 0x2d, 0xf7, 0xe9, 0x42, 0x91, 0x18,
-  0x1e, 0x3f, 0x1b, 0x51, 0xf5, 0x2a, 0xdf, 0xfa, 0xd0, 0x3e, 0xdb, 0xe3,
-  0xe4, 0xc6, 0xe2, 0xe6, 0xf2, 0xfe, 0x00, 0xe2, 0x55, 0xf5, 0x24, 0xf0,
-  0x35, 0x01, 0x4b, 0xca, 0xf6, 0xe7, 0x09, 0xdb, 0xe6, 0x48, 0x3f, 0x33,
-  0xd8, 0x0c, 0xb5, 0x9d, 0x5a, 0x13, 0xf6, 0xad, 0xc7, 0xb8, 0xe5, 0x36,
-  0xe9, 0x93, 0xba, 0x04, 0x32, 0x9f, 0xff, 0x4a, 0xc0, 0xc2, 0xf5, 0x28,
-  0x2b, 0xe8, 0x89, 0xe3, 0x03, 0xd0, 0x14, 0xad, 0x36, 0xf8, 0xe7, 0xb3,
-  0x2d, 0xe1, 0xff, 0x51, 0xfa, 0x32, 0x45, 0x4c, 0x28, 0xfd, 0x23, 0xfb,
-  0x38, 0x3d, 0xad, 0x37, 0xf8, 0x37, 0x02, 0xe9, 0x2f, 0xf5, 0xe4, 0x1e,
-  0x09, 0xe0, 0x0c, 0xa0, 0x24, 0xe5, 0xa8, 0x2e, 0xba, 0x44, 0xa8, 0xe9,
-  0x4a, 0x28, 0x20, 0x32, 0x38, 0x1c, 0xdf, 0x36, 0x24, 0xea, 0x10, 0xbc,
-  0x3b, 0xf4, 0xc9, 0x26, 0xe0, 0x1f, 0xa3, 0x06, 0xb2, 0xc6, 0x45, 0xc7,
-  0xd7, 0x38, 0xa7, 0xc5, 0x39, 0xf4, 0x27, 0x18, 0xe4, 0xd4, 0xb4, 0x25,
-  0xc8, 0x0b, 0x40, 0xf1, 0x03, 0xd1, 0x17, 0xea, 0x2b, 0x27, 0x1f, 0xc6,
-  0x33, 0xd1, 0xc3, 0xf1, 0xfc, 0x47, 0xda, 0xed, 0xab, 0x93, 0x9f, 0xdd,
-  0x44, 0xc7, 0x05, 0x35, 0xc1, 0xa7, 0xd3, 0xdb, 0xe2, 0x0b, 0xcd, 0xfa,
-  0xc0, 0x1e, 0x52, 0xc4, 0x27, 0x09, 0x1d, 0x2c, 0x4d, 0x20, 0xa6, 0xd8,
-  0xc7, 0x35, 0xfe, 0x45, 0xfc, 0x15, 0xb1, 0x33, 0x01, 0x24, 0xed, 0x18,
-  0xd4, 0x9e, 0xd6, 0x37, 0x02, 0x0c, 0x9f, 0xb1, 0x2c, 0x33, 0x24, 0x3e,
-  0x06, 0xe1, 0x24, 0xea, 0x3c, 0xd8, 0xc4, 0x51, 0x37, 0x03, 0x2d, 0x1f,
-  0xb1, 0xd2, 0xbe, 0x06, 0x22, 0x03, 0x10, 0x4a, 0xde, 0x33, 0x03, 0x0d,
-  0x20, 0xdb, 0x12, 0xac, 0x5e, 0xcc, 0xec, 0x39, 0xf3, 0xaa, 0xf8, 0x16,
-  0x26, 0xab, 0xd7, 0x09, 0xaf, 0xad, 0xf2, 0xb0, 0xc4, 0x02, 0xc6, 0xe4,
-  0x27, 0xcb, 0x4d, 0xd7, 0x37, 0x3b, 0xc3, 0x5e, 0x26, 0xfc, 0xd0, 0xb9,
-  0x20, 0x92, 0x60, 0x6a, 0x2c, 0xca, 0x62, 0x50, 0xfc, 0xe9, 0xe2, 0x34,
-  0x4e, 0xf9, 0x0e, 0x38, 0x45, 0xd3, 0xbb, 0x55, 0x0c, 0xd8, 0xa9, 0xce,
-  0xbf, 0xee, 0x59, 0x4f, 0x21, 0xa8, 0xe2, 0xb6, 0xa6, 0xf1, 0xfa, 0x48,
-  0xe4, 0xff, 0x17, 0xe4, 0xfd, 0x29, 0x43, 0xc7, 0x3f, 0x0c, 0x97, 0xdc,
-  0xff, 0x33, 0x51, 0xd2, 0x98, 0xc4, 0xef, 0xe6, 0xb6, 0x95, 0xab, 0x02,
-  0xa8, 0x3f, 0x28, 0xf3, 0x49, 0x4c, 0xdc, 0xb7, 0xaa, 0xac, 0xc5, 0x59,
-  0x3a, 0xb1, 0x2f, 0xa8, 0x22, 0x55, 0xf0, 0xe5, 0xd9, 0x4e, 0x56, 0xfc,
-  0xab, 0x2a, 0x12, 0x9f, 0x55, 0xd2, 0x19, 0xc6, 0x0e, 0x6c, 0x26, 0xf4,
-  0x38, 0x53, 0x59, 0x19, 0x13, 0xb9, 0x47, 0x5a, 0x1a, 0xe8, 0x29, 0x43,
-  0xac, 0x34, 0xfb, 0x35, 0x12, 0x63, 0x3c, 0xd8, 0x9e, 0xc0, 0xff, 0x46,
-  0xf3, 0x47, 0xbe, 0x11, 0x3e, 0x1b, 0x5a, 0x02, 0x86, 0x4b, 0xd9, 0x3e,
-  0x00, 0x04, 0x01, 0xeb, 0x58, 0x39, 0xa5, 0x2b, 0x30, 0xfa, 0x11, 0x8a,
-  0x9c, 0x44, 0x1d, 0x3b, 0xeb, 0x36, 0x23, 0x2b, 0x4c, 0xf4, 0x11, 0xf0,
-  0xe7, 0xb0, 0x40, 0x39, 0x8a, 0x36, 0xac, 0x45, 0x45, 0xf0, 0x60, 0x50,
-  0xbf, 0xff, 0xc4, 0xf5, 0xb3, 0xa5, 0x32, 0x21, 0xd5, 0xac, 0x01, 0x16,
-  0xb3, 0x97, 0x51, 0x93, 0x93, 0xb6, 0x25, 0xe5, 0x15, 0xb4, 0xac, 0x37,
-  0xbe, 0x32, 0xda, 0xcb, 0x1c, 0x03, 0xbc, 0x1e, 0x81, 0xe2, 0xb7, 0x4a,
-  0x19, 0x1c, 0x42, 0xa7, 0xf9, 0x36, 0xa3, 0x34, 0x86, 0x4b, 0x95, 0xde,
-  0x92, 0x05, 0x4f, 0x01, 0x21, 0x05, 0x1e, 0xc0, 0x40, 0xcf, 0x09, 0xbe,
-  0x40, 0x08, 0xc4, 0xd3, 0x97, 0xf3, 0xb2, 0xa1, 0x51, 0xaa, 0x29, 0x2d,
-  0x3b, 0x97, 0x03, 0xed, 0x0e, 0xc8, 0x42, 0x06, 0xc7, 0xb6, 0x45, 0x1d,
-  0xb7, 0xab, 0xce, 0xc1, 0x23, 0xa0, 0x1b, 0xe3, 0xfc, 0x4e, 0xd6, 0xfd,
-  0xc5, 0xc7, 0xeb, 0x43, 0x2e, 0x5a, 0xf6, 0xd2, 0x54, 0xf6, 0x4b, 0x48,
-  0x04, 0x09, 0xcc, 0x44, 0xc4, 0xb2, 0x3b, 0xda, 0x20, 0xe5, 0x3b, 0xf4,
-  0x3b, 0x18, 0x14, 0x20, 0xec, 0x00, 0x51, 0x1d, 0x95, 0x94, 0xf8, 0x67,
-  0xe9, 0xab, 0xfa, 0xcb, 0xa9, 0xd7, 0xa4, 0xa3, 0xb7, 0x37, 0xee, 0x38,
-  0xe0, 0x0f, 0x9f, 0x50, 0xa9, 0x0e, 0x16, 0xb2, 0x3e, 0xdd, 0x0e, 0x27,
-  0xa9, 0xb6, 0xb8, 0xaa, 0x14, 0x30, 0x02, 0xc6, 0x2f, 0xaf, 0xec, 0x12,
-  0x93, 0xb8, 0x0e, 0x5f, 0x89, 0xc3, 0xbf, 0x0e, 0x52, 0x48, 0xf4, 0x5c,
-  0xeb, 0x15, 0xea, 0x00, 0xaa, 0x2e, 0x12, 0x39, 0x01, 0xc6, 0xea, 0x3f,
-  0x4f, 0x61, 0xdc, 0xc1, 0xb8, 0x39, 0x4c, 0x44, 0xca, 0x4d, 0x36, 0xe2,
-  0xda, 0xfb, 0x57, 0xcc, 0x9e, 0xd8, 0x00, 0x3d, 0xd9, 0x2c, 0x9d, 0x4b,
-  0xee, 0x01, 0xab, 0x4b, 0xc8, 0xe1, 0x97, 0xa8, 0xbc, 0x1d, 0x1b, 0x2a,
-  0xee, 0xa9, 0xae, 0xc8, 0x30, 0x2a, 0x35, 0xbc, 0xf2, 0xef, 0xec, 0xce,
-  0x97, 0x19, 0x05, 0xdb, 0xd5, 0x20, 0xfc, 0xf2, 0x37, 0x2f, 0xd8, 0x49,
-  0x56, 0xdf, 0xe5, 0xef, 0xa3, 0xcc, 0x61, 0xf1, 0x0f, 0xa1, 0xbc, 0x03,
-  0xf5, 0xfe, 0xff, 0xa2, 0x05, 0xb4, 0xd0, 0xe1, 0xf1, 0x60, 0x04, 0xff,
-  0xd5, 0xab, 0xe4, 0x08, 0xd6, 0x4f, 0x2d, 0x38, 0xee, 0xca, 0xd3, 0x62,
-  0xd7, 0x0a, 0xba, 0xe8, 0xa2, 0x49, 0xa0, 0x2f, 0xd3, 0xaf, 0xdb, 0x6d,
-  0x03, 0x43, 0xb6, 0xa6, 0x1d, 0xcd, 0x4f, 0xd8, 0xac, 0xcd, 0xcf, 0x8f,
-  0xea, 0x9b, 0x16, 0xae, 0x53, 0xc3, 0x20, 0x99, 0x5e, 0xce, 0xb2, 0xbb,
-  0xce, 0x8c, 0xef, 0x37, 0x03, 0xe8, 0x01, 0xe2, 0xdf, 0xeb, 0xf9, 0xdd,
-  0xfb, 0xe1, 0x24, 0xec, 0x04, 0x0d, 0xec, 0xdb, 0xf8, 0x0b, 0xfa, 0xf4,
-  0xd7, 0xf1, 0x05, 0xf7, 0x04, 0xe5, 0xf7, 0xf6, 0x0f, 0xf9, 0x10, 0xff,
-  0x06, 0xe6, 0xef, 0xcd, 0xd5, 0xec, 0xea, 0xd2, 0xfc, 0xc9, 0x10, 0xeb,
-  0x0a, 0x0f, 0xdc, 0xda, 0x0a, 0x09, 0x1e, 0x09, 0xd9, 0xf7, 0x11, 0x0a,
-  0xda, 0xde, 0xfb, 0xef, 0x0d, 0xef, 0xff, 0x09, 0x1b, 0xff, 0xf1, 0xe4,
-  0xef, 0xe0, 0xf2, 0xc6, 0x02, 0xcd, 0x0d, 0xfc, 0x1e, 0xf6, 0xd6, 0xdf,
-  0x15, 0x13, 0xfb, 0x05, 0xb6, 0xeb, 0x09, 0xfc, 0xde, 0xd5, 0xfd, 0x0b,
-  0x2b, 0xe2, 0x1a, 0x13, 0x00, 0xff, 0x01, 0xec, 0xf6, 0xf8, 0xf9, 0xe5,
-  0x03, 0xf8, 0x01, 0xfb, 0x1f, 0xe7, 0x06, 0xf7, 0x09, 0x09, 0x0d, 0x16,
-  0x11, 0x13, 0xf8, 0xf3, 0xec, 0xe6, 0x01, 0x0a, 0x18, 0xf5, 0x0c, 0x23,
-  0x23, 0x06, 0x18, 0xe5, 0xef, 0xd6, 0xf3, 0xda, 0x12, 0xe8, 0x08, 0x07,
-  0x29, 0x1a, 0xe3, 0xe0, 0xd3, 0x23, 0xb2, 0x09, 0xe2, 0xe1, 0xff, 0xfc,
-  0xed, 0xe9, 0x26, 0xfd, 0x2a, 0x88, 0xeb, 0xe0, 0x16, 0x0b, 0x11, 0xec,
-  0xf5, 0xda, 0xea, 0xde, 0xf1, 0xdf, 0xff, 0x03, 0x28, 0x1f, 0xdb, 0xcd,
-  0xe3, 0x23, 0xca, 0x0e, 0xc8, 0xe5, 0xf3, 0xf7, 0xd8, 0xdc, 0x28, 0x01,
-  0x25, 0x81, 0xe5, 0xcc, 0x1e, 0xf0, 0xfc, 0xee, 0xf3, 0xd7, 0xfc, 0xd7,
-  0xf1, 0xe1, 0x16, 0xfa, 0x16, 0x1e, 0xd9, 0xd4, 0xef, 0x2e, 0xb3, 0xf9,
-  0xde, 0xda, 0xf3, 0x05, 0xc7, 0xca, 0x1b, 0x0e, 0x22, 0x9d, 0xde, 0xc4,
-  0x12, 0x10, 0x15, 0xf9, 0xf2, 0xda, 0x0b, 0xfd, 0x15, 0xf6, 0x13, 0xff,
-  0x22, 0xf6, 0x19, 0x04, 0xf5, 0x1c, 0xff, 0xee, 0x08, 0x0d, 0x23, 0x0d,
-  0xf5, 0xeb, 0x19, 0x06, 0xfd, 0xdc, 0x1e, 0xf0, 0x2e, 0x0e, 0x16, 0xe9,
-  0xfd, 0xe3, 0xff, 0xf2, 0x15, 0xe6, 0x08, 0x02, 0x24, 0x25, 0xfd, 0xd6,
-  0xcf, 0x29, 0xc6, 0x09, 0xe9, 0xc0, 0xf2, 0x11, 0xf6, 0xf4, 0x1c, 0x0a,
-  0x2d, 0xa5, 0xdf, 0xe1, 0x27, 0x10, 0x03, 0xeb, 0x0f, 0xc9, 0xf6, 0xed,
-  0x01, 0xe8, 0x11, 0x03, 0x2a, 0x36, 0xdf, 0xdb, 0xda, 0x2b, 0xc6, 0x0d,
-  0xd0, 0xe4, 0x03, 0x01, 0xd1, 0xde, 0x1e, 0xf4, 0x32, 0x86, 0xf1, 0xe1,
-  0x1c, 0xf5, 0xfc, 0xe9, 0x09, 0xd0, 0xf9, 0xf4, 0x08, 0xd2, 0xf8, 0x0c,
-  0x34, 0x29, 0xe7, 0xcf, 0xd3, 0x28, 0xc3, 0xf9, 0xe6, 0xdb, 0x01, 0x0e,
-  0xc3, 0xd5, 0x2c, 0x07, 0x29, 0x9c, 0xea, 0xcc, 0x19, 0x1e, 0x09, 0x12,
-  0xcc, 0xe0, 0x0b, 0xe9, 0x21, 0xe8, 0x16, 0x04, 0x2a, 0xf4, 0x09, 0xfb,
-  0xf0, 0x28, 0x1a, 0x03, 0x0a, 0x09, 0x0f, 0xf0, 0xe1, 0xed, 0x16, 0xf2,
-  0x0e, 0xe0, 0x0b, 0xcd, 0x13, 0x08, 0x1a, 0x07, 0xdc, 0x02, 0xfb, 0xf8,
-  0x1b, 0xf8, 0x0a, 0x15, 0x23, 0x1f, 0x13, 0xf9, 0x00, 0x1e, 0xf0, 0x08,
-  0xf5, 0xcb, 0xfb, 0xf3, 0xff, 0xff, 0x2e, 0x0c, 0x13, 0xf4, 0xdf, 0xe9,
-  0x17, 0x1a, 0x13, 0x03, 0xd7, 0x0c, 0x0d, 0xfd, 0x12, 0xef, 0x15, 0x18,
-  0x38, 0x3f, 0x0b, 0x04, 0x02, 0x28, 0xf5, 0xea, 0xec, 0xf6, 0x09, 0x0d,
-  0xce, 0xf1, 0x1a, 0x0a, 0x13, 0xda, 0xde, 0xe7, 0x1d, 0x05, 0x01, 0x08,
-  0xdf, 0xf1, 0x0a, 0xf2, 0x19, 0xea, 0x08, 0xf6, 0x1e, 0x3d, 0x0e, 0xf7,
-  0x0b, 0x1f, 0xfc, 0x00, 0xed, 0xe4, 0x05, 0xfd, 0xc8, 0xf7, 0x31, 0xff,
-  0x19, 0xef, 0xdb, 0xe2, 0x1a, 0x0f, 0x13, 0x01, 0x06, 0x0f, 0x05, 0x01,
-  0x0d, 0x04, 0xfb, 0x09, 0x18, 0x13, 0x03, 0x05, 0xf2, 0x1f, 0x17, 0x0b,
-  0xf6, 0x0f, 0x13, 0xf1, 0xda, 0x09, 0x10, 0x07, 0x0a, 0xf0, 0x15, 0xf7,
-  0xe2, 0x19, 0xf2, 0x18, 0xda, 0xd9, 0x2d, 0x14, 0xb2, 0x2e, 0x05, 0x00,
-  0xcb, 0xe3, 0x39, 0x4b, 0xed, 0xdc, 0xf5, 0xef, 0x1f, 0xb2, 0xde, 0xf7,
-  0xf9, 0x1e, 0xf1, 0x0e, 0x2d, 0x18, 0xe9, 0x03, 0xf8, 0x21, 0xf3, 0x46,
-  0xa8, 0xb6, 0x49, 0x16, 0xd1, 0x3c, 0xe0, 0x17, 0xd3, 0xde, 0x4d, 0x5d,
-  0x00, 0xff, 0x1a, 0x10, 0x3d, 0xd6, 0xda, 0x06, 0xbc, 0x19, 0xe5, 0x10,
-  0x22, 0x1d, 0x0b, 0x29, 0xe3, 0x39, 0x14, 0x1a, 0xd8, 0xcb, 0x53, 0x39,
-  0xad, 0x60, 0x05, 0xfd, 0xc3, 0xd9, 0x5f, 0x4f, 0xe2, 0x0d, 0x12, 0x01,
-  0x3e, 0xc3, 0xd6, 0x03, 0x9f, 0x07, 0xeb, 0x19, 0x19, 0x01, 0xfb, 0x26,
-  0xf6, 0x0e, 0x01, 0x2d, 0xc1, 0x0d, 0x22, 0x1a, 0xfa, 0x30, 0x0b, 0xf6,
-  0xf2, 0xed, 0x06, 0x18, 0xfe, 0xe4, 0xfc, 0xfa, 0xf1, 0xf6, 0x05, 0x01,
-  0xb4, 0x02, 0xe6, 0x05, 0x0a, 0xe9, 0xed, 0x32, 0x01, 0x44, 0xff, 0x49,
-  0x14, 0xa6, 0x2f, 0x26, 0xda, 0x41, 0x09, 0x0b, 0xd6, 0xbf, 0x3d, 0x5f,
-  0xbf, 0xd1, 0x04, 0x03, 0x44, 0xa2, 0x00, 0x0d, 0x0a, 0xf6, 0xf2, 0x07,
-  0x3f, 0x0c, 0xa2, 0xb3, 0xef, 0x3e, 0x2d, 0x5a, 0xc8, 0xcb, 0x32, 0x36,
-  0xe5, 0x5a, 0xee, 0xe6, 0xe1, 0xd4, 0x75, 0x38, 0xa3, 0xe8, 0x0c, 0xea,
-  0x64, 0xa5, 0xe4, 0xf0, 0xb3, 0x21, 0x28, 0x01, 0x39, 0xd1, 0xb5, 0x9f,
-  0x0c, 0x62, 0x33, 0x3d, 0xec, 0xa9, 0x54, 0x2b, 0xc3, 0x58, 0x00, 0x13,
-  0xec, 0xdb, 0x75, 0x57, 0x93, 0xde, 0xed, 0xff, 0x69, 0xab, 0xef, 0xea,
-  0x90, 0x29, 0xf8, 0x01, 0x18, 0xdb, 0xcb, 0x95, 0x0c, 0x1a, 0xfa, 0x42,
-  0xb6, 0xc0, 0x0d, 0x07, 0xfc, 0x2b, 0xe7, 0xe8, 0xe2, 0xcd, 0x05, 0x22,
-  0x03, 0xfc, 0xe7, 0x0e, 0x08, 0xfe, 0xe0, 0xfb, 0xd7, 0x27, 0x0f, 0xdd,
-  0x11, 0xe9, 0xee, 0x10, 0x08, 0x40, 0x02, 0x27, 0xef, 0xd5, 0x24, 0x01,
-  0xb8, 0x42, 0x1a, 0xe9, 0xf2, 0xb2, 0x55, 0x41, 0xc2, 0xcb, 0xf5, 0x11,
-  0x41, 0xb4, 0xfd, 0x16, 0x0c, 0x0e, 0xfd, 0x19, 0x17, 0x29, 0xba, 0xd0,
-  0x0e, 0x33, 0x19, 0x3f, 0xcb, 0xcb, 0x4a, 0x2f, 0xcb, 0x4d, 0x04, 0x03,
-  0xf1, 0xbe, 0x6b, 0x77, 0x97, 0xe2, 0x16, 0x01, 0x60, 0xd5, 0x1e, 0xf0,
-  0xbd, 0x16, 0x18, 0x05, 0x27, 0x0b, 0xdb, 0xa3, 0x0b, 0x58, 0x2a, 0x37,
-  0x01, 0xad, 0x38, 0x35, 0xd1, 0x75, 0x02, 0x12, 0xbd, 0xcd, 0x71, 0x7f,
-  0xa9, 0xe8, 0x28, 0x08, 0x39, 0xc8, 0x11, 0x08, 0xae, 0x1a, 0x0e, 0xfa,
-  0x45, 0x2b, 0xaf, 0xba, 0xe4, 0x03, 0x15, 0x3a, 0x9f, 0xae, 0x16, 0x27,
-  0xf1, 0x4f, 0xec, 0x13, 0xd2, 0xe8, 0x09, 0x03, 0xe0, 0xd6, 0xfb, 0xe9,
-  0xfc, 0xf6, 0x12, 0x04, 0xd5, 0x0d, 0xfb, 0x14, 0x01, 0x1b, 0xf3, 0x35,
-  0xf8, 0x2b, 0x02, 0x07, 0xf5, 0x04, 0x26, 0xf0, 0x9d, 0x17, 0x1a, 0xf2,
-  0xe3, 0xb0, 0x00, 0x06, 0x02, 0xb1, 0xcb, 0xf2, 0x07, 0xba, 0xf7, 0x19,
-  0x08, 0x05, 0x11, 0x08, 0x1e, 0x12, 0xfc, 0xd1, 0x04, 0x2b, 0x28, 0x34,
-  0xfb, 0xe9, 0x27, 0xff, 0xb3, 0x34, 0x0d, 0xf4, 0xf2, 0xc2, 0x1b, 0x29,
-  0x17, 0xb3, 0xd3, 0x05, 0x40, 0xca, 0xf9, 0xfb, 0x00, 0x0e, 0xfc, 0x06,
-  0xec, 0xf3, 0x15, 0xea, 0xdf, 0x1f, 0x26, 0x10, 0x09, 0x18, 0x0f, 0x0f,
-  0x9c, 0x2c, 0x1a, 0xfc, 0xf0, 0xd2, 0x1f, 0x12, 0xea, 0xc8, 0xdd, 0x12,
-  0x1c, 0xdf, 0x15, 0xf3, 0xfe, 0x05, 0x05, 0x14, 0x15, 0xe1, 0xf4, 0xe2,
-  0xf5, 0x0f, 0x08, 0x3b, 0xde, 0x0c, 0xf1, 0x17, 0xd5, 0x14, 0xf0, 0xf6,
-  0xfd, 0x17, 0xf7, 0xf8, 0xee, 0xb8, 0xde, 0xec, 0x09, 0x01, 0x19, 0xe8,
-  0xcc, 0x1d, 0xdc, 0xff, 0xe3, 0xd4, 0xf3, 0xf5, 0xf2, 0xe1, 0xe7, 0x13,
-  0x0c, 0x21, 0xef, 0xe6, 0xfd, 0xe1, 0xff, 0xfd, 0xe5, 0xf8, 0x24, 0xef,
-  0x19, 0x12, 0xfc, 0xf6, 0x09, 0x26, 0x03, 0x00, 0x04, 0xf5, 0xf8, 0xee,
-  0xf9, 0x0f, 0x11, 0x07, 0xe2, 0xf5, 0xca, 0x08, 0x20, 0x14, 0xf4, 0xea,
-  0xbe, 0xf9, 0x0c, 0x09, 0xf2, 0x04, 0x1c, 0x08, 0x1a, 0xf1, 0xf4, 0x09,
-  0x1a, 0x00, 0xfe, 0xf9, 0x1f, 0xca, 0x04, 0xf8, 0x02, 0x01, 0x12, 0x01,
-  0xdf, 0xf0, 0xce, 0x04, 0x30, 0x0f, 0xe2, 0xf2, 0xac, 0xf2, 0x06, 0xfc,
-  0xd8, 0xf3, 0x0f, 0x19, 0x14, 0xec, 0xf4, 0x0a, 0x2a, 0x14, 0xf3, 0x08,
-  0x39, 0xdc, 0xe7, 0x01, 0x03, 0x0d, 0x04, 0x0b, 0x10, 0x03, 0x15, 0xfe,
-  0x13, 0xf1, 0x11, 0xf1, 0xf7, 0xef, 0x03, 0xfa, 0x08, 0x18, 0xf2, 0xf8,
-  0xf7, 0x10, 0x04, 0xfd, 0x16, 0xf5, 0xfe, 0xf1, 0x2a, 0xfb, 0x01, 0x0f,
-  0x04, 0x14, 0x0d, 0xe5, 0xd8, 0xf6, 0xea, 0xda, 0xf6, 0x29, 0xe3, 0x03,
-  0xf8, 0x06, 0xf7, 0xf9, 0xde, 0xdc, 0xf9, 0x06, 0x36, 0xf5, 0x07, 0x05,
-  0x06, 0x35, 0xf6, 0xf5, 0x0f, 0xfd, 0xcf, 0x07, 0xf4, 0xcc, 0x28, 0x41,
-  0xa1, 0xf6, 0xbe, 0xe8, 0xec, 0x3e, 0xeb, 0xec, 0xec, 0xf2, 0xfa, 0xfd,
-  0xb0, 0x98, 0xfa, 0x1d, 0x32, 0xbd, 0x0c, 0x03, 0xff, 0x22, 0xf8, 0x07,
-  0x39, 0xf8, 0xc1, 0xef, 0xd8, 0x3c, 0x28, 0x34, 0xb2, 0xfe, 0xea, 0xe5,
-  0xee, 0x26, 0xf4, 0xf4, 0xed, 0x11, 0x09, 0x0a, 0xb0, 0xb5, 0x03, 0x0d,
-  0x36, 0xc4, 0x0d, 0xea, 0x1a, 0x21, 0xf2, 0x05, 0x3d, 0xf3, 0xd8, 0xf9,
-  0xe4, 0x26, 0x30, 0x44, 0xe2, 0xf4, 0x03, 0xee, 0x18, 0x2e, 0x05, 0x00,
-  0xe7, 0x05, 0x11, 0x05, 0xfe, 0xce, 0x00, 0xfa, 0x10, 0xc7, 0xf5, 0xff,
-  0xf2, 0x04, 0xfe, 0x05, 0x26, 0xf8, 0xf0, 0xf8, 0x05, 0x18, 0xfe, 0x0f,
-  0xcb, 0x02, 0xe4, 0xe7, 0xe7, 0x18, 0xdb, 0xde, 0xf3, 0xec, 0x08, 0x06,
-  0xc8, 0xee, 0xfd, 0xe8, 0x14, 0xf9, 0x03, 0xf7, 0x05, 0x28, 0xf7, 0xfd,
-  0x0c, 0xec, 0xdc, 0x0e, 0xe8, 0xc2, 0x2d, 0x1f, 0xb2, 0xe9, 0xbf, 0xed,
-  0xf3, 0x1f, 0xee, 0xfa, 0xf4, 0xf4, 0x00, 0xeb, 0xc2, 0x81, 0x02, 0x17,
-  0x1c, 0xc1, 0xf2, 0x0a, 0x01, 0x35, 0xf8, 0x0c, 0x2f, 0xf0, 0xb6, 0xef,
-  0xd1, 0x20, 0x0f, 0x33, 0xbc, 0x06, 0xc8, 0x02, 0xf5, 0x2c, 0xe2, 0xe8,
-  0xe1, 0x03, 0xfe, 0x05, 0xc7, 0xcf, 0x1a, 0x1a, 0x24, 0xad, 0xeb, 0xed,
-  0x08, 0x39, 0xf7, 0x08, 0x42, 0xf5, 0xcc, 0x09, 0xca, 0xea, 0x2d, 0x2c,
-  0xf4, 0xf8, 0x07, 0x06, 0x25, 0x2b, 0xf0, 0xe5, 0xe9, 0xee, 0x17, 0x04,
-  0xe0, 0xdc, 0x0b, 0x16, 0x16, 0xd6, 0xf4, 0xf8, 0x04, 0x00, 0xfb, 0x0d,
-  0x2c, 0xe7, 0xe1, 0x04, 0x10, 0x16, 0x18, 0xf0, 0xf2, 0x10, 0x09, 0xee,
-  0x29, 0xf0, 0x0a, 0x03, 0xe6, 0x04, 0xf7, 0xfe, 0xe6, 0x03, 0x0c, 0x10,
-  0x02, 0x11, 0x23, 0xee, 0x00, 0x1a, 0x10, 0xf6, 0x01, 0xf9, 0xf8, 0x03,
-  0x09, 0x06, 0x13, 0x1a, 0xf9, 0xf7, 0xf8, 0xfd, 0x18, 0x09, 0x10, 0xff,
-  0xea, 0x0b, 0x00, 0x09, 0xff, 0xc7, 0x12, 0xff, 0xfc, 0x10, 0x09, 0x0a,
-  0x17, 0x0e, 0x01, 0xf9, 0x32, 0xfd, 0xcc, 0x0a, 0x0a, 0x21, 0x0d, 0x30,
-  0xfd, 0x0a, 0xfe, 0xef, 0x0e, 0xf5, 0xfd, 0x09, 0xf1, 0xfd, 0x02, 0x05,
-  0x00, 0xe6, 0xff, 0x0d, 0x00, 0xf6, 0x09, 0xf3, 0xff, 0x09, 0xfd, 0xf8,
-  0x1b, 0x11, 0xe6, 0x04, 0x02, 0x25, 0x1e, 0x35, 0x07, 0x0d, 0xf9, 0xf8,
-  0x23, 0xf4, 0x0b, 0x01, 0x06, 0x0d, 0x0b, 0x0a, 0xfd, 0x0d, 0x0a, 0xff,
-  0xf4, 0x04, 0x0c, 0x09, 0x03, 0xff, 0x04, 0x07, 0x28, 0x10, 0xf0, 0xf7,
-  0x0a, 0x0b, 0x09, 0x12, 0x83, 0xbc, 0x0b, 0xd0, 0xe9, 0x26, 0xac, 0xd6,
-  0xa2, 0x01, 0xc6, 0x1e, 0x90, 0xe3, 0x47, 0x97, 0xfb, 0xaf, 0x95, 0x0d,
-  0x95, 0xc4, 0xde, 0x24, 0x33, 0x1d, 0x00, 0xda, 0xbf, 0x30, 0x04, 0x2d,
-  0xb8, 0x2a, 0x8e, 0x2c, 0x3f, 0x08, 0x0d, 0xd3, 0xed, 0x2a, 0x2c, 0x31,
-  0xec, 0xe1, 0xe0, 0xd4, 0xe2, 0xd6, 0x9d, 0x3c, 0xcb, 0xe3, 0xa8, 0x5d,
-  0x2b, 0x07, 0x24, 0xc3, 0x9c, 0xb0, 0x26, 0x12, 0xf4, 0xd9, 0xda, 0x98,
-  0xd2, 0xd5, 0x99, 0x96, 0x10, 0x30, 0x4c, 0xb6, 0xb8, 0xa3, 0xc1, 0x8e,
-  0x16, 0x94, 0xba, 0x01, 0x31, 0xe7, 0xe9, 0x28, 0xe0, 0x07, 0x24, 0xd3,
-  0x0c, 0xe6, 0x13, 0x30, 0x87, 0x04, 0xaf, 0xb7, 0x18, 0xac, 0xc5, 0x9b,
-  0x8f, 0x0e, 0x31, 0x4e, 0xe5, 0x05, 0x53, 0x9b, 0x22, 0x3c, 0xa3, 0x02,
-  0xa8, 0xef, 0xba, 0xd8, 0x27, 0x07, 0xf3, 0x1c, 0xb0, 0x4b, 0xe0, 0x2a,
-  0x2a, 0xe4, 0x30, 0x11, 0xda, 0xd2, 0xa7, 0xa4, 0x93, 0xf2, 0xe1, 0xf8,
-  0xc5, 0x2a, 0xac, 0x3b, 0xd6, 0x22, 0x8c, 0xbd, 0xd4, 0xa7, 0x2b, 0x0a,
-  0xde, 0x01, 0xc6, 0xc8, 0xb4, 0x4a, 0x2d, 0xaf, 0x9a, 0x1d, 0xfb, 0x41,
-  0xcd, 0xd4, 0xef, 0xad, 0xd5, 0xbe, 0xdc, 0x23, 0xe2, 0x37, 0x0a, 0xdf,
-  0xc9, 0x3a, 0x3c, 0xf6, 0xdc, 0x2f, 0xea, 0xd8, 0x53, 0x24, 0x35, 0xd0,
-  0xdc, 0xe4, 0xba, 0xe1, 0xb8, 0x02, 0x97, 0x3c, 0x3d, 0xfd, 0xb0, 0x29,
-  0x3f, 0x00, 0x28, 0xfc, 0xd4, 0xcb, 0x5b, 0x53, 0xac, 0xcd, 0x2c, 0x18,
-  0xe2, 0xe4, 0x05, 0x5c, 0xac, 0x20, 0xc0, 0x5d, 0x9c, 0xb8, 0xb5, 0x0e,
-  0x0f, 0xd7, 0x87, 0x18, 0x06, 0x1f, 0xdf, 0x83, 0xa5, 0x34, 0xcd, 0xa9,
-  0x12, 0x99, 0xdc, 0x03, 0x38, 0x2b, 0xfd, 0xe5, 0xe4, 0xb6, 0xda, 0x57,
-  0x4e, 0x33, 0xe3, 0xa5, 0x2c, 0x0a, 0xe6, 0xc5, 0x23, 0xe7, 0xd2, 0xe1,
-  0x4e, 0x25, 0xe3, 0xf8, 0x03, 0xda, 0xad, 0x2e, 0xbd, 0xf2, 0xe2, 0x4a,
-  0x29, 0xc3, 0xc8, 0x45, 0xa9, 0x14, 0xb6, 0x2b, 0x47, 0x9b, 0xd7, 0x27,
-  0x3a, 0x12, 0x0a, 0x40, 0xfc, 0x03, 0xa2, 0xa6, 0xf3, 0x38, 0x10, 0x9c,
-  0x1c, 0xff, 0x30, 0xf1, 0x17, 0xd0, 0x2c, 0xe1, 0xc5, 0xe1, 0xc5, 0xe1,
-  0xea, 0x11, 0x06, 0xc5, 0x12, 0x88, 0x8f, 0xf2, 0x98, 0xe9, 0xcd, 0xa4,
-  0x17, 0xed, 0x02, 0xb5, 0xcc, 0x09, 0x1d, 0xda, 0xa6, 0xfa, 0xc3, 0x51,
-  0xc5, 0x01, 0x0a, 0xe6, 0xca, 0x2f, 0xc9, 0xa3, 0xbe, 0xd8, 0x34, 0x5a,
-  0x41, 0x3a, 0xbe, 0x13, 0xce, 0x54, 0xb5, 0x23, 0xd8, 0xbb, 0x09, 0xbc,
-  0x1f, 0xe3, 0xf5, 0xa4, 0xa3, 0x41, 0xd7, 0x20, 0x0a, 0xc1, 0xa4, 0x1e,
-  0xfa, 0x8a, 0xc4, 0xb1, 0xbb, 0x0d, 0xb2, 0xc9, 0x16, 0x90, 0x17, 0xda,
-  0x12, 0xa6, 0xc9, 0x4e, 0x92, 0xbc, 0x13, 0xde, 0x42, 0x12, 0x04, 0x94,
-  0xd9, 0x9f, 0xcb, 0x08, 0x04, 0x1e, 0xcc, 0x23, 0xdc, 0xc6, 0x18, 0xc5,
-  0x17, 0xf6, 0xaa, 0x39, 0x4f, 0x07, 0x34, 0x2b, 0x8f, 0xa1, 0xdb, 0xc9,
-  0x31, 0x11, 0xb5, 0xf4, 0xcd, 0xe1, 0x09, 0x31, 0x98, 0xf7, 0xec, 0x54,
-  0xdc, 0xeb, 0x37, 0xa3, 0xad, 0x0a, 0x08, 0xa4, 0xdd, 0xa0, 0x41, 0xba,
-  0xac, 0xf2, 0xf9, 0x56, 0x86, 0xf4, 0x25, 0x0b, 0x96, 0x30, 0xfe, 0x8b,
-  0xb1, 0x36, 0x1f, 0xa3, 0xd1, 0xca, 0xc0, 0xa3, 0xcc, 0x38, 0x8e, 0x14,
-  0x20, 0xcc, 0xe6, 0xed, 0xb5, 0x39, 0x1a, 0x3f, 0x05, 0x0a, 0xb5, 0x39,
-  0x8e, 0x25, 0x4d, 0xae, 0x11, 0x1d, 0x07, 0x90, 0xcb, 0xb5, 0x03, 0xfb,
-  0x26, 0xf9, 0x47, 0x5d, 0xdd, 0xd8, 0x26, 0xaa, 0x34, 0xbd, 0xa1, 0x0c,
-  0xff, 0x1e, 0x8a, 0xcd, 0xb5, 0xdb, 0xb0, 0x56, 0x81, 0x11, 0x0c, 0xd7,
-  0xe4, 0xd9, 0xcc, 0x40, 0x93, 0xa2, 0xbf, 0x1e, 0xcd, 0x35, 0xea, 0xec,
-  0x0c, 0x40, 0x42, 0xbb, 0x94, 0x11, 0x30, 0xf1, 0xe0, 0x38, 0xb2, 0x51,
-  0xfc, 0xc8, 0xaf, 0x27, 0xcc, 0xe4, 0x0c, 0xcc, 0x4c, 0xcf, 0x2e, 0xb2,
-  0xe0, 0x54, 0x1b, 0xf4, 0x02, 0x2b, 0x9a, 0xfd, 0x33, 0xcf, 0x97, 0xfd,
-  0xe8, 0xd7, 0x4f, 0x35, 0x10, 0x1d, 0x1e, 0x44, 0x69, 0xba, 0x30, 0xac,
-  0x0e, 0xd6, 0xf8, 0x3a, 0x04, 0x31, 0x14, 0x05, 0xcc, 0xd6, 0xbb, 0xcc,
-  0x46, 0x0a, 0x01, 0x1e, 0xdd, 0x60, 0x62, 0xfe, 0x19, 0xd8, 0x84, 0x19,
-  0xb9, 0xe1, 0x91, 0xe0, 0xf4, 0xf2, 0x8b, 0x20, 0xc5, 0x23, 0xd4, 0xae,
-  0x55, 0x22, 0xa0, 0xd1, 0xd5, 0xbb, 0x28, 0x01, 0x05, 0x5c, 0x38, 0x95,
-  0x93, 0x15, 0x11, 0x0c, 0xcd, 0xf3, 0xa0, 0x13, 0xd8, 0xf0, 0x2b, 0x29,
-  0xa7, 0xc3, 0xab, 0xff, 0x1f, 0xcd, 0x4c, 0xf1, 0xe2, 0xe7, 0x9c, 0xb8,
-  0xda, 0x09, 0x3c, 0x08, 0x1d, 0xf3, 0xfa, 0xe2, 0x44, 0xcd, 0xcf, 0x5a,
-  0x22, 0xfb, 0x37, 0xa3, 0x00, 0x3d, 0x17, 0x16, 0x48, 0x21, 0xe6, 0x49,
-  0xd3, 0x2c, 0xde, 0xb9, 0x0f, 0xc4, 0xf6, 0xc0, 0x1f, 0xb3, 0xc0, 0xcf,
-  0x34, 0xbc, 0x44, 0xda, 0x4e, 0x53, 0x15, 0xd6, 0x0b, 0x96, 0xf4, 0x5e,
-  0x60, 0x11, 0xd1, 0x0e, 0x98, 0x91, 0xde, 0x5d, 0xbb, 0x10, 0x03, 0x57,
-  0x1f, 0x82, 0xe8, 0x96, 0xad, 0xf3, 0xc9, 0x1d, 0xfd, 0xcb, 0xb4, 0x5d,
-  0x47, 0x10, 0x10, 0xe5, 0x63, 0xa7, 0x3f, 0xb0, 0xc7, 0xc2, 0xf1, 0xd5,
-  0xff, 0xc4, 0x1b, 0x58, 0xe2, 0xc5, 0xcc, 0x0d, 0x94, 0x51, 0xc3, 0xd7,
-  0x38, 0x4c, 0x33, 0x09, 0x0e, 0xf7, 0x18, 0x13, 0x4e, 0x43, 0xa3, 0x8d,
-  0x05, 0xf1, 0x94, 0x46, 0x4b, 0x01, 0x5b, 0x69, 0x1d, 0x4d, 0x16, 0x2d,
-  0xcf, 0xb4, 0xca, 0xe6, 0x2f, 0xd0, 0xa9, 0xe1, 0x2e, 0xd2, 0x00, 0x99,
-  0x45, 0xaf, 0xb9, 0xd0, 0xd5, 0xb4, 0x03, 0x08, 0x1e, 0xae, 0x2c, 0x4b,
-  0x88, 0x0d, 0xb0, 0x1d, 0x39, 0xc7, 0x28, 0x97, 0x08, 0xa5, 0x50, 0x3f,
-  0x51, 0x85, 0x57, 0xe3, 0x04, 0x96, 0xa4, 0x0a, 0xab, 0x01, 0x46, 0x20,
-  0x54, 0x14, 0x4e, 0xe5, 0xa9, 0x3d, 0x66, 0xcf, 0x0f, 0x20, 0x58, 0x09,
-  0x08, 0x36, 0xa6, 0x27, 0x8d, 0xf4, 0x01, 0xdb, 0x3a, 0xcf, 0xd8, 0x96,
-  0x9a, 0xd6, 0xd1, 0x93, 0x55, 0xd3, 0x59, 0x1f, 0x2b, 0x66, 0x04, 0x3e,
-  0xb7, 0x85, 0x51, 0x47, 0x2c, 0x92, 0xdd, 0xa1, 0x0f, 0x36, 0x10, 0xbe,
-  0x99, 0x57, 0x19, 0x56, 0x94, 0x44, 0x0d, 0x02, 0x3b, 0x9a, 0xf9, 0xed,
-  0x02, 0x2f, 0x98, 0xff, 0xd6, 0x9a, 0x10, 0x8c, 0xc3, 0xf8, 0xdc, 0x49,
-  0x3a, 0x96, 0xf7, 0x01, 0xe0, 0xfe, 0xb5, 0x13, 0xfc, 0x2b, 0x12, 0xf5,
-  0xcf, 0x39, 0xb3, 0xde, 0xa2, 0xe8, 0x94, 0xd2, 0xb8, 0x13, 0x1b, 0x42,
-  0x2b, 0xe9, 0x4b, 0x1c, 0xbf, 0xa8, 0xae, 0xcc, 0x0b, 0x9d, 0xc6, 0xab,
-  0xc5, 0xdd, 0xf9, 0x9b, 0xbb, 0xa8, 0xd1, 0x38, 0x99, 0xa4, 0xec, 0xb0,
-  0xee, 0xde, 0x0c, 0x56, 0xd9, 0x94, 0x50, 0xf3, 0xc2, 0x36, 0xcf, 0xbc,
-  0xce, 0x95, 0x10, 0xaf, 0xf6, 0xf2, 0x42, 0xc1, 0xab, 0x14, 0x4d, 0x9e,
-  0xa5, 0xb4, 0xed, 0x47, 0xd9, 0xde, 0x53, 0xb8, 0x10, 0xe0, 0xaf, 0x11,
-  0x81, 0x1b, 0xd8, 0x1d, 0x40, 0xb8, 0x9b, 0xd9, 0x4e, 0x29, 0x2d, 0x5c,
-  0x0c, 0xe7, 0xdf, 0x05, 0xb4, 0xb5, 0xb7, 0xe6, 0xa6, 0xc1, 0x18, 0x05,
-  0x39, 0x9a, 0x20, 0xd9, 0xc4, 0x18, 0xe7, 0x36, 0xc0, 0x2e, 0x2d, 0xaf,
-  0xc5, 0x99, 0xd3, 0x87, 0xd6, 0x13, 0xf3, 0x9f, 0xad, 0x21, 0x2a, 0x4f,
-  0x64, 0x16, 0xbf, 0x08, 0xaf, 0x4a, 0x4d, 0x09, 0x5e, 0xfa, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x30, 0xff, 0xff, 0xff,
-  0x34, 0xfe, 0xff, 0xff, 0x0a, 0x03, 0x00, 0x00, 0xb2, 0xfc, 0xff, 0xff,
-  0x1e, 0xfb, 0xff, 0xff, 0x53, 0xff, 0xff, 0xff, 0x81, 0xfc, 0xff, 0xff,
-  0x46, 0xfa, 0xff, 0xff, 0xaf, 0xfe, 0xff, 0xff, 0x8e, 0x04, 0x00, 0x00,
-  0x47, 0xfe, 0xff, 0xff, 0x7c, 0xfc, 0xff, 0xff, 0x05, 0xff, 0xff, 0xff,
-  0xfd, 0xf7, 0xff, 0xff, 0xc1, 0xfd, 0xff, 0xff, 0xe6, 0xfe, 0xff, 0xff,
-  0xcc, 0xfc, 0xff, 0xff, 0x72, 0xfb, 0xff, 0xff, 0x7d, 0x05, 0x00, 0x00,
-  0x87, 0xfe, 0xff, 0xff, 0x6e, 0xfd, 0xff, 0xff, 0x61, 0xfb, 0xff, 0xff,
-  0x83, 0xf9, 0xff, 0xff, 0xdf, 0xfb, 0xff, 0xff, 0x39, 0x03, 0x00, 0x00,
-  0x13, 0x00, 0x00, 0x00, 0xc0, 0xfc, 0xff, 0xff, 0x5d, 0x01, 0x00, 0x00,
-  0x86, 0x00, 0x00, 0x00, 0x6a, 0x02, 0x00, 0x00, 0x3d, 0xf9, 0xff, 0xff,
-  0x99, 0xfa, 0xff, 0xff, 0xea, 0xfa, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0xc0, 0x00, 0x00, 0x00, 0xf2, 0x3e, 0x20, 0xd7, 0xec, 0xdb, 0xeb, 0x22,
-  0x3e, 0x8c, 0xc9, 0xeb, 0x2e, 0xdf, 0xda, 0x1d, 0xc6, 0xe8, 0xf6, 0xfa,
-  0xdc, 0x27, 0xed, 0xf1, 0x81, 0xdb, 0x39, 0xaa, 0x33, 0x1c, 0x3b, 0x33,
-  0x1c, 0xc7, 0xda, 0x19, 0xe2, 0x00, 0xf0, 0xdf, 0x81, 0x30, 0xf3, 0xe7,
-  0xb4, 0x27, 0x14, 0x0b, 0xfd, 0xf0, 0x26, 0xea, 0xf1, 0xe7, 0x02, 0xe7,
-  0x13, 0x12, 0xf3, 0x20, 0xc3, 0xc6, 0xff, 0xe6, 0x6c, 0x69, 0xe0, 0xe8,
-  0xcb, 0x83, 0xf9, 0x70, 0x36, 0xf9, 0x09, 0xc0, 0x2a, 0x7f, 0xfb, 0x9d,
-  0x26, 0x84, 0x61, 0x7c, 0x41, 0xc3, 0x2c, 0xd3, 0x3e, 0x12, 0x68, 0x6c,
-  0x54, 0xd0, 0xf2, 0x92, 0xee, 0xb5, 0x24, 0x02, 0xec, 0xfd, 0xe6, 0xe2,
-  0xc2, 0x81, 0xe4, 0x10, 0x18, 0x02, 0xfb, 0x11, 0x21, 0x08, 0x0f, 0x17,
-  0xe6, 0x1e, 0x10, 0xfa, 0x8a, 0x0d, 0xe6, 0x8a, 0xbb, 0x28, 0x08, 0xf9,
-  0x08, 0x36, 0xcc, 0xdd, 0x09, 0x36, 0x3d, 0xef, 0xc4, 0x2d, 0xf5, 0xc5,
-  0xa6, 0xcd, 0xc1, 0x33, 0xed, 0xc6, 0x81, 0x18, 0xd4, 0xd0, 0x05, 0xc1,
-  0x0b, 0xc8, 0x33, 0x2a, 0x2e, 0xc3, 0x33, 0x0e, 0xf1, 0xd8, 0x38, 0xea,
-  0xce, 0xed, 0x0f, 0xd8, 0x81, 0xcb, 0x0b, 0xff, 0x24, 0x03, 0xea, 0xfd,
-  0xe6, 0xed, 0x31, 0xd0, 0xf2, 0xe4, 0xe2, 0xfc, 0x19, 0x2e, 0xda, 0x26,
-  0xa5, 0x3b, 0xd7, 0x15, 0xb6, 0xfb, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x18, 0x00, 0x00, 0x00, 0xec, 0xfe, 0xff, 0xff, 0x75, 0x00, 0x00, 0x00,
-  0x8a, 0xfc, 0xff, 0xff, 0x40, 0x01, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00,
-  0x9c, 0xfe, 0xff, 0xff, 0xda, 0xfb, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x08, 0xe4, 0xff, 0xff,
-  0xee, 0xfb, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0xfe, 0xfb, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0e, 0xfc, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x3c, 0xe4, 0xff, 0xff, 0x40, 0xe4, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00,
-  0x4d, 0x4c, 0x49, 0x52, 0x20, 0x43, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
-  0x65, 0x64, 0x2e, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0c, 0x00,
-  0x08, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x1c, 0x00, 0x00, 0x00, 0x6c, 0x04, 0x00, 0x00, 0x70, 0x04, 0x00, 0x00,
-  0x74, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, 0x6e,
-  0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x1c, 0x04, 0x00, 0x00,
-  0xbc, 0x03, 0x00, 0x00, 0x64, 0x03, 0x00, 0x00, 0x3c, 0x03, 0x00, 0x00,
-  0xe0, 0x02, 0x00, 0x00, 0x8c, 0x02, 0x00, 0x00, 0x48, 0x02, 0x00, 0x00,
-  0x04, 0x02, 0x00, 0x00, 0xc0, 0x01, 0x00, 0x00, 0x7c, 0x01, 0x00, 0x00,
-  0x4c, 0x01, 0x00, 0x00, 0x0c, 0x01, 0x00, 0x00, 0xd4, 0x00, 0x00, 0x00,
-  0xac, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x92, 0xfc, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x09, 0x14, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
-  0x07, 0x00, 0x00, 0x00, 0xd6, 0xfc, 0xff, 0xff, 0x00, 0x00, 0x80, 0x3f,
-  0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x1f, 0x00, 0x00, 0x00, 0xc2, 0xfc, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x06, 0x00, 0x00, 0x00, 0x24, 0xe5, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00,
-  0x1f, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
-  0x07, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xf6, 0xfc, 0xff, 0xff,
-  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x14, 0x00, 0x00, 0x00,
-  0x18, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x8e, 0xfc, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
-  0x08, 0x00, 0x00, 0x00, 0xa2, 0xfd, 0xff, 0xff, 0x0c, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x1d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
-  0x1c, 0x00, 0x00, 0x00, 0x52, 0xfd, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x3b, 0x14, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x96, 0xfd, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x1b, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x86, 0xfd, 0xff, 0xff,
-  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x14, 0x00, 0x00, 0x00,
-  0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x76, 0xfd, 0xff, 0xff,
-  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x66, 0xfd, 0xff, 0xff,
-  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x10, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x56, 0xfd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x02,
-  0x01, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x19, 0x00, 0x00, 0x00, 0xee, 0xfd, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x05, 0x24, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0x05, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x2e, 0xfe, 0xff, 0xff,
-  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1c, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xf0, 0xfe, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x17, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
-  0x6e, 0xfe, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-  0x24, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-  0x7e, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x01, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x16, 0x00, 0x00, 0x00, 0xae, 0xfe, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x1c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x70, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x16, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
-  0x0d, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0xee, 0xfe, 0xff, 0xff,
-  0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x34, 0x00, 0x00, 0x00,
-  0x38, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
-  0x18, 0x00, 0x17, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00,
-  0x0e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x01, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x3e, 0xff, 0xff, 0xff, 0x20, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x28, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0c, 0x00,
-  0x08, 0x00, 0x07, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
-  0x0f, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00,
-  0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0xba, 0xff, 0xff, 0xff,
-  0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x1c, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
-  0x08, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x11, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1a, 0x00, 0x14, 0x00,
-  0x10, 0x00, 0x0c, 0x00, 0x0b, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00,
-  0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x24, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
-  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
-  0x0e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x11, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x0e, 0x00, 0x16, 0x00, 0x00, 0x00, 0x10, 0x00, 0x0c, 0x00,
-  0x0b, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x37, 0x18, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x07, 0x00, 0x06, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x21, 0x00, 0x00, 0x00, 0x40, 0x17, 0x00, 0x00, 0xe4, 0x16, 0x00, 0x00,
-  0x8c, 0x16, 0x00, 0x00, 0x50, 0x16, 0x00, 0x00, 0x14, 0x16, 0x00, 0x00,
-  0xd8, 0x15, 0x00, 0x00, 0x3c, 0x15, 0x00, 0x00, 0x98, 0x14, 0x00, 0x00,
-  0xc4, 0x12, 0x00, 0x00, 0xe8, 0x10, 0x00, 0x00, 0x14, 0x0f, 0x00, 0x00,
-  0x30, 0x0d, 0x00, 0x00, 0x1c, 0x0c, 0x00, 0x00, 0xf8, 0x0a, 0x00, 0x00,
-  0x44, 0x0a, 0x00, 0x00, 0x80, 0x09, 0x00, 0x00, 0x2c, 0x09, 0x00, 0x00,
-  0xd4, 0x08, 0x00, 0x00, 0x78, 0x08, 0x00, 0x00, 0xe0, 0x07, 0x00, 0x00,
-  0x04, 0x07, 0x00, 0x00, 0x68, 0x06, 0x00, 0x00, 0x8c, 0x05, 0x00, 0x00,
-  0xf0, 0x04, 0x00, 0x00, 0x14, 0x04, 0x00, 0x00, 0x78, 0x03, 0x00, 0x00,
-  0x24, 0x03, 0x00, 0x00, 0xcc, 0x02, 0x00, 0x00, 0x70, 0x02, 0x00, 0x00,
-  0xe8, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x5a, 0xe9, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x18, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
-  0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x50, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x06, 0x00, 0x00, 0x00,
-  0x44, 0xe9, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3b, 0x1b, 0x00, 0x00, 0x00,
-  0x53, 0x74, 0x61, 0x74, 0x65, 0x66, 0x75, 0x6c, 0x50, 0x61, 0x72, 0x74,
-  0x69, 0x74, 0x69, 0x6f, 0x6e, 0x65, 0x64, 0x43, 0x61, 0x6c, 0x6c, 0x5f,
-  0x31, 0x3a, 0x30, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x06, 0x00, 0x00, 0x00, 0xd2, 0xe9, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x18, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x78, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x06, 0x00, 0x00, 0x00,
-  0xbc, 0xe9, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0xa2, 0x14, 0x9e, 0x3e, 0x40, 0x00, 0x00, 0x00,
-  0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31,
-  0x5f, 0x31, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x33, 0x5f, 0x31,
-  0x2f, 0x4d, 0x61, 0x74, 0x4d, 0x75, 0x6c, 0x3b, 0x73, 0x65, 0x71, 0x75,
-  0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x5f, 0x31, 0x2f, 0x64,
-  0x65, 0x6e, 0x73, 0x65, 0x5f, 0x33, 0x5f, 0x31, 0x2f, 0x42, 0x69, 0x61,
-  0x73, 0x41, 0x64, 0x64, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x72, 0xea, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0x98, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-  0x20, 0x00, 0x00, 0x00, 0x5c, 0xea, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x1a, 0x95, 0xc7, 0x3d, 0x5e, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75,
-  0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x5f, 0x31, 0x2f, 0x64,
-  0x65, 0x6e, 0x73, 0x65, 0x5f, 0x32, 0x5f, 0x31, 0x2f, 0x4d, 0x61, 0x74,
-  0x4d, 0x75, 0x6c, 0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69,
-  0x61, 0x6c, 0x5f, 0x31, 0x5f, 0x31, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65,
-  0x5f, 0x32, 0x5f, 0x31, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x73, 0x65,
-  0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x5f, 0x31,
-  0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x32, 0x5f, 0x31, 0x2f, 0x42,
-  0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x32, 0xeb, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0x5c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-  0x00, 0x02, 0x00, 0x00, 0x1c, 0xeb, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0xc1, 0x5c, 0x80, 0x3c, 0x22, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75,
-  0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x5f, 0x31, 0x2f, 0x72,
-  0x65, 0x73, 0x68, 0x61, 0x70, 0x65, 0x5f, 0x33, 0x5f, 0x31, 0x2f, 0x52,
-  0x65, 0x73, 0x68, 0x61, 0x70, 0x65, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x0e, 0xec, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x38, 0x00, 0x00, 0x00,
-  0xf8, 0xeb, 0xff, 0xff, 0x28, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75,
-  0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x5f, 0x31, 0x2f, 0x72,
-  0x65, 0x73, 0x68, 0x61, 0x70, 0x65, 0x5f, 0x33, 0x5f, 0x31, 0x2f, 0x52,
-  0x65, 0x73, 0x68, 0x61, 0x70, 0x65, 0x2f, 0x73, 0x68, 0x61, 0x70, 0x65,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x66, 0xec, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-  0x38, 0x00, 0x00, 0x00, 0x50, 0xec, 0xff, 0xff, 0x28, 0x00, 0x00, 0x00,
-  0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31,
-  0x5f, 0x31, 0x2f, 0x72, 0x65, 0x73, 0x68, 0x61, 0x70, 0x65, 0x5f, 0x33,
-  0x5f, 0x31, 0x2f, 0x73, 0x74, 0x72, 0x69, 0x64, 0x65, 0x64, 0x5f, 0x73,
-  0x6c, 0x69, 0x63, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xba, 0xec, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-  0x30, 0x00, 0x00, 0x00, 0xa4, 0xec, 0xff, 0xff, 0x20, 0x00, 0x00, 0x00,
-  0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31,
-  0x5f, 0x31, 0x2f, 0x72, 0x65, 0x73, 0x68, 0x61, 0x70, 0x65, 0x5f, 0x33,
-  0x5f, 0x31, 0x2f, 0x53, 0x68, 0x61, 0x70, 0x65, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xb2, 0xec, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0x44, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0x68, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0xa4, 0xec, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x01, 0x00, 0x00, 0x00, 0xc1, 0x5c, 0x80, 0x3c, 0x2a, 0x00, 0x00, 0x00,
-  0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31,
-  0x5f, 0x31, 0x2f, 0x6d, 0x61, 0x78, 0x5f, 0x70, 0x6f, 0x6f, 0x6c, 0x69,
-  0x6e, 0x67, 0x32, 0x64, 0x5f, 0x35, 0x5f, 0x31, 0x2f, 0x4d, 0x61, 0x78,
-  0x50, 0x6f, 0x6f, 0x6c, 0x32, 0x64, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0x4a, 0xed, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x18, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00,
-  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xa8, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x3c, 0xed, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0xc1, 0x5c, 0x80, 0x3c, 0x67, 0x00, 0x00, 0x00,
-  0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31,
-  0x5f, 0x31, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x35, 0x5f,
-  0x31, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x73, 0x65, 0x71, 0x75, 0x65,
-  0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x5f, 0x31, 0x2f, 0x63, 0x6f,
-  0x6e, 0x76, 0x32, 0x64, 0x5f, 0x35, 0x5f, 0x31, 0x2f, 0x42, 0x69, 0x61,
-  0x73, 0x41, 0x64, 0x64, 0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74,
-  0x69, 0x61, 0x6c, 0x5f, 0x31, 0x5f, 0x31, 0x2f, 0x63, 0x6f, 0x6e, 0x76,
-  0x32, 0x64, 0x5f, 0x35, 0x5f, 0x31, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x6f,
-  0x6c, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x3b, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0x22, 0xee, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x18, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
-  0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x68, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x14, 0xee, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00,
-  0xf4, 0x63, 0x8f, 0x3b, 0x2a, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75,
-  0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x5f, 0x31, 0x2f, 0x6d,
-  0x61, 0x78, 0x5f, 0x70, 0x6f, 0x6f, 0x6c, 0x69, 0x6e, 0x67, 0x32, 0x64,
-  0x5f, 0x34, 0x5f, 0x31, 0x2f, 0x4d, 0x61, 0x78, 0x50, 0x6f, 0x6f, 0x6c,
-  0x32, 0x64, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0xba, 0xee, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x09, 0xa8, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0xac, 0xee, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0xf4, 0x63, 0x8f, 0x3b, 0x67, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75,
-  0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x5f, 0x31, 0x2f, 0x63,
-  0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x34, 0x5f, 0x31, 0x2f, 0x52, 0x65,
-  0x6c, 0x75, 0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61,
-  0x6c, 0x5f, 0x31, 0x5f, 0x31, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64,
-  0x5f, 0x34, 0x5f, 0x31, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64,
-  0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f,
-  0x31, 0x5f, 0x31, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x34,
-  0x5f, 0x31, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x6f, 0x6c, 0x75, 0x74, 0x69,
-  0x6f, 0x6e, 0x3b, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x92, 0xef, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x09, 0x68, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x08, 0x00, 0x00, 0x00, 0x84, 0xef, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x5f, 0x5d, 0x21, 0x3b,
-  0x2a, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69,
-  0x61, 0x6c, 0x5f, 0x31, 0x5f, 0x31, 0x2f, 0x6d, 0x61, 0x78, 0x5f, 0x70,
-  0x6f, 0x6f, 0x6c, 0x69, 0x6e, 0x67, 0x32, 0x64, 0x5f, 0x33, 0x5f, 0x31,
-  0x2f, 0x4d, 0x61, 0x78, 0x50, 0x6f, 0x6f, 0x6c, 0x32, 0x64, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x2a, 0xf0, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0x48, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0xa8, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-  0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-  0x1c, 0xf0, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x5f, 0x5d, 0x21, 0x3b,
-  0x67, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69,
-  0x61, 0x6c, 0x5f, 0x31, 0x5f, 0x31, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32,
-  0x64, 0x5f, 0x33, 0x5f, 0x31, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x73,
-  0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x5f,
-  0x31, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x33, 0x5f, 0x31,
-  0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x3b, 0x73, 0x65, 0x71,
-  0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x5f, 0x31, 0x2f,
-  0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x33, 0x5f, 0x31, 0x2f, 0x63,
-  0x6f, 0x6e, 0x76, 0x6f, 0x6c, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x3b, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0xf1, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0x48, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0x64, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-  0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0xf4, 0xf0, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x27, 0x80, 0x80, 0x3b,
-  0x22, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69,
-  0x61, 0x6c, 0x5f, 0x31, 0x5f, 0x31, 0x2f, 0x72, 0x65, 0x73, 0x68, 0x61,
-  0x70, 0x65, 0x5f, 0x32, 0x5f, 0x31, 0x2f, 0x52, 0x65, 0x73, 0x68, 0x61,
-  0x70, 0x65, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0xee, 0xf1, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-  0x38, 0x00, 0x00, 0x00, 0xd8, 0xf1, 0xff, 0xff, 0x28, 0x00, 0x00, 0x00,
-  0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31,
-  0x5f, 0x31, 0x2f, 0x72, 0x65, 0x73, 0x68, 0x61, 0x70, 0x65, 0x5f, 0x32,
-  0x5f, 0x31, 0x2f, 0x52, 0x65, 0x73, 0x68, 0x61, 0x70, 0x65, 0x2f, 0x73,
-  0x68, 0x61, 0x70, 0x65, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x46, 0xf2, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x02, 0x38, 0x00, 0x00, 0x00, 0x30, 0xf2, 0xff, 0xff,
-  0x28, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69,
-  0x61, 0x6c, 0x5f, 0x31, 0x5f, 0x31, 0x2f, 0x72, 0x65, 0x73, 0x68, 0x61,
-  0x70, 0x65, 0x5f, 0x32, 0x5f, 0x31, 0x2f, 0x73, 0x74, 0x72, 0x69, 0x64,
-  0x65, 0x64, 0x5f, 0x73, 0x6c, 0x69, 0x63, 0x65, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x9a, 0xf2, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x02, 0x30, 0x00, 0x00, 0x00, 0x84, 0xf2, 0xff, 0xff,
-  0x20, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69,
-  0x61, 0x6c, 0x5f, 0x31, 0x5f, 0x31, 0x2f, 0x72, 0x65, 0x73, 0x68, 0x61,
-  0x70, 0x65, 0x5f, 0x32, 0x5f, 0x31, 0x2f, 0x53, 0x68, 0x61, 0x70, 0x65,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0xea, 0xf2, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-  0x88, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0x94, 0x00, 0x00, 0x00, 0x6c, 0xf2, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x4c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0xad, 0xbb, 0x19, 0x3b,
-  0xad, 0xcc, 0x08, 0x3b, 0x5f, 0x63, 0x13, 0x3b, 0x42, 0xc4, 0x23, 0x3b,
-  0x99, 0xa1, 0xff, 0x3a, 0x8a, 0x0e, 0x1d, 0x3b, 0x46, 0x94, 0xf7, 0x3a,
-  0xf6, 0x31, 0x24, 0x3b, 0x12, 0x00, 0x00, 0x00, 0x74, 0x66, 0x6c, 0x2e,
-  0x70, 0x73, 0x65, 0x75, 0x64, 0x6f, 0x5f, 0x71, 0x63, 0x6f, 0x6e, 0x73,
-  0x74, 0x39, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0xaa, 0xf3, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-  0x84, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-  0x90, 0x00, 0x00, 0x00, 0x2c, 0xf3, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x48, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x08, 0x00, 0x00, 0x00, 0x98, 0x55, 0x1a, 0x37, 0xa3, 0x55, 0x09, 0x37,
-  0xef, 0xf6, 0x13, 0x37, 0x38, 0x68, 0x24, 0x37, 0xc4, 0x50, 0x00, 0x37,
-  0xc8, 0xab, 0x1d, 0x37, 0x26, 0x8c, 0xf8, 0x36, 0x5a, 0xd6, 0x24, 0x37,
-  0x12, 0x00, 0x00, 0x00, 0x74, 0x66, 0x6c, 0x2e, 0x70, 0x73, 0x65, 0x75,
-  0x64, 0x6f, 0x5f, 0x71, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x38, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x5a, 0xf4, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0xe8, 0x00, 0x00, 0x00,
-  0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xf4, 0x00, 0x00, 0x00,
-  0xdc, 0xf3, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x89, 0x5d, 0x6f, 0x3b,
-  0xd3, 0x80, 0x35, 0x3b, 0x30, 0xa7, 0x98, 0x3b, 0xe7, 0x63, 0x5a, 0x3b,
-  0x34, 0xf5, 0x22, 0x3b, 0xff, 0xd7, 0xc1, 0x3a, 0x5b, 0x15, 0x42, 0x3b,
-  0x35, 0x74, 0xb3, 0x3b, 0xd5, 0x3c, 0x5a, 0x3b, 0x5f, 0x00, 0x39, 0x3b,
-  0x66, 0x64, 0x83, 0x3b, 0x7b, 0x22, 0x5c, 0x3b, 0x99, 0xed, 0x52, 0x3b,
-  0xc1, 0x76, 0xa3, 0x3b, 0x8b, 0x1b, 0x54, 0x3b, 0xa7, 0x31, 0x3a, 0x3b,
-  0x12, 0x00, 0x00, 0x00, 0x74, 0x66, 0x6c, 0x2e, 0x70, 0x73, 0x65, 0x75,
-  0x64, 0x6f, 0x5f, 0x71, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x37, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x7a, 0xf5, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x00,
-  0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xf0, 0x00, 0x00, 0x00,
-  0xfc, 0xf4, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x21, 0xe1, 0x16, 0x37, 0x70, 0xd0, 0xe4, 0x36,
-  0xa5, 0x71, 0x40, 0x37, 0x7c, 0xa8, 0x09, 0x37, 0x4b, 0x6f, 0xcd, 0x36,
-  0x16, 0x5f, 0x74, 0x36, 0x70, 0xac, 0xf4, 0x36, 0x12, 0x3b, 0x62, 0x37,
-  0xdb, 0x8f, 0x09, 0x37, 0x6b, 0x39, 0xe9, 0x36, 0x21, 0xa4, 0x25, 0x37,
-  0xfa, 0xc1, 0x0a, 0x37, 0x5c, 0xf4, 0x04, 0x37, 0x9c, 0x12, 0x4e, 0x37,
-  0xaf, 0xb2, 0x05, 0x37, 0x46, 0xba, 0xea, 0x36, 0x12, 0x00, 0x00, 0x00,
-  0x74, 0x66, 0x6c, 0x2e, 0x70, 0x73, 0x65, 0x75, 0x64, 0x6f, 0x5f, 0x71,
-  0x63, 0x6f, 0x6e, 0x73, 0x74, 0x36, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x8a, 0xf6, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x14, 0x00, 0x00, 0x00, 0xa8, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x09, 0xb4, 0x01, 0x00, 0x00, 0x0c, 0xf6, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x0c, 0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x2c, 0xcb, 0xeb, 0x3b, 0xec, 0xbd, 0x49, 0x3b, 0xee, 0x70, 0x8b, 0x3b,
-  0x73, 0xe9, 0x68, 0x3b, 0xd0, 0x42, 0xc3, 0x3b, 0xf6, 0xc3, 0xb6, 0x3b,
-  0x17, 0x64, 0x85, 0x3b, 0x0e, 0x30, 0x9c, 0x3b, 0x16, 0xaf, 0xa7, 0x3b,
-  0x6d, 0x83, 0xa1, 0x3b, 0x27, 0x93, 0xa2, 0x3a, 0xf6, 0x5d, 0xec, 0x3a,
-  0xdd, 0xc3, 0xaa, 0x3b, 0x9c, 0x9b, 0xa2, 0x3b, 0x16, 0x72, 0xb9, 0x3b,
-  0xab, 0x66, 0xbe, 0x3b, 0x85, 0xcb, 0xb1, 0x3b, 0xf4, 0x40, 0x84, 0x3b,
-  0x41, 0x21, 0xc6, 0x3b, 0x8e, 0x55, 0xba, 0x3a, 0xe9, 0x8b, 0x8f, 0x3b,
-  0x6a, 0x94, 0xbc, 0x3b, 0xd0, 0x4b, 0x3c, 0x3b, 0x5c, 0xe8, 0x9b, 0x3a,
-  0x03, 0x68, 0xb5, 0x3b, 0x42, 0x1d, 0x9b, 0x3b, 0x98, 0xcb, 0x99, 0x3b,
-  0x50, 0x05, 0x89, 0x3a, 0xc4, 0x53, 0xb6, 0x3b, 0x27, 0x43, 0xd1, 0x3b,
-  0x2d, 0xcf, 0xc2, 0x3b, 0x36, 0x10, 0xd8, 0x3b, 0x12, 0x00, 0x00, 0x00,
-  0x74, 0x66, 0x6c, 0x2e, 0x70, 0x73, 0x65, 0x75, 0x64, 0x6f, 0x5f, 0x71,
-  0x63, 0x6f, 0x6e, 0x73, 0x74, 0x35, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x6a, 0xf8, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x14, 0x00, 0x00, 0x00, 0xa4, 0x01, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x02, 0xb0, 0x01, 0x00, 0x00, 0xec, 0xf7, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x08, 0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x8e, 0x12, 0x04, 0x38,
-  0xb7, 0xff, 0x61, 0x37, 0x0d, 0x35, 0x9c, 0x37, 0x58, 0x75, 0x82, 0x37,
-  0x1e, 0xbd, 0xda, 0x37, 0xa5, 0xbd, 0xcc, 0x37, 0xfb, 0x6d, 0x95, 0x37,
-  0xa7, 0xf7, 0xae, 0x37, 0x8c, 0xd8, 0xbb, 0x37, 0xf3, 0xee, 0xb4, 0x37,
-  0x59, 0x1f, 0xb6, 0x36, 0xc6, 0x64, 0x04, 0x37, 0x2a, 0x4c, 0xbf, 0x37,
-  0xd3, 0x28, 0xb6, 0x37, 0x44, 0xbe, 0xcf, 0x37, 0x61, 0x4b, 0xd5, 0x37,
-  0x35, 0x2c, 0xc7, 0x37, 0xd7, 0x27, 0x94, 0x37, 0xde, 0xf3, 0xdd, 0x37,
-  0x16, 0xbd, 0xd0, 0x36, 0x66, 0xce, 0xa0, 0x37, 0x11, 0x41, 0xd3, 0x37,
-  0xbc, 0xef, 0x52, 0x37, 0x56, 0xa7, 0xae, 0x36, 0xdc, 0x37, 0xcb, 0x37,
-  0xd0, 0xc3, 0xad, 0x37, 0x8c, 0x49, 0xac, 0x37, 0xef, 0x7e, 0x99, 0x36,
-  0xf5, 0x3f, 0xcc, 0x37, 0x6e, 0x6c, 0xea, 0x37, 0x94, 0x3b, 0xda, 0x37,
-  0xd5, 0x0a, 0xf2, 0x37, 0x12, 0x00, 0x00, 0x00, 0x74, 0x66, 0x6c, 0x2e,
-  0x70, 0x73, 0x65, 0x75, 0x64, 0x6f, 0x5f, 0x71, 0x63, 0x6f, 0x6e, 0x73,
-  0x74, 0x34, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x3a, 0xfa, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-  0xa8, 0x01, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0xb4, 0x01, 0x00, 0x00, 0xbc, 0xf9, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x0c, 0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x27, 0x7e, 0x68, 0x3a,
-  0x08, 0x01, 0x90, 0x3b, 0xb6, 0x6a, 0xcd, 0x3b, 0x8c, 0x47, 0xaf, 0x3a,
-  0x5e, 0x96, 0x7f, 0x3a, 0x1a, 0xe0, 0x79, 0x3a, 0x92, 0x5d, 0x73, 0x3a,
-  0x2a, 0x40, 0x90, 0x3a, 0xc9, 0xaf, 0x6d, 0x3b, 0xdd, 0xa5, 0x9c, 0x3b,
-  0xdc, 0xc1, 0x87, 0x3a, 0xe6, 0xdb, 0x70, 0x3a, 0xe5, 0x4d, 0x67, 0x3b,
-  0xd9, 0xb9, 0x90, 0x3a, 0x2d, 0x13, 0x92, 0x3a, 0x47, 0xb8, 0x61, 0x3a,
-  0xd3, 0x6f, 0x7e, 0x3a, 0x2e, 0x41, 0x78, 0x3a, 0xc4, 0x11, 0x91, 0x3b,
-  0x8b, 0xc4, 0x86, 0x3a, 0xd9, 0xcf, 0xa6, 0x3a, 0xf7, 0x3f, 0x93, 0x3a,
-  0x76, 0xb5, 0x95, 0x3a, 0xd5, 0x3c, 0x83, 0x3a, 0x07, 0xc5, 0x76, 0x3b,
-  0x90, 0x41, 0xa3, 0x3a, 0x8e, 0x06, 0x85, 0x3a, 0x3f, 0x14, 0xc5, 0x3b,
-  0xfa, 0x0a, 0x7b, 0x3b, 0x35, 0xd4, 0xbc, 0x3b, 0x90, 0xe9, 0x92, 0x3a,
-  0x3f, 0x10, 0x7e, 0x3a, 0x12, 0x00, 0x00, 0x00, 0x74, 0x66, 0x6c, 0x2e,
-  0x70, 0x73, 0x65, 0x75, 0x64, 0x6f, 0x5f, 0x71, 0x63, 0x6f, 0x6e, 0x73,
-  0x74, 0x33, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x00, 0x02, 0x00, 0x00, 0x12, 0xfc, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x14, 0x00, 0x00, 0x00, 0xa4, 0x01, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x02, 0xb0, 0x01, 0x00, 0x00, 0x94, 0xfb, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x08, 0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xa0, 0x26, 0x69, 0x37,
-  0x62, 0x69, 0x90, 0x38, 0x90, 0xff, 0xcd, 0x38, 0x90, 0xc6, 0xaf, 0x37,
-  0xca, 0x27, 0x80, 0x37, 0x2c, 0x95, 0x7a, 0x37, 0xec, 0x0d, 0x74, 0x37,
-  0xb2, 0xa8, 0x90, 0x37, 0x06, 0x5c, 0x6e, 0x38, 0x60, 0x17, 0x9d, 0x38,
-  0x3c, 0x24, 0x88, 0x37, 0x6f, 0x8a, 0x71, 0x37, 0x82, 0xf5, 0x67, 0x38,
-  0xb9, 0x22, 0x91, 0x37, 0x07, 0x7d, 0x92, 0x37, 0xd8, 0x5b, 0x62, 0x37,
-  0x33, 0x28, 0x7f, 0x37, 0x13, 0xf5, 0x78, 0x37, 0xe4, 0x7a, 0x91, 0x38,
-  0x33, 0x26, 0x87, 0x37, 0xba, 0x48, 0xa7, 0x37, 0xab, 0xaa, 0x93, 0x37,
-  0xf2, 0x21, 0x96, 0x37, 0xef, 0x9b, 0x83, 0x37, 0xd9, 0x77, 0x77, 0x38,
-  0xdd, 0xb7, 0xa3, 0x37, 0xf3, 0x66, 0x85, 0x37, 0x0f, 0xa3, 0xc5, 0x38,
-  0xe4, 0xc0, 0x7b, 0x38, 0x0a, 0x5d, 0xbd, 0x38, 0x05, 0x54, 0x93, 0x37,
-  0x5a, 0xc8, 0x7e, 0x37, 0x12, 0x00, 0x00, 0x00, 0x74, 0x66, 0x6c, 0x2e,
-  0x70, 0x73, 0x65, 0x75, 0x64, 0x6f, 0x5f, 0x71, 0x63, 0x6f, 0x6e, 0x73,
-  0x74, 0x32, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0xe2, 0xfd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-  0x70, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0x7c, 0x00, 0x00, 0x00, 0x64, 0xfd, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x3c, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x06, 0x00, 0x00, 0x00, 0xaf, 0xd9, 0xc8, 0x3b, 0x45, 0x83, 0x16, 0x3c,
-  0x74, 0xde, 0x34, 0x3b, 0x50, 0x69, 0x3c, 0x3c, 0x2f, 0x6d, 0xc7, 0x3b,
-  0x82, 0x90, 0xf1, 0x3b, 0x12, 0x00, 0x00, 0x00, 0x74, 0x66, 0x6c, 0x2e,
-  0x70, 0x73, 0x65, 0x75, 0x64, 0x6f, 0x5f, 0x71, 0x63, 0x6f, 0x6e, 0x73,
-  0x74, 0x31, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0x82, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x14, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x02, 0x78, 0x00, 0x00, 0x00, 0x04, 0xfe, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x06, 0x00, 0x00, 0x00, 0x32, 0x96, 0x1c, 0x3a, 0x69, 0xaf, 0x6a, 0x3a,
-  0x44, 0x02, 0x8d, 0x39, 0x9a, 0xe3, 0x92, 0x3a, 0x06, 0x7a, 0x1b, 0x3a,
-  0x07, 0x54, 0x3c, 0x3a, 0x11, 0x00, 0x00, 0x00, 0x74, 0x66, 0x6c, 0x2e,
-  0x70, 0x73, 0x65, 0x75, 0x64, 0x6f, 0x5f, 0x71, 0x63, 0x6f, 0x6e, 0x73,
-  0x74, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
-  0x1a, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-  0x1c, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00,
-  0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61,
-  0x6e, 0x74, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xff, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x1c, 0x00, 0x00, 0x00,
-  0x3c, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74,
-  0x68, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x33, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x8a, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x02, 0x1c, 0x00, 0x00, 0x00, 0x74, 0xff, 0xff, 0xff,
-  0x0f, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f,
-  0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xc2, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-  0x1c, 0x00, 0x00, 0x00, 0xac, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00,
-  0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61,
-  0x6e, 0x74, 0x31, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x16, 0x00, 0x1c, 0x00, 0x18, 0x00, 0x17, 0x00, 0x10, 0x00,
-  0x0c, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00,
-  0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00,
-  0x18, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-  0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x0e, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f,
-  0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x20, 0x00, 0x1c, 0x00,
-  0x1b, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x08, 0x00, 0x07, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x18, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x64, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x04, 0x00, 0x00,
-  0x0c, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x01, 0x00, 0x00, 0x00, 0x27, 0x80, 0x80, 0x3b, 0x21, 0x00, 0x00, 0x00,
-  0x73, 0x65, 0x72, 0x76, 0x69, 0x6e, 0x67, 0x5f, 0x64, 0x65, 0x66, 0x61,
-  0x75, 0x6c, 0x74, 0x5f, 0x6b, 0x65, 0x72, 0x61, 0x73, 0x5f, 0x74, 0x65,
-  0x6e, 0x73, 0x6f, 0x72, 0x5f, 0x31, 0x32, 0x3a, 0x30, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-  0x08, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
-  0x70, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00,
-  0x2c, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0xd0, 0xff, 0xff, 0xff, 0x19, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x19, 0xe0, 0xff, 0xff, 0xff, 0x09, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xf0, 0xff, 0xff, 0xff,
-  0x11, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
-  0x0c, 0x00, 0x10, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x03, 0xdc, 0xff, 0xff, 0xff, 0x16, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x16, 0xe8, 0xff, 0xff, 0xff, 0x53, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x53, 0xf4, 0xff, 0xff, 0xff, 0x2d, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x2d, 0x0c, 0x00, 0x0c, 0x00, 0x0b, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x4d
-};
-unsigned int mfcc_model_tflite_len = 31144;
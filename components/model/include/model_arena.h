@@ -0,0 +1,60 @@
+#pragma once
+
+#ifndef MODEL_ARENA_H
+#define MODEL_ARENA_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Usage of the TFLM arenas shared by every interpreter
+ */
+typedef struct {
+    uint32_t interpreters;            ///< Interpreters created on the shared region
+    size_t shared_bytes;              ///< Shared activation (non-persistent) region size
+    size_t shared_peak_bytes;         ///< High-water mark of the shared region over all interpreters
+    size_t persistent_bytes;          ///< Sum of the private persistent regions
+    size_t persistent_used_bytes;     ///< Sum of their high-water marks
+} model_arena_stats_t;
+
+/**
+ * @brief Reports how much of the shared and persistent regions is in use
+ * @param stats Output statistics
+ *
+ * @note Measured with a fill pattern like a stack high-water mark, so an
+ * activation that happens to end in the pattern byte may be undercounted
+ */
+void model_arena_get_stats(model_arena_stats_t *stats);
+
+#ifdef __cplusplus
+}
+
+namespace tflite {
+class MicroAllocator;
+}
+
+/**
+ * @brief Creates a TFLM allocator on the shared activation region
+ * @param owner Model name used in logs
+ * @param persistent_bytes Size of the private persistent region
+ * @return Allocator to pass to the MicroInterpreter constructor, or nullptr if out of memory
+ *
+ * Every interpreter plans its activations, scratch buffers, inputs and
+ * outputs from the start of one shared region, sized for the largest model,
+ * and keeps tensor metadata, kernel state and variables in its own small
+ * persistent region. Peak RAM is the largest activation plan instead of the
+ * sum of all arenas.
+ *
+ * @note Called while loading a model, under the predictor lock. Interpreters
+ * on the shared region must never run concurrently, and
+ * their input and output tensors are only valid until another interpreter
+ * runs: write the input, Invoke() and read the output under one lock
+ */
+tflite::MicroAllocator *model_arena_create_allocator(const char *owner, size_t persistent_bytes);
+#endif
+
+#endif // MODEL_ARENA_H
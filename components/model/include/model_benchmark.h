@@ -0,0 +1,107 @@
+#pragma once
+
+#ifndef MODEL_BENCHMARK_H
+#define MODEL_BENCHMARK_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "model_predictor.h"
+#include "model_arena.h"
+#include "model_memory.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Latency and footprint of the deployed model
+ */
+typedef struct {
+    uint32_t iterations;              ///< Inferences measured
+    uint32_t invoke_min_us;           ///< Fastest Invoke()
+    uint32_t invoke_avg_us;           ///< Mean Invoke()
+    uint32_t invoke_max_us;           ///< Slowest Invoke()
+    uint32_t quantize_avg_us;         ///< Mean time writing the PCM window into the input tensor
+    model_info_t model;               ///< Flash size, arena use and load time
+    model_arena_stats_t arena;        ///< Shared activation and persistent region use
+} model_benchmark_result_t;
+
+/**
+ * @brief Runs the model repeatedly on a synthetic window
+ * @param iterations Number of timed inferences (1-1000)
+ * @param result Output measurements
+ * @return ESP_OK on success, ESP_ERR_INVALID_ARG for a bad iteration count,
+ *         ESP_FAIL if inference failed
+ *
+ * @note Build once per model variant (e.g. with and without
+ * MODEL_LUT_COMPRESSION) to compare them on the same board
+ */
+esp_err_t model_benchmark_run(uint32_t iterations, model_benchmark_result_t *result);
+
+#define MODEL_PLACEMENT_COUNT 5 ///< Arena and weight placements compared by model_benchmark_placement()
+
+/**
+ * @brief Latency of the classifier with one memory placement
+ */
+typedef struct {
+    model_memory_t arena;             ///< Memory holding activations and kernel scratch
+    model_memory_t weights;           ///< Memory the weights are read from
+    bool measured;                    ///< false when the board lacks that memory or it was full
+    uint32_t invoke_min_us;           ///< Fastest Invoke()
+    uint32_t invoke_avg_us;           ///< Mean Invoke()
+    uint32_t invoke_max_us;           ///< Slowest Invoke()
+} model_placement_benchmark_t;
+
+/**
+ * @brief Configured placement policy and the latency of every placement
+ */
+typedef struct {
+    uint32_t iterations;              ///< Inferences timed per placement
+    model_memory_t activations;       ///< Configured activation memory
+    model_memory_t weights;           ///< Configured weight memory
+    model_memory_t audio_history;     ///< Configured memory of bulk audio buffers
+    model_placement_benchmark_t placements[MODEL_PLACEMENT_COUNT]; ///< Internal arena first
+} model_placement_comparison_t;
+
+/**
+ * @brief Times the TFLM classifier with its arena and weights in every memory
+ * @param iterations Inferences per placement (1-1000)
+ * @param result Output measurements
+ * @return ESP_OK if at least one placement was measured, ESP_ERR_INVALID_ARG
+ *         for a bad iteration count, ESP_FAIL otherwise
+ *
+ * @note Each placement gets a private interpreter and arena, so the board
+ * needs one more arena of free memory. Live inference waits while a
+ * placement is timed. PSRAM placements are skipped on boards without PSRAM
+ */
+esp_err_t model_benchmark_placement(uint32_t iterations, model_placement_comparison_t *result);
+
+/**
+ * @brief TFLM initialization with the offline memory plan and with on-device planning
+ */
+typedef struct {
+    uint32_t tensors;                 ///< Tensors with an offline offset (0: the model has no plan)
+    bool honored;                     ///< TFLM placed the tensors at the planned offsets
+    uint32_t offline_init_us;         ///< AllocateTensors() using the plan
+    uint32_t online_init_us;          ///< AllocateTensors() planning every tensor on the device
+    size_t offline_arena_bytes;       ///< Arena used with the plan
+    size_t online_arena_bytes;        ///< Arena used without it
+} model_planning_benchmark_t;
+
+/**
+ * @brief Compares TFLM initialization with and without the offline memory plan
+ * @param result Output measurements
+ * @return ESP_OK on success, ESP_ERR_NOT_FOUND if the model carries no plan
+ *         (see tools/plan_tflite_memory.py), ESP_FAIL otherwise
+ *
+ * @note Needs one more arena and a RAM copy of the model. Live inference
+ * waits while the interpreters are set up
+ */
+esp_err_t model_benchmark_planning(model_planning_benchmark_t *result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MODEL_BENCHMARK_H
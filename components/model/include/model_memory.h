@@ -0,0 +1,100 @@
+#pragma once
+
+#ifndef MODEL_MEMORY_H
+#define MODEL_MEMORY_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Physical memory a buffer lives in
+ *
+ * Flash and PSRAM are both read through the same external-memory cache, so
+ * every access to them that misses the cache stalls the core. Internal SRAM
+ * is never cached.
+ */
+typedef enum {
+    MODEL_MEMORY_FLASH,               ///< Memory-mapped flash (rodata)
+    MODEL_MEMORY_INTERNAL,            ///< Internal SRAM
+    MODEL_MEMORY_PSRAM,               ///< External PSRAM
+} model_memory_t;
+
+/**
+ * @brief Kind of buffer, placed by the Kconfig memory placement policy
+ */
+typedef enum {
+    MODEL_REGION_ACTIVATIONS,         ///< Tensor arenas and kernel scratch, touched by every layer
+    MODEL_REGION_WEIGHTS,             ///< Model weights, streamed once per inference
+    MODEL_REGION_AUDIO_HISTORY,       ///< Bulk audio buffers, written once and read sequentially
+} model_region_t;
+
+/**
+ * @brief Memory the placement policy assigns to a region
+ * @param region Buffer kind
+ * @return Configured memory, internal SRAM for PSRAM regions when the board has no PSRAM
+ *
+ * @note MODEL_MEMORY_FLASH is only returned for weights left in the model
+ * flatbuffer; buffers that must be written still come from model_region_alloc()
+ */
+model_memory_t model_region_memory(model_region_t region);
+
+/**
+ * @brief RAM that writable buffers of a region are allocated from
+ * @param region Buffer kind
+ * @return Same as model_region_memory(), except that weights kept in flash
+ *         get PSRAM when the board has it and internal SRAM otherwise
+ */
+model_memory_t model_region_ram(model_region_t region);
+
+/**
+ * @brief Allocates a 16-byte aligned buffer for a region
+ * @param region Buffer kind
+ * @param size Size in bytes
+ * @return Buffer to release with model_memory_free(), or NULL if out of memory
+ *
+ * @note Activations never fall back to PSRAM: a full internal heap fails the
+ * allocation instead of silently moving the hot path behind the cache.
+ * Weights and audio history fall back to internal SRAM when PSRAM is full
+ */
+void *model_region_alloc(model_region_t region, size_t size);
+
+/**
+ * @brief Allocates a 16-byte aligned buffer in a specific memory
+ * @param memory MODEL_MEMORY_INTERNAL or MODEL_MEMORY_PSRAM
+ * @param size Size in bytes
+ * @return Buffer to release with model_memory_free(), or NULL if unavailable
+ */
+void *model_memory_alloc(model_memory_t memory, size_t size);
+
+/**
+ * @brief Releases a buffer from model_region_alloc() or model_memory_alloc()
+ * @param buffer Buffer (may be NULL)
+ */
+void model_memory_free(void *buffer);
+
+/**
+ * @brief Reports which memory a buffer lives in
+ * @param buffer Any pointer
+ * @return Memory holding the buffer
+ */
+model_memory_t model_memory_of(const void *buffer);
+
+/**
+ * @brief Short name of a memory ("flash", "internal" or "psram")
+ */
+const char *model_memory_name(model_memory_t memory);
+
+/**
+ * @brief Tells whether the board has PSRAM added to the heap
+ */
+bool model_memory_psram_available(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MODEL_MEMORY_H
@@ -3,13 +3,297 @@
 #ifndef MODEL_PREDICTOR_H
 #define MODEL_PREDICTOR_H
 
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
 #include "esp_heap_caps.h"  // For ESP32-specific memory allocation
 
+#define MODEL_INPUT_SIZE 1024   ///< Raw audio samples per inference window
+#define MODEL_NUM_CLASSES 6     ///< Number of output classes
+#define MODEL_TOP_K 3           ///< Number of ranked classes reported per result
+#define MODEL_BACKGROUND_CLASS 3 ///< Class index of background noise (NOISE)
+#define MODEL_EMBEDDING_MAX_SIZE 64 ///< Largest embedding predict_stream_embedding() returns
+#define MODEL_MAX_HEADS 4       ///< Most binary detection heads sharing the classifier's backbone
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-int predict_class(const float *input_data);  // Returns class 0-5
+/**
+ * @brief Output of one binary detection head for one window
+ */
+typedef struct {
+    bool enabled;                        ///< Head enabled when the window was classified
+    bool detected;                       ///< score reached the head's threshold
+    float score;                         ///< Probability of the head's event (0 if disabled)
+} model_head_result_t;
+
+/**
+ * @brief Runtime settings of one detection head
+ */
+typedef struct {
+    bool enabled;                        ///< Report the head's result (it is computed by the shared Invoke() either way)
+    float threshold;                     ///< Minimum score for detected, in [0, 1]
+} model_head_config_t;
+
+/**
+ * @brief Outcome of one inference with per-stage latencies
+ *
+ * The predictor fills the class, scores, top-k, quantize and invoke fields.
+ * Callers that own the capture and feature stages fill the remaining fields.
+ */
+typedef struct {
+    int top_class;                       ///< Predicted class index, -1 on failure
+    float scores[MODEL_NUM_CLASSES];     ///< Dequantized score of every class
+    int8_t raw_scores[MODEL_NUM_CLASSES]; ///< Raw int8 model outputs (0 for float models)
+    int top_k[MODEL_TOP_K];              ///< Class indices ordered by descending score
+    bool gated;                          ///< Rejected by the cascade stage-one detector: no inference ran,
+                                         ///< the scores are a confident background and quantize/invoke are 0
+    int64_t capture_timestamp_us;        ///< Time the newest sample of the window was captured
+    uint32_t capture_us;                 ///< Audio capture latency
+    uint32_t features_us;                ///< Feature extraction (normalization) latency
+    uint32_t quantize_us;                ///< Input quantization (or copy of a quantized window) latency
+    uint32_t invoke_us;                  ///< Interpreter Invoke() latency
+    model_head_result_t heads[MODEL_MAX_HEADS]; ///< Detection heads, indexed as model_head_name() (model_head_count() valid)
+} prediction_result_t;
+
+/**
+ * @brief Footprint and load cost of the deployed model
+ */
+typedef struct {
+    const char *engine;                  ///< Inference engine running the model ("tflm")
+    size_t model_bytes;                  ///< Model file size in flash
+    size_t arena_bytes;                  ///< Tensor arena (activation memory) size
+    size_t arena_used_bytes;             ///< Arena actually used after allocation
+    size_t decompressed_bytes;           ///< Heap holding a copy of the model out of flash (0 when read in place)
+    uint32_t load_us;                    ///< Model load and tensor allocation time
+} model_info_t;
+
+/**
+ * @brief Consecutive windows that share a streaming model's recurrent state
+ *
+ * Streaming models (SVDF, LSTM, resource variables) carry state from one
+ * Invoke() to the next, so they see context far longer than one window at
+ * the cost of one window per hop. The state only makes sense for one
+ * uninterrupted sequence of windows: the predictor clears it whenever a
+ * stream's window does not directly follow that stream's previous one (a
+ * dropped, skipped or gated window, a restarted capture) or another caller
+ * used the model in between. For stateless models streams cost nothing.
+ */
+typedef struct {
+    uint32_t id;                         ///< Assigned by model_stream_init(), never 0
+    uint32_t last_window_id;             ///< Window id of the stream's previous inference
+    uint32_t resets;                     ///< Times the state was cleared before one of its windows
+} model_stream_t;
+
+/**
+ * @brief Creates the interpreter lock and loads the model
+ * @return ESP_OK on success, ESP_FAIL if the model could not be loaded
+ *
+ * @note Call once at startup, before any other function of this API except
+ * model_class_name() and normalize_audio_window(); later calls only retry a
+ * failed load
+ */
+esp_err_t model_init(void);
+
+/**
+ * @brief Min-max normalizes a window of PCM samples into [0, 1]
+ * @param samples Raw 16-bit PCM samples
+ * @param output Normalized output buffer (same length as samples)
+ * @param num_samples Number of samples in the window
+ *
+ * @note This is the preprocessing the classifier was trained with
+ */
+void normalize_audio_window(const int16_t *samples, float *output, size_t num_samples);
+
+/**
+ * @brief Min-max normalizes a window of PCM samples straight into the int8 model input
+ * @param samples Raw 16-bit PCM samples
+ * @param output Quantized output buffer (same length as samples)
+ * @param num_samples Number of samples in the window
+ * @return ESP_OK on success, ESP_ERR_INVALID_ARG for an empty window,
+ *         ESP_ERR_INVALID_STATE if the model is not loaded,
+ *         ESP_ERR_NOT_SUPPORTED if the model input is not int8 (output untouched)
+ *
+ * @note Same result as normalize_audio_window() followed by input quantization,
+ * computed with integer math only. Float and int16 models take their windows
+ * through predict_pcm() instead.
+ */
+esp_err_t quantize_audio_window(const int16_t *samples, int8_t *output, size_t num_samples);
+
+/**
+ * @brief Runs inference on one normalized window
+ * @param input_data Normalized input window (MODEL_INPUT_SIZE floats)
+ * @param result Filled with scores, top-k and predictor latencies (may be NULL)
+ * @return Predicted class index (0-5), or -1 on failure
+ *
+ * @note capture_timestamp_us, capture_us and features_us are left untouched
+ */
+int predict_class(const float *input_data, prediction_result_t *result);
+
+/**
+ * @brief Runs inference on one window already quantized to the model input
+ * @param input_data Quantized input window (MODEL_INPUT_SIZE int8 values)
+ * @param result Filled as by predict_class() (may be NULL)
+ * @return Predicted class index (0-5), or -1 on failure
+ *
+ * @note The window is copied into the input tensor as is; only models with
+ * an int8 input are supported. A streaming model classifies it from a cleared state.
+ */
+int predict_class_quantized(const int8_t *input_data, prediction_result_t *result);
+
+/**
+ * @brief Starts a new stream, or restarts one from a cleared state
+ * @param stream Stream to initialize
+ */
+void model_stream_init(model_stream_t *stream);
+
+/**
+ * @brief Runs inference on the next window of a stream
+ * @param stream Stream from model_stream_init()
+ * @param window_id Caller's sequence number of the window; a gap since the
+ *        stream's previous window clears the recurrent state first
+ * @param input_data Quantized input window (MODEL_INPUT_SIZE int8 values)
+ * @param result Filled as by predict_class() (may be NULL)
+ * @return Predicted class index (0-5), or -1 on failure
+ */
+int predict_stream(model_stream_t *stream, uint32_t window_id, const int8_t *input_data,
+                   prediction_result_t *result);
+
+/**
+ * @brief Runs predict_stream() and also returns the window's embedding
+ * @param stream Stream from model_stream_init()
+ * @param window_id Sequence number of the window (see predict_stream())
+ * @param input_data Quantized input window (MODEL_INPUT_SIZE int8 values)
+ * @param result Filled as by predict_class() (may be NULL)
+ * @param embedding Output of model_embedding_size() floats with unit L2 norm
+ *        (all zero if the layer did not activate), or NULL
+ * @return Predicted class index (0-5), or -1 on failure
+ *
+ * @note The embedding is the penultimate dense layer, exposed as the second
+ * model output by tools/simplify_tflite_graph.py --expose-embedding
+ */
+int predict_stream_embedding(model_stream_t *stream, uint32_t window_id, const int8_t *input_data,
+                             prediction_result_t *result, float *embedding);
+
+/**
+ * @brief Runs inference on a window of raw PCM samples
+ * @param stream Stream from model_stream_init(), or NULL for an independent window
+ * @param window_id Sequence number of the window (see predict_stream(), ignored without a stream)
+ * @param samples Raw 16-bit PCM window (MODEL_INPUT_SIZE samples)
+ * @param result Filled as by predict_class() (may be NULL); quantize_us is
+ *        the time spent writing the window into the input tensor
+ * @param embedding As for predict_stream_embedding(), or NULL
+ * @return Predicted class index (0-5), or -1 on failure
+ *
+ * @note The window goes into the input tensor in a single bounded pass, with
+ * no intermediate buffer. A model with an int16 input (16x8 quantized,
+ * trained on fixed-scale PCM, see model_takes_pcm()) gets the samples copied
+ * as is; int8 and float models get the min-max normalization of
+ * quantize_audio_window() written straight into the tensor
+ */
+int predict_pcm(model_stream_t *stream, uint32_t window_id, const int16_t *samples,
+                prediction_result_t *result, float *embedding);
+
+/**
+ * @brief Tells whether the deployed model consumes raw int16 PCM
+ * @return true if the model input is int16, false for int8 or float inputs or if not loadable
+ *
+ * @note Such models normalize inside the graph. They can only be fed through
+ * predict_pcm(): quantized windows and predict_class() are rejected
+ */
+bool model_takes_pcm(void);
+
+/**
+ * @brief Returns the number of elements of the model's embedding
+ * @return Embedding size, or 0 if the model has no embedding output or could not be loaded
+ */
+size_t model_embedding_size(void);
+
+/**
+ * @brief Returns the number of binary detection heads of the deployed model
+ * @return Heads sharing the classifier's backbone, 0 if none or not loadable
+ *
+ * @note Heads are the 1-2 element model outputs after the classifier, found by
+ * tools/generate_model_sources.py; every inference fills their results in
+ * prediction_result_t.heads from the same Invoke() as the classes
+ */
+int model_head_count(void);
+
+/**
+ * @brief Returns the name of a detection head
+ * @param head Head index (0 to model_head_count() - 1)
+ * @return Head name, or "unknown" for an invalid index
+ */
+const char *model_head_name(int head);
+
+/**
+ * @brief Finds a detection head by name
+ * @param name Head name
+ * @return Head index, or -1 if the model has no such head
+ */
+int model_head_find(const char *name);
+
+/**
+ * @brief Reads the runtime settings of a detection head
+ * @param head Head index
+ * @param config Output settings
+ * @return 0 on success, -1 for an invalid index
+ */
+int model_head_get_config(int head, model_head_config_t *config);
+
+/**
+ * @brief Enables or disables a detection head and sets its threshold
+ * @param head Head index
+ * @param config New settings
+ * @return 0 on success, -1 for an invalid index or a threshold outside [0, 1]
+ *
+ * @note Applies from the next inference. Every head starts enabled with
+ * CONFIG_MODEL_HEAD_THRESHOLD
+ */
+int model_head_set_config(int head, const model_head_config_t *config);
+
+/**
+ * @brief Tells whether the deployed model keeps recurrent state between windows
+ * @return true for streaming models, false if stateless or not loadable
+ */
+bool model_is_stateful(void);
+
+/**
+ * @brief Clears the recurrent state of the deployed model
+ * @return 0 on success, -1 if the model could not be loaded or reset
+ *
+ * @note The next window of every stream then also starts from a cleared state
+ */
+int model_reset_state(void);
+
+/**
+ * @brief Runs inference on consecutive quantized windows
+ * @param stream Stream the windows continue, or NULL for independent windows
+ * @param windows num_windows * MODEL_INPUT_SIZE int8 values, one window after another
+ * @param num_windows Number of windows in the batch
+ * @param results One result per window, filled as by predict_class()
+ * @return Number of windows classified before the first failure, or -1 on error
+ *
+ * @note The interpreter is set up and locked once for the whole batch, so
+ * other callers wait for at most one batch
+ */
+int predict_batch(model_stream_t *stream, const int8_t *windows, size_t num_windows, prediction_result_t *results);
+
+/**
+ * @brief Loads the model if needed and reports its footprint
+ * @param info Output model information
+ * @return 0 on success, -1 if the model could not be loaded
+ */
+int model_get_info(model_info_t *info);
+
+/**
+ * @brief Returns the human readable name of a class index
+ * @param class_index Class index returned by the predictor
+ * @return Class name, or "UNKNOWN" for an invalid index
+ */
+const char *model_class_name(int class_index);
 
 #ifdef __cplusplus
 }
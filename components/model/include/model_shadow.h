@@ -0,0 +1,37 @@
+#pragma once
+
+#ifndef MODEL_SHADOW_H
+#define MODEL_SHADOW_H
+
+#include <stdint.h>
+#include "model_predictor.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Loads the shadow model if needed and reports its footprint
+ * @param info Output model information
+ * @return 0 on success, -1 if CONFIG_MODEL_SHADOW_ENABLE is off or the model could not be loaded
+ */
+int model_shadow_get_info(model_info_t *info);
+
+/**
+ * @brief Runs the shadow model on a window quantized for the active model
+ * @param input_data Window from quantize_audio_window() (MODEL_INPUT_SIZE int8 values)
+ * @param result Filled as by predict_class_quantized() (never NULL)
+ * @return Predicted class index (0-5), or -1 on failure or when the shadow slot is not built
+ *
+ * @note The window is requantized through a 256-entry table when the two
+ * models' input quantization differs. The shadow shares the activation
+ * region and the predictor lock with the active model, so the active model
+ * waits for at most one shadow Invoke().
+ */
+int model_shadow_predict(const int8_t *input_data, prediction_result_t *result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MODEL_SHADOW_H
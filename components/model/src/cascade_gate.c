@@ -0,0 +1,161 @@
+/**
+ * @file cascade_gate.c
+ * @brief Two-stage cascade: tiny always-on detector gating the full classifier
+ *
+ * Stage one computes CASCADE_NUM_BANDS log band energies of the newest
+ * CASCADE_FFT_SIZE samples and scores them with logistic regression. Only
+ * windows whose event probability exceeds the threshold reach stage two,
+ * the full CNN, so the average inference cost drops by the rejection rate.
+ */
+
+#include <math.h>
+#include <string.h>
+#include "cascade_gate.h"
+#include "esp_dsp.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+
+static const char *TAG = "cascade_gate";
+
+#define CASCADE_FFT_SIZE 512            ///< Samples analyzed by stage one
+#define CASCADE_MIN_FREQ_HZ 100.0f      ///< Lower edge of the first band
+#define SAMPLE_RATE CONFIG_EXAMPLE_SAMPLE_RATE
+
+// Exponential moving average with a 1/8 weight for the newest sample
+#define STAGE_AVERAGE(avg, sample) ((avg) == 0 ? (sample) : (avg) - ((avg) >> 3) + ((sample) >> 3))
+
+/**
+ * Stage-one coefficients over log10 mean band power (full scale = 0).
+ * The defaults form a band-limited energy detector: equal weights with the
+ * 50% point at -45 dBFS. Replace them with coefficients fitted on labelled
+ * hop windows to make the gate class-aware; until then MODEL_CASCADE_ENABLE
+ * has no menuconfig prompt.
+ */
+static const float GATE_WEIGHTS[CASCADE_NUM_BANDS] = {
+    0.25f, 0.25f, 0.25f, 0.25f, 0.25f, 0.25f, 0.25f, 0.25f
+};
+static const float GATE_BIAS = 9.0f;
+
+static bool s_initialized = false;
+static float s_threshold = CONFIG_MODEL_CASCADE_THRESHOLD / 100.0f;
+static int s_band_edges[CASCADE_NUM_BANDS + 1];       ///< FFT bin boundaries of each band
+static portMUX_TYPE s_stats_lock = portMUX_INITIALIZER_UNLOCKED;
+static cascade_stats_t s_stats;
+
+// Stage-one buffers (real FFT input / CASCADE_FFT_SIZE/2 + 1 bins and window coefficients)
+static rfft_plan_f32_t s_rfft;
+__attribute__((aligned(16)))
+static float fft_buffer[CASCADE_FFT_SIZE + 2];
+__attribute__((aligned(16)))
+static float hann_window[CASCADE_FFT_SIZE];
+
+/**
+ * @brief Prepares the FFT tables, window and log-spaced band edges
+ * @return true when stage one is ready
+ */
+static bool cascade_init(void) {
+    if (s_initialized) {
+        return true;
+    }
+
+    esp_err_t ret = dsps_rfft_init_f32(&s_rfft, CASCADE_FFT_SIZE);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "FFT init failed: %d", ret);
+        return false;
+    }
+    dsps_wind_hann_f32(hann_window, CASCADE_FFT_SIZE);
+
+    // Log-spaced bands from CASCADE_MIN_FREQ_HZ to Nyquist
+    const float bin_hz = (float)SAMPLE_RATE / CASCADE_FFT_SIZE;
+    const float nyquist = SAMPLE_RATE / 2.0f;
+    for (int b = 0; b <= CASCADE_NUM_BANDS; b++) {
+        float freq = CASCADE_MIN_FREQ_HZ * powf(nyquist / CASCADE_MIN_FREQ_HZ, (float)b / CASCADE_NUM_BANDS);
+        int bin = (int)(freq / bin_hz);
+        if (b > 0 && bin <= s_band_edges[b - 1]) {
+            bin = s_band_edges[b - 1] + 1;
+        }
+        s_band_edges[b] = bin > CASCADE_FFT_SIZE / 2 ? CASCADE_FFT_SIZE / 2 : bin;
+    }
+
+    s_initialized = true;
+    return true;
+}
+
+bool cascade_stage1(const int16_t *samples, size_t num_samples, float *probability) {
+    if (samples == NULL || num_samples < CASCADE_FFT_SIZE || !cascade_init()) {
+        // Never hide events from the classifier when the gate cannot run
+        return true;
+    }
+
+    const int64_t start_us = esp_timer_get_time();
+    const int16_t *newest = samples + num_samples - CASCADE_FFT_SIZE;
+
+    // Windowed real input, transformed in place (half the cost of a complex FFT)
+    for (int i = 0; i < CASCADE_FFT_SIZE; i++) {
+        fft_buffer[i] = (newest[i] / 32768.0f) * hann_window[i];
+    }
+    dsps_rfft_f32(&s_rfft, fft_buffer, fft_buffer);
+
+    // Logistic regression on the log mean power of each band
+    float z = GATE_BIAS;
+    for (int b = 0; b < CASCADE_NUM_BANDS; b++) {
+        float energy = 0.0f;
+        for (int k = s_band_edges[b]; k < s_band_edges[b + 1]; k++) {
+            float re = fft_buffer[k * 2];
+            float im = fft_buffer[k * 2 + 1];
+            energy += re * re + im * im;
+        }
+        int bins = s_band_edges[b + 1] - s_band_edges[b];
+        energy /= (float)(bins > 0 ? bins : 1) * CASCADE_FFT_SIZE;
+        z += GATE_WEIGHTS[b] * log10f(energy + 1e-12f);
+    }
+    const float p = 1.0f / (1.0f + expf(-z));
+    const bool hit = p > s_threshold;
+
+    const uint32_t elapsed_us = (uint32_t)(esp_timer_get_time() - start_us);
+    portENTER_CRITICAL(&s_stats_lock);
+    s_stats.stage1_runs++;
+    if (hit) {
+        s_stats.stage1_hits++;
+    }
+    s_stats.stage1_avg_us = STAGE_AVERAGE(s_stats.stage1_avg_us, elapsed_us);
+    portEXIT_CRITICAL(&s_stats_lock);
+
+    if (probability != NULL) {
+        *probability = p;
+    }
+    return hit;
+}
+
+int cascade_stage2(model_stream_t *stream, uint32_t window_id, const int8_t *input_data,
+                   const int16_t *samples, prediction_result_t *result, float *embedding) {
+    const int64_t start_us = esp_timer_get_time();
+    int predicted_class = samples != NULL ?
+                          predict_pcm(stream, window_id, samples, result, embedding) :
+                          predict_stream_embedding(stream, window_id, input_data, result, embedding);
+    const uint32_t elapsed_us = (uint32_t)(esp_timer_get_time() - start_us);
+
+    portENTER_CRITICAL(&s_stats_lock);
+    s_stats.stage2_runs++;
+    s_stats.stage2_avg_us = STAGE_AVERAGE(s_stats.stage2_avg_us, elapsed_us);
+    portEXIT_CRITICAL(&s_stats_lock);
+
+    return predicted_class;
+}
+
+esp_err_t cascade_set_threshold(float threshold) {
+    if (threshold < 0.0f || threshold > 1.0f) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    s_threshold = threshold;
+    ESP_LOGI(TAG, "Stage-one threshold set to %.2f", threshold);
+    return ESP_OK;
+}
+
+void cascade_get_stats(cascade_stats_t *stats) {
+    portENTER_CRITICAL(&s_stats_lock);
+    *stats = s_stats;
+    portEXIT_CRITICAL(&s_stats_lock);
+    stats->threshold = s_threshold;
+}
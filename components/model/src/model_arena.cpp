@@ -0,0 +1,98 @@
+/**
+* @file model_arena.cpp
+* @brief One activation region shared by every TFLM interpreter
+*
+* Built on the split persistent / non-persistent arena allocators of
+* tensorflow/lite/micro/arena_allocator, which MicroAllocator::Create()
+* wires up when given two separate buffers. Both regions are hot on every
+* layer, so they follow the activation placement (internal SRAM unless
+* CONFIG_MODEL_ACTIVATIONS_PSRAM).
+*/
+
+#include "model_arena.h"
+#include "model_memory.h"
+#include "tensorflow/lite/micro/micro_allocator.h"
+#include "esp_log.h"
+#include "sdkconfig.h"
+#include <cstring>
+
+#define SHARED_ARENA_SIZE (CONFIG_MODEL_SHARED_ARENA_SIZE_KB * 1024)
+#define MAX_INTERPRETERS 4
+#define FILL_PATTERN 0xA5
+
+static const char* TAG = "model_arena";
+
+typedef struct {
+    const char* owner;                ///< Model name, for logs
+    uint8_t* buffer;
+    size_t size;
+} persistent_region_t;
+
+static uint8_t* shared_arena = nullptr;
+static persistent_region_t persistent_regions[MAX_INTERPRETERS];
+static uint32_t interpreter_count = 0;
+
+tflite::MicroAllocator* model_arena_create_allocator(const char* owner, size_t persistent_bytes) {
+    if (interpreter_count >= MAX_INTERPRETERS) {
+        ESP_LOGE(TAG, "No region left for %s, at most %d interpreters", owner, MAX_INTERPRETERS);
+        return nullptr;
+    }
+
+    if (shared_arena == nullptr) {
+        shared_arena = (uint8_t*)model_region_alloc(MODEL_REGION_ACTIVATIONS, SHARED_ARENA_SIZE);
+        if (shared_arena == nullptr) {
+            ESP_LOGE(TAG, "Failed to allocate the %d byte shared arena", SHARED_ARENA_SIZE);
+            return nullptr;
+        }
+        memset(shared_arena, FILL_PATTERN, SHARED_ARENA_SIZE);
+    }
+
+    uint8_t* persistent = (uint8_t*)model_region_alloc(MODEL_REGION_ACTIVATIONS, persistent_bytes);
+    if (persistent == nullptr) {
+        ESP_LOGE(TAG, "Failed to allocate %u persistent bytes for %s", (unsigned)persistent_bytes, owner);
+        return nullptr;
+    }
+    memset(persistent, FILL_PATTERN, persistent_bytes);
+
+    tflite::MicroAllocator* allocator = tflite::MicroAllocator::Create(
+        persistent, persistent_bytes, shared_arena, SHARED_ARENA_SIZE);
+    if (allocator == nullptr) {
+        model_memory_free(persistent);
+        return nullptr;
+    }
+
+    persistent_regions[interpreter_count++] = { owner, persistent, persistent_bytes };
+    ESP_LOGI(TAG, "%s: %u persistent bytes, activations in the %d byte shared region (%s)",
+             owner, (unsigned)persistent_bytes, SHARED_ARENA_SIZE, model_memory_name(model_memory_of(shared_arena)));
+    return allocator;
+}
+
+// The shared region fills from its start, persistent regions from their end
+static size_t used_from_start(const uint8_t* buffer, size_t size) {
+    size_t used = size;
+    while (used > 0 && buffer[used - 1] == FILL_PATTERN) {
+        used--;
+    }
+    return used;
+}
+
+static size_t used_from_end(const uint8_t* buffer, size_t size) {
+    size_t unused = 0;
+    while (unused < size && buffer[unused] == FILL_PATTERN) {
+        unused++;
+    }
+    return size - unused;
+}
+
+extern "C" void model_arena_get_stats(model_arena_stats_t* stats) {
+    memset(stats, 0, sizeof(*stats));
+    stats->interpreters = interpreter_count;
+    if (shared_arena != nullptr) {
+        stats->shared_bytes = SHARED_ARENA_SIZE;
+        stats->shared_peak_bytes = used_from_start(shared_arena, SHARED_ARENA_SIZE);
+    }
+    for (uint32_t i = 0; i < interpreter_count; i++) {
+        stats->persistent_bytes += persistent_regions[i].size;
+        stats->persistent_used_bytes += used_from_end(persistent_regions[i].buffer, persistent_regions[i].size);
+    }
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+#ifndef MODEL_BACKEND_H
+#define MODEL_BACKEND_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "sdkconfig.h"
+#include "model_predictor.h"
+#include "model_benchmark.h"
+
+/**
+* @brief Affine quantization of an int8 tensor: real = (q - zero_point) * scale
+*/
+typedef struct {
+    float scale;
+    int32_t zero_point;
+} tensor_quant_t;
+
+/**
+* @brief Output tensor of one binary detection head
+*/
+typedef struct {
+    const void* output;           ///< 1 (sigmoid) or 2 (softmax, element 1 is the event) elements
+    size_t elements;              ///< Elements of output
+    bool is_float;                ///< Output is float32 instead of int8
+    tensor_quant_t quant;         ///< Output quantization (int8 output only)
+} model_backend_head_t;
+
+/**
+* @brief Input and output tensors of a loaded backend
+*
+* The buffers stay valid for the lifetime of the firmware; the predictor
+* writes the input, calls invoke() and reads the output in place.
+*/
+typedef struct {
+    void* input;                  ///< MODEL_INPUT_SIZE int8 (or float, or int16) elements
+    const void* output;           ///< MODEL_NUM_CLASSES int8 (or float) elements
+    bool input_is_float;          ///< Input is float32 instead of int8
+    bool input_is_int16;          ///< Input is raw int16 PCM, normalized inside the graph (16x8 quantized models)
+    bool output_is_float;         ///< Output is float32 instead of int8
+    bool stateful;                ///< Keeps recurrent state between invoke() calls (SVDF, LSTM, resource variables)
+    tensor_quant_t input_quant;   ///< Input quantization (int8 input only)
+    tensor_quant_t output_quant;  ///< Output quantization (int8 output only)
+    const int8_t* embedding;      ///< Penultimate layer activations after invoke() (NULL if the model has no embedding output)
+    size_t embedding_elements;    ///< Elements of embedding
+    int32_t embedding_zero_point; ///< Zero point of embedding (the scale cancels out of cosine similarity)
+    model_backend_head_t heads[MODEL_MAX_HEADS]; ///< Detection heads sharing the backbone
+    size_t head_count;            ///< Valid entries of heads (0 if the model has none)
+} model_backend_io_t;
+
+/**
+* @brief Inference engine behind the predictor API
+*
+* @note The predictor calls init() once and serializes every call under its
+* lock, so backends keep their state in plain statics
+*/
+typedef struct {
+    const char* name;                                        ///< Engine name reported in model_info_t
+    bool (*init)(model_backend_io_t* io, model_info_t* info); ///< Loads the model and fills io and info
+    bool (*invoke)(void);                                    ///< Runs the model on the current input
+    bool (*reset_state)(void);                               ///< Clears the recurrent state (NULL if the engine has none)
+} model_backend_t;
+
+/// TensorFlow Lite Micro with the ESP-NN kernels, serving the predictor API
+extern const model_backend_t tflm_backend;
+
+/**
+* @brief Times a private TFLM interpreter built with the given memory placement
+* @param placement Arena and weight memory to use; measured and timings are filled in
+* @param samples PCM window to classify (MODEL_INPUT_SIZE samples)
+* @param iterations Timed Invoke() calls
+* @return false if a buffer could not be allocated or inference failed
+*
+* @note Uses its own arena and model copy, never the shared region. Caller
+* holds the predictor lock so live inference does not skew the timings
+*/
+bool tflm_measure_placement(model_placement_benchmark_t* placement, const int16_t* samples, uint32_t iterations);
+
+/**
+* @brief Times AllocateTensors() with the model's offline memory plan and without it
+* @param planning Output measurements; tensors is 0 when the model has no plan
+* @return false if the model has no plan or a buffer could not be allocated
+*
+* @note Uses a private arena and a RAM copy of the model. Caller holds the
+* predictor lock
+*/
+bool tflm_measure_planning(model_planning_benchmark_t* planning);
+
+#if CONFIG_MODEL_SHADOW_ENABLE
+/// TFLM running models/sound_classifier_shadow.tflite next to the active model
+extern const model_backend_t shadow_backend;
+#endif
+
+#endif // MODEL_BACKEND_H
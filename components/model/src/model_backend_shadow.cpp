@@ -0,0 +1,100 @@
+/**
+* @file model_backend_shadow.cpp
+* @brief TFLM backend of the shadow model
+*
+* Same loading as model_backend_tflm.cpp, for the candidate model embedded
+* from models/sound_classifier_shadow.tflite. Its sources are generated with
+* --name shadow, so the array, resolver and metadata do not clash with the
+* active model's. Weights are read from flash in place; LUT-compressed
+* filters are decoded per op into the shared arena's scratch space.
+*/
+
+#include "model_backend.h"
+#include "shadow_data.h"
+#include "shadow_metadata.h"
+#include "shadow_op_resolver.h"
+#include "model_compression.h"
+#include "model_arena.h"
+#include "tensorflow/lite/micro/micro_interpreter.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+
+#define PERSISTENT_ARENA_SIZE (CONFIG_MODEL_SHADOW_PERSISTENT_ARENA_SIZE_KB * 1024)
+#define SHARED_ARENA_SIZE (CONFIG_MODEL_SHARED_ARENA_SIZE_KB * 1024)
+
+static const char* TAG = "model_shadow";
+
+// Predictions are compared class by class, so the shadow must share the active model's interface
+static_assert(SHADOW_INPUT_ELEMENTS == MODEL_INPUT_SIZE, "The shadow model input does not match MODEL_INPUT_SIZE");
+static_assert(SHADOW_OUTPUT_ELEMENTS == MODEL_NUM_CLASSES, "The shadow model output does not match MODEL_NUM_CLASSES");
+// The shadow skips windows, so recurrent state would not follow the stream
+static_assert(!SHADOW_STATEFUL, "Streaming (stateful) models cannot run in the shadow slot");
+
+static tflite::MicroInterpreter* interpreter = nullptr;
+static shadow::OpResolver resolver;
+static LutOpResolver lut_resolver(resolver);
+
+static bool shadow_init(model_backend_io_t* io, model_info_t* info) {
+    const int64_t load_start_us = esp_timer_get_time();
+
+    const tflite::Model* model = tflite::GetModel(shadow_tflite);
+    if (model->version() != TFLITE_SCHEMA_VERSION) {
+        ESP_LOGE(TAG, "Model schema mismatch");
+        return false;
+    }
+
+    if (shadow::RegisterOps(resolver) != kTfLiteOk) {
+        ESP_LOGE(TAG, "Failed to register model ops");
+        return false;
+    }
+
+    // Activations are planned in the region the active model uses, which
+    // must be sized for the larger of the two plans
+    tflite::MicroAllocator* allocator = model_arena_create_allocator("shadow", PERSISTENT_ARENA_SIZE);
+    if (allocator == nullptr) {
+        ESP_LOGE(TAG, "Failed to allocate tensor arena");
+        return false;
+    }
+
+    static tflite::MicroInterpreter static_interpreter(model, lut_resolver, allocator);
+
+    interpreter = &static_interpreter;
+
+    if (lut_allocate_tensors(model, interpreter) != kTfLiteOk) {
+        ESP_LOGE(TAG, "Failed to allocate tensors (is CONFIG_MODEL_SHARED_ARENA_SIZE_KB large enough?)");
+        return false;
+    }
+
+    TfLiteTensor* input = interpreter->input(0);
+    TfLiteTensor* output = interpreter->output(0);
+    if ((input->type != kTfLiteInt8 && input->type != kTfLiteFloat32) ||
+        (output->type != kTfLiteInt8 && output->type != kTfLiteFloat32)) {
+        ESP_LOGE(TAG, "Unsupported tensor types: input %d, output %d", input->type, output->type);
+        return false;
+    }
+
+    io->input = input->data.data;
+    io->output = output->data.data;
+    io->input_is_float = input->type == kTfLiteFloat32;
+    io->output_is_float = output->type == kTfLiteFloat32;
+    io->input_quant = { input->params.scale, input->params.zero_point };
+    io->output_quant = { output->params.scale, output->params.zero_point };
+
+    info->model_bytes = shadow_tflite_len;
+    info->arena_bytes = PERSISTENT_ARENA_SIZE + SHARED_ARENA_SIZE;
+    info->arena_used_bytes = interpreter->arena_used_bytes();
+    info->decompressed_bytes = 0;
+    info->load_us = (uint32_t)(esp_timer_get_time() - load_start_us);
+    return true;
+}
+
+static bool shadow_invoke() {
+    return interpreter->Invoke() == kTfLiteOk;
+}
+
+const model_backend_t shadow_backend = {
+    .name = "tflm-shadow",
+    .init = shadow_init,
+    .invoke = shadow_invoke,
+};
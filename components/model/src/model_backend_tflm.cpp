@@ -0,0 +1,433 @@
+/**
+* @file model_backend_tflm.cpp
+* @brief TensorFlow Lite Micro backend of the predictor
+*
+* Loads the generated model array with the generated op resolver (wrapped
+* so LUT-compressed filters are decoded per op) and exposes the interpreter's input and output
+* tensors to model_predictor.cpp. Weights are read from flash in place or
+* copied to RAM as the placement policy (model_memory.h) says.
+*
+* Streaming models keep their recurrent state (SVDF and LSTM variable
+* tensors, resource variables) in the interpreter's persistent region, so it
+* survives other interpreters running on the shared activation region.
+*
+* Models carrying an offline memory plan (tools/plan_tflite_memory.py) skip
+* on-device planning of their activation tensors; init checks that TFLM
+* placed them at the planned offsets.
+*/
+
+#include "model_backend.h"
+#include "model_data.h"
+#include "model_metadata.h"
+#include "model_op_resolver.h"
+#include "model_compression.h"
+#include "model_arena.h"
+#include "model_memory.h"
+#include "tensorflow/lite/micro/micro_interpreter.h"
+#include "tensorflow/lite/micro/micro_resource_variable.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
+#define PERSISTENT_ARENA_SIZE (CONFIG_MODEL_PERSISTENT_ARENA_SIZE_KB * 1024)
+#define SHARED_ARENA_SIZE (CONFIG_MODEL_SHARED_ARENA_SIZE_KB * 1024)
+#define OFFLINE_PLAN_METADATA "OfflineMemoryAllocation"
+#define OFFLINE_PLAN_HEADER_WORDS 3   // version, subgraph, tensor count
+#define ARENA_ALIGNMENT 16            // MicroArenaBufferAlignment()
+
+static const char* TAG = "model_tflm";
+
+// The public API sizes buffers at compile time; fail the build if the model changed shape
+static_assert(MODEL_INPUT_ELEMENTS == MODEL_INPUT_SIZE, "MODEL_INPUT_SIZE does not match the model input");
+static_assert(MODEL_OUTPUT_ELEMENTS == MODEL_NUM_CLASSES, "MODEL_NUM_CLASSES does not match the model output");
+static_assert(MODEL_HEAD_COUNT <= MODEL_MAX_HEADS, "The model has more detection heads than MODEL_MAX_HEADS");
+
+static tflite::MicroInterpreter* interpreter = nullptr;
+
+// Generated from the model file, see tools/generate_model_sources.py
+static model::OpResolver resolver;
+static LutOpResolver lut_resolver(resolver);
+static bool ops_registered = false;
+
+/**
+* @brief Creates the table of resource variables (VAR_HANDLE) of the model
+* @param allocator Allocator of the interpreter that will own them
+* @param resource_variables Output table, nullptr when the model has none
+* @return false if the table did not fit the persistent region
+*/
+static bool create_resource_variables(tflite::MicroAllocator* allocator,
+                                      tflite::MicroResourceVariables** resource_variables) {
+    *resource_variables = nullptr;
+#if MODEL_RESOURCE_VARIABLES > 0
+    *resource_variables = tflite::MicroResourceVariables::Create(allocator, MODEL_RESOURCE_VARIABLES);
+    if (*resource_variables == nullptr) {
+        ESP_LOGE(TAG, "No persistent memory for %d resource variables", MODEL_RESOURCE_VARIABLES);
+        return false;
+    }
+#endif
+    return true;
+}
+
+/**
+* @brief Finds the offline memory plan written by tools/plan_tflite_memory.py
+* @param model Model to search
+* @param planned Output number of tensors with an offline offset (may be nullptr)
+* @return Metadata entry of the plan, or nullptr if the model has none
+*/
+static const tflite::Metadata* find_offline_plan(const tflite::Model* model, uint32_t* planned) {
+    if (model->metadata() == nullptr) {
+        return nullptr;
+    }
+    for (const tflite::Metadata* metadata : *model->metadata()) {
+        if (metadata->name() == nullptr || strcmp(metadata->name()->c_str(), OFFLINE_PLAN_METADATA) != 0) {
+            continue;
+        }
+        const flatbuffers::Vector<uint8_t>* data = model->buffers()->Get(metadata->buffer())->data();
+        if (data == nullptr || data->size() < OFFLINE_PLAN_HEADER_WORDS * sizeof(int32_t)) {
+            return nullptr;
+        }
+        if (planned != nullptr) {
+            const int32_t* words = reinterpret_cast<const int32_t*>(data->data());
+            const uint32_t tensor_count = (uint32_t)words[2];
+            *planned = 0;
+            for (uint32_t i = 0; i < tensor_count; ++i) {
+                *planned += words[OFFLINE_PLAN_HEADER_WORDS + i] >= 0 ? 1 : 0;
+            }
+        }
+        return metadata;
+    }
+    return nullptr;
+}
+
+/**
+* @brief Checks that the input and output tensors landed at their offline offsets
+* @param model Model with an offline plan
+* @param placed Interpreter after AllocateTensors()
+* @param arena Start of the interpreter's non-persistent region, or nullptr
+*        to only check the distance between the two tensors
+* @return true if the plan was honored
+*/
+static bool offline_plan_honored(const tflite::Model* model, tflite::MicroInterpreter* placed, const uint8_t* arena) {
+    const tflite::Metadata* metadata = find_offline_plan(model, nullptr);
+    if (metadata == nullptr) {
+        return false;
+    }
+    const int32_t* offsets = reinterpret_cast<const int32_t*>(
+        model->buffers()->Get(metadata->buffer())->data()->data()) + OFFLINE_PLAN_HEADER_WORDS;
+    const tflite::SubGraph* subgraph = model->subgraphs()->Get(0);
+    const int32_t input_offset = offsets[subgraph->inputs()->Get(0)];
+    const int32_t output_offset = offsets[subgraph->outputs()->Get(0)];
+    if (input_offset < 0 || output_offset < 0) {
+        return false;
+    }
+
+    const uint8_t* input = placed->input(0)->data.uint8;
+    const uint8_t* output = placed->output(0)->data.uint8;
+    if (arena != nullptr) {
+        const uint8_t* base = (const uint8_t*)(((uintptr_t)arena + ARENA_ALIGNMENT - 1) & ~(uintptr_t)(ARENA_ALIGNMENT - 1));
+        return input - base == input_offset && output - base == output_offset;
+    }
+    return input - output == input_offset - output_offset;
+}
+
+static bool register_ops() {
+    if (!ops_registered) {
+        if (model::RegisterOps(resolver) != kTfLiteOk) {
+            ESP_LOGE(TAG, "Failed to register model ops");
+            return false;
+        }
+        ops_registered = true;
+    }
+    return true;
+}
+
+/**
+* @brief Returns the model flatbuffer in the memory its weights should be read from
+* @param memory MODEL_MEMORY_FLASH to use the embedded array in place
+* @return Model data, or nullptr if the copy could not be allocated
+*/
+static const uint8_t* place_model_data(model_memory_t memory) {
+    if (memory == MODEL_MEMORY_FLASH) {
+        return model_tflite;
+    }
+    uint8_t* copy = (uint8_t*)model_memory_alloc(memory, model_tflite_len);
+    if (copy != nullptr) {
+        memcpy(copy, model_tflite, model_tflite_len);
+    }
+    return copy;
+}
+
+static void release_model_data(const uint8_t* model_data) {
+    if (model_data != model_tflite) {
+        model_memory_free((void*)model_data);
+    }
+}
+
+static bool tflm_init(model_backend_io_t* io, model_info_t* info) {
+    const int64_t load_start_us = esp_timer_get_time();
+
+    const model_memory_t weight_memory = model_region_memory(MODEL_REGION_WEIGHTS);
+    const uint8_t* model_data = place_model_data(weight_memory);
+    if (model_data == nullptr) {
+        ESP_LOGE(TAG, "No %s memory for a %u byte model copy", model_memory_name(weight_memory),
+                 (unsigned)model_tflite_len);
+        return false;
+    }
+
+    const tflite::Model* model = tflite::GetModel(model_data);
+    if (model->version() != TFLITE_SCHEMA_VERSION) {
+        ESP_LOGE(TAG, "Model schema mismatch");
+        return false;
+    }
+
+    if (!register_ops()) {
+        return false;
+    }
+
+    // Activations live in the region shared with every other interpreter
+    tflite::MicroAllocator* allocator = model_arena_create_allocator("classifier", PERSISTENT_ARENA_SIZE);
+    if (allocator == nullptr) {
+        ESP_LOGE(TAG, "Failed to allocate tensor arena");
+        return false;
+    }
+
+    tflite::MicroResourceVariables* resource_variables = nullptr;
+    if (!create_resource_variables(allocator, &resource_variables)) {
+        return false;
+    }
+
+    static tflite::MicroInterpreter static_interpreter(model, lut_resolver, allocator, resource_variables);
+
+    interpreter = &static_interpreter;
+
+    if (lut_allocate_tensors(model, interpreter) != kTfLiteOk) {
+        ESP_LOGE(TAG, "Failed to allocate tensors");
+        return false;
+    }
+
+    uint32_t planned = 0;
+    if (find_offline_plan(model, &planned) != nullptr) {
+        if (offline_plan_honored(model, interpreter, nullptr)) {
+            ESP_LOGI(TAG, "Offline memory plan used for %lu tensors", planned);
+        } else {
+            ESP_LOGW(TAG, "Offline memory plan present but not followed, tensors were planned on the device");
+        }
+    }
+
+    TfLiteTensor* input = interpreter->input(0);
+    TfLiteTensor* output = interpreter->output(0);
+    if ((input->type != kTfLiteInt8 && input->type != kTfLiteFloat32 && input->type != kTfLiteInt16) ||
+        (output->type != kTfLiteInt8 && output->type != kTfLiteFloat32)) {
+        ESP_LOGE(TAG, "Unsupported tensor types: input %d, output %d", input->type, output->type);
+        return false;
+    }
+
+    io->input = input->data.data;
+    io->output = output->data.data;
+    io->input_is_float = input->type == kTfLiteFloat32;
+    io->input_is_int16 = input->type == kTfLiteInt16;
+    io->output_is_float = output->type == kTfLiteFloat32;
+    io->stateful = MODEL_STATEFUL;
+    io->input_quant = { input->params.scale, input->params.zero_point };
+    io->output_quant = { output->params.scale, output->params.zero_point };
+
+    // Heads follow the classifier output; their layers share one Invoke() with it
+    for (int h = 0; h < MODEL_HEAD_COUNT; ++h) {
+        const TfLiteTensor* head = interpreter->output(MODEL_HEAD_FIRST_OUTPUT + h);
+        if (head == nullptr || (head->type != kTfLiteInt8 && head->type != kTfLiteFloat32)) {
+            ESP_LOGE(TAG, "Detection head %d must be an int8 or float output", h);
+            return false;
+        }
+        io->heads[h].output = head->data.data;
+        io->heads[h].elements = head->bytes / (head->type == kTfLiteFloat32 ? sizeof(float) : sizeof(int8_t));
+        io->heads[h].is_float = head->type == kTfLiteFloat32;
+        io->heads[h].quant = { head->params.scale, head->params.zero_point };
+    }
+    io->head_count = MODEL_HEAD_COUNT;
+
+#if MODEL_EMBEDDING_ELEMENTS > 0
+    // Last output, kept alive by the planner like any graph output
+    TfLiteTensor* embedding = interpreter->output(MODEL_EMBEDDING_OUTPUT);
+    if (embedding == nullptr || embedding->type != kTfLiteInt8) {
+        ESP_LOGE(TAG, "The embedding output must be int8");
+        return false;
+    }
+    io->embedding = embedding->data.int8;
+    io->embedding_elements = MODEL_EMBEDDING_ELEMENTS;
+    io->embedding_zero_point = embedding->params.zero_point;
+#endif
+
+    info->model_bytes = model_tflite_len;
+    info->arena_bytes = PERSISTENT_ARENA_SIZE + SHARED_ARENA_SIZE;
+    info->arena_used_bytes = interpreter->arena_used_bytes();
+    info->decompressed_bytes = model_data != model_tflite ? model_tflite_len : 0;
+    info->load_us = (uint32_t)(esp_timer_get_time() - load_start_us);
+    return true;
+}
+
+static bool tflm_invoke() {
+    return interpreter->Invoke() == kTfLiteOk;
+}
+
+static bool tflm_reset_state() {
+    // Zeroes variable tensors (to their zero point) and resource variables,
+    // and re-runs CALL_ONCE initializers on the next Invoke()
+    return interpreter->Reset() == kTfLiteOk;
+}
+
+/**
+* @brief Min-max normalizes and quantizes a PCM window into an int8 input tensor
+*/
+static void quantize_window(const int16_t* samples, const TfLiteTensor* input, int8_t* window) {
+    int16_t min_val = samples[0];
+    int16_t max_val = samples[0];
+    for (int i = 1; i < MODEL_INPUT_SIZE; ++i) {
+        if (samples[i] < min_val) min_val = samples[i];
+        if (samples[i] > max_val) max_val = samples[i];
+    }
+    const float range = max_val > min_val ? (float)(max_val - min_val) : 1.0f;
+    for (int i = 0; i < MODEL_INPUT_SIZE; ++i) {
+        int32_t quantized = (int32_t)lroundf((samples[i] - min_val) / range / input->params.scale) +
+                            input->params.zero_point;
+        window[i] = (int8_t)(quantized < -128 ? -128 : (quantized > 127 ? 127 : quantized));
+    }
+}
+
+/**
+* @brief Times Invoke() of an interpreter, rewriting the input before every run
+* @return false if inference failed
+*/
+static bool time_invokes(tflite::MicroInterpreter* placed, const void* window, size_t window_bytes,
+                         uint32_t iterations, model_placement_benchmark_t* placement) {
+    uint64_t total_us = 0;
+    placement->invoke_min_us = UINT32_MAX;
+    for (uint32_t i = 0; i < iterations; ++i) {
+        // The memory planner may reuse the input buffer for later activations
+        memcpy(placed->input(0)->data.data, window, window_bytes);
+        const int64_t start_us = esp_timer_get_time();
+        if (placed->Invoke() != kTfLiteOk) {
+            return false;
+        }
+        const uint32_t invoke_us = (uint32_t)(esp_timer_get_time() - start_us);
+        total_us += invoke_us;
+        if (invoke_us < placement->invoke_min_us) placement->invoke_min_us = invoke_us;
+        if (invoke_us > placement->invoke_max_us) placement->invoke_max_us = invoke_us;
+    }
+    placement->invoke_avg_us = (uint32_t)(total_us / iterations);
+    return true;
+}
+
+bool tflm_measure_placement(model_placement_benchmark_t* placement, const int16_t* samples, uint32_t iterations) {
+    placement->measured = false;
+    if (!register_ops() || iterations == 0) {
+        return false;
+    }
+
+    // One private arena the size of both shared-arena regions, so the loaded
+    // interpreters and their memory are left alone
+    const size_t arena_bytes = PERSISTENT_ARENA_SIZE + SHARED_ARENA_SIZE;
+    uint8_t* arena = (uint8_t*)model_memory_alloc(placement->arena, arena_bytes);
+    const uint8_t* model_data = place_model_data(placement->weights);
+    int8_t* window = (int8_t*)malloc(MODEL_INPUT_SIZE);
+    if (arena == nullptr || model_data == nullptr || window == nullptr) {
+        ESP_LOGW(TAG, "Not enough memory for a %s arena with %s weights",
+                 model_memory_name(placement->arena), model_memory_name(placement->weights));
+        free(window);
+        release_model_data(model_data);
+        model_memory_free(arena);
+        return false;
+    }
+
+    const tflite::Model* model = tflite::GetModel(model_data);
+    tflite::MicroAllocator* allocator = tflite::MicroAllocator::Create(arena, arena_bytes);
+    tflite::MicroResourceVariables* resource_variables = nullptr;
+    if (allocator != nullptr && create_resource_variables(allocator, &resource_variables)) {
+        tflite::MicroInterpreter placed(model, lut_resolver, allocator, resource_variables);
+        if (lut_allocate_tensors(model, &placed) == kTfLiteOk) {
+            if (placed.input(0)->type == kTfLiteInt8) {
+                quantize_window(samples, placed.input(0), window);
+                placement->measured = time_invokes(&placed, window, MODEL_INPUT_SIZE, iterations, placement);
+            } else if (placed.input(0)->type == kTfLiteInt16) {
+                placement->measured = time_invokes(&placed, samples, MODEL_INPUT_SIZE * sizeof(int16_t),
+                                                   iterations, placement);
+            }
+        }
+    }
+
+    free(window);
+    release_model_data(model_data);
+    model_memory_free(arena);
+    return placement->measured;
+}
+
+/**
+* @brief Times AllocateTensors() of a private interpreter on a model copy
+* @param model_data Model flatbuffer
+* @param arena Private arena of PERSISTENT_ARENA_SIZE + SHARED_ARENA_SIZE bytes
+* @param init_us Output AllocateTensors() duration
+* @param arena_used Output arena use
+* @param honored Output whether the offline plan was followed (may be nullptr)
+* @return false if the interpreter could not be set up
+*/
+static bool time_allocation(const uint8_t* model_data, uint8_t* arena, uint32_t* init_us, size_t* arena_used,
+                            bool* honored) {
+    const size_t arena_bytes = PERSISTENT_ARENA_SIZE + SHARED_ARENA_SIZE;
+    const tflite::Model* model = tflite::GetModel(model_data);
+    tflite::MicroAllocator* allocator = tflite::MicroAllocator::Create(arena, arena_bytes);
+    tflite::MicroResourceVariables* resource_variables = nullptr;
+    if (allocator == nullptr || !create_resource_variables(allocator, &resource_variables)) {
+        return false;
+    }
+
+    tflite::MicroInterpreter placed(model, lut_resolver, allocator, resource_variables);
+    const int64_t start_us = esp_timer_get_time();
+    if (lut_allocate_tensors(model, &placed) != kTfLiteOk) {
+        return false;
+    }
+    *init_us = (uint32_t)(esp_timer_get_time() - start_us);
+    *arena_used = placed.arena_used_bytes();
+    if (honored != nullptr) {
+        *honored = offline_plan_honored(model, &placed, arena);
+    }
+    return true;
+}
+
+bool tflm_measure_planning(model_planning_benchmark_t* planning) {
+    memset(planning, 0, sizeof(*planning));
+    const tflite::Metadata* plan = find_offline_plan(tflite::GetModel(model_tflite), &planning->tensors);
+    if (plan == nullptr || !register_ops()) {
+        return false;
+    }
+
+    // The plan is hidden from TFLM by renaming its metadata entry in a RAM copy
+    const size_t arena_bytes = PERSISTENT_ARENA_SIZE + SHARED_ARENA_SIZE;
+    uint8_t* arena = (uint8_t*)model_memory_alloc(model_region_memory(MODEL_REGION_ACTIVATIONS), arena_bytes);
+    uint8_t* copy = (uint8_t*)model_memory_alloc(model_region_ram(MODEL_REGION_WEIGHTS), model_tflite_len);
+    bool measured = false;
+    if (arena != nullptr && copy != nullptr) {
+        memcpy(copy, model_tflite, model_tflite_len);
+        const tflite::Metadata* copied_plan = find_offline_plan(tflite::GetModel(copy), nullptr);
+        measured = time_allocation(copy, arena, &planning->offline_init_us, &planning->offline_arena_bytes,
+                                   &planning->honored);
+        char* name = const_cast<char*>(copied_plan->name()->c_str());
+        name[0] = '_';
+        measured = measured && time_allocation(copy, arena, &planning->online_init_us,
+                                               &planning->online_arena_bytes, nullptr);
+    } else {
+        ESP_LOGW(TAG, "Not enough memory for a private arena and model copy");
+    }
+
+    model_memory_free(copy);
+    model_memory_free(arena);
+    return measured;
+}
+
+const model_backend_t tflm_backend = {
+    .name = "tflm",
+    .init = tflm_init,
+    .invoke = tflm_invoke,
+    .reset_state = tflm_reset_state,
+};
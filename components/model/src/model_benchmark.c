@@ -0,0 +1,156 @@
+/**
+ * @file model_benchmark.c
+ * @brief On-device latency and footprint measurement of the deployed model
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "model_benchmark.h"
+#include "model_engine.h"
+#include "esp_log.h"
+
+static const char *TAG = "model_benchmark";
+
+#define BENCHMARK_MAX_ITERATIONS 1000
+
+esp_err_t model_benchmark_run(uint32_t iterations, model_benchmark_result_t *result) {
+    if (result == NULL || iterations == 0 || iterations > BENCHMARK_MAX_ITERATIONS) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    memset(result, 0, sizeof(*result));
+
+    if (model_get_info(&result->model) != 0) {
+        return ESP_FAIL;
+    }
+
+    int16_t *samples = malloc(MODEL_INPUT_SIZE * sizeof(int16_t));
+    if (samples == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    // Deterministic pseudo-random window so runs are comparable
+    uint32_t seed = 0x12345678;
+    for (int i = 0; i < MODEL_INPUT_SIZE; i++) {
+        seed = seed * 1664525u + 1013904223u;
+        samples[i] = (int16_t)(seed >> 16);
+    }
+
+    uint64_t invoke_total_us = 0;
+    uint64_t quantize_total_us = 0;
+    result->invoke_min_us = UINT32_MAX;
+
+    esp_err_t ret = ESP_OK;
+    for (uint32_t i = 0; i < iterations; i++) {
+        prediction_result_t prediction;
+        // The path live windows take: PCM straight into the input tensor
+        if (predict_pcm(NULL, 0, samples, &prediction, NULL) < 0) {
+            ret = ESP_FAIL;
+            break;
+        }
+        invoke_total_us += prediction.invoke_us;
+        quantize_total_us += prediction.quantize_us;
+        if (prediction.invoke_us < result->invoke_min_us) {
+            result->invoke_min_us = prediction.invoke_us;
+        }
+        if (prediction.invoke_us > result->invoke_max_us) {
+            result->invoke_max_us = prediction.invoke_us;
+        }
+        result->iterations++;
+    }
+    free(samples);
+    model_arena_get_stats(&result->arena);
+
+    if (result->iterations > 0) {
+        result->invoke_avg_us = (uint32_t)(invoke_total_us / result->iterations);
+        result->quantize_avg_us = (uint32_t)(quantize_total_us / result->iterations);
+    } else {
+        result->invoke_min_us = 0;
+    }
+
+    ESP_LOGI(TAG, "%lu runs: invoke %lu/%lu/%lu us (min/avg/max), model %u bytes, load %lu us",
+             result->iterations, result->invoke_min_us, result->invoke_avg_us, result->invoke_max_us,
+             (unsigned)result->model.model_bytes, result->model.load_us);
+    return ret;
+}
+
+/**
+ * @brief Fills a deterministic test window: two tones plus noise, varying per seed
+ * @param samples Output window (MODEL_INPUT_SIZE samples)
+ * @param seed Window number
+ */
+static void synthesize_window(int16_t *samples, uint32_t seed) {
+    const float f1 = 0.01f + 0.37f * ((seed * 7919u) % 97u) / 97.0f;
+    const float f2 = 0.01f + 0.37f * ((seed * 104729u) % 89u) / 89.0f;
+    const float noise = ((seed * 31u) % 11u) / 10.0f;
+    uint32_t state = seed * 2654435761u + 1u;
+    for (int i = 0; i < MODEL_INPUT_SIZE; i++) {
+        state = state * 1664525u + 1013904223u;
+        const float value = 0.5f * sinf(2.0f * (float)M_PI * f1 * i) + 0.3f * sinf(2.0f * (float)M_PI * f2 * i) +
+                            noise * (((state >> 16) & 0xFFFF) / 32768.0f - 1.0f);
+        samples[i] = (int16_t)(value * 16000.0f);
+    }
+}
+
+// Hot-path placements first; the weight copies show what the cache costs
+static const struct {
+    model_memory_t arena;
+    model_memory_t weights;
+} PLACEMENTS[MODEL_PLACEMENT_COUNT] = {
+    { MODEL_MEMORY_INTERNAL, MODEL_MEMORY_FLASH },
+    { MODEL_MEMORY_INTERNAL, MODEL_MEMORY_INTERNAL },
+    { MODEL_MEMORY_INTERNAL, MODEL_MEMORY_PSRAM },
+    { MODEL_MEMORY_PSRAM, MODEL_MEMORY_FLASH },
+    { MODEL_MEMORY_PSRAM, MODEL_MEMORY_PSRAM },
+};
+
+esp_err_t model_benchmark_placement(uint32_t iterations, model_placement_comparison_t *result) {
+    if (result == NULL || iterations == 0 || iterations > BENCHMARK_MAX_ITERATIONS) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    memset(result, 0, sizeof(*result));
+    result->iterations = iterations;
+    result->activations = model_region_memory(MODEL_REGION_ACTIVATIONS);
+    result->weights = model_region_memory(MODEL_REGION_WEIGHTS);
+    result->audio_history = model_region_memory(MODEL_REGION_AUDIO_HISTORY);
+
+    int16_t *samples = malloc(MODEL_INPUT_SIZE * sizeof(int16_t));
+    if (samples == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    synthesize_window(samples, 0);
+
+    const bool psram = model_memory_psram_available();
+    int measured = 0;
+    for (int p = 0; p < MODEL_PLACEMENT_COUNT; p++) {
+        model_placement_benchmark_t *placement = &result->placements[p];
+        placement->arena = PLACEMENTS[p].arena;
+        placement->weights = PLACEMENTS[p].weights;
+        if (!psram && (placement->arena == MODEL_MEMORY_PSRAM || placement->weights == MODEL_MEMORY_PSRAM)) {
+            continue;
+        }
+        if (model_engine_measure_placement(placement, samples, iterations) != 0) {
+            continue;
+        }
+        measured++;
+        ESP_LOGI(TAG, "arena %s, weights %s: invoke %lu/%lu/%lu us",
+                 model_memory_name(placement->arena), model_memory_name(placement->weights),
+                 placement->invoke_min_us, placement->invoke_avg_us, placement->invoke_max_us);
+    }
+    free(samples);
+    return measured > 0 ? ESP_OK : ESP_FAIL;
+}
+
+esp_err_t model_benchmark_planning(model_planning_benchmark_t *result) {
+    if (result == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (model_engine_measure_planning(result) != 0) {
+        return result->tensors == 0 ? ESP_ERR_NOT_FOUND : ESP_FAIL;
+    }
+    ESP_LOGI(TAG, "Offline plan (%lu tensors, %s): init %lu us vs %lu us, arena %u bytes vs %u bytes",
+             result->tensors, result->honored ? "honored" : "not honored",
+             result->offline_init_us, result->online_init_us,
+             (unsigned)result->offline_arena_bytes, (unsigned)result->online_arena_bytes);
+    return ESP_OK;
+}
@@ -0,0 +1,468 @@
+/**
+* @file model_compression.cc
+* @brief Per-op decoding of TFLM LUT-compressed weight tensors
+*
+* Compressed models are produced by tools/compress_tflite_weights.py.
+* The layout follows tensorflow/lite/micro/compression (schema version 1):
+* - Model metadata "COMPRESSION_METADATA" points at a size-prefixed
+*   Metadata table: subgraphs[] -> lut_tensors[] -> {tensor, value_buffer, index_bitwidth}
+* - The tensor's own buffer holds the indices, packed MSB first
+* - value_buffer holds one value table per quantization channel
+*
+* The ESP-NN kernels read plain int8 filters, so LutOpResolver hands out
+* wrapped registrations of every op that takes one. When an op's filter is
+* compressed, the wrapper requests an arena scratch buffer of the expanded
+* size in Prepare() and decodes the filter into it right before the kernel
+* runs. Scratch buffers only live for their op, so the planner lays them
+* over activations of other ops and no RAM outside the arena is used.
+*/
+
+#include "model_compression.h"
+#include "tensorflow/lite/micro/kernels/kernel_util.h"
+#include "tensorflow/lite/schema/schema_utils.h"
+#include "freertos/FreeRTOS.h"
+#include "esp_log.h"
+#include <cstring>
+
+static const char* TAG = "model_compression";
+static const char* COMPRESSION_METADATA = "COMPRESSION_METADATA";
+static const int SUPPORTED_SCHEMA_VERSION = 1;
+
+// Field offsets of the compression metadata tables (vtable slot = 4 + 2 * field index)
+enum : flatbuffers::voffset_t {
+    METADATA_SCHEMA_VERSION = 4,
+    METADATA_SUBGRAPHS = 6,
+    SUBGRAPH_LUT_TENSORS = 4,
+    LUT_TENSOR_TENSOR = 4,
+    LUT_TENSOR_VALUE_BUFFER = 6,
+    LUT_TENSOR_INDEX_BITWIDTH = 8,
+};
+
+using TableVector = flatbuffers::Vector<flatbuffers::Offset<flatbuffers::Table>>;
+
+// Every wrapped op takes its filter as input 1, as tools/compress_tflite_weights.py expects
+static const int FILTER_INPUT = 1;
+
+// Ops that can read a compressed filter through the wrapper
+enum : int {
+    SLOT_CONV_2D,
+    SLOT_DEPTHWISE_CONV_2D,
+    SLOT_FULLY_CONNECTED,
+    SLOT_CONV_2D_MAXPOOL,
+    SLOT_COUNT,
+};
+static const char* CONV_2D_MAXPOOL_NAME = "CONV_2D_MAXPOOL_2X2";
+
+// Models between lut_allocate_tensors() and the end of their AllocateTensors()
+#define MAX_PREPARING_MODELS 4
+static portMUX_TYPE s_preparing_lock = portMUX_INITIALIZER_UNLOCKED;
+static const tflite::Model* s_preparing[MAX_PREPARING_MODELS];
+
+/**
+* @brief Decoding parameters of one compressed tensor
+*/
+struct LutTensor {
+    const uint8_t* packed;            ///< Indices, packed MSB first
+    const uint8_t* values;            ///< One value table per channel
+    size_t count;                     ///< Elements of the tensor
+    size_t type_size;                 ///< Bytes per element
+    size_t channels;                  ///< Value tables
+    size_t stride;                    ///< Entries per value table
+    size_t bit_width;                 ///< Bits per index
+    bool channel_last;                ///< Tables follow the last axis instead of the first
+};
+
+/**
+* @brief Node data of a wrapped op
+*/
+struct WrapperData {
+    void* inner_data;                 ///< The wrapped kernel's own node data
+    bool compressed;                  ///< Whether the filter is decoded before each run
+    int scratch_index;                ///< Arena scratch buffer holding the decoded filter
+    LutTensor lut;
+};
+
+/**
+* @brief Finds the compression metadata table of a model
+* @return Root table, or nullptr when the model is not compressed
+*/
+static const flatbuffers::Table* find_compression_metadata(const tflite::Model* model) {
+    if (model->metadata() == nullptr || model->buffers() == nullptr) {
+        return nullptr;
+    }
+    for (const tflite::Metadata* metadata : *model->metadata()) {
+        if (metadata->name() == nullptr || strcmp(metadata->name()->c_str(), COMPRESSION_METADATA) != 0) {
+            continue;
+        }
+        if (metadata->buffer() >= model->buffers()->size()) {
+            return nullptr;
+        }
+        const flatbuffers::Vector<uint8_t>* data = model->buffers()->Get(metadata->buffer())->data();
+        if (data == nullptr || data->size() < sizeof(flatbuffers::uoffset_t)) {
+            return nullptr;
+        }
+        return flatbuffers::GetSizePrefixedRoot<flatbuffers::Table>(data->data());
+    }
+    return nullptr;
+}
+
+/**
+* @brief Finds the LUT tensor entries of the model's only subgraph
+* @param lut_tensors Output entries, nullptr when the model is not compressed
+* @return kTfLiteOk unless the metadata is unsupported
+*/
+static TfLiteStatus find_lut_tensors(const tflite::Model* model, const TableVector** lut_tensors) {
+    *lut_tensors = nullptr;
+    const flatbuffers::Table* metadata = find_compression_metadata(model);
+    if (metadata == nullptr) {
+        return kTfLiteOk;
+    }
+
+    const int32_t schema_version = metadata->GetField<int32_t>(METADATA_SCHEMA_VERSION, 1);
+    if (schema_version > SUPPORTED_SCHEMA_VERSION) {
+        ESP_LOGE(TAG, "Compression schema version %ld not supported", (long)schema_version);
+        return kTfLiteError;
+    }
+
+    const TableVector* subgraphs = metadata->GetPointer<const TableVector*>(METADATA_SUBGRAPHS);
+    if (subgraphs == nullptr || subgraphs->size() == 0) {
+        return kTfLiteOk;
+    }
+    if (subgraphs->size() > 1) {
+        ESP_LOGE(TAG, "Only single-subgraph models are supported");
+        return kTfLiteError;
+    }
+
+    *lut_tensors = subgraphs->Get(0)->GetPointer<const TableVector*>(SUBGRAPH_LUT_TENSORS);
+    return kTfLiteOk;
+}
+
+/**
+* @brief Reads and checks the decoding parameters of one LUT tensor entry
+* @return kTfLiteOk when the entry matches its tensor
+*/
+static TfLiteStatus parse_lut_tensor(const tflite::Model* model, const flatbuffers::Table* entry, LutTensor* lut) {
+    const int32_t tensor_index = entry->GetField<int32_t>(LUT_TENSOR_TENSOR, 0);
+    const uint32_t value_buffer = entry->GetField<uint32_t>(LUT_TENSOR_VALUE_BUFFER, 0);
+    lut->bit_width = entry->GetField<uint8_t>(LUT_TENSOR_INDEX_BITWIDTH, 0);
+
+    auto tensors = model->subgraphs()->Get(0)->tensors();
+    if (tensor_index < 0 || (size_t)tensor_index >= tensors->size() ||
+        value_buffer >= model->buffers()->size() || lut->bit_width < 1 || lut->bit_width > 7) {
+        ESP_LOGE(TAG, "Invalid LUT tensor entry (tensor %ld)", (long)tensor_index);
+        return kTfLiteError;
+    }
+
+    const tflite::Tensor* tensor = tensors->Get(tensor_index);
+    const flatbuffers::Vector<uint8_t>* packed = model->buffers()->Get(tensor->buffer())->data();
+    const flatbuffers::Vector<uint8_t>* values = model->buffers()->Get(value_buffer)->data();
+    if (packed == nullptr || values == nullptr || tensor->shape() == nullptr) {
+        ESP_LOGE(TAG, "Tensor %ld has no packed data or value table", (long)tensor_index);
+        return kTfLiteError;
+    }
+
+    switch (tensor->type()) {
+        case tflite::TensorType_INT8: lut->type_size = 1; break;
+        case tflite::TensorType_INT16: lut->type_size = 2; break;
+        case tflite::TensorType_INT32: lut->type_size = 4; break;
+        case tflite::TensorType_FLOAT32: lut->type_size = 4; break;
+        default:
+            ESP_LOGE(TAG, "Unsupported LUT tensor type %d", tensor->type());
+            return kTfLiteError;
+    }
+
+    lut->count = 1;
+    for (int32_t dim : *tensor->shape()) {
+        lut->count *= dim;
+    }
+
+    // Per-channel tables along the quantized dimension (first or last axis)
+    lut->channels = 1;
+    lut->channel_last = false;
+    const tflite::QuantizationParameters* quant = tensor->quantization();
+    if (quant != nullptr && quant->scale() != nullptr && quant->scale()->size() > 1) {
+        lut->channels = quant->scale()->size();
+        lut->channel_last = quant->quantized_dimension() == (int32_t)tensor->shape()->size() - 1 &&
+                            quant->quantized_dimension() != 0;
+    }
+    lut->stride = values->size() / lut->type_size / lut->channels;
+    if (packed->size() * 8 < lut->count * lut->bit_width || lut->stride == 0 || lut->count % lut->channels != 0) {
+        ESP_LOGE(TAG, "Tensor %ld: packed data does not match its shape", (long)tensor_index);
+        return kTfLiteError;
+    }
+
+    lut->packed = packed->data();
+    lut->values = values->data();
+    return kTfLiteOk;
+}
+
+/**
+* @brief Reads the index of one element from a packed MSB-first bit stream
+*/
+static inline size_t read_index(const uint8_t* packed, size_t element, size_t bit_width) {
+    size_t bit = element * bit_width;
+    size_t index = 0;
+    for (size_t i = 0; i < bit_width; ++i, ++bit) {
+        index = (index << 1) | ((packed[bit >> 3] >> (7 - (bit & 7))) & 1);
+    }
+    return index;
+}
+
+/**
+* @brief Expands a LUT tensor into plain values
+*/
+static void decode_lut_tensor(const LutTensor* lut, uint8_t* output) {
+    const size_t per_channel = lut->count / lut->channels;
+
+    // What compress_tflite_weights.py --bits 4 writes for conv and FC filters:
+    // two int8 indices per byte, one table per output channel
+    if (lut->bit_width == 4 && lut->type_size == 1 && !lut->channel_last) {
+        for (size_t channel = 0, i = 0; channel < lut->channels; ++channel) {
+            const uint8_t* table = lut->values + channel * lut->stride;
+            for (const size_t end = i + per_channel; i < end; ++i) {
+                const uint8_t pair = lut->packed[i >> 1];
+                output[i] = table[(i & 1) ? (pair & 0x0f) : (pair >> 4)];
+            }
+        }
+        return;
+    }
+
+    for (size_t i = 0; i < lut->count; ++i) {
+        const size_t channel = lut->channel_last ? i % lut->channels : i / per_channel;
+        const size_t index = read_index(lut->packed, i, lut->bit_width);
+        memcpy(output + i * lut->type_size, lut->values + (channel * lut->stride + index) * lut->type_size,
+               lut->type_size);
+    }
+}
+
+/**
+* @brief Finds the LUT entry whose packed indices a constant tensor points at
+* @param data Data pointer of the tensor, still into the model flatbuffer during Prepare()
+* @param lut Output decoding parameters
+* @return true when the tensor belongs to a model being prepared and is compressed
+*/
+static bool find_preparing_lut(const void* data, LutTensor* lut) {
+    const tflite::Model* models[MAX_PREPARING_MODELS];
+    portENTER_CRITICAL(&s_preparing_lock);
+    memcpy(models, s_preparing, sizeof(models));
+    portEXIT_CRITICAL(&s_preparing_lock);
+
+    for (const tflite::Model* model : models) {
+        const TableVector* lut_tensors = nullptr;
+        if (model == nullptr || find_lut_tensors(model, &lut_tensors) != kTfLiteOk || lut_tensors == nullptr) {
+            continue;
+        }
+        auto tensors = model->subgraphs()->Get(0)->tensors();
+        for (const flatbuffers::Table* entry : *lut_tensors) {
+            const int32_t tensor_index = entry->GetField<int32_t>(LUT_TENSOR_TENSOR, -1);
+            if (tensor_index < 0 || (size_t)tensor_index >= tensors->size()) {
+                continue;
+            }
+            const flatbuffers::Vector<uint8_t>* packed =
+                model->buffers()->Get(tensors->Get(tensor_index)->buffer())->data();
+            if (packed != nullptr && packed->data() == data) {
+                return parse_lut_tensor(model, entry, lut) == kTfLiteOk;
+            }
+        }
+    }
+    return false;
+}
+
+// Registrations of the wrapped kernels, filled by LutOpResolver::FindOp()
+static TFLMRegistration s_inner[SLOT_COUNT];
+static TFLMRegistration s_wrapped[SLOT_COUNT];
+
+template <int Slot>
+static void* wrapped_init(TfLiteContext* context, const char* buffer, size_t length) {
+    WrapperData* data = (WrapperData*)context->AllocatePersistentBuffer(context, sizeof(WrapperData));
+    if (data == nullptr) {
+        return nullptr;
+    }
+    data->inner_data = s_inner[Slot].init != nullptr ? s_inner[Slot].init(context, buffer, length) : nullptr;
+    data->compressed = false;
+    data->scratch_index = -1;
+    return data;
+}
+
+template <int Slot>
+static void wrapped_free(TfLiteContext* context, void* buffer) {
+    if (buffer != nullptr && s_inner[Slot].free != nullptr) {
+        s_inner[Slot].free(context, ((WrapperData*)buffer)->inner_data);
+    }
+}
+
+template <int Slot>
+static void wrapped_reset(TfLiteContext* context, void* buffer) {
+    if (buffer != nullptr && s_inner[Slot].reset != nullptr) {
+        s_inner[Slot].reset(context, ((WrapperData*)buffer)->inner_data);
+    }
+}
+
+template <int Slot>
+static TfLiteStatus wrapped_prepare(TfLiteContext* context, TfLiteNode* node) {
+    WrapperData* data = (WrapperData*)node->user_data;
+    TF_LITE_ENSURE(context, data != nullptr);
+
+    // The kernel only reads the filter's shape and quantization here
+    node->user_data = data->inner_data;
+    const TfLiteStatus status = s_inner[Slot].prepare != nullptr ? s_inner[Slot].prepare(context, node) : kTfLiteOk;
+    node->user_data = data;
+    TF_LITE_ENSURE_STATUS(status);
+
+    const TfLiteEvalTensor* filter = tflite::micro::GetEvalInput(context, node, FILTER_INPUT);
+    data->compressed = filter != nullptr && find_preparing_lut(filter->data.data, &data->lut);
+    if (!data->compressed) {
+        return kTfLiteOk;
+    }
+    return context->RequestScratchBufferInArena(context, data->lut.count * data->lut.type_size,
+                                                &data->scratch_index);
+}
+
+template <int Slot>
+static TfLiteStatus wrapped_invoke(TfLiteContext* context, TfLiteNode* node) {
+    WrapperData* data = (WrapperData*)node->user_data;
+    TfLiteEvalTensor* filter = nullptr;
+    if (data->compressed) {
+        uint8_t* decoded = (uint8_t*)context->GetScratchBuffer(context, data->scratch_index);
+        decode_lut_tensor(&data->lut, decoded);
+        filter = context->GetEvalTensor(context, node->inputs->data[FILTER_INPUT]);
+        filter->data.data = decoded;
+    }
+
+    node->user_data = data->inner_data;
+    const TfLiteStatus status = s_inner[Slot].invoke(context, node);
+    node->user_data = data;
+
+    // Other ops may reuse the scratch memory, so the filter points at the indices again
+    if (filter != nullptr) {
+        filter->data.data = (void*)data->lut.packed;
+    }
+    return status;
+}
+
+template <int Slot>
+static constexpr TFLMRegistration wrapper_registration() {
+    return { wrapped_init<Slot>, wrapped_free<Slot>, wrapped_prepare<Slot>, wrapped_invoke<Slot>,
+             wrapped_reset<Slot>, 0, nullptr };
+}
+
+/**
+* @brief Wrapper slot of an op, SLOT_COUNT when its inputs are never compressed
+*/
+static int slot_of(tflite::BuiltinOperator op, const char* custom_name) {
+    if (custom_name != nullptr) {
+        return strcmp(custom_name, CONV_2D_MAXPOOL_NAME) == 0 ? SLOT_CONV_2D_MAXPOOL : SLOT_COUNT;
+    }
+    switch (op) {
+        case tflite::BuiltinOperator_CONV_2D: return SLOT_CONV_2D;
+        case tflite::BuiltinOperator_DEPTHWISE_CONV_2D: return SLOT_DEPTHWISE_CONV_2D;
+        case tflite::BuiltinOperator_FULLY_CONNECTED: return SLOT_FULLY_CONNECTED;
+        default: return SLOT_COUNT;
+    }
+}
+
+/**
+* @brief Returns the wrapped registration of an op that can take a compressed filter
+*/
+static const TFLMRegistration* wrap(const TFLMRegistration* registration, int slot) {
+    static const TFLMRegistration wrappers[SLOT_COUNT] = {
+        wrapper_registration<SLOT_CONV_2D>(),
+        wrapper_registration<SLOT_DEPTHWISE_CONV_2D>(),
+        wrapper_registration<SLOT_FULLY_CONNECTED>(),
+        wrapper_registration<SLOT_CONV_2D_MAXPOOL>(),
+    };
+    if (registration == nullptr || slot == SLOT_COUNT) {
+        return registration;
+    }
+
+    // One kernel per op: every resolver registers the same functions
+    portENTER_CRITICAL(&s_preparing_lock);
+    if (s_inner[slot].invoke == nullptr) {
+        s_inner[slot] = *registration;
+        s_wrapped[slot] = wrappers[slot];
+        s_wrapped[slot].builtin_code = registration->builtin_code;
+        s_wrapped[slot].custom_name = registration->custom_name;
+    }
+    const bool same_kernel = s_inner[slot].invoke == registration->invoke;
+    portEXIT_CRITICAL(&s_preparing_lock);
+    return same_kernel ? &s_wrapped[slot] : registration;
+}
+
+const TFLMRegistration* LutOpResolver::FindOp(tflite::BuiltinOperator op) const {
+    return wrap(inner_.FindOp(op), slot_of(op, nullptr));
+}
+
+const TFLMRegistration* LutOpResolver::FindOp(const char* op) const {
+    return wrap(inner_.FindOp(op), slot_of(tflite::BuiltinOperator_CUSTOM, op));
+}
+
+tflite::TfLiteBridgeBuiltinParseFunction LutOpResolver::GetOpDataParser(tflite::BuiltinOperator op) const {
+    return inner_.GetOpDataParser(op);
+}
+
+/**
+* @brief Checks that every compressed tensor is the filter of an op the wrapper decodes
+* @return kTfLiteOk when no op would read packed indices as weights
+*/
+static TfLiteStatus check_lut_consumers(const tflite::Model* model, const TableVector* lut_tensors) {
+    const tflite::SubGraph* subgraph = model->subgraphs()->Get(0);
+    if (subgraph->operators() == nullptr) {
+        return kTfLiteOk;
+    }
+    for (const tflite::Operator* op : *subgraph->operators()) {
+        if (op->inputs() == nullptr || op->opcode_index() >= model->operator_codes()->size()) {
+            continue;
+        }
+        const tflite::OperatorCode* code = model->operator_codes()->Get(op->opcode_index());
+        const tflite::BuiltinOperator builtin = tflite::GetBuiltinCode(code);
+        const char* custom_name = builtin == tflite::BuiltinOperator_CUSTOM && code->custom_code() != nullptr ?
+                                  code->custom_code()->c_str() : nullptr;
+        const bool wrapped = slot_of(builtin, custom_name) != SLOT_COUNT;
+        for (size_t i = 0; i < op->inputs()->size(); ++i) {
+            for (const flatbuffers::Table* entry : *lut_tensors) {
+                if (entry->GetField<int32_t>(LUT_TENSOR_TENSOR, -1) == op->inputs()->Get(i) &&
+                    (!wrapped || (int)i != FILTER_INPUT)) {
+                    ESP_LOGE(TAG, "Compressed tensor %ld is input %u of an op that cannot decode it",
+                             (long)op->inputs()->Get(i), (unsigned)i);
+                    return kTfLiteError;
+                }
+            }
+        }
+    }
+    return kTfLiteOk;
+}
+
+TfLiteStatus lut_allocate_tensors(const tflite::Model* model, tflite::MicroInterpreter* interpreter) {
+    const TableVector* lut_tensors = nullptr;
+    TF_LITE_ENSURE_STATUS(find_lut_tensors(model, &lut_tensors));
+    if (lut_tensors == nullptr) {
+        return interpreter->AllocateTensors();
+    }
+    TF_LITE_ENSURE_STATUS(check_lut_consumers(model, lut_tensors));
+
+    int slot = -1;
+    portENTER_CRITICAL(&s_preparing_lock);
+    for (int i = 0; i < MAX_PREPARING_MODELS && slot < 0; i++) {
+        if (s_preparing[i] == nullptr) {
+            s_preparing[i] = model;
+            slot = i;
+        }
+    }
+    portEXIT_CRITICAL(&s_preparing_lock);
+    if (slot < 0) {
+        ESP_LOGE(TAG, "More than %d compressed models allocating at once", MAX_PREPARING_MODELS);
+        return kTfLiteError;
+    }
+
+    // The wrapped kernels' Prepare() find their tables through s_preparing
+    const TfLiteStatus status = interpreter->AllocateTensors();
+
+    portENTER_CRITICAL(&s_preparing_lock);
+    s_preparing[slot] = nullptr;
+    portEXIT_CRITICAL(&s_preparing_lock);
+
+    if (status == kTfLiteOk) {
+        ESP_LOGI(TAG, "%u LUT tensors decoded per op into arena scratch", (unsigned)lut_tensors->size());
+    }
+    return status;
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#ifndef MODEL_COMPRESSION_H
+#define MODEL_COMPRESSION_H
+
+#include "tensorflow/lite/micro/micro_interpreter.h"
+#include "tensorflow/lite/micro/micro_op_resolver.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+
+/**
+ * @brief Op resolver that lets the conv and fully connected kernels read LUT-compressed filters
+ *
+ * Returns the inner resolver's registrations, with CONV_2D, DEPTHWISE_CONV_2D,
+ * FULLY_CONNECTED and CONV_2D_MAXPOOL_2X2 wrapped: an op whose filter is
+ * compressed decodes it into an arena scratch buffer before each run.
+ * Models without compressed tensors run exactly as with the inner resolver.
+ *
+ * @note The model keeps TFLM's LUT compression format (value tables plus
+ * 1-7 bit packed indices). This esp-tflite-micro build has no
+ * USE_TFLM_COMPRESSION, and its ESP-NN kernels would not support it, so the
+ * decode happens in the wrapper instead of the kernels.
+ */
+class LutOpResolver : public tflite::MicroOpResolver {
+public:
+    explicit LutOpResolver(const tflite::MicroOpResolver& inner) : inner_(inner) {}
+
+    const TFLMRegistration* FindOp(tflite::BuiltinOperator op) const override;
+    const TFLMRegistration* FindOp(const char* op) const override;
+    tflite::TfLiteBridgeBuiltinParseFunction GetOpDataParser(tflite::BuiltinOperator op) const override;
+
+private:
+    const tflite::MicroOpResolver& inner_;
+};
+
+/**
+ * @brief AllocateTensors() for a model that may carry LUT-compressed weights
+ * @param model Model the interpreter was built from, with or without TFLM "COMPRESSION_METADATA"
+ * @param interpreter Interpreter built with a LutOpResolver
+ * @return kTfLiteOk on success, kTfLiteError when the metadata is invalid, a
+ *         compressed tensor feeds an op that cannot decode it, or allocation fails
+ *
+ * @note The decoded filters are arena scratch buffers, so arena_used_bytes()
+ * includes the largest one (overlapped with activations of other ops), and no
+ * memory outside the arena is used. Each Invoke() decodes every compressed filter once.
+ */
+TfLiteStatus lut_allocate_tensors(const tflite::Model* model, tflite::MicroInterpreter* interpreter);
+
+#endif // MODEL_COMPRESSION_H
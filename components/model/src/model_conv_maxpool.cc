@@ -0,0 +1,248 @@
+/**
+* @file model_conv_maxpool.cc
+* @brief Fused CONV_2D + 2x2 MAX_POOL_2D custom op
+*
+* Every block of the classifier is Conv2D(ReLU) -> MaxPooling2D(2x2). Run as
+* two ops, the conv writes its full resolution output to the arena and the
+* pool reads it back: 4x the pooled size in traffic, and that tensor sets
+* the peak of the activation arena. The graph rewrite in
+* tools/simplify_tflite_graph.py --fuse-conv-pool replaces each such pair
+* with this op, which pools every 2 conv rows as soon as they are computed
+* (esp_nn_conv_s8_maxpool2x2()). The intermediate tensor no longer exists.
+*
+* Quantization comes from the conv input, filter and the pooled output,
+* which TFLite gives the same scale and zero point as the conv output.
+*/
+
+#include "model_conv_maxpool.h"
+#include "tensorflow/lite/c/builtin_op_data.h"
+#include "tensorflow/lite/kernels/kernel_util.h"
+#include "tensorflow/lite/kernels/padding.h"
+#include "tensorflow/lite/micro/kernels/conv.h"
+#include "tensorflow/lite/micro/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/micro_log.h"
+#include <esp_nn.h>
+#include <cstring>
+
+namespace tflite {
+namespace {
+
+// Custom options: little-endian int32 values in this order
+enum : int {
+    OPTION_VERSION,
+    OPTION_PADDING,
+    OPTION_STRIDE_WIDTH,
+    OPTION_STRIDE_HEIGHT,
+    OPTION_ACTIVATION,
+    OPTION_COUNT,
+};
+
+// Schema Padding values
+enum : int32_t {
+    SCHEMA_PADDING_SAME = 0,
+    SCHEMA_PADDING_VALID = 1,
+};
+
+struct OpData {
+    OpDataConv conv;
+    TfLiteConvParams params;
+    bool options_valid;
+    int scratch_index;
+};
+
+/**
+* @brief Decodes the custom options written by simplify_tflite_graph.py
+* @return false when they are missing or from another version
+*/
+bool parse_options(const char* buffer, size_t length, TfLiteConvParams* params) {
+    int32_t options[OPTION_COUNT];
+    if (buffer == nullptr || length != sizeof(options)) {
+        return false;
+    }
+    memcpy(options, buffer, sizeof(options));
+    if (options[OPTION_VERSION] != CONV_MAXPOOL_OPTIONS_VERSION) {
+        return false;
+    }
+
+    switch (options[OPTION_PADDING]) {
+    case SCHEMA_PADDING_SAME:
+        params->padding = kTfLitePaddingSame;
+        break;
+    case SCHEMA_PADDING_VALID:
+        params->padding = kTfLitePaddingValid;
+        break;
+    default:
+        return false;
+    }
+    if (options[OPTION_STRIDE_WIDTH] < 1 || options[OPTION_STRIDE_HEIGHT] < 1) {
+        return false;
+    }
+    params->stride_width = options[OPTION_STRIDE_WIDTH];
+    params->stride_height = options[OPTION_STRIDE_HEIGHT];
+
+    // Schema NONE, RELU, RELU_N1_TO_1 and RELU6 have the TfLiteFusedActivation values
+    if (options[OPTION_ACTIVATION] < kTfLiteActNone || options[OPTION_ACTIVATION] > kTfLiteActRelu6) {
+        return false;
+    }
+    params->activation = static_cast<TfLiteFusedActivation>(options[OPTION_ACTIVATION]);
+    params->dilation_width_factor = 1;
+    params->dilation_height_factor = 1;
+    params->quantized_bias_type = kTfLiteNoType;
+    return true;
+}
+
+void* Init(TfLiteContext* context, const char* buffer, size_t length) {
+    TFLITE_DCHECK(context->AllocatePersistentBuffer != nullptr);
+    OpData* data = static_cast<OpData*>(context->AllocatePersistentBuffer(context, sizeof(OpData)));
+    if (data != nullptr) {
+        data->options_valid = parse_options(buffer, length, &data->params);
+        data->scratch_index = -1;
+    }
+    return data;
+}
+
+TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
+    TFLITE_DCHECK(node->user_data != nullptr);
+    OpData* data = static_cast<OpData*>(node->user_data);
+    TF_LITE_ENSURE_MSG(context, data->options_valid, "CONV_2D_MAXPOOL_2X2: unsupported custom options");
+
+    MicroContext* micro_context = GetMicroContext(context);
+    TfLiteTensor* input = micro_context->AllocateTempInputTensor(node, kConvInputTensor);
+    TF_LITE_ENSURE(context, input != nullptr);
+    TfLiteTensor* filter = micro_context->AllocateTempInputTensor(node, kConvWeightsTensor);
+    TF_LITE_ENSURE(context, filter != nullptr);
+    TfLiteTensor* output = micro_context->AllocateTempOutputTensor(node, kConvOutputTensor);
+    TF_LITE_ENSURE(context, output != nullptr);
+
+    TF_LITE_ENSURE_MSG(context,
+                       input->type == kTfLiteInt8 && filter->type == kTfLiteInt8 &&
+                       output->type == kTfLiteInt8,
+                       "CONV_2D_MAXPOOL_2X2 supports int8 tensors only");
+    TF_LITE_ENSURE_EQ(context, NumDimensions(input), 4);
+    TF_LITE_ENSURE_EQ(context, NumDimensions(filter), 4);
+    TF_LITE_ENSURE_EQ(context, NumDimensions(output), 4);
+    TF_LITE_ENSURE_EQ(context, filter->quantization.type, kTfLiteAffineQuantization);
+
+    const int input_width = input->dims->data[2];
+    const int input_height = input->dims->data[1];
+    const int input_channels = input->dims->data[3];
+    const int filter_width = filter->dims->data[2];
+    const int filter_height = filter->dims->data[1];
+    const int output_channels = filter->dims->data[kConvQuantizedDimension];
+    TF_LITE_ENSURE_EQ(context, filter->dims->data[3], input_channels);
+    TF_LITE_ENSURE_EQ(context, output->dims->data[3], output_channels);
+
+    // The pooled output covers the conv output with 2x2 VALID windows
+    const int conv_width = ComputeOutSize(data->params.padding, input_width, filter_width,
+                                          data->params.stride_width);
+    const int conv_height = ComputeOutSize(data->params.padding, input_height, filter_height,
+                                           data->params.stride_height);
+    TF_LITE_ENSURE_EQ(context, output->dims->data[2], conv_width / 2);
+    TF_LITE_ENSURE_EQ(context, output->dims->data[1], conv_height / 2);
+
+    data->conv.per_channel_output_multiplier = static_cast<int32_t*>(
+        context->AllocatePersistentBuffer(context, output_channels * sizeof(int32_t)));
+    data->conv.per_channel_output_shift = static_cast<int32_t*>(
+        context->AllocatePersistentBuffer(context, output_channels * sizeof(int32_t)));
+    TF_LITE_ENSURE(context, data->conv.per_channel_output_multiplier != nullptr &&
+                            data->conv.per_channel_output_shift != nullptr);
+
+    TF_LITE_ENSURE_STATUS(CalculateOpDataConv(context, node, data->params, input_width, input_height,
+                                              filter_width, filter_height, conv_width, conv_height,
+                                              kTfLiteInt8, &data->conv));
+
+    data_dims_t input_dims = {
+        .width = input_width, .height = input_height, .channels = input_channels, .extra = 1
+    };
+    data_dims_t output_dims = {
+        .width = output->dims->data[2], .height = output->dims->data[1],
+        .channels = output_channels, .extra = 1
+    };
+    data_dims_t filter_dims = {.width = filter_width, .height = filter_height, .channels = 0, .extra = 0};
+    conv_params_t conv_params = {
+        .in_offset = 0, .out_offset = 0,
+        .stride = {data->params.stride_width, data->params.stride_height},
+        .padding = {data->conv.padding.width, data->conv.padding.height},
+        .dilation = {0, 0}, .activation = {-128, 127}
+    };
+    const int scratch_size = esp_nn_get_conv_s8_maxpool2x2_scratch_size(&input_dims, &filter_dims,
+                                                                        &output_dims, &conv_params);
+    data->scratch_index = -1;
+    if (scratch_size > 0) {
+        TF_LITE_ENSURE_STATUS(context->RequestScratchBufferInArena(context, scratch_size,
+                                                                   &data->scratch_index));
+    }
+
+    micro_context->DeallocateTempTfLiteTensor(output);
+    micro_context->DeallocateTempTfLiteTensor(input);
+    micro_context->DeallocateTempTfLiteTensor(filter);
+    return kTfLiteOk;
+}
+
+TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
+    TFLITE_DCHECK(node->user_data != nullptr);
+    const OpData& data = *static_cast<const OpData*>(node->user_data);
+
+    const TfLiteEvalTensor* input = tflite::micro::GetEvalInput(context, node, kConvInputTensor);
+    const TfLiteEvalTensor* filter = tflite::micro::GetEvalInput(context, node, kConvWeightsTensor);
+    const TfLiteEvalTensor* bias = (NumInputs(node) == 3)
+        ? tflite::micro::GetEvalInput(context, node, kConvBiasTensor)
+        : nullptr;
+    TfLiteEvalTensor* output = tflite::micro::GetEvalOutput(context, node, kConvOutputTensor);
+
+    const RuntimeShape input_shape = tflite::micro::GetTensorShape(input);
+    const RuntimeShape filter_shape = tflite::micro::GetTensorShape(filter);
+    const RuntimeShape output_shape = tflite::micro::GetTensorShape(output);
+    const int batches = MatchingDim(input_shape, 0, output_shape, 0);
+
+    void* scratch = nullptr;
+    if (data.scratch_index > -1) {
+        scratch = context->GetScratchBuffer(context, data.scratch_index);
+    }
+    esp_nn_set_conv_s8_maxpool2x2_scratch_buf(scratch);
+
+    data_dims_t input_dims = {
+        .width = input_shape.Dims(2), .height = input_shape.Dims(1),
+        .channels = input_shape.Dims(3), .extra = 1
+    };
+    data_dims_t output_dims = {
+        .width = output_shape.Dims(2), .height = output_shape.Dims(1),
+        .channels = output_shape.Dims(3), .extra = 1
+    };
+    data_dims_t filter_dims = {
+        .width = filter_shape.Dims(2), .height = filter_shape.Dims(1), .channels = 0, .extra = 0
+    };
+    conv_params_t conv_params = {
+        .in_offset = -data.conv.input_zero_point, .out_offset = data.conv.output_zero_point,
+        .stride = {data.params.stride_width, data.params.stride_height},
+        .padding = {data.conv.padding.width, data.conv.padding.height},
+        .dilation = {0, 0},
+        .activation = {data.conv.output_activation_min, data.conv.output_activation_max}
+    };
+    quant_data_t quant_data = {
+        .shift = data.conv.per_channel_output_shift,
+        .mult = data.conv.per_channel_output_multiplier
+    };
+
+    const int8_t* input_data = tflite::micro::GetTensorData<int8_t>(input);
+    int8_t* output_data = tflite::micro::GetTensorData<int8_t>(output);
+    const int input_size = input_shape.FlatSize() / batches;
+    const int output_size = output_shape.FlatSize() / batches;
+    for (int batch = 0; batch < batches; batch++) {
+        esp_nn_conv_s8_maxpool2x2(&input_dims, input_data + batch * input_size,
+                                  &filter_dims, tflite::micro::GetTensorData<int8_t>(filter),
+                                  tflite::micro::GetOptionalTensorData<int32_t>(bias),
+                                  &output_dims, output_data + batch * output_size,
+                                  &conv_params, &quant_data);
+    }
+    return kTfLiteOk;
+}
+
+}  // namespace
+
+const TFLMRegistration* Register_CONV_2D_MAXPOOL_2X2() {
+    static TFLMRegistration registration = tflite::micro::RegisterOp(Init, Prepare, Eval);
+    return &registration;
+}
+
+}  // namespace tflite
@@ -0,0 +1,28 @@
+#pragma once
+
+#ifndef MODEL_CONV_MAXPOOL_H
+#define MODEL_CONV_MAXPOOL_H
+
+#include "tensorflow/lite/micro/micro_common.h"
+
+#define CONV_MAXPOOL_OPTIONS_VERSION 1   ///< First custom option, bumped when the layout changes
+
+namespace tflite {
+
+/**
+ * @brief Registration of the fused CONV_2D + MAX_POOL_2D(2x2, stride 2) custom op
+ * @return Registration to pass to MicroMutableOpResolver::AddCustom()
+ *
+ * @note tools/simplify_tflite_graph.py --fuse-conv-pool replaces each int8
+ * CONV_2D whose only consumer is a 2x2/2 VALID MAX_POOL_2D with this op.
+ * Inputs are the conv input, filter and bias; the output is the pooled
+ * tensor, so the full resolution activation is never allocated. The custom
+ * options are little-endian int32 values: [CONV_MAXPOOL_OPTIONS_VERSION,
+ * conv padding, stride width, stride height, fused activation], padding and
+ * activation as in the TFLite schema. Runs esp_nn_conv_s8_maxpool2x2().
+ */
+const TFLMRegistration* Register_CONV_2D_MAXPOOL_2X2();
+
+}  // namespace tflite
+
+#endif // MODEL_CONV_MAXPOOL_H
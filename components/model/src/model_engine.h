@@ -0,0 +1,36 @@
+#pragma once
+
+#ifndef MODEL_ENGINE_H
+#define MODEL_ENGINE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "model_predictor.h"
+#include "model_benchmark.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Times the TFLM classifier with one arena and weight placement
+ * @param placement Placement to measure, timings are filled in
+ * @param samples PCM window to classify (MODEL_INPUT_SIZE samples)
+ * @param iterations Timed inferences
+ * @return 0 on success, -1 if the placement could not be built or run
+ */
+int model_engine_measure_placement(model_placement_benchmark_t *placement, const int16_t *samples,
+                                   uint32_t iterations);
+
+/**
+ * @brief Compares TFLM initialization with and without the offline memory plan
+ * @param planning Output measurements
+ * @return 0 on success, -1 if the model has no plan or the comparison could not run
+ */
+int model_engine_measure_planning(model_planning_benchmark_t *planning);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MODEL_ENGINE_H
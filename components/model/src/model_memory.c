@@ -0,0 +1,112 @@
+/**
+ * @file model_memory.c
+ * @brief Memory placement policy of the model and audio buffers
+ *
+ * Maps the CONFIG_MODEL_*_MEMORY choices to heap capabilities. Boards
+ * without PSRAM never see the PSRAM choices in menuconfig, and a PSRAM
+ * build that finds no PSRAM at runtime falls back to internal SRAM.
+ */
+
+#include "model_memory.h"
+#include "esp_heap_caps.h"
+#include "esp_memory_utils.h"
+#include "esp_log.h"
+#include "sdkconfig.h"
+
+#define BUFFER_ALIGNMENT 16
+
+static const char *TAG = "model_memory";
+
+bool model_memory_psram_available(void) {
+    return heap_caps_get_total_size(MALLOC_CAP_SPIRAM) > 0;
+}
+
+/**
+ * @brief Configured memory of a region, before checking for PSRAM
+ */
+static model_memory_t configured_memory(model_region_t region) {
+    switch (region) {
+        case MODEL_REGION_ACTIVATIONS:
+#if CONFIG_MODEL_ACTIVATIONS_PSRAM
+            return MODEL_MEMORY_PSRAM;
+#else
+            return MODEL_MEMORY_INTERNAL;
+#endif
+        case MODEL_REGION_WEIGHTS:
+#if CONFIG_MODEL_WEIGHTS_PSRAM
+            return MODEL_MEMORY_PSRAM;
+#elif CONFIG_MODEL_WEIGHTS_INTERNAL
+            return MODEL_MEMORY_INTERNAL;
+#else
+            return MODEL_MEMORY_FLASH;
+#endif
+        case MODEL_REGION_AUDIO_HISTORY:
+#if CONFIG_MODEL_AUDIO_HISTORY_PSRAM
+            return MODEL_MEMORY_PSRAM;
+#else
+            return MODEL_MEMORY_INTERNAL;
+#endif
+    }
+    return MODEL_MEMORY_INTERNAL;
+}
+
+model_memory_t model_region_memory(model_region_t region) {
+    const model_memory_t memory = configured_memory(region);
+    if (memory == MODEL_MEMORY_PSRAM && !model_memory_psram_available()) {
+        return MODEL_MEMORY_INTERNAL;
+    }
+    return memory;
+}
+
+void *model_memory_alloc(model_memory_t memory, size_t size) {
+    switch (memory) {
+        case MODEL_MEMORY_INTERNAL:
+            return heap_caps_aligned_alloc(BUFFER_ALIGNMENT, size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+        case MODEL_MEMORY_PSRAM:
+            return heap_caps_aligned_alloc(BUFFER_ALIGNMENT, size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+        default:
+            return NULL;
+    }
+}
+
+model_memory_t model_region_ram(model_region_t region) {
+    const model_memory_t memory = model_region_memory(region);
+    if (memory == MODEL_MEMORY_FLASH) {
+        // Weights that cannot stay in flash (patched copies) go next to it behind the cache
+        return model_memory_psram_available() ? MODEL_MEMORY_PSRAM : MODEL_MEMORY_INTERNAL;
+    }
+    return memory;
+}
+
+void *model_region_alloc(model_region_t region, size_t size) {
+    const model_memory_t memory = model_region_ram(region);
+    void *buffer = model_memory_alloc(memory, size);
+    if (buffer == NULL && memory == MODEL_MEMORY_PSRAM && region != MODEL_REGION_ACTIVATIONS) {
+        ESP_LOGW(TAG, "PSRAM full, %u bytes of region %d go to internal SRAM", (unsigned)size, region);
+        buffer = model_memory_alloc(MODEL_MEMORY_INTERNAL, size);
+    }
+    return buffer;
+}
+
+void model_memory_free(void *buffer) {
+    heap_caps_free(buffer);
+}
+
+model_memory_t model_memory_of(const void *buffer) {
+    if (esp_ptr_external_ram(buffer)) {
+        return MODEL_MEMORY_PSRAM;
+    }
+    if (esp_ptr_internal(buffer)) {
+        return MODEL_MEMORY_INTERNAL;
+    }
+    return MODEL_MEMORY_FLASH;
+}
+
+const char *model_memory_name(model_memory_t memory) {
+    switch (memory) {
+        case MODEL_MEMORY_FLASH: return "flash";
+        case MODEL_MEMORY_INTERNAL: return "internal";
+        case MODEL_MEMORY_PSRAM: return "psram";
+    }
+    return "unknown";
+}
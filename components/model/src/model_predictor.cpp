@@ -1,148 +1,798 @@
 /**
-* @file model_inference.cpp
-* @brief TensorFlow Lite Micro implementation for audio classification
-* 
+* @file model_predictor.cpp
+* @brief Predictor API (model_predictor.h) on top of the TFLM backend
+*
 * This file contains the implementation for:
-* - Loading a pre-trained TFLite model
-* - Setting up the interpreter with required operations
-* - Running inference on input MFCC features
-* - Returning the predicted class
-*/
-
-#include "model.h"
-#include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
-#include "tensorflow/lite/micro/micro_interpreter.h"
-#include "tensorflow/lite/schema/schema_generated.h"
-#include "esp_heap_caps.h"  // For ESP32-specific memory allocation
-#include <cstdio>
-
-#define INPUT_SIZE 1024
-#define OUTPUT_SIZE 6
-#define TENSOR_ARENA_SIZE (60*1024)
-
-// Use ESP32's aligned memory allocation
-static uint8_t* tensor_arena = nullptr;
-static tflite::MicroInterpreter* interpreter = nullptr;
-static TfLiteTensor* input = nullptr;
-static TfLiteTensor* output = nullptr;
-
-extern "C" int predict_class(float* input_data) {
-    static bool initialized = false;
-
-    if (!initialized) {
-        // Allocate aligned memory using ESP32's memory manager
-        tensor_arena = (uint8_t*)heap_caps_aligned_alloc(16, TENSOR_ARENA_SIZE, MALLOC_CAP_8BIT);
-        if (tensor_arena == nullptr) {
-            printf("Failed to allocate tensor arena\n");
-            return -1;
+* - Loading the model through the TFLM backend (see model_backend.h) in model_init()
+* - Classifying normalized float, pre-quantized int8 and raw PCM windows
+* - Quantizing PCM windows straight to the int8 model input
+* - Returning the predicted class, all class scores and stage latencies
+* - Classifying batches of windows with a single interpreter setup
+* - Keeping the recurrent state of streaming models across a stream's windows
+* - Returning the unit-length embedding of a window for custom sound matching
+* - Reading the binary detection heads that share the classifier's Invoke()
+* - Running the shadow model on the active model's windows (CONFIG_MODEL_SHADOW_ENABLE)
+*/
+
+#include "model_predictor.h"
+#include "model_engine.h"
+#include "model_shadow.h"
+#include "model_backend.h"
+#include "model_metadata.h"
+#include "dsps_dotprod.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include <cmath>
+#include <cstring>
+
+#define INPUT_SIZE MODEL_INPUT_SIZE
+#define OUTPUT_SIZE MODEL_NUM_CLASSES
+
+static_assert(MODEL_EMBEDDING_ELEMENTS <= MODEL_EMBEDDING_MAX_SIZE, "The embedding exceeds MODEL_EMBEDDING_MAX_SIZE");
+
+static const char* TAG = "model_predictor";
+
+/**
+* @brief A backend plus the predictor state derived from its tensors
+*/
+typedef struct {
+    const model_backend_t* backend;
+    bool initialized;
+    model_backend_io_t io;
+    model_info_t info;
+    uint64_t input_inv_scale_q32;  ///< 1 / input scale in Q32, used by quantize_audio_window()
+    float output_lut[256];         ///< Dequantized value of every int8 output code, indexed by (uint8_t)code
+} model_engine_t;
+
+// Engine behind the predictor API
+static model_engine_t active_engine = { .backend = &tflm_backend };
+
+#if CONFIG_MODEL_SHADOW_ENABLE
+// Candidate model evaluated on live windows next to the active one
+static model_engine_t shadow_engine = { .backend = &shadow_backend };
+static int8_t shadow_input_map[256];   ///< Shadow input code of every active input code, indexed by (uint8_t)code
+static bool shadow_ready = false;
+#endif
+
+// Serializes interpreter use between the continuous pipeline and batch jobs (created by model_init())
+static StaticSemaphore_t interpreter_lock_buffer;
+static SemaphoreHandle_t interpreter_lock = nullptr;
+
+// Stream the recurrent state of a streaming model belongs to (0: none),
+// and the id of the next stream (both guarded by interpreter_lock)
+static uint32_t state_owner = 0;
+static uint32_t next_stream_id = 1;
+
+static const char* CLASS_NAMES[OUTPUT_SIZE] = MODEL_CLASS_NAMES;
+static const char* HEAD_NAMES[MODEL_MAX_HEADS] = MODEL_HEAD_NAMES;
+
+// Runtime head settings, read by every inference (guarded by interpreter_lock).
+// One per output head of the active model, set up when it loads
+static model_head_config_t head_configs[MODEL_MAX_HEADS];
+
+extern "C" const char* model_class_name(int class_index) {
+    if (class_index < 0 || class_index >= OUTPUT_SIZE) {
+        return "UNKNOWN";
+    }
+    return CLASS_NAMES[class_index];
+}
+
+extern "C" void normalize_audio_window(const int16_t* samples, float* output_data, size_t num_samples) {
+    if (num_samples == 0) {
+        return;
+    }
+
+    int16_t min_val = samples[0];
+    int16_t max_val = samples[0];
+    for (size_t i = 1; i < num_samples; ++i) {
+        if (samples[i] < min_val) min_val = samples[i];
+        if (samples[i] > max_val) max_val = samples[i];
+    }
+
+    float range = (float)(max_val - min_val);
+    if (range == 0) range = 1.0f;
+
+    for (size_t i = 0; i < num_samples; ++i) {
+        output_data[i] = ((float)(samples[i]) - min_val) / range;
+    }
+}
+
+/**
+* @brief Loads an engine's backend on first use and derives the quantization helpers
+* @param engine Engine to initialize
+* @return true when the engine is ready
+*
+* @note Caller holds interpreter_lock
+*/
+static bool initialize_engine(model_engine_t* engine) {
+    if (engine->initialized) {
+        return true;
+    }
+
+    engine->info.engine = engine->backend->name;
+    if (!engine->backend->init(&engine->io, &engine->info)) {
+        ESP_LOGE(TAG, "Failed to load the %s backend", engine->backend->name);
+        return false;
+    }
+
+    const model_backend_io_t* io = &engine->io;
+    if (!io->input_is_float && !io->input_is_int16) {
+        engine->input_inv_scale_q32 = (uint64_t)(4294967296.0 / io->input_quant.scale + 0.5);
+    }
+    if (!io->output_is_float) {
+        for (int code = -128; code <= 127; ++code) {
+            engine->output_lut[(uint8_t)code] = (code - io->output_quant.zero_point) * io->output_quant.scale;
         }
+    }
+
+    ESP_LOGI(TAG, "%s model ready in %lu us: %u bytes in flash, arena used: %u of %u bytes",
+             engine->backend->name, engine->info.load_us, (unsigned)engine->info.model_bytes,
+             (unsigned)engine->info.arena_used_bytes, (unsigned)engine->info.arena_bytes);
 
-        const tflite::Model* model = tflite::GetModel(mfcc_model_tflite);
-        if (model->version() != TFLITE_SCHEMA_VERSION) {
-            printf("Model schema mismatch\n");
-            heap_caps_free(tensor_arena);
-            return -1;
+    if (engine == &active_engine) {
+        for (size_t h = 0; h < io->head_count; ++h) {
+            head_configs[h] = { true, CONFIG_MODEL_HEAD_THRESHOLD / 100.0f };
         }
+    }
+
+    engine->initialized = true;
+    return true;
+}
 
-        static tflite::MicroMutableOpResolver<16> resolver;
-        resolver.AddConv2D();
-        resolver.AddMaxPool2D();
-        resolver.AddRelu();
-        resolver.AddFullyConnected();
-        resolver.AddReshape();
-        resolver.AddSoftmax();
-        resolver.AddQuantize();
-        resolver.AddDequantize();
-        resolver.AddExpandDims();
-        resolver.AddDepthwiseConv2D();
-        resolver.AddShape();
-        resolver.AddStridedSlice();
-        resolver.AddPack();
-
-        static tflite::MicroInterpreter static_interpreter(
-            model, resolver, tensor_arena, TENSOR_ARENA_SIZE);
-
-        interpreter = &static_interpreter;
-
-        if (interpreter->AllocateTensors() != kTfLiteOk) {
-            printf("Failed to allocate tensors\n");
-            heap_caps_free(tensor_arena);
-            return -1;
+/**
+* @brief Returns the active engine, loading it under the lock if needed
+* @return Engine, or nullptr if loading failed
+*/
+static model_engine_t* ready_engine(void) {
+    model_engine_t* engine = &active_engine;
+    if (!engine->initialized) {
+        xSemaphoreTake(interpreter_lock, portMAX_DELAY);
+        bool ready = initialize_engine(engine);
+        xSemaphoreGive(interpreter_lock);
+        if (!ready) {
+            return nullptr;
         }
+    }
+    return engine;
+}
 
-        input = interpreter->input(0);
-        output = interpreter->output(0);
+extern "C" esp_err_t model_init(void) {
+    if (interpreter_lock == nullptr) {
+        interpreter_lock = xSemaphoreCreateMutexStatic(&interpreter_lock_buffer);
+    }
+    return ready_engine() != nullptr ? ESP_OK : ESP_FAIL;
+}
 
-        printf("Input dimensions: ");
-        for (int i = 0; i < input->dims->size; ++i) {
-            printf("%d ", input->dims->data[i]);
+/**
+* @brief Min-max normalizes PCM samples into an engine's int8 input quantization
+* @param engine Initialized engine with an int8 input
+* @param samples Raw 16-bit PCM samples (at least one)
+* @param output_data Quantized output, either a caller buffer or the input tensor itself
+* @param num_samples Number of samples
+*/
+static void quantize_window(const model_engine_t* engine, const int16_t* samples, int8_t* output_data,
+                            size_t num_samples) {
+    int16_t min_val = samples[0];
+    int16_t max_val = samples[0];
+    for (size_t i = 1; i < num_samples; ++i) {
+        if (samples[i] < min_val) min_val = samples[i];
+        if (samples[i] > max_val) max_val = samples[i];
+    }
+
+    uint32_t range = (uint32_t)(max_val - min_val);
+    if (range == 0) range = 1;
+
+    // q = (sample - min) / range / scale + zero_point, with 1 / (range * scale) in Q32
+    const uint64_t multiplier = (engine->input_inv_scale_q32 + range / 2) / range;
+    const int32_t zero_point = engine->io.input_quant.zero_point;
+    for (size_t i = 0; i < num_samples; ++i) {
+        const uint64_t offset = (uint32_t)(samples[i] - min_val);
+        int32_t quantized = (int32_t)((offset * multiplier + (1ULL << 31)) >> 32) + zero_point;
+        quantized = quantized > 127 ? 127 : quantized;
+        output_data[i] = (int8_t)quantized;
+    }
+}
+
+extern "C" esp_err_t quantize_audio_window(const int16_t* samples, int8_t* output_data, size_t num_samples) {
+    if (num_samples == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    // The quantization parameters never change once the engine is loaded,
+    // so only the first call takes the lock
+    model_engine_t* engine = ready_engine();
+    if (engine == nullptr) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (engine->io.input_is_float || engine->io.input_is_int16) {
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+    quantize_window(engine, samples, output_data, num_samples);
+    return ESP_OK;
+}
+
+/**
+* @brief Orders the MODEL_TOP_K best classes by descending raw int8 output
+* @param result Result whose raw scores are already filled
+*
+* @note Dequantization is monotonic, so ranking the raw values gives the same
+* order as ranking the dequantized scores
+*/
+static void fill_top_k_int8(prediction_result_t* result) {
+    bool taken[OUTPUT_SIZE] = {false};
+    for (int k = 0; k < MODEL_TOP_K; ++k) {
+        int best = -1;
+        for (int i = 0; i < OUTPUT_SIZE; ++i) {
+            if (!taken[i] && (best < 0 || result->raw_scores[i] > result->raw_scores[best])) {
+                best = i;
+            }
         }
-        printf("\n");
+        taken[best] = true;
+        result->top_k[k] = best;
+    }
+}
 
-        initialized = true;
+/**
+* @brief Orders the MODEL_TOP_K best classes by descending score
+* @param result Result whose scores are already filled
+*/
+static void fill_top_k(prediction_result_t* result) {
+    bool taken[OUTPUT_SIZE] = {false};
+    for (int k = 0; k < MODEL_TOP_K; ++k) {
+        int best = -1;
+        for (int i = 0; i < OUTPUT_SIZE; ++i) {
+            if (!taken[i] && (best < 0 || result->scores[i] > result->scores[best])) {
+                best = i;
+            }
+        }
+        taken[best] = true;
+        result->top_k[k] = best;
     }
+}
 
-    // Input processing
-    if (input->type == kTfLiteInt8) {
-        float input_scale = input->params.scale;
-        int32_t input_zero_point = input->params.zero_point;
-        int8_t* input_buffer = input->data.int8;
+/**
+* @brief Logs the raw scores, at most once per CONFIG_MODEL_LOG_INTERVAL_MS
+* @param result Result to log
+*
+* @note Compiled out unless CONFIG_MODEL_LOG_RAW_OUTPUTS is set, since a
+* blocking UART printf costs milliseconds per inference
+*/
+static void log_raw_outputs(const prediction_result_t* result) {
+#if CONFIG_MODEL_LOG_RAW_OUTPUTS
+    static int64_t last_log_us = 0;
+    const int64_t now_us = esp_timer_get_time();
+    if (last_log_us != 0 && now_us - last_log_us < CONFIG_MODEL_LOG_INTERVAL_MS * 1000LL) {
+        return;
+    }
+    last_log_us = now_us;
 
-        for (int i = 0; i < INPUT_SIZE; ++i) {
-            int32_t quantized = static_cast<int32_t>(round(input_data[i] / input_scale) + input_zero_point);
-            quantized = quantized < -128 ? -128 : (quantized > 127 ? 127 : quantized);
-            input_buffer[i] = static_cast<int8_t>(quantized);
+    char line[OUTPUT_SIZE * 12];
+    size_t offset = 0;
+    for (int i = 0; i < OUTPUT_SIZE && offset < sizeof(line); ++i) {
+        offset += snprintf(line + offset, sizeof(line) - offset, "%.3f ", result->scores[i]);
+    }
+    ESP_LOGI(TAG, "Raw outputs: %s(invoke %lu us)", line, result->invoke_us);
+#else
+    (void)result;
+#endif
+}
+
+/**
+* @brief Quantizes a normalized float window into the input tensor
+* @param engine Initialized engine
+* @param input_data Normalized input window (INPUT_SIZE floats)
+*/
+static void load_float_input(model_engine_t* engine, const float* input_data) {
+    if (engine->io.input_is_float) {
+        memcpy(engine->io.input, input_data, INPUT_SIZE * sizeof(float));
+        return;
+    }
+
+    float input_scale = engine->io.input_quant.scale;
+    int32_t input_zero_point = engine->io.input_quant.zero_point;
+    int8_t* input_buffer = (int8_t*)engine->io.input;
+
+    for (int i = 0; i < INPUT_SIZE; ++i) {
+        int32_t quantized = static_cast<int32_t>(round(input_data[i] / input_scale) + input_zero_point);
+        quantized = quantized < -128 ? -128 : (quantized > 127 ? 127 : quantized);
+        input_buffer[i] = static_cast<int8_t>(quantized);
+    }
+}
+
+/**
+* @brief Copies an already quantized window into the input tensor
+* @param engine Initialized engine
+* @param input_data Quantized input window (INPUT_SIZE int8 values)
+* @return true on success
+*/
+static bool load_quantized_input(model_engine_t* engine, const int8_t* input_data) {
+    if (engine->io.input_is_float || engine->io.input_is_int16) {
+        ESP_LOGE(TAG, "Quantized input needs an int8 model");
+        return false;
+    }
+    memcpy(engine->io.input, input_data, INPUT_SIZE);
+    return true;
+}
+
+/**
+* @brief Writes a PCM window into the input tensor in one pass
+* @param engine Initialized engine
+* @param samples Raw 16-bit PCM window (INPUT_SIZE samples)
+*
+* @note int16 models normalize in the graph, so the window is copied as is.
+* Other models get the training-time min-max normalization written
+* straight into the tensor, without an intermediate window
+*/
+static void load_pcm_input(model_engine_t* engine, const int16_t* samples) {
+    if (engine->io.input_is_int16) {
+        memcpy(engine->io.input, samples, INPUT_SIZE * sizeof(int16_t));
+    } else if (engine->io.input_is_float) {
+        normalize_audio_window(samples, (float*)engine->io.input, INPUT_SIZE);
+    } else {
+        quantize_window(engine, samples, (int8_t*)engine->io.input, INPUT_SIZE);
+    }
+}
+
+/**
+* @brief Reads the detection heads of the last invoke()
+* @param engine Initialized engine
+* @param result Result whose heads are filled
+*
+* @note A head reports the probability of its event: the single sigmoid
+* element, or element 1 of a two-way softmax. Caller holds interpreter_lock
+*/
+static void read_heads(const model_engine_t* engine, prediction_result_t* result) {
+    memset(result->heads, 0, sizeof(result->heads));
+    for (size_t h = 0; h < engine->io.head_count; ++h) {
+        const model_head_config_t* config = &head_configs[h];
+        model_head_result_t* head_result = &result->heads[h];
+        head_result->enabled = config->enabled;
+        if (!config->enabled) {
+            continue;
         }
+
+        const model_backend_head_t* head = &engine->io.heads[h];
+        const size_t event = head->elements - 1;
+        head_result->score = head->is_float ? ((const float*)head->output)[event] :
+            (((const int8_t*)head->output)[event] - head->quant.zero_point) * head->quant.scale;
+        head_result->detected = head_result->score >= config->threshold;
     }
-    else if (input->type == kTfLiteFloat32) {
-        float* input_buffer = input->data.f;
-        for (int i = 0; i < INPUT_SIZE; ++i) {
-            input_buffer[i] = input_data[i];
+}
+
+/**
+* @brief Invokes the backend and reads the scores
+* @param engine Initialized engine
+* @param result Result to fill (never NULL)
+* @return Predicted class index, or -1 on failure
+*
+* @note int8 outputs are ranked as is and converted through output_lut, so
+* no float math runs per inference
+*/
+static int invoke_and_read_output(model_engine_t* engine, prediction_result_t* result) {
+    const int64_t stage_start_us = esp_timer_get_time();
+    if (!engine->backend->invoke()) {
+        ESP_LOGE(TAG, "Inference failed");
+        return -1;
+    }
+    result->invoke_us = (uint32_t)(esp_timer_get_time() - stage_start_us);
+    result->gated = false;
+
+    if (!engine->io.output_is_float) {
+        const int8_t* output_buffer = (const int8_t*)engine->io.output;
+        for (int i = 0; i < OUTPUT_SIZE; ++i) {
+            result->raw_scores[i] = output_buffer[i];
+            result->scores[i] = engine->output_lut[(uint8_t)output_buffer[i]];
         }
+        fill_top_k_int8(result);
     }
     else {
-        printf("Unsupported input type: %d\n", input->type);
+        memcpy(result->scores, engine->io.output, sizeof(result->scores));
+        memset(result->raw_scores, 0, sizeof(result->raw_scores));
+        fill_top_k(result);
+    }
+
+    read_heads(engine, result);
+    result->top_class = result->top_k[0];
+    log_raw_outputs(result);
+    return result->top_class;
+}
+
+/**
+* @brief Quantizes one float window, invokes the backend and reads the scores
+* @param engine Initialized engine
+* @param input_data Normalized input window (INPUT_SIZE floats)
+* @param result Result to fill (never NULL)
+* @return Predicted class index, or -1 on failure
+*
+* @note Caller holds interpreter_lock
+*/
+static int run_inference(model_engine_t* engine, const float* input_data, prediction_result_t* result) {
+    result->top_class = -1;
+    if (engine->io.input_is_int16) {
+        ESP_LOGE(TAG, "The model takes raw PCM, normalized windows cannot be classified");
         return -1;
     }
 
-    // Run inference
-    if (interpreter->Invoke() != kTfLiteOk) {
-        printf("Inference failed\n");
+    const int64_t stage_start_us = esp_timer_get_time();
+    load_float_input(engine, input_data);
+    result->quantize_us = (uint32_t)(esp_timer_get_time() - stage_start_us);
+    return invoke_and_read_output(engine, result);
+}
+
+/**
+* @brief Runs inference on one quantized window
+* @param engine Initialized engine
+* @param input_data Quantized input window (INPUT_SIZE int8 values)
+* @param result Result to fill (never NULL)
+* @return Predicted class index, or -1 on failure
+*
+* @note Caller holds interpreter_lock
+*/
+static int run_quantized_inference(model_engine_t* engine, const int8_t* input_data, prediction_result_t* result) {
+    result->top_class = -1;
+
+    const int64_t stage_start_us = esp_timer_get_time();
+    if (!load_quantized_input(engine, input_data)) {
         return -1;
     }
+    result->quantize_us = (uint32_t)(esp_timer_get_time() - stage_start_us);
+    return invoke_and_read_output(engine, result);
+}
 
-    // Process output
-    if (output->type == kTfLiteInt8) {
-        int8_t* output_buffer = output->data.int8;
-        float output_scale = output->params.scale;
-        int32_t output_zero_point = output->params.zero_point;
+/**
+* @brief Runs inference on one PCM window
+* @param engine Initialized engine
+* @param samples Raw 16-bit PCM window (INPUT_SIZE samples)
+* @param result Result to fill (never NULL)
+* @return Predicted class index, or -1 on failure
+*
+* @note Caller holds interpreter_lock
+*/
+static int run_pcm_inference(model_engine_t* engine, const int16_t* samples, prediction_result_t* result) {
+    result->top_class = -1;
 
-        printf("Raw outputs: ");
-        int max_index = 0;
-        float max_value = (output_buffer[0] - output_zero_point) * output_scale;
-        
-        for (int i = 0; i < OUTPUT_SIZE; ++i) {
-            float value = (output_buffer[i] - output_zero_point) * output_scale;
-            printf("%f ", value);
-            if (value > max_value) {
-                max_value = value;
-                max_index = i;
-            }
+    const int64_t stage_start_us = esp_timer_get_time();
+    load_pcm_input(engine, samples);
+    result->quantize_us = (uint32_t)(esp_timer_get_time() - stage_start_us);
+    return invoke_and_read_output(engine, result);
+}
+
+/**
+* @brief Clears a streaming model's state unless the window continues its stream
+* @param engine Initialized engine
+* @param stream Stream of the window, nullptr for an independent window
+* @param continues Whether the window directly follows the stream's previous one
+* @return false if the state could not be cleared
+*
+* @note Caller holds interpreter_lock
+*/
+static bool prepare_state(model_engine_t* engine, model_stream_t* stream, bool continues) {
+    if (!engine->io.stateful) {
+        return true;
+    }
+    if (stream != nullptr && continues && state_owner == stream->id) {
+        return true;
+    }
+
+    if (!engine->backend->reset_state()) {
+        ESP_LOGE(TAG, "Failed to reset the model state");
+        return false;
+    }
+    state_owner = stream != nullptr ? stream->id : 0;
+    if (stream != nullptr && stream->last_window_id != 0) {
+        stream->resets++;
+    }
+    return true;
+}
+
+extern "C" int predict_class(const float* input_data, prediction_result_t* result) {
+    prediction_result_t local_result;
+    if (result == nullptr) {
+        memset(&local_result, 0, sizeof(local_result));
+        result = &local_result;
+    }
+    result->top_class = -1;
+
+    model_engine_t* engine = &active_engine;
+    xSemaphoreTake(interpreter_lock, portMAX_DELAY);
+    int predicted_class = initialize_engine(engine) && prepare_state(engine, nullptr, false) ?
+                          run_inference(engine, input_data, result) : -1;
+    xSemaphoreGive(interpreter_lock);
+    return predicted_class;
+}
+
+extern "C" int predict_class_quantized(const int8_t* input_data, prediction_result_t* result) {
+    prediction_result_t local_result;
+    if (result == nullptr) {
+        memset(&local_result, 0, sizeof(local_result));
+        result = &local_result;
+    }
+    result->top_class = -1;
+
+    model_engine_t* engine = &active_engine;
+    xSemaphoreTake(interpreter_lock, portMAX_DELAY);
+    int predicted_class = initialize_engine(engine) && prepare_state(engine, nullptr, false) ?
+                          run_quantized_inference(engine, input_data, result) : -1;
+    xSemaphoreGive(interpreter_lock);
+    return predicted_class;
+}
+
+extern "C" void model_stream_init(model_stream_t* stream) {
+    xSemaphoreTake(interpreter_lock, portMAX_DELAY);
+    stream->id = next_stream_id++;
+    if (next_stream_id == 0) {
+        next_stream_id = 1;
+    }
+    xSemaphoreGive(interpreter_lock);
+    stream->last_window_id = 0;
+    stream->resets = 0;
+}
+
+/**
+* @brief Converts the embedding of the last invoke() to a unit-length float vector
+* @param engine Initialized engine with an embedding output
+* @param embedding Output of engine->io.embedding_elements floats
+*
+* @note Cosine similarity ignores the quantization scale, so only the zero
+* point is removed. Caller holds interpreter_lock
+*/
+static void read_embedding(const model_engine_t* engine, float* embedding) {
+    const size_t elements = engine->io.embedding_elements;
+    for (size_t i = 0; i < elements; ++i) {
+        embedding[i] = (float)(engine->io.embedding[i] - engine->io.embedding_zero_point);
+    }
+
+    float squared_norm = 0.0f;
+    dsps_dotprod_f32(embedding, embedding, &squared_norm, elements);
+    if (squared_norm > 0.0f) {
+        const float inverse_norm = 1.0f / sqrtf(squared_norm);
+        for (size_t i = 0; i < elements; ++i) {
+            embedding[i] *= inverse_norm;
         }
-        printf("\n");
-        return max_index;
-    }
-    else if (output->type == kTfLiteFloat32) {
-        float* output_buffer = output->data.f;
-        int max_index = 0;
-        for (int i = 1; i < OUTPUT_SIZE; ++i) {
-            if (output_buffer[i] > output_buffer[max_index]) {
-                max_index = i;
-            }
+    }
+}
+
+/**
+* @brief Classifies one window of a stream with the active model
+* @param stream Stream of the window, nullptr for an independent window
+* @param window_id Sequence number of the window (ignored without a stream)
+* @param input_data Quantized window, used when samples is nullptr
+* @param samples PCM window, or nullptr
+* @param result Result to fill (may be nullptr)
+* @param embedding Embedding output, or nullptr
+* @return Predicted class index, or -1 on failure
+*/
+static int predict_window(model_stream_t* stream, uint32_t window_id, const int8_t* input_data,
+                          const int16_t* samples, prediction_result_t* result, float* embedding) {
+    prediction_result_t local_result;
+    if (result == nullptr) {
+        memset(&local_result, 0, sizeof(local_result));
+        result = &local_result;
+    }
+    result->top_class = -1;
+
+    const bool continues = stream != nullptr && stream->last_window_id != 0 &&
+                           window_id == stream->last_window_id + 1;
+    model_engine_t* engine = &active_engine;
+    xSemaphoreTake(interpreter_lock, portMAX_DELAY);
+    int predicted_class = -1;
+    if (initialize_engine(engine) && prepare_state(engine, stream, continues)) {
+        predicted_class = samples != nullptr ? run_pcm_inference(engine, samples, result) :
+                                               run_quantized_inference(engine, input_data, result);
+    }
+    if (predicted_class >= 0 && embedding != nullptr && engine->io.embedding != nullptr) {
+        read_embedding(engine, embedding);
+    }
+    if (stream != nullptr) {
+        stream->last_window_id = window_id;
+    }
+    xSemaphoreGive(interpreter_lock);
+    return predicted_class;
+}
+
+extern "C" int predict_stream_embedding(model_stream_t* stream, uint32_t window_id, const int8_t* input_data,
+                                        prediction_result_t* result, float* embedding) {
+    return predict_window(stream, window_id, input_data, nullptr, result, embedding);
+}
+
+extern "C" int predict_pcm(model_stream_t* stream, uint32_t window_id, const int16_t* samples,
+                           prediction_result_t* result, float* embedding) {
+    return predict_window(stream, window_id, nullptr, samples, result, embedding);
+}
+
+extern "C" int predict_stream(model_stream_t* stream, uint32_t window_id, const int8_t* input_data,
+                              prediction_result_t* result) {
+    return predict_stream_embedding(stream, window_id, input_data, result, nullptr);
+}
+
+extern "C" size_t model_embedding_size(void) {
+    model_engine_t* engine = ready_engine();
+    return engine != nullptr && engine->io.embedding != nullptr ? engine->io.embedding_elements : 0;
+}
+
+extern "C" int model_head_count(void) {
+    model_engine_t* engine = ready_engine();
+    return engine != nullptr ? (int)engine->io.head_count : 0;
+}
+
+extern "C" const char* model_head_name(int head) {
+    if (head < 0 || head >= model_head_count()) {
+        return "unknown";
+    }
+    return HEAD_NAMES[head];
+}
+
+extern "C" int model_head_find(const char* name) {
+    for (int h = 0; h < model_head_count(); ++h) {
+        if (strcmp(HEAD_NAMES[h], name) == 0) {
+            return h;
         }
-        return max_index;
     }
+    return -1;
+}
+
+extern "C" int model_head_get_config(int head, model_head_config_t* config) {
+    if (head < 0 || head >= model_head_count()) {
+        return -1;
+    }
+    xSemaphoreTake(interpreter_lock, portMAX_DELAY);
+    *config = head_configs[head];
+    xSemaphoreGive(interpreter_lock);
+    return 0;
+}
+
+extern "C" int model_head_set_config(int head, const model_head_config_t* config) {
+    if (head < 0 || head >= model_head_count() || !(config->threshold >= 0.0f && config->threshold <= 1.0f)) {
+        return -1;
+    }
+    xSemaphoreTake(interpreter_lock, portMAX_DELAY);
+    head_configs[head] = *config;
+    xSemaphoreGive(interpreter_lock);
+    ESP_LOGI(TAG, "Head %s %s, threshold %.2f", HEAD_NAMES[head], config->enabled ? "enabled" : "disabled",
+             config->threshold);
+    return 0;
+}
+
+extern "C" bool model_takes_pcm(void) {
+    model_engine_t* engine = ready_engine();
+    return engine != nullptr && engine->io.input_is_int16;
+}
+
+extern "C" bool model_is_stateful(void) {
+    model_engine_t* engine = ready_engine();
+    return engine != nullptr && engine->io.stateful;
+}
+
+extern "C" int model_reset_state(void) {
+    model_engine_t* engine = &active_engine;
+    xSemaphoreTake(interpreter_lock, portMAX_DELAY);
+    bool reset = initialize_engine(engine) && prepare_state(engine, nullptr, false);
+    xSemaphoreGive(interpreter_lock);
+    return reset ? 0 : -1;
+}
+
+extern "C" int model_engine_measure_placement(model_placement_benchmark_t* placement, const int16_t* samples,
+                                              uint32_t iterations) {
+    xSemaphoreTake(interpreter_lock, portMAX_DELAY);
+    bool measured = tflm_measure_placement(placement, samples, iterations);
+    xSemaphoreGive(interpreter_lock);
+    return measured ? 0 : -1;
+}
+
+extern "C" int model_engine_measure_planning(model_planning_benchmark_t* planning) {
+    xSemaphoreTake(interpreter_lock, portMAX_DELAY);
+    bool measured = tflm_measure_planning(planning);
+    xSemaphoreGive(interpreter_lock);
+    return measured ? 0 : -1;
+}
+
+#if CONFIG_MODEL_SHADOW_ENABLE
+/**
+* @brief Loads both models and maps the active input codes to the shadow's
+* @return true when the shadow model can run
+*
+* @note Caller holds interpreter_lock
+*/
+static bool initialize_shadow(void) {
+    if (shadow_ready) {
+        return true;
+    }
+    if (!initialize_engine(&active_engine) || !initialize_engine(&shadow_engine)) {
+        return false;
+    }
+
+    const model_backend_io_t* active = &active_engine.io;
+    const model_backend_io_t* shadow = &shadow_engine.io;
+    if (active->input_is_float || shadow->input_is_float || active->input_is_int16) {
+        ESP_LOGE(TAG, "The shadow model needs int8 inputs on both models");
+        return false;
+    }
+
+    // Identity when both models were trained with the same input quantization
+    for (int code = -128; code <= 127; ++code) {
+        const float value = (code - active->input_quant.zero_point) * active->input_quant.scale;
+        int32_t quantized = (int32_t)lroundf(value / shadow->input_quant.scale) + shadow->input_quant.zero_point;
+        quantized = quantized < -128 ? -128 : (quantized > 127 ? 127 : quantized);
+        shadow_input_map[(uint8_t)code] = (int8_t)quantized;
+    }
+    shadow_ready = true;
+    return true;
+}
+#endif
+
+extern "C" int model_shadow_get_info(model_info_t* info) {
+#if CONFIG_MODEL_SHADOW_ENABLE
+    xSemaphoreTake(interpreter_lock, portMAX_DELAY);
+    bool ready = initialize_shadow();
+    xSemaphoreGive(interpreter_lock);
+    if (!ready) {
+        return -1;
+    }
+    *info = shadow_engine.info;
+    return 0;
+#else
+    (void)info;
+    return -1;
+#endif
+}
 
-    printf("Unsupported output type\n");
+extern "C" int model_shadow_predict(const int8_t* input_data, prediction_result_t* result) {
+    result->top_class = -1;
+#if CONFIG_MODEL_SHADOW_ENABLE
+    int predicted_class = -1;
+    xSemaphoreTake(interpreter_lock, portMAX_DELAY);
+    if (initialize_shadow()) {
+        const int64_t stage_start_us = esp_timer_get_time();
+        int8_t* input_buffer = (int8_t*)shadow_engine.io.input;
+        for (int i = 0; i < INPUT_SIZE; ++i) {
+            input_buffer[i] = shadow_input_map[(uint8_t)input_data[i]];
+        }
+        result->quantize_us = (uint32_t)(esp_timer_get_time() - stage_start_us);
+        predicted_class = invoke_and_read_output(&shadow_engine, result);
+    }
+    xSemaphoreGive(interpreter_lock);
+    return predicted_class;
+#else
+    (void)input_data;
     return -1;
-}
\ No newline at end of file
+#endif
+}
+
+extern "C" int model_get_info(model_info_t* info) {
+    model_engine_t* engine = ready_engine();
+    if (engine == nullptr) {
+        return -1;
+    }
+    *info = engine->info;
+    return 0;
+}
+
+extern "C" int predict_batch(model_stream_t* stream, const int8_t* windows, size_t num_windows,
+                             prediction_result_t* results) {
+    if (windows == nullptr || results == nullptr) {
+        return -1;
+    }
+
+    model_engine_t* engine = &active_engine;
+    xSemaphoreTake(interpreter_lock, portMAX_DELAY);
+    if (!initialize_engine(engine)) {
+        xSemaphoreGive(interpreter_lock);
+        return -1;
+    }
+
+    int classified = 0;
+    for (size_t i = 0; i < num_windows; ++i) {
+        if (!prepare_state(engine, stream, stream != nullptr) ||
+            run_quantized_inference(engine, windows + i * INPUT_SIZE, &results[i]) < 0) {
+            break;
+        }
+        if (stream != nullptr) {
+            stream->last_window_id++;
+        }
+        classified++;
+    }
+    xSemaphoreGive(interpreter_lock);
+    return classified;
+}
@@ -61,10 +61,14 @@ void apply_mel_filterbank(float* power_spectrum, float* mel_fb, float* mel_energ
 void mount_sdcard(void);
 void record_wav(uint32_t rec_time, const char* category_name);
 void init_microphone(void);
+void record_category(const char* category_name);
 void start_recording(const char* category_name);
 void unmount_sdcard(void);
 esp_err_t collect_audio_samples(int16_t *audio_buffer);
+esp_err_t collect_audio_frames(int16_t *audio_buffer, size_t num_samples);
 void get_audio_samples(int16_t* input_data);
+void init_mfcc(void);
 void extract_mfcc_features(int16_t* audio_samples, float* mfcc_output);
+void deinit_mfcc(void);
 // Add this to your header file
 void deinit_microphone(void);
\ No newline at end of file
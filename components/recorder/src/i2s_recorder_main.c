@@ -324,31 +324,45 @@ void record_wav(uint32_t rec_time, const char* category_name) {
 static float *hamming_window = NULL;
 static float *mel_filterbank = NULL;
 static float *dct_matrix = NULL;
+static float *fft_buffer = NULL;
 #else
 static float hamming_window[FRAME_LENGTH] = {0};
 static float mel_filterbank[N_MELS][N_FFT/2 + 1] = {0};
 static float dct_matrix[N_MFCC][N_MELS] = {0};
+// N_FFT real samples in, N_FFT/2 + 1 complex bins out
+__attribute__((aligned(16)))
+static float fft_buffer[N_FFT + 2];
 #endif
 
+// Real FFT tables, built once by init_mfcc()
+static rfft_plan_f32_t mfcc_rfft;
+
 // Convert Hz to Mel scale
 static float hz_to_mel(float hz) {
     return 2595.0f * log10f(1.0f + hz / 700.0f);
 }
 
 // Initialize MFCC processing (call once at startup)
-void init_mfcc() {
+void init_mfcc(void) {
     // Initialize memory for large buffers
     #if CONFIG_SPIRAM_USE_MALLOC
     hamming_window = (float*)heap_caps_malloc(FRAME_LENGTH * sizeof(float), MALLOC_CAP_SPIRAM);
     mel_filterbank = (float*)heap_caps_malloc(N_MELS * (N_FFT/2 + 1) * sizeof(float), MALLOC_CAP_SPIRAM);
     dct_matrix = (float*)heap_caps_malloc(N_MFCC * N_MELS * sizeof(float), MALLOC_CAP_SPIRAM);
+    fft_buffer = (float*)heap_caps_aligned_alloc(16, (N_FFT + 2) * sizeof(float), MALLOC_CAP_SPIRAM);
     
-    if (!hamming_window || !mel_filterbank || !dct_matrix) {
+    if (!hamming_window || !mel_filterbank || !dct_matrix || !fft_buffer) {
         ESP_LOGE(TAG, "Failed to allocate MFCC buffers in PSRAM");
         return;
     }
     #endif
 
+    esp_err_t ret = dsps_rfft_init_f32(&mfcc_rfft, N_FFT);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to initialize the %d point real FFT: 0x%x", N_FFT, ret);
+        return;
+    }
+
     // Initialize Hamming window
     for (int i = 0; i < FRAME_LENGTH; i++) {
         hamming_window[i] = 0.54f - 0.46f * cosf(2 * M_PI * i / (FRAME_LENGTH - 1));
@@ -394,12 +408,14 @@ void init_mfcc() {
 
 // Extract MFCC features from audio samples
 void extract_mfcc_features(int16_t* audio_samples, float* mfcc_output) {
-    float frame[FRAME_LENGTH];
-    float fft_buffer[N_FFT] = {0};
-    float power_spectrum[N_FFT/2 + 1];
     float mel_energies[N_MELS];
     float mfcc_frame[N_MFCC];
     
+    if (mfcc_rfft.N == 0) {
+        ESP_LOGE(TAG, "init_mfcc() must be called before extracting MFCC features");
+        return;
+    }
+
     int num_frames = (1024 - FRAME_LENGTH) / FRAME_SHIFT + 1;
     if (num_frames > 1024) num_frames = 1024; // Safety check
     
@@ -415,22 +431,21 @@ void extract_mfcc_features(int16_t* audio_samples, float* mfcc_output) {
     for (int frame_idx = 0; frame_idx < num_frames; frame_idx++) {
         int offset = frame_idx * FRAME_SHIFT;
         
-        // Apply Hamming window
+        // Apply Hamming window, zero-padded to N_FFT real samples
         for (int i = 0; i < FRAME_LENGTH; i++) {
             if (offset + i < 1024) {
-                frame[i] = (audio_samples[offset + i] / 32768.0f) * hamming_window[i];
+                fft_buffer[i] = (audio_samples[offset + i] / 32768.0f) * hamming_window[i];
             } else {
-                frame[i] = 0; // Zero-pad if needed
+                fft_buffer[i] = 0; // Zero-pad if needed
             }
         }
+        memset(fft_buffer + FRAME_LENGTH, 0, (N_FFT - FRAME_LENGTH) * sizeof(float));
 
-        // Compute FFT
-        memcpy(fft_buffer, frame, FRAME_LENGTH * sizeof(float));
-        dsps_fft2r_init_fc32(NULL, N_FFT);
-        dsps_fft2r_fc32(fft_buffer, N_FFT);
-        dsps_bit_rev2r_fc32(fft_buffer, N_FFT);
+        // Compute the N_FFT/2 + 1 bins of the real frame in place
+        dsps_rfft_f32(&mfcc_rfft, fft_buffer, fft_buffer);
         
-        // Compute power spectrum
+        // Compute power spectrum in place: bin i only overwrites values already read
+        float *power_spectrum = fft_buffer;
         for (int i = 0; i < N_FFT/2 + 1; i++) {
             float real = fft_buffer[i*2];
             float imag = fft_buffer[i*2 + 1];
@@ -469,12 +484,14 @@ void extract_mfcc_features(int16_t* audio_samples, float* mfcc_output) {
 
 
 // Don't forget to free allocated memory when done
-void deinit_mfcc() {
+void deinit_mfcc(void) {
     #if CONFIG_SPIRAM_USE_MALLOC
     if (hamming_window) heap_caps_free(hamming_window);
     if (mel_filterbank) heap_caps_free(mel_filterbank);
     if (dct_matrix) heap_caps_free(dct_matrix);
+    if (fft_buffer) heap_caps_free(fft_buffer);
     #endif
+    dsps_rfft_deinit_f32(&mfcc_rfft);
 }
 
 
@@ -559,17 +576,18 @@ void get_audio_samples(int16_t* input_data)
 }
 
 /**
- * @brief Collects 1024 audio samples from I2S microphone
- * @param audio_buffer Output buffer for 16-bit PCM samples (must be 1024 elements)
+ * @brief Collects an arbitrary number of audio samples from I2S microphone
+ * @param audio_buffer Output buffer for 16-bit PCM samples
+ * @param num_samples Number of samples to read into audio_buffer
  * @return ESP_OK on success, error code on failure
  * 
  * @note This function:
- * - Requires initialized I2S microphone
- * - Blocks for ~64ms (at 16kHz sampling rate)
+ * - Initializes the I2S microphone on first use
+ * - Blocks until num_samples have been captured
  * - Automatically retries once on read failure
  */
-esp_err_t collect_audio_samples(int16_t *audio_buffer) {
-    if (audio_buffer == NULL) {
+esp_err_t collect_audio_frames(int16_t *audio_buffer, size_t num_samples) {
+    if (audio_buffer == NULL || num_samples == 0) {
         ESP_LOGE(TAG, "Invalid audio buffer");
         return ESP_ERR_INVALID_ARG;
     }
@@ -590,11 +608,11 @@ esp_err_t collect_audio_samples(int16_t *audio_buffer) {
     for (int attempt = 0; attempt < 2; attempt++) {
         ret = i2s_channel_read(rx_handle, 
                               (char *)audio_buffer, 
-                              1024 * sizeof(int16_t),
+                              num_samples * sizeof(int16_t),
                               &bytes_read, 
                               1000 / portTICK_PERIOD_MS);
         
-        if (ret == ESP_OK && bytes_read == 1024 * sizeof(int16_t)) {
+        if (ret == ESP_OK && bytes_read == num_samples * sizeof(int16_t)) {
             return ESP_OK;
         }
         
@@ -602,21 +620,37 @@ esp_err_t collect_audio_samples(int16_t *audio_buffer) {
                 attempt, esp_err_to_name(ret), bytes_read);
     }
 
-    ESP_LOGE(TAG, "Failed to collect 1024 samples");
+    ESP_LOGE(TAG, "Failed to collect %u samples", (unsigned)num_samples);
     return ESP_FAIL;
 }
 
 /**
-* @brief Main recording task
+ * @brief Collects 1024 audio samples from I2S microphone
+ * @param audio_buffer Output buffer for 16-bit PCM samples (must be 1024 elements)
+ * @return ESP_OK on success, error code on failure
+ * 
+ * @note This function:
+ * - Requires initialized I2S microphone
+ * - Blocks for ~64ms (at 16kHz sampling rate)
+ * - Automatically retries once on read failure
+ */
+esp_err_t collect_audio_samples(int16_t *audio_buffer) {
+    return collect_audio_frames(audio_buffer, 1024);
+}
+
+/**
+* @brief Records one WAV file and releases the microphone
 * @param category_name Audio category name for storage
 * 
 * Workflow:
 * 1. Initializes microphone
 * 2. Records audio to SD card
 * 3. Cleans up resources
-* 4. Deletes task when complete
+*
+* @note Blocks for CONFIG_EXAMPLE_REC_TIME seconds and returns once the
+* file is closed, so the caller knows when the microphone is free again.
 */
-void start_recording(const char* category_name) {
+void record_category(const char* category_name) {
     ESP_LOGI(TAG, "Starting recording for: %s", category_name);
     
     // Initialize hardware
@@ -629,7 +663,16 @@ void start_recording(const char* category_name) {
         i2s_del_channel(rx_handle);
         rx_handle = NULL;
     }
+}
 
+/**
+* @brief Main recording task
+* @param category_name Audio category name for storage (heap copy, freed here)
+* 
+* Runs record_category() and deletes the task when complete
+*/
+void start_recording(const char* category_name) {
+    record_category(category_name);
     free((void*)category_name);
     vTaskDelete(NULL);
 }
\ No newline at end of file
@@ -19,6 +19,8 @@
 #include "i2s_recorder_main.h"
 #include "file_server.h"
 #include "model_predictor.h"
+#include "inference_scheduler.h"
+#include "inference_service.h"
 #include "soft_access_point.h"
 #include <stdio.h>
 #include <string.h>
@@ -55,6 +57,7 @@ static const char *TAG = "main_function";  ///< Logging tag for main application
 * 3. WiFi Access Point - Creates the soft AP for client connections
 * 4. Storage system - Mounts the SD card/filesystem
 * 5. HTTP File Server - Starts the web server for file management
+* 6. Continuous inference - Classifies the microphone stream in the background
 * 
 * The initialization sequence is critical - components must be started
 * in the correct order to ensure proper operation.
@@ -108,7 +111,18 @@ void app_main(void)
     ESP_ERROR_CHECK(mount_storage(base_path));
     
     /**************************************************************************
-    * Step 5: Start HTTP File Server
+    * Step 5: Load the Classifier
+    *
+    * Creates the interpreter lock and loads the model before anything that
+    * classifies (HTTP handlers, continuous inference) can run. The file
+    * server still starts without a model; predictions then fail.
+    *************************************************************************/
+    if (model_init() != ESP_OK) {
+        ESP_LOGE(TAG, "Model failed to load, classification is unavailable");
+    }
+
+    /**************************************************************************
+    * Step 6: Start HTTP File Server
     * 
     * Launches the web server with the following capabilities:
     * - File upload/download
@@ -121,6 +135,19 @@ void app_main(void)
     ESP_ERROR_CHECK(start_file_server(base_path));
     ESP_LOGI(TAG, "File server started at http://192.168.4.1");
 
+    /**************************************************************************
+    * Step 7: Start Continuous Inference
+    * 
+    * Classifies overlapping microphone windows in the background and keeps
+    * a smoothed current-state result that /predict serves directly.
+    * Configured in the "Sound Classification Inference" menu.
+    *************************************************************************/
+#if CONFIG_INFERENCE_SCHEDULER_ENABLE
+    ESP_ERROR_CHECK(inference_scheduler_start());
+#endif
+    // Serves /predict whenever the scheduler is not running
+    ESP_ERROR_CHECK(inference_service_start());
+
     /**************************************************************************
     * Optional: Model Prediction Example (commented out)
     * 
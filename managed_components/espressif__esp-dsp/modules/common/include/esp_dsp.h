@@ -42,6 +42,7 @@ extern "C"
 
 #include "dsps_fft2r.h"
 #include "dsps_fft4r.h"
+#include "dsps_rfft.h"
 #include "dsps_dct.h"
 
 // Matrix operations
@@ -0,0 +1,187 @@
+// Copyright 2018-2024 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Fixed point version of dsps_rfft_f32.c, see there for the split formulas.
+// dsps_fft2r_sc16 halves the data on every stage, so the complex result is
+// Z/M and the split adds the last 1/2: the bins are X/N. The inverse feeds
+// the same kernel, which turns its result into x/N.
+
+#include "dsps_rfft.h"
+#include "dsp_common.h"
+#include "dsp_types.h"
+#include <math.h>
+#include <string.h>
+#include <malloc.h>
+
+// (a*2^15 + t + round) >> shift, t being a sum of Q15 products
+static inline int16_t dsps_rfft_sc16_round(int32_t a, int64_t t, int shift)
+{
+    int64_t result = (int64_t)a * 32768 + t + ((int64_t)1 << (shift - 1));
+    result >>= shift;
+    if (result > INT16_MAX) {
+        return INT16_MAX;
+    }
+    if (result < INT16_MIN) {
+        return INT16_MIN;
+    }
+    return (int16_t)result;
+}
+
+esp_err_t dsps_rfft_init_sc16(rfft_plan_sc16_t *plan, int N)
+{
+    if (plan == NULL) {
+        return ESP_ERR_DSP_INVALID_PARAM;
+    }
+    memset(plan, 0, sizeof(rfft_plan_sc16_t));
+    if (!dsp_is_power_of_two(N)) {
+        return ESP_ERR_DSP_INVALID_LENGTH;
+    }
+    if ((N < DSPS_RFFT_MIN_SIZE) || (N > DSPS_RFFT_MAX_SIZE)) {
+        return ESP_ERR_DSP_PARAM_OUTOFRANGE;
+    }
+    const int M = N / 2;
+
+    esp_err_t result = dsps_fft2r_init_sc16(NULL, CONFIG_DSP_MAX_FFT_SIZE);
+    if (result != ESP_OK) {
+        return result;
+    }
+    if (M > dsps_fft_w_table_sc16_size) {
+        return ESP_ERR_DSP_PARAM_OUTOFRANGE;
+    }
+
+    plan->w_split = (int16_t *)malloc((M / 2 + 1) * 2 * sizeof(int16_t));
+    if (plan->w_split == NULL) {
+        return ESP_ERR_DSP_PARAM_OUTOFRANGE;
+    }
+    const double e = M_PI * 2.0 / N;
+    for (int k = 0; k <= M / 2; k++) {
+        plan->w_split[2 * k + 0] = (int16_t)lround(INT16_MAX * cos(k * e));
+        plan->w_split[2 * k + 1] = (int16_t)lround(INT16_MAX * sin(k * e));
+    }
+    plan->N = N;
+    return ESP_OK;
+}
+
+void dsps_rfft_deinit_sc16(rfft_plan_sc16_t *plan)
+{
+    if (plan == NULL) {
+        return;
+    }
+    free(plan->w_split);
+    memset(plan, 0, sizeof(rfft_plan_sc16_t));
+}
+
+static esp_err_t dsps_rfft_sc16_check(const rfft_plan_sc16_t *plan)
+{
+    if ((plan == NULL) || (plan->N == 0) || !dsps_fft2r_sc16_initialized) {
+        return ESP_ERR_DSP_UNINITIALIZED;
+    }
+    if ((plan->N / 2) > dsps_fft_w_table_sc16_size) {
+        return ESP_ERR_DSP_PARAM_OUTOFRANGE;
+    }
+    return ESP_OK;
+}
+
+esp_err_t dsps_rfft_sc16(const rfft_plan_sc16_t *plan, const int16_t *input, int16_t *output)
+{
+    esp_err_t result = dsps_rfft_sc16_check(plan);
+    if (result != ESP_OK) {
+        return result;
+    }
+    const int N = plan->N;
+    const int M = N / 2;
+
+    if (output != input) {
+        memcpy(output, input, N * sizeof(int16_t));
+    }
+    result = dsps_fft2r_sc16(output, M);
+    if (result != ESP_OK) {
+        return result;
+    }
+    result = dsps_bit_rev_sc16_ansi(output, M);
+    if (result != ESP_OK) {
+        return result;
+    }
+
+    sc16_t *bins = (sc16_t *)output;
+    const int16_t *w = plan->w_split;
+
+    const int32_t z0_re = bins[0].re;
+    const int32_t z0_im = bins[0].im;
+    bins[0].re = (z0_re + z0_im + 1) >> 1;
+    bins[0].im = 0;
+    bins[M].re = (z0_re - z0_im + 1) >> 1;
+    bins[M].im = 0;
+
+    for (int k = 1; k <= M / 2; k++) {
+        const sc16_t zk = bins[k];
+        const sc16_t zn = bins[M - k];
+        const int32_t a_re = zk.re + zn.re;
+        const int32_t a_im = zk.im - zn.im;
+        const int32_t b_re = zk.re - zn.re;
+        const int32_t b_im = zk.im + zn.im;
+        const int32_t c = w[2 * k + 0];
+        const int32_t s = w[2 * k + 1];
+        const int64_t t_re = (int64_t)(s * b_re) - c * b_im;
+        const int64_t t_im = (int64_t)(c * b_re) + s * b_im;
+
+        bins[k].re = dsps_rfft_sc16_round(a_re, -t_re, 17);
+        bins[k].im = dsps_rfft_sc16_round(a_im, -t_im, 17);
+        bins[M - k].re = dsps_rfft_sc16_round(a_re, t_re, 17);
+        bins[M - k].im = dsps_rfft_sc16_round(-a_im, -t_im, 17);
+    }
+    return ESP_OK;
+}
+
+esp_err_t dsps_irfft_sc16(const rfft_plan_sc16_t *plan, const int16_t *input, int16_t *output)
+{
+    esp_err_t result = dsps_rfft_sc16_check(plan);
+    if (result != ESP_OK) {
+        return result;
+    }
+    const int N = plan->N;
+    const int M = N / 2;
+    const sc16_t *bins = (const sc16_t *)input;
+    sc16_t *z = (sc16_t *)output;
+    const int16_t *w = plan->w_split;
+
+    const int32_t x0 = bins[0].re;
+    const int32_t xm = bins[M].re;
+    z[0].re = dsps_rfft_sc16_round(x0 + xm, 0, 16);
+    z[0].im = dsps_rfft_sc16_round(x0 - xm, 0, 16);
+
+    for (int k = 1; k <= M / 2; k++) {
+        const sc16_t xk = bins[k];
+        const sc16_t xn = bins[M - k];
+        const int32_t a_re = xk.re + xn.re;
+        const int32_t a_im = xk.im - xn.im;
+        const int32_t b_re = xk.re - xn.re;
+        const int32_t b_im = xk.im + xn.im;
+        const int32_t c = w[2 * k + 0];
+        const int32_t s = w[2 * k + 1];
+        const int64_t t_re = -(int64_t)(s * b_re) - c * b_im;
+        const int64_t t_im = (int64_t)(c * b_re) - s * b_im;
+
+        z[M - k].re = dsps_rfft_sc16_round(a_re, t_re, 16);
+        z[M - k].im = dsps_rfft_sc16_round(a_im, t_im, 16);
+        z[k].re = dsps_rfft_sc16_round(a_re, -t_re, 16);
+        z[k].im = dsps_rfft_sc16_round(-a_im, t_im, 16);
+    }
+
+    result = dsps_fft2r_sc16(output, M);
+    if (result != ESP_OK) {
+        return result;
+    }
+    return dsps_bit_rev_sc16_ansi(output, M);
+}
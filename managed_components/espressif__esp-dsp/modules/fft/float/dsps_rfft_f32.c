@@ -0,0 +1,271 @@
+// Copyright 2018-2024 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Real FFT of N samples through an N/2 point complex FFT.
+//
+// The samples are read as z[n] = x[2n] + i*x[2n+1], M = N/2, and Z = FFT_M(z).
+// With A = Z[k] + conj(Z[M-k]), B = Z[k] - conj(Z[M-k]) and W = exp(-2*pi*i*k/N):
+//     X[k]   = (A - i*W*B) / 2
+//     X[M-k] = conj(A + i*W*B) / 2
+// so every pair (k, M-k) is split in place from the same two complex values.
+// The inverse builds Z back from X the same way and stores it in reversed
+// order (Z[k] at M-k), which turns the forward FFT into the inverse one.
+
+#include "dsps_rfft.h"
+#include "dsp_common.h"
+#include "dsp_types.h"
+#include <math.h>
+#include <string.h>
+#include <malloc.h>
+
+#if CONFIG_DSP_OPTIMIZED
+#if (dsps_fft2r_fc32_aes3_enabled == 1)
+#define dsps_rfft_cplx_fc32 dsps_fft2r_fc32_aes3_
+#elif (dsps_fft2r_fc32_ae32_enabled == 1)
+#define dsps_rfft_cplx_fc32 dsps_fft2r_fc32_ae32_
+#elif (dsps_fft2r_fc32_arp4_enabled == 1)
+#define dsps_rfft_cplx_fc32 dsps_fft2r_fc32_arp4_
+#endif
+#endif // CONFIG_DSP_OPTIMIZED
+
+#ifndef dsps_rfft_cplx_fc32
+// Same butterflies as dsps_fft2r_fc32_ansi_, which only accepts the global table
+static esp_err_t dsps_rfft_cplx_fc32(float *data, int N, float *w)
+{
+    int ie, ia, m;
+    float re_temp, im_temp;
+    float c, s;
+    ie = 1;
+    for (int N2 = N / 2; N2 > 0; N2 >>= 1) {
+        ia = 0;
+        for (int j = 0; j < ie; j++) {
+            c = w[2 * j];
+            s = w[2 * j + 1];
+            for (int i = 0; i < N2; i++) {
+                m = ia + N2;
+                re_temp = c * data[2 * m] + s * data[2 * m + 1];
+                im_temp = c * data[2 * m + 1] - s * data[2 * m];
+                data[2 * m] = data[2 * ia] - re_temp;
+                data[2 * m + 1] = data[2 * ia + 1] - im_temp;
+                data[2 * ia] = data[2 * ia] + re_temp;
+                data[2 * ia + 1] = data[2 * ia + 1] + im_temp;
+                ia++;
+            }
+            ia += N2;
+        }
+        ie <<= 1;
+    }
+    return ESP_OK;
+}
+#endif // dsps_rfft_cplx_fc32
+
+static esp_err_t dsps_rfft_check_size(int N)
+{
+    if (!dsp_is_power_of_two(N)) {
+        return ESP_ERR_DSP_INVALID_LENGTH;
+    }
+    if ((N < DSPS_RFFT_MIN_SIZE) || (N > DSPS_RFFT_MAX_SIZE)) {
+        return ESP_ERR_DSP_PARAM_OUTOFRANGE;
+    }
+    return ESP_OK;
+}
+
+// Number of swapped pairs of the M point bit reversal, padded to an even count for the ae32 lookup
+static int dsps_rfft_bitrev_count(int M)
+{
+    int count = 0;
+    int j = 0;
+    for (int i = 1; i < (M - 1); i++) {
+        int k = M >> 1;
+        while (k <= j) {
+            j -= k;
+            k >>= 1;
+        }
+        j += k;
+        if (i < j) {
+            count++;
+        }
+    }
+    return (count + 1) & ~1;
+}
+
+static void dsps_rfft_gen_bitrev(uint16_t *table, int M, int count)
+{
+    int n = 0;
+    int j = 0;
+    for (int i = 1; i < (M - 1); i++) {
+        int k = M >> 1;
+        while (k <= j) {
+            j -= k;
+            k >>= 1;
+        }
+        j += k;
+        if (i < j) {
+            table[n * 2 + 0] = i * sizeof(fc32_t);
+            table[n * 2 + 1] = j * sizeof(fc32_t);
+            n++;
+        }
+    }
+    // Padding pair swaps element 0 with itself
+    for (; n < count; n++) {
+        table[n * 2 + 0] = 0;
+        table[n * 2 + 1] = 0;
+    }
+}
+
+esp_err_t dsps_rfft_init_f32(rfft_plan_f32_t *plan, int N)
+{
+    if (plan == NULL) {
+        return ESP_ERR_DSP_INVALID_PARAM;
+    }
+    memset(plan, 0, sizeof(rfft_plan_f32_t));
+    esp_err_t result = dsps_rfft_check_size(N);
+    if (result != ESP_OK) {
+        return result;
+    }
+    const int M = N / 2;
+
+    plan->bitrev_size = dsps_rfft_bitrev_count(M);
+    plan->w = (float *)memalign(16, M * sizeof(float));
+    plan->w_split = (float *)malloc((M / 2 + 1) * 2 * sizeof(float));
+    plan->bitrev = (uint16_t *)malloc(plan->bitrev_size * 2 * sizeof(uint16_t));
+    if ((plan->w == NULL) || (plan->w_split == NULL) || (plan->bitrev == NULL)) {
+        dsps_rfft_deinit_f32(plan);
+        return ESP_ERR_DSP_PARAM_OUTOFRANGE;
+    }
+
+    // Complex FFT table exactly as dsps_fft2r_init_fc32 builds the global one
+    result = dsps_gen_w_r2_fc32(plan->w, M);
+    if (result == ESP_OK) {
+        result = dsps_bit_rev_fc32_ansi(plan->w, M >> 1);
+    }
+    if (result != ESP_OK) {
+        dsps_rfft_deinit_f32(plan);
+        return result;
+    }
+    dsps_rfft_gen_bitrev(plan->bitrev, M, plan->bitrev_size);
+
+    const double e = M_PI * 2.0 / N;
+    for (int k = 0; k <= M / 2; k++) {
+        plan->w_split[2 * k + 0] = cos(k * e);
+        plan->w_split[2 * k + 1] = sin(k * e);
+    }
+    plan->N = N;
+    return ESP_OK;
+}
+
+void dsps_rfft_deinit_f32(rfft_plan_f32_t *plan)
+{
+    if (plan == NULL) {
+        return;
+    }
+    free(plan->w);
+    free(plan->w_split);
+    free(plan->bitrev);
+    memset(plan, 0, sizeof(rfft_plan_f32_t));
+}
+
+esp_err_t dsps_rfft_f32(const rfft_plan_f32_t *plan, const float *input, float *output)
+{
+    if ((plan == NULL) || (plan->N == 0)) {
+        return ESP_ERR_DSP_UNINITIALIZED;
+    }
+    const int N = plan->N;
+    const int M = N / 2;
+
+    if (output != input) {
+        memcpy(output, input, N * sizeof(float));
+    }
+    esp_err_t result = dsps_rfft_cplx_fc32(output, M, plan->w);
+    if (result != ESP_OK) {
+        return result;
+    }
+    dsps_bit_rev_lookup_fc32(output, plan->bitrev_size, plan->bitrev);
+
+    fc32_t *bins = (fc32_t *)output;
+    const float *w = plan->w_split;
+
+    // DC and Nyquist are the sum and the difference of the first complex value
+    const float z0_re = bins[0].re;
+    const float z0_im = bins[0].im;
+    bins[0].re = z0_re + z0_im;
+    bins[0].im = 0;
+    bins[M].re = z0_re - z0_im;
+    bins[M].im = 0;
+
+    for (int k = 1; k <= M / 2; k++) {
+        const fc32_t zk = bins[k];
+        const fc32_t zn = bins[M - k];
+        const float a_re = zk.re + zn.re;
+        const float a_im = zk.im - zn.im;
+        const float b_re = zk.re - zn.re;
+        const float b_im = zk.im + zn.im;
+        const float c = w[2 * k + 0];
+        const float s = w[2 * k + 1];
+        // i*W*B with W = c - i*s
+        const float t_re = s * b_re - c * b_im;
+        const float t_im = c * b_re + s * b_im;
+
+        bins[k].re = 0.5f * (a_re - t_re);
+        bins[k].im = 0.5f * (a_im - t_im);
+        bins[M - k].re = 0.5f * (a_re + t_re);
+        bins[M - k].im = -0.5f * (a_im + t_im);
+    }
+    return ESP_OK;
+}
+
+esp_err_t dsps_irfft_f32(const rfft_plan_f32_t *plan, const float *input, float *output)
+{
+    if ((plan == NULL) || (plan->N == 0)) {
+        return ESP_ERR_DSP_UNINITIALIZED;
+    }
+    const int N = plan->N;
+    const int M = N / 2;
+    const fc32_t *bins = (const fc32_t *)input;
+    fc32_t *z = (fc32_t *)output;
+    const float *w = plan->w_split;
+    // 1/2 of the split and 1/M of the inverse FFT
+    const float scale = 1.0f / N;
+
+    const float x0 = bins[0].re;
+    const float xm = bins[M].re;
+    z[0].re = scale * (x0 + xm);
+    z[0].im = scale * (x0 - xm);
+
+    for (int k = 1; k <= M / 2; k++) {
+        const fc32_t xk = bins[k];
+        const fc32_t xn = bins[M - k];
+        const float a_re = xk.re + xn.re;
+        const float a_im = xk.im - xn.im;
+        const float b_re = xk.re - xn.re;
+        const float b_im = xk.im + xn.im;
+        const float c = w[2 * k + 0];
+        const float s = w[2 * k + 1];
+        // i*conj(W)*B with conj(W) = c + i*s
+        const float t_re = -s * b_re - c * b_im;
+        const float t_im = c * b_re - s * b_im;
+
+        // Z[k] goes to M-k and Z[M-k] = conj(A - i*conj(W)*B)/2 to k
+        z[M - k].re = scale * (a_re + t_re);
+        z[M - k].im = scale * (a_im + t_im);
+        z[k].re = scale * (a_re - t_re);
+        z[k].im = -scale * (a_im - t_im);
+    }
+
+    esp_err_t result = dsps_rfft_cplx_fc32(output, M, plan->w);
+    if (result != ESP_OK) {
+        return result;
+    }
+    return dsps_bit_rev_lookup_fc32(output, plan->bitrev_size, plan->bitrev);
+}
@@ -0,0 +1,141 @@
+// Copyright 2018-2024 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _dsps_rfft_H_
+#define _dsps_rfft_H_
+
+#include <stdint.h>
+#include "dsp_err.h"
+#include "sdkconfig.h"
+#include "dsps_fft2r.h"
+
+#define DSPS_RFFT_MIN_SIZE 16       ///< Smallest supported number of real samples
+#define DSPS_RFFT_MAX_SIZE 16384    ///< Largest supported number of real samples (16 bit bit-reverse table)
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * @brief Plan of a f32 real FFT
+ *
+ * Holds the tables of one transform size, so any number of sizes can be used at the same time
+ * without touching the global dsps_fft2r tables.
+ * All fields of this structure are initialized by the dsps_rfft_init_f32(...) function.
+ */
+typedef struct rfft_plan_f32_s {
+    int       N;            /*!< Number of real samples.*/
+    float    *w;            /*!< Twiddles of the N/2 point complex FFT, bit reversed as in dsps_fft2r.*/
+    float    *w_split;      /*!< cos/sin(2*pi*k/N) for k = 0..N/4, splits the complex result into N/2+1 bins.*/
+    uint16_t *bitrev;       /*!< Byte offset pairs swapped by the bit reversal, dsps_bit_rev_lookup_fc32 format.*/
+    int       bitrev_size;  /*!< Number of pairs in bitrev.*/
+} rfft_plan_f32_t;
+
+/**
+ * @brief Plan of a sc16 real FFT
+ *
+ * The fixed point radix-2 kernels only run on the global table of dsps_fft2r_init_sc16(...),
+ * so the plan uses that table for the complex FFT and holds the split twiddles only.
+ * All fields of this structure are initialized by the dsps_rfft_init_sc16(...) function.
+ */
+typedef struct rfft_plan_sc16_s {
+    int       N;            /*!< Number of real samples.*/
+    int16_t  *w_split;      /*!< Q15 cos/sin(2*pi*k/N) for k = 0..N/4.*/
+} rfft_plan_sc16_t;
+
+/**@{*/
+/**
+ * @brief      init real FFT plan
+ *
+ * Allocates and fills the tables of a real FFT of N samples.
+ * The f32 plan is self contained. The sc16 plan calls dsps_fft2r_init_sc16(NULL, CONFIG_DSP_MAX_FFT_SIZE)
+ * when the global fixed point table is not initialized yet, and needs N/2 <= its size.
+ * The implementation use ANSI C and could be compiled and run on any platform
+ *
+ * @param[out] plan: plan structure to initialize
+ * @param[in] N: number of real samples, power of two from DSPS_RFFT_MIN_SIZE to DSPS_RFFT_MAX_SIZE
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_DSP_INVALID_LENGTH if N is not a power of two
+ *      - ESP_ERR_DSP_PARAM_OUTOFRANGE if N is out of range or memory can not be allocated
+ *      - One of the error codes from DSP library
+ */
+esp_err_t dsps_rfft_init_f32(rfft_plan_f32_t *plan, int N);
+esp_err_t dsps_rfft_init_sc16(rfft_plan_sc16_t *plan, int N);
+/**@}*/
+
+/**@{*/
+/**
+ * @brief      deinit real FFT plan
+ *
+ * Frees the tables allocated by dsps_rfft_init_f32(...)/dsps_rfft_init_sc16(...).
+ * The global fixed point table stays initialized.
+ *
+ * @param[inout] plan: plan structure to release
+ */
+void dsps_rfft_deinit_f32(rfft_plan_f32_t *plan);
+void dsps_rfft_deinit_sc16(rfft_plan_sc16_t *plan);
+/**@}*/
+
+/**@{*/
+/**
+ * @brief      real FFT
+ *
+ * Spectrum of N real samples in one call. The samples are packed as N/2 complex values, transformed
+ * by the N/2 point radix-2 FFT (the optimized kernel of the target) and split into N/2+1 bins,
+ * which costs about half of an N point complex FFT.
+ * The sc16 version is scaled by 1/N, like dsps_fft2r_sc16.
+ *
+ * @param[in] plan: plan of N samples
+ * @param[in] input: N real samples
+ * @param[out] output: N/2+1 complex bins: Re[0], Im[0], ... Re[N/2], Im[N/2], that is N+2 values.
+ *                     Im[0] and Im[N/2] are 0. May be the input buffer when it holds N+2 values.
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_DSP_UNINITIALIZED if the plan is not initialized
+ *      - One of the error codes from DSP library
+ */
+esp_err_t dsps_rfft_f32(const rfft_plan_f32_t *plan, const float *input, float *output);
+esp_err_t dsps_rfft_sc16(const rfft_plan_sc16_t *plan, const int16_t *input, int16_t *output);
+/**@}*/
+
+/**@{*/
+/**
+ * @brief      inverse real FFT
+ *
+ * N real samples from their N/2+1 bins, the inverse of dsps_rfft_f32(...): a round trip returns the input.
+ * Im[0] and Im[N/2] are ignored.
+ * The sc16 version is scaled by 1/N like the forward one, so a round trip returns input/N.
+ *
+ * @param[in] plan: plan of N samples
+ * @param[in] input: N/2+1 complex bins, N+2 values
+ * @param[out] output: N real samples. May be the input buffer.
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_DSP_UNINITIALIZED if the plan is not initialized
+ *      - One of the error codes from DSP library
+ */
+esp_err_t dsps_irfft_f32(const rfft_plan_f32_t *plan, const float *input, float *output);
+esp_err_t dsps_irfft_sc16(const rfft_plan_sc16_t *plan, const int16_t *input, int16_t *output);
+/**@}*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _dsps_rfft_H_
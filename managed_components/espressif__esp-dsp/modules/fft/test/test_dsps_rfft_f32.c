@@ -0,0 +1,106 @@
+// Copyright 2018-2024 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string.h>
+#include "unity.h"
+#include "esp_dsp.h"
+#include "dsp_platform.h"
+#include "esp_log.h"
+
+#include "dsps_rfft.h"
+#include "dsp_tests.h"
+
+static const char *TAG = "dsps_rfft_f32";
+
+#define RFFT_TEST_N 1024
+
+__attribute__((aligned(16)))
+static float input[RFFT_TEST_N];
+__attribute__((aligned(16)))
+static float bins[RFFT_TEST_N + 2];
+__attribute__((aligned(16)))
+static float check_data[RFFT_TEST_N * 2];
+
+TEST_CASE("dsps_rfft_f32 functionality", "[dsps]")
+{
+    const int N = RFFT_TEST_N;
+    for (int i = 0 ; i < N ; i++) {
+        input[i] = 0.7f * sinf(2 * M_PI * 37 * i / N) + 0.2f * cosf(2 * M_PI * 200 * i / N) + 0.1f * ((i % 7) - 3) / 3.0f;
+        check_data[i * 2 + 0] = input[i];
+        check_data[i * 2 + 1] = 0;
+    }
+
+    // Reference: N point complex FFT of the same samples
+    TEST_ESP_OK(dsps_fft2r_init_fc32(NULL, N));
+    dsps_fft2r_fc32(check_data, N);
+    dsps_bit_rev2r_fc32(check_data, N);
+
+    rfft_plan_f32_t plan;
+    TEST_ESP_OK(dsps_rfft_init_f32(&plan, N));
+    TEST_ESP_OK(dsps_rfft_f32(&plan, input, bins));
+
+    for (int k = 0 ; k <= N / 2 ; k++) {
+        TEST_ASSERT_FLOAT_WITHIN(1e-3f, check_data[k * 2 + 0], bins[k * 2 + 0]);
+        TEST_ASSERT_FLOAT_WITHIN(1e-3f, check_data[k * 2 + 1], bins[k * 2 + 1]);
+    }
+    TEST_ASSERT_EQUAL_FLOAT(0, bins[1]);
+    TEST_ASSERT_EQUAL_FLOAT(0, bins[N + 1]);
+
+    // Round trip, in place
+    TEST_ESP_OK(dsps_irfft_f32(&plan, bins, bins));
+    for (int i = 0 ; i < N ; i++) {
+        TEST_ASSERT_FLOAT_WITHIN(1e-5f, input[i], bins[i]);
+    }
+
+    dsps_rfft_deinit_f32(&plan);
+    dsps_fft2r_deinit_fc32();
+}
+
+TEST_CASE("dsps_rfft_f32 parameters", "[dsps]")
+{
+    rfft_plan_f32_t plan;
+    TEST_ASSERT_EQUAL(ESP_ERR_DSP_INVALID_LENGTH, dsps_rfft_init_f32(&plan, 1000));
+    TEST_ASSERT_EQUAL(ESP_ERR_DSP_PARAM_OUTOFRANGE, dsps_rfft_init_f32(&plan, DSPS_RFFT_MIN_SIZE / 2));
+    TEST_ASSERT_EQUAL(ESP_ERR_DSP_PARAM_OUTOFRANGE, dsps_rfft_init_f32(&plan, DSPS_RFFT_MAX_SIZE * 2));
+    TEST_ASSERT_EQUAL(ESP_ERR_DSP_UNINITIALIZED, dsps_rfft_f32(&plan, input, bins));
+}
+
+TEST_CASE("dsps_rfft_f32 benchmark", "[dsps]")
+{
+    TEST_ESP_OK(dsps_fft2r_init_fc32(NULL, CONFIG_DSP_MAX_FFT_SIZE));
+
+    for (int i = 6 ; i < 11 ; i++) {
+        int N_check = 1 << i;
+        rfft_plan_f32_t plan;
+        TEST_ESP_OK(dsps_rfft_init_f32(&plan, N_check));
+
+        unsigned int start_b = dsp_get_cpu_cycle_count();
+        dsps_rfft_f32(&plan, input, bins);
+        unsigned int end_b = dsp_get_cpu_cycle_count();
+        float rfft_cycles = end_b - start_b;
+
+        start_b = dsp_get_cpu_cycle_count();
+        dsps_fft2r_fc32(check_data, N_check);
+        dsps_bit_rev2r_fc32(check_data, N_check);
+        end_b = dsp_get_cpu_cycle_count();
+        float cplx_cycles = end_b - start_b;
+
+        ESP_LOGI(TAG, "Benchmark dsps_rfft_f32 - %6i cycles for %6i points, complex FFT - %6i cycles.",
+                 (int)rfft_cycles, N_check, (int)cplx_cycles);
+        // Half size complex FFT plus a linear split
+        TEST_ASSERT_LESS_THAN(cplx_cycles, rfft_cycles);
+        dsps_rfft_deinit_f32(&plan);
+    }
+    dsps_fft2r_deinit_fc32();
+}
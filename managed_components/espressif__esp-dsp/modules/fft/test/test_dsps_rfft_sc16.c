@@ -0,0 +1,72 @@
+// Copyright 2018-2024 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string.h>
+#include "unity.h"
+#include "esp_dsp.h"
+#include "dsp_platform.h"
+#include "esp_log.h"
+
+#include "dsps_rfft.h"
+#include "dsp_tests.h"
+
+static const char *TAG = "dsps_rfft_sc16";
+
+#define RFFT_TEST_N 1024
+
+__attribute__((aligned(16)))
+static int16_t input[RFFT_TEST_N];
+__attribute__((aligned(16)))
+static int16_t bins[RFFT_TEST_N + 2];
+__attribute__((aligned(16)))
+static float check_data[RFFT_TEST_N * 2];
+
+TEST_CASE("dsps_rfft_sc16 functionality", "[dsps]")
+{
+    const int N = RFFT_TEST_N;
+    for (int i = 0 ; i < N ; i++) {
+        float x = 0.7f * sinf(2 * M_PI * 37 * i / N) + 0.2f * cosf(2 * M_PI * 200 * i / N);
+        input[i] = (int16_t)(INT16_MAX * x);
+        check_data[i * 2 + 0] = input[i];
+        check_data[i * 2 + 1] = 0;
+    }
+
+    // Reference: f32 N point complex FFT, scaled by 1/N like the sc16 result
+    TEST_ESP_OK(dsps_fft2r_init_fc32(NULL, N));
+    dsps_fft2r_fc32(check_data, N);
+    dsps_bit_rev2r_fc32(check_data, N);
+
+    rfft_plan_sc16_t plan;
+    TEST_ESP_OK(dsps_rfft_init_sc16(&plan, N));
+
+    unsigned int start_b = dsp_get_cpu_cycle_count();
+    TEST_ESP_OK(dsps_rfft_sc16(&plan, input, bins));
+    unsigned int end_b = dsp_get_cpu_cycle_count();
+    ESP_LOGI(TAG, "dsps_rfft_sc16 - %i cycles for %i points", end_b - start_b, N);
+
+    for (int k = 0 ; k <= N / 2 ; k++) {
+        TEST_ASSERT_INT_WITHIN(4, (int)roundf(check_data[k * 2 + 0] / N), bins[k * 2 + 0]);
+        TEST_ASSERT_INT_WITHIN(4, (int)roundf(check_data[k * 2 + 1] / N), bins[k * 2 + 1]);
+    }
+
+    // Both directions scale by 1/N: the round trip returns input/N
+    TEST_ESP_OK(dsps_irfft_sc16(&plan, bins, bins));
+    for (int i = 0 ; i < N ; i++) {
+        TEST_ASSERT_INT_WITHIN(2, (int)roundf((float)input[i] / N), bins[i]);
+    }
+
+    dsps_rfft_deinit_sc16(&plan);
+    dsps_fft2r_deinit_fc32();
+    dsps_fft2r_deinit_sc16();
+}
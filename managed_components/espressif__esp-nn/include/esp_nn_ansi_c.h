@@ -29,6 +29,10 @@
 
 #define esp_nn_conv_s8 esp_nn_conv_s8_ansi
 
+#define esp_nn_conv_s8_maxpool2x2 esp_nn_conv_s8_maxpool2x2_ansi
+#define esp_nn_get_conv_s8_maxpool2x2_scratch_size esp_nn_get_conv_s8_maxpool2x2_scratch_size_ansi
+#define esp_nn_set_conv_s8_maxpool2x2_scratch_buf esp_nn_set_conv_s8_maxpool2x2_scratch_buf_ansi
+
 #define esp_nn_get_conv_scratch_size esp_nn_get_conv_scratch_size_ansi
 #define esp_nn_set_conv_scratch_buf esp_nn_set_conv_scratch_buf_ansi
 
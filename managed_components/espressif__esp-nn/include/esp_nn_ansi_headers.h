@@ -114,6 +114,32 @@ int esp_nn_get_conv_scratch_size_ansi(const data_dims_t *input_dims,
                                       const conv_params_t *conv_params);
 void esp_nn_set_conv_scratch_buf_ansi(const void *buf);
 
+/**
+ * @brief       2d-convolution followed by 2x2 max pooling with stride 2
+ *
+ * @note        operation: out = max over 2x2 of requant(conv)
+ *
+ *              Convolution arguments as for esp_nn_conv_s8_ansi. output_dims
+ *              are the pooled dims: floor(conv output / 2), VALID pooling.
+ *              activation is applied once, after pooling (it commutes with
+ *              the max), and pooling keeps the conv output quantization.
+ */
+void esp_nn_conv_s8_maxpool2x2_ansi(const data_dims_t *input_dims,
+                                    const int8_t *input_data,
+                                    const data_dims_t *filter_dims,
+                                    const int8_t *filter_data,
+                                    const int32_t *bias,
+                                    const data_dims_t *output_dims,
+                                    int8_t *out_data,
+                                    const conv_params_t *conv_params,
+                                    const quant_data_t *quant_data);
+
+int esp_nn_get_conv_s8_maxpool2x2_scratch_size_ansi(const data_dims_t *input_dims,
+                                                    const data_dims_t *filter_dims,
+                                                    const data_dims_t *output_dims,
+                                                    const conv_params_t *conv_params);
+void esp_nn_set_conv_s8_maxpool2x2_scratch_buf_ansi(const void *buf);
+
 int esp_nn_get_depthwise_conv_scratch_size_ansi(const data_dims_t *input_dims,
                                                 const data_dims_t *filter_dims,
                                                 const data_dims_t *output_dims,
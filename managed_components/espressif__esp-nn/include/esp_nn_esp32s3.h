@@ -119,6 +119,30 @@ int esp_nn_get_conv_scratch_size_esp32s3(const data_dims_t *input_dims,
                                          const conv_params_t *conv_params);
 void esp_nn_set_conv_scratch_buf_esp32s3(const void *buf);
 
+/**
+ * @brief       2d - convolution followed by 2x2 max pooling with stride 2
+ *
+ * @note        Runs esp_nn_conv_s8_esp32s3 on the input rows of 2 conv rows at
+ *              a time and pools them right away, so only 2 rows of the full
+ *              resolution activation are ever stored. Sets the conv scratch
+ *              buffer to a part of its own.
+ */
+void esp_nn_conv_s8_maxpool2x2_esp32s3(const data_dims_t *input_dims,
+                                       const int8_t *input_data,
+                                       const data_dims_t *filter_dims,
+                                       const int8_t *filter_data,
+                                       const int32_t *bias,
+                                       const data_dims_t *output_dims,
+                                       int8_t *output_data,
+                                       const conv_params_t *conv_params,
+                                       const quant_data_t *quant_data);
+
+int esp_nn_get_conv_s8_maxpool2x2_scratch_size_esp32s3(const data_dims_t *input_dims,
+                                                       const data_dims_t *filter_dims,
+                                                       const data_dims_t *output_dims,
+                                                       const conv_params_t *conv_params);
+void esp_nn_set_conv_s8_maxpool2x2_scratch_buf_esp32s3(const void *buf);
+
 int esp_nn_get_depthwise_conv_scratch_size_esp32s3(const data_dims_t *input_dims,
                                                    const data_dims_t *filter_dims,
                                                    const data_dims_t *output_dims,
@@ -243,6 +267,10 @@ void esp_nn_relu6_s8_esp32s3(int8_t *data, uint16_t size);
 
 #define esp_nn_conv_s8 esp_nn_conv_s8_esp32s3
 
+#define esp_nn_conv_s8_maxpool2x2 esp_nn_conv_s8_maxpool2x2_esp32s3
+#define esp_nn_get_conv_s8_maxpool2x2_scratch_size esp_nn_get_conv_s8_maxpool2x2_scratch_size_esp32s3
+#define esp_nn_set_conv_s8_maxpool2x2_scratch_buf esp_nn_set_conv_s8_maxpool2x2_scratch_buf_esp32s3
+
 #define esp_nn_relu6_s8 esp_nn_relu6_s8_esp32s3
 
 #define esp_nn_avg_pool_s8 esp_nn_avg_pool_s8_esp32s3
@@ -177,3 +177,100 @@ void esp_nn_conv_s8_ansi(const data_dims_t *input_dims,
         }
     }
 }
+
+int esp_nn_get_conv_s8_maxpool2x2_scratch_size_ansi(const data_dims_t *input_dims,
+                                                    const data_dims_t *filter_dims,
+                                                    const data_dims_t *output_dims,
+                                                    const conv_params_t *conv_params)
+{
+    return 0;
+}
+
+void esp_nn_set_conv_s8_maxpool2x2_scratch_buf_ansi(const void *buf)
+{
+
+}
+
+/**
+ * Assumption 1: output_dims are the pooled dims (2x2 window, stride 2, VALID)
+ * Assumption 2: Pointers are valid
+ * Assumption 3: dialation width = 1
+ *
+ * Requantization is monotonic (positive multiplier) and so is the activation
+ * clamp, so the max of the 4 requantized outputs is the requantized max of
+ * the 4 accumulators: only that one is requantized.
+ */
+void esp_nn_conv_s8_maxpool2x2_ansi(const data_dims_t *input_dims,
+                                    const int8_t *input_data,
+                                    const data_dims_t *filter_dims,
+                                    const int8_t *filter_data,
+                                    const int32_t *bias,
+                                    const data_dims_t *output_dims,
+                                    int8_t *out_data,
+                                    const conv_params_t *conv_params,
+                                    const quant_data_t *quant_data)
+{
+    const uint16_t input_wd = input_dims->width;
+    const uint16_t input_ht = input_dims->height;
+    const uint16_t in_channels = input_dims->channels;
+    const int32_t input_offset = conv_params->in_offset;
+    const int32_t out_offset = conv_params->out_offset;
+    const uint16_t pad_wd = conv_params->padding.width;
+    const uint16_t pad_ht = conv_params->padding.height;
+    const uint16_t stride_wd = conv_params->stride.width;
+    const uint16_t stride_ht = conv_params->stride.height;
+    const uint16_t filter_wd = filter_dims->width;
+    const uint16_t filter_ht = filter_dims->height;
+    const uint16_t out_wd = output_dims->width;
+    const uint16_t out_ht = output_dims->height;
+    const uint16_t out_channels = output_dims->channels;
+    const int32_t *out_shift = quant_data->shift;
+    const int32_t *out_mult = quant_data->mult;
+    const int32_t activation_min = conv_params->activation.min;
+    const int32_t activation_max = conv_params->activation.max;
+
+    for (int32_t out_y = 0; out_y < out_ht; out_y++) {
+        for (int32_t out_x = 0; out_x < out_wd; out_x++) {
+            for (int32_t out_ch_idx = 0; out_ch_idx < out_channels; out_ch_idx++) {
+                int32_t pool_max = INT32_MIN;
+
+                for (int32_t pool_idx = 0; pool_idx < 4; pool_idx++) {
+                    const int32_t conv_y = 2 * out_y + (pool_idx >> 1);
+                    const int32_t conv_x = 2 * out_x + (pool_idx & 1);
+                    const int32_t base_y = stride_ht * conv_y - pad_ht;
+                    const int32_t base_x = stride_wd * conv_x - pad_wd;
+
+                    const int32_t filter_y_start = max(0, -base_y);
+                    const int32_t filter_x_start = max(0, -base_x);
+                    const int32_t filter_y_end = min(filter_ht, input_ht - base_y);
+                    const int32_t filter_x_end = min(filter_wd, input_wd - base_x);
+
+                    int32_t conv_out = 0;
+                    for (int32_t filter_y_idx = filter_y_start; filter_y_idx < filter_y_end; filter_y_idx++) {
+                        for (int32_t filter_x_idx = filter_x_start; filter_x_idx < filter_x_end; filter_x_idx++) {
+                            const int32_t in_row = base_y + filter_y_idx;
+                            const int32_t in_col = base_x + filter_x_idx;
+                            int32_t input_base_offset = (in_row * input_wd + in_col) * in_channels;
+                            int32_t filter_base_offset = out_ch_idx * in_channels * filter_ht * filter_wd +
+                                                           (filter_y_idx * filter_wd + filter_x_idx) * in_channels;
+                            for (int32_t in_ch_idx = 0; in_ch_idx < in_channels; in_ch_idx++) {
+                                conv_out +=
+                                    (input_data[input_base_offset + in_ch_idx] + input_offset) *
+                                    filter_data[filter_base_offset + in_ch_idx];
+                            }
+                        }
+                    }
+                    pool_max = max(pool_max, conv_out);
+                }
+                if (bias) {
+                    pool_max += bias[out_ch_idx];
+                }
+                pool_max = esp_nn_multiply_by_quantized_mult(pool_max, out_mult[out_ch_idx], out_shift[out_ch_idx]);
+                pool_max += out_offset;
+                pool_max = max(pool_max, activation_min);
+                pool_max = min(pool_max, activation_max);
+                *out_data++ = (int8_t) pool_max;
+            }
+        }
+    }
+}
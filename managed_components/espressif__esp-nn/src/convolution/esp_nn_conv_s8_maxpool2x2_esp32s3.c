@@ -0,0 +1,161 @@
+/*
+ * SPDX-FileCopyrightText: 2020-2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * Convolution followed by 2x2 max pooling with stride 2, in one pass.
+ *
+ * A Conv2D -> MaxPool2D(2x2) pair normally writes the full resolution conv
+ * output and reads it back to pool it: 4x the pooled size in activation
+ * memory. Strategy used here instead:
+ *      > The convolution itself is `esp_nn_conv_s8_esp32s3`, the same
+ *          assembly path an unfused layer runs, called for the 2 conv rows
+ *          feeding one pooled row.
+ *      > The input rows these 2 conv rows read are copied to an aligned
+ *          slice, padded with -input_offset, so the conv runs without
+ *          padding and only the slice is ever padded.
+ *      > The 2 conv rows are pooled right away, so only 2 rows of the full
+ *          resolution activation are stored at any time.
+ *      > Pooling the requantized, clamped conv output gives exactly what
+ *          the unfused pair gives.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <esp_nn_defs.h>
+#include <esp_nn_esp32s3.h>
+
+#include <common_functions.h>
+
+static int8_t *scratch_buffer = NULL;
+
+/* Dims and params of the conv run on one slice: 2 conv rows, no padding */
+static void maxpool2x2_slice_dims(const data_dims_t *input_dims,
+                                  const data_dims_t *filter_dims,
+                                  const data_dims_t *output_dims,
+                                  const conv_params_t *conv_params,
+                                  data_dims_t *slice_dims,
+                                  data_dims_t *conv_out_dims,
+                                  conv_params_t *slice_params)
+{
+    const int32_t conv_wd = 2 * output_dims->width;
+    *slice_dims = (data_dims_t) {
+        .width = (conv_wd - 1) * conv_params->stride.width + filter_dims->width,
+        .height = conv_params->stride.height + filter_dims->height,
+        .channels = input_dims->channels, .extra = 1
+    };
+    *conv_out_dims = (data_dims_t) {
+        .width = conv_wd, .height = 2,
+        .channels = output_dims->channels, .extra = 1
+    };
+    *slice_params = *conv_params;
+    slice_params->padding.width = 0;
+    slice_params->padding.height = 0;
+}
+
+static inline int8_t *maxpool2x2_align16(int8_t *ptr)
+{
+    return (int8_t *) (((uintptr_t) ptr + 15) & ~(uintptr_t) 15);
+}
+
+int esp_nn_get_conv_s8_maxpool2x2_scratch_size_esp32s3(const data_dims_t *input_dims,
+                                                       const data_dims_t *filter_dims,
+                                                       const data_dims_t *output_dims,
+                                                       const conv_params_t *conv_params)
+{
+    data_dims_t slice_dims, conv_out_dims;
+    conv_params_t slice_params;
+    maxpool2x2_slice_dims(input_dims, filter_dims, output_dims, conv_params,
+                          &slice_dims, &conv_out_dims, &slice_params);
+
+    int slice_scratch = slice_dims.width * slice_dims.height * slice_dims.channels;
+    int conv_out_scratch = conv_out_dims.width * conv_out_dims.height * conv_out_dims.channels;
+    int conv_scratch = esp_nn_get_conv_scratch_size_esp32s3(&slice_dims, filter_dims,
+                                                            &conv_out_dims, &slice_params);
+    int align_buf_size = 48; /* extra buffer to align the 3 parts */
+    return slice_scratch + conv_out_scratch + conv_scratch + align_buf_size;
+}
+
+void esp_nn_set_conv_s8_maxpool2x2_scratch_buf_esp32s3(const void *buf)
+{
+    scratch_buffer = (int8_t *) buf;
+}
+
+void esp_nn_conv_s8_maxpool2x2_esp32s3(const data_dims_t *input_dims,
+                                       const int8_t *input,
+                                       const data_dims_t *filter_dims,
+                                       const int8_t *filter_data,
+                                       const int32_t *bias,
+                                       const data_dims_t *output_dims,
+                                       int8_t *out_data,
+                                       const conv_params_t *conv_params,
+                                       const quant_data_t *quant_data)
+{
+    if (scratch_buffer == NULL) {
+        printf("esp_nn_conv_maxpool2x2 error! scratch_buffer not set!\n");
+        return;
+    }
+    const int32_t input_wd = input_dims->width;
+    const int32_t input_ht = input_dims->height;
+    const int32_t channels = input_dims->channels;
+    const int8_t pad_val = (int8_t) -conv_params->in_offset;
+    const int32_t pad_wd = conv_params->padding.width;
+    const int32_t pad_ht = conv_params->padding.height;
+    const int32_t stride_ht = conv_params->stride.height;
+    const int32_t out_wd = output_dims->width;
+    const int32_t out_ht = output_dims->height;
+    const int32_t out_channels = output_dims->channels;
+
+    data_dims_t slice_dims, conv_out_dims;
+    conv_params_t slice_params;
+    maxpool2x2_slice_dims(input_dims, filter_dims, output_dims, conv_params,
+                          &slice_dims, &conv_out_dims, &slice_params);
+
+    const int32_t slice_wd = slice_dims.width;
+    const int32_t slice_row_size = slice_wd * channels;
+    const int32_t conv_row_size = conv_out_dims.width * out_channels;
+
+    int8_t *slice = maxpool2x2_align16(scratch_buffer);
+    int8_t *conv_out = maxpool2x2_align16(slice + slice_dims.height * slice_row_size);
+    int8_t *conv_scratch = maxpool2x2_align16(conv_out + 2 * conv_row_size);
+
+    // slice column x holds input column x - pad_wd, the rest is padding
+    const int32_t left_pad = min(pad_wd, slice_wd) * channels;
+    const int32_t copy_size = max(0, min(input_wd, slice_wd - pad_wd)) * channels;
+
+    for (int32_t out_y = 0; out_y < out_ht; out_y++) {
+        // input rows read by conv rows 2 * out_y and 2 * out_y + 1
+        const int32_t row_start = 2 * out_y * stride_ht - pad_ht;
+        int8_t *slice_row = slice;
+        for (int32_t row = row_start; row < row_start + slice_dims.height; row++) {
+            if (row < 0 || row >= input_ht || copy_size == 0) {
+                memset(slice_row, pad_val, slice_row_size);
+            } else {
+                memset(slice_row, pad_val, left_pad);
+                memcpy(slice_row + left_pad, input + row * input_wd * channels, copy_size);
+                memset(slice_row + left_pad + copy_size, pad_val, slice_row_size - left_pad - copy_size);
+            }
+            slice_row += slice_row_size;
+        }
+
+        // the conv scratch pointer is shared with unfused convs: point it at our part
+        esp_nn_set_conv_scratch_buf_esp32s3(conv_scratch);
+        esp_nn_conv_s8_esp32s3(&slice_dims, slice, filter_dims, filter_data, bias,
+                               &conv_out_dims, conv_out, &slice_params, quant_data);
+
+        const int8_t *row0 = conv_out;
+        const int8_t *row1 = conv_out + conv_row_size;
+        for (int32_t out_x = 0; out_x < out_wd; out_x++) {
+            for (int32_t ch_idx = 0; ch_idx < out_channels; ch_idx++) {
+                int8_t pool_max = max(row0[ch_idx], row0[out_channels + ch_idx]);
+                pool_max = max(pool_max, row1[ch_idx]);
+                pool_max = max(pool_max, row1[out_channels + ch_idx]);
+                *out_data++ = pool_max;
+            }
+            row0 += 2 * out_channels;
+            row1 += 2 * out_channels;
+        }
+    }
+}
@@ -63,6 +63,7 @@ void app_main()
     printf("mul, c %"PRIu32" opt %"PRIu32"\n", total_c, total_opt);
     esp_nn_depthwise_conv_s8_test();
     esp_nn_conv_s8_test();
+    esp_nn_conv_s8_maxpool2x2_test();
 
     esp_nn_relu6_s8_test();
     printf("relu, c %"PRIu32" opt %"PRIu32"\n", total_c, total_opt);
@@ -19,6 +19,7 @@ void esp_nn_mul_elementwise_s8_test();
 
 void esp_nn_depthwise_conv_s8_test();
 void esp_nn_conv_s8_test();
+void esp_nn_conv_s8_maxpool2x2_test();
 
 void esp_nn_avg_pool_s8_test();
 void esp_nn_max_pool_s8_test();
@@ -626,3 +626,242 @@ void esp_nn_conv_s8_test()
         }
     }
 }
+
+void esp_nn_conv_s8_maxpool2x2_test()
+{
+    uint32_t total_c = 0, total_opt = 0;
+    const int32_t input_offset = 5; /* some number in [-128, 127] */
+    const int32_t activation_min = -128; /* ReLU with out_offset -128 */
+    const int32_t activation_max = 127;
+    const int32_t out_offset = -128;
+
+    void *scratch_buf = NULL;
+    int8_t *input = NULL;
+    int8_t *conv_out = NULL;
+    int8_t *out_data_ref = NULL;
+    int8_t *out_data_c = NULL;
+    int8_t *out_data_opt = NULL;
+    int8_t *filter_data = NULL;
+    int32_t *bias = NULL;
+    int32_t *out_shift = NULL;
+    int32_t *out_mult = NULL;
+
+    /* independent variable */
+    int in_wd, in_ht, in_channels, out_channels;
+    uint16_t filter_ht, filter_wd, conv_wd, conv_ht, out_wd, out_ht;
+    uint16_t pad_wd, pad_ht, stride_wd, stride_ht;
+
+    printf("\n######## Running %s ##########\n", __FUNCTION__);
+    for (int itr = 0; itr < 6; itr++) {
+        switch (itr) {
+        case 0: // first block of the sound classifier: 32x32x1 -> 3x3x8 same -> pool
+            in_wd = 32;
+            in_ht = 32;
+            in_channels = 1;
+            out_channels = 8;
+            filter_ht = 3;
+            filter_wd = 3;
+            pad_wd = 1;
+            pad_ht = 1;
+            stride_wd = 1;
+            stride_ht = 1;
+            break;
+        case 1: // second block: 16x16x8 -> 3x3x16
+            in_wd = 16;
+            in_ht = 16;
+            in_channels = 8;
+            out_channels = 16;
+            filter_ht = 3;
+            filter_wd = 3;
+            pad_wd = 1;
+            pad_ht = 1;
+            stride_wd = 1;
+            stride_ht = 1;
+            break;
+        case 2: // third block: 8x8x16 -> 3x3x32
+            in_wd = 8;
+            in_ht = 8;
+            in_channels = 16;
+            out_channels = 32;
+            filter_ht = 3;
+            filter_wd = 3;
+            pad_wd = 1;
+            pad_ht = 1;
+            stride_wd = 1;
+            stride_ht = 1;
+            break;
+        case 3: // valid conv, odd conv output (last row/col not pooled)
+            in_wd = 13;
+            in_ht = 10;
+            in_channels = 3;
+            out_channels = 5;
+            filter_ht = 3;
+            filter_wd = 3;
+            pad_wd = 0;
+            pad_ht = 0;
+            stride_wd = 1;
+            stride_ht = 1;
+            break;
+        case 4: // 1x1 filter, stride 2
+            in_wd = 12;
+            in_ht = 12;
+            in_channels = 4;
+            out_channels = 6;
+            filter_ht = 1;
+            filter_wd = 1;
+            pad_wd = 0;
+            pad_ht = 0;
+            stride_wd = 2;
+            stride_ht = 2;
+            break;
+        default: // non square 5x3 filter
+            in_wd = 20;
+            in_ht = 9;
+            in_channels = 2;
+            out_channels = 4;
+            filter_ht = 3;
+            filter_wd = 5;
+            pad_wd = 2;
+            pad_ht = 1;
+            stride_wd = 1;
+            stride_ht = 1;
+            break;
+        }
+
+        /* prepare data */
+        if (pad_wd) {
+            conv_wd = (in_wd + stride_wd - 1) / stride_wd;
+        } else {
+            conv_wd = (in_wd + stride_wd - filter_wd) / stride_wd;
+        }
+        if (pad_ht) {
+            conv_ht = (in_ht + stride_ht - 1) / stride_ht;
+        } else {
+            conv_ht = (in_ht + stride_ht - filter_ht) / stride_ht;
+        }
+        out_wd = conv_wd / 2;
+        out_ht = conv_ht / 2;
+
+        int in_size = in_wd * in_ht * in_channels;
+        int filter_size = filter_wd * filter_ht * in_channels * out_channels;
+        int conv_size = conv_wd * conv_ht * out_channels;
+        int out_size = out_wd * out_ht * out_channels;
+
+        input = ESP_NN_TEST_ALLOC(in_size);
+        conv_out = ESP_NN_TEST_ALLOC(conv_size);
+        out_data_ref = ESP_NN_TEST_ALLOC(out_size);
+        out_data_c = ESP_NN_TEST_ALLOC(out_size);
+        out_data_opt = ESP_NN_TEST_ALLOC(out_size);
+        filter_data = ESP_NN_TEST_ALLOC(filter_size);
+        bias = ESP_NN_TEST_ALLOC(sizeof (int32_t) * out_channels);
+        out_shift = ESP_NN_TEST_ALLOC(sizeof (int32_t) * out_channels);
+        out_mult = ESP_NN_TEST_ALLOC(sizeof (int32_t) * out_channels);
+
+        if (input == NULL || filter_data == NULL || conv_out == NULL || out_data_ref == NULL ||
+                out_data_c == NULL || out_data_opt == NULL) {
+            printf(ANSI_COLOR_RED"input/filter/out_data allocations failed\n"ANSI_COLOR_RESET);
+            goto conv_s8_maxpool2x2_cleanup;
+        }
+
+        if (bias == NULL || out_shift == NULL || out_mult == NULL) {
+            printf(ANSI_COLOR_RED"bias/out_shift/out_mult allocations failed\n"ANSI_COLOR_RESET);
+            goto conv_s8_maxpool2x2_cleanup;
+        }
+
+        /* Generate input data between -128 -> +127 */
+        for (int i = 0; i < in_size; ++i) {
+            input[i] = rand() % 255 - 128;
+        }
+
+        /* Generate filter data between -128 -> +127 */
+        for (int i = 0; i < filter_size; ++i) {
+            filter_data[i] = rand() % 256 - 128;
+        }
+
+        /* Generate bias data, centered so that ReLU clips about half */
+        for (int i = 0; i < out_channels; ++i) {
+            bias[i] = (int32_t)rand() % UINT16_MAX - INT16_MAX;
+        }
+
+        /* Shift and multiplier */
+        for (int i = 0; i < out_channels; ++i) {
+            out_shift[i] = -10 + rand() % 2;
+            out_mult[i] = 0x7f67f4f8 + rand() % 50;
+        }
+
+        data_dims_t input_dims = {.width = in_wd, .height = in_ht, .channels = in_channels, 1};
+        data_dims_t conv_dims = {.width = conv_wd, .height = conv_ht, .channels = out_channels, 1};
+        data_dims_t output_dims = {.width = out_wd, .height = out_ht, .channels = out_channels, 1};
+        data_dims_t filter_dims = {.width = filter_wd, .height = filter_ht, 0, 0};
+        conv_params_t conv_params = {.in_offset = input_offset, .out_offset = out_offset,
+                                    .stride = {stride_wd, stride_ht}, .padding = {pad_wd, pad_ht},
+                                    .dilation = {0, 0}, .activation = {activation_min, activation_max}};
+        quant_data_t quant_data = {.shift = out_shift, .mult = out_mult};
+
+        int scratch_buf_size = esp_nn_get_conv_s8_maxpool2x2_scratch_size(&input_dims, &filter_dims,
+                                                                          &output_dims, &conv_params);
+        if (scratch_buf_size > 0) {
+            scratch_buf = ESP_NN_TEST_ALLOC(scratch_buf_size + 16);
+            if (scratch_buf == NULL) {
+                printf(ANSI_COLOR_RED"scratch_buf alloc failed size %d\n"ANSI_COLOR_RESET, scratch_buf_size);
+                goto conv_s8_maxpool2x2_cleanup;
+            }
+            int align_sz = 16 - (((int32_t) scratch_buf) & 0xf);
+            esp_nn_set_conv_s8_maxpool2x2_scratch_buf(scratch_buf + align_sz);
+        }
+
+        /* Unfused reference: conv, then 2x2 max pool */
+        esp_nn_conv_s8_ansi(&input_dims, input, &filter_dims, filter_data,
+                            bias, &conv_dims, conv_out, &conv_params, &quant_data);
+        esp_nn_max_pool_s8_ansi(conv_out, conv_wd, conv_ht, out_data_ref, out_wd, out_ht,
+                                2, 2, 2, 2, 0, 0, activation_min, activation_max, out_channels);
+
+        /* enable profiler */
+        profile_c_start();
+
+        /* C function */
+        esp_nn_conv_s8_maxpool2x2_ansi(&input_dims, input, &filter_dims, filter_data,
+                                       bias, &output_dims, out_data_c, &conv_params, &quant_data);
+
+        total_c = profile_c_end();
+        profile_opt_start();
+
+        /* Optimized function */
+        esp_nn_conv_s8_maxpool2x2(&input_dims, input, &filter_dims, filter_data,
+                                  bias, &output_dims, out_data_opt, &conv_params, &quant_data);
+
+        /* disable profiler */
+        total_opt = profile_opt_end();
+
+        bool ret = CHECK_EQUAL(out_data_ref, out_data_c, out_size) &&
+                   CHECK_EQUAL(out_data_ref, out_data_opt, out_size);
+        if (ret == false) {
+            printf(ANSI_COLOR_RED"[%3d] failed [pad: (%d, %d), stride: (%d, %d)"
+                   " out: (%3d,%3d,%3d), filter: (%d, %d,%3d)]\n"ANSI_COLOR_RESET,
+                   itr, pad_wd, pad_ht, stride_wd, stride_ht, out_wd, out_ht,
+                   out_channels, filter_wd, filter_ht, in_channels);
+            goto conv_s8_maxpool2x2_cleanup;
+        }
+        printf(ANSI_COLOR_GREEN"[%3d] passed [pad: (%d, %d), stride: (%d, %d)"
+               " out: (%3d,%3d,%3d), filter: (%d, %d,%3d)]"ANSI_COLOR_RESET,
+               itr, pad_wd, pad_ht, stride_wd, stride_ht, out_wd, out_ht,
+               out_channels, filter_wd, filter_ht, in_channels);
+        printf("\tcycles: c %8"PRIu32", opt %8"PRIu32"\n", total_c, total_opt);
+
+    conv_s8_maxpool2x2_cleanup:
+        free(input);
+        free(conv_out);
+        free(filter_data);
+        free(out_data_ref);
+        free(out_data_c);
+        free(out_data_opt);
+        free(bias);
+        free(out_shift);
+        free(out_mult);
+        free(scratch_buf);
+        input = conv_out = filter_data = NULL;
+        out_data_ref = out_data_c = out_data_opt = NULL;
+        bias = out_shift = out_mult = NULL;
+        scratch_buf = NULL;
+    }
+}
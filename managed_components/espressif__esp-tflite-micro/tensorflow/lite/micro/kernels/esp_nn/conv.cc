@@ -45,7 +45,7 @@ struct NodeData {
 
 static void* Init(TfLiteContext* context, const char* buffer, size_t length) {
   TFLITE_DCHECK(context->AllocatePersistentBuffer != nullptr);
-  return context->AllocatePersistentBuffer(context, sizeof(OpDataConv));
+  return context->AllocatePersistentBuffer(context, sizeof(NodeData));
 }
 
 static TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
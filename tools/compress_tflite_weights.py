@@ -0,0 +1,294 @@
+#!/usr/bin/env python3
+"""
+LUT weight compression for the sound classification model.
+
+Replaces the int8 filter tensors of CONV_2D, DEPTHWISE_CONV_2D,
+FULLY_CONNECTED and fused CONV_2D_MAXPOOL_2X2 ops with bit-packed indices into small per-channel value
+tables, in the TFLM compression format (schema version 1):
+
+- the tensor buffer holds the indices, packed MSB first
+- a new buffer holds one value table per quantization channel, each padded
+  to 2^bits entries
+- a size-prefixed "COMPRESSION_METADATA" model metadata entry lists every
+  compressed tensor with its value buffer and index bit width
+
+A channel that already uses at most 2^bits distinct values is stored
+losslessly. Otherwise its values are clustered with 1-D k-means and rounded
+back to int8, which changes the model: re-check accuracy before deploying,
+or pass --lossless to leave such tensors untouched.
+
+The firmware decodes each filter into an arena scratch buffer right before
+its op runs (components/model/src/model_compression.cc), so the model
+shrinks in flash while inference keeps running the regular int8 kernels.
+Enable CONFIG_MODEL_LUT_COMPRESSION to embed the output file.
+
+Usage:
+    python tools/compress_tflite_weights.py \\
+        components/model/models/sound_classifier.tflite \\
+        components/model/models/sound_classifier_lut.tflite --bits 4
+
+Requires TensorFlow (for the flatbuffer object API), as used to train and
+convert the model in models/fresh.ipynb.
+"""
+
+import argparse
+import collections
+import math
+import sys
+
+import flatbuffers
+import numpy as np
+
+try:
+    from tensorflow.lite.python import schema_py_generated as schema_fb
+    from tensorflow.lite.tools import flatbuffer_utils
+except ImportError:  # pragma: no cover - only hit without TensorFlow
+    schema_fb = None
+    flatbuffer_utils = None
+
+COMPRESSION_METADATA = 'COMPRESSION_METADATA'
+SCHEMA_VERSION = 1
+TENSOR_TYPE_INT8 = 9
+
+# Builtin operator name -> input index of its weight tensor
+WEIGHT_INPUTS = {
+    'CONV_2D': 1,
+    'DEPTHWISE_CONV_2D': 1,
+    'FULLY_CONNECTED': 1,
+}
+
+# Custom code -> input index of its weight tensor (simplify_tflite_graph.py --fuse-conv-pool)
+CUSTOM_WEIGHT_INPUTS = {
+    'CONV_2D_MAXPOOL_2X2': 1,
+}
+
+
+def builtin_code(model, op):
+    """Returns the builtin operator code of an operator."""
+    code = model.operatorCodes[op.opcodeIndex]
+    return max(code.builtinCode, code.deprecatedBuiltinCode)
+
+
+def weight_input(model, op, builtin_inputs):
+    """Returns the input index of an operator's weight tensor, or None."""
+    code = model.operatorCodes[op.opcodeIndex]
+    if builtin_code(model, op) == schema_fb.BuiltinOperator.CUSTOM:
+        custom = code.customCode.decode() if isinstance(code.customCode, bytes) else code.customCode
+        return CUSTOM_WEIGHT_INPUTS.get(custom)
+    return builtin_inputs.get(builtin_code(model, op))
+
+
+def kmeans_1d(values, clusters, iterations=50):
+    """Clusters scalar values, returning the sorted centroids."""
+    centroids = np.quantile(values, np.linspace(0.0, 1.0, clusters))
+    for _ in range(iterations):
+        labels = np.abs(values[:, None] - centroids[None, :]).argmin(axis=1)
+        updated = centroids.copy()
+        for k in range(clusters):
+            members = values[labels == k]
+            if members.size:
+                updated[k] = members.mean()
+        if np.allclose(updated, centroids):
+            break
+        centroids = updated
+    return np.sort(centroids)
+
+
+def channel_table(values, bits, lossless):
+    """
+    Builds the value table of one channel.
+
+    Returns (table, indices), or None when the channel needs more than
+    2^bits values and lossless compression was requested.
+    """
+    unique = np.unique(values)
+    if unique.size > (1 << bits):
+        if lossless:
+            return None
+        centroids = kmeans_1d(values.astype(np.float64), 1 << bits)
+        unique = np.unique(np.clip(np.round(centroids), -128, 127).astype(np.int8))
+    indices = np.abs(values[:, None].astype(np.int16) - unique[None, :].astype(np.int16)).argmin(axis=1)
+    return unique, indices
+
+
+def pack_indices(indices, bits):
+    """Packs indices MSB first into bytes."""
+    bit_matrix = (indices[:, None] >> np.arange(bits - 1, -1, -1)) & 1
+    return np.packbits(bit_matrix.astype(np.uint8).reshape(-1))
+
+
+class LutCompressor:
+    """Compresses the weight tensors of a ModelT in place."""
+
+    def __init__(self, model, bits, lossless, min_bytes):
+        self.model = model
+        self.graph = model.subgraphs[0]
+        self.bits = bits
+        self.lossless = lossless
+        self.min_bytes = min_bytes
+        self.entries = []           # (tensor, value_buffer, bit width)
+        self.skipped = collections.Counter()
+        self.report = []
+
+    def weight_tensors(self):
+        """Yields tensor indices used as weights, each once."""
+        ops = {getattr(schema_fb.BuiltinOperator, name): index for name, index in WEIGHT_INPUTS.items()}
+        seen = set()
+        for op in self.graph.operators:
+            input_index = weight_input(self.model, op, ops)
+            if input_index is None or len(op.inputs) <= input_index:
+                continue
+            tensor_index = op.inputs[input_index]
+            if tensor_index >= 0 and tensor_index not in seen:
+                seen.add(tensor_index)
+                yield tensor_index
+
+    def buffer_users(self, buffer_index):
+        return sum(1 for tensor in self.graph.tensors if tensor.buffer == buffer_index)
+
+    def compress_tensor(self, tensor_index):
+        tensor = self.graph.tensors[tensor_index]
+        buffer = self.model.buffers[tensor.buffer]
+        if tensor.type != TENSOR_TYPE_INT8 or buffer.data is None:
+            self.skipped['not int8 constant'] += 1
+            return
+        if self.buffer_users(tensor.buffer) > 1:
+            self.skipped['shared buffer'] += 1
+            return
+
+        shape = [int(d) for d in tensor.shape]
+        weights = np.frombuffer(bytes(bytearray(buffer.data)), dtype=np.int8).reshape(shape)
+        quant = tensor.quantization
+        channels = 1
+        axis = 0
+        if quant is not None and quant.scale is not None and len(quant.scale) > 1:
+            channels = len(quant.scale)
+            axis = int(getattr(quant, 'quantizedDimension', 0) or 0)
+            if axis not in (0, len(shape) - 1):
+                self.skipped['unsupported channel axis'] += 1
+                return
+
+        # Channel-major view for table building, element order kept for packing
+        per_channel = np.moveaxis(weights, axis, 0).reshape(channels, -1)
+        tables = []
+        channel_indices = []
+        for values in per_channel:
+            result = channel_table(values, self.bits, self.lossless)
+            if result is None:
+                self.skipped['too many values'] += 1
+                return
+            tables.append(result[0])
+            channel_indices.append(result[1])
+
+        # Narrowest bit width that still addresses every table
+        bits = max(1, math.ceil(math.log2(max(table.size for table in tables))))
+        stride = 1 << bits
+        value_table = np.zeros((channels, stride), dtype=np.int8)
+        for channel, table in enumerate(tables):
+            value_table[channel, :table.size] = table
+
+        indices = np.stack(channel_indices).reshape(np.moveaxis(weights, axis, 0).shape)
+        indices = np.moveaxis(indices, 0, axis).reshape(-1)
+        packed = pack_indices(indices, bits)
+
+        compressed_bytes = packed.size + value_table.size
+        if weights.size - compressed_bytes < self.min_bytes:
+            self.skipped['not worth it'] += 1
+            return
+
+        decoded = np.take_along_axis(value_table, np.stack(channel_indices), axis=1)
+        max_error = int(np.abs(decoded.astype(np.int16) - per_channel.astype(np.int16)).max())
+
+        buffer.data = packed
+        value_buffer = schema_fb.BufferT()
+        value_buffer.data = value_table.reshape(-1).view(np.uint8)
+        self.model.buffers.append(value_buffer)
+        self.entries.append((tensor_index, len(self.model.buffers) - 1, bits))
+        self.report.append((tensor.name, weights.size, compressed_bytes, bits, max_error))
+
+    def metadata_buffer(self):
+        """Serializes the compression metadata as a size-prefixed flatbuffer."""
+        builder = flatbuffers.Builder(256)
+        luts = []
+        for tensor_index, value_buffer, bits in self.entries:
+            builder.StartObject(3)
+            builder.PrependInt32Slot(0, tensor_index, -1)
+            builder.PrependUint32Slot(1, value_buffer, 0)
+            builder.PrependUint8Slot(2, bits, 0)
+            luts.append(builder.EndObject())
+        builder.StartVector(4, len(luts), 4)
+        for lut in reversed(luts):
+            builder.PrependUOffsetTRelative(lut)
+        lut_vector = builder.EndVector(len(luts))
+
+        builder.StartObject(1)
+        builder.PrependUOffsetTRelativeSlot(0, lut_vector, 0)
+        subgraph = builder.EndObject()
+        builder.StartVector(4, 1, 4)
+        builder.PrependUOffsetTRelative(subgraph)
+        subgraph_vector = builder.EndVector(1)
+
+        builder.StartObject(2)
+        builder.PrependInt32Slot(0, SCHEMA_VERSION, 0)
+        builder.PrependUOffsetTRelativeSlot(1, subgraph_vector, 0)
+        builder.FinishSizePrefixed(builder.EndObject())
+        return np.frombuffer(bytes(builder.Output()), dtype=np.uint8)
+
+    def run(self):
+        for tensor_index in self.weight_tensors():
+            self.compress_tensor(tensor_index)
+        if not self.entries:
+            return
+
+        metadata_buffer = schema_fb.BufferT()
+        metadata_buffer.data = self.metadata_buffer()
+        self.model.buffers.append(metadata_buffer)
+        metadata = schema_fb.MetadataT()
+        metadata.name = COMPRESSION_METADATA
+        metadata.buffer = len(self.model.buffers) - 1
+        self.model.metadata = (self.model.metadata or []) + [metadata]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n\n')[0].strip())
+    parser.add_argument('input', help='quantized .tflite model')
+    parser.add_argument('output', help='LUT-compressed .tflite model')
+    parser.add_argument('--bits', type=int, default=4, choices=range(1, 8),
+                        help='maximum index bit width (default: 4)')
+    parser.add_argument('--lossless', action='store_true',
+                        help='only compress tensors that need no clustering')
+    parser.add_argument('--min-saving', type=int, default=64,
+                        help='skip tensors saving fewer bytes (default: 64)')
+    args = parser.parse_args()
+
+    if flatbuffer_utils is None:
+        sys.exit('TensorFlow is required: pip install tensorflow')
+
+    with open(args.input, 'rb') as f:
+        input_size = len(f.read())
+    model = flatbuffer_utils.read_model(args.input)
+    if len(model.subgraphs) != 1:
+        sys.exit('Only single-subgraph models are supported')
+    if any(m.name == COMPRESSION_METADATA for m in model.metadata or []):
+        sys.exit('Model is already compressed')
+
+    compressor = LutCompressor(model, args.bits, args.lossless, args.min_saving)
+    compressor.run()
+    flatbuffer_utils.write_model(model, args.output)
+
+    with open(args.output, 'rb') as f:
+        output_size = len(f.read())
+
+    for name, original, compressed, bits, max_error in compressor.report:
+        name = name.decode() if isinstance(name, bytes) else name
+        print(f'  {name[:40]:<40} {original:>7} -> {compressed:>6} bytes, '
+              f'{bits} bit, max error {max_error}')
+    print(f'Compressed: {len(compressor.entries)} tensors')
+    print(f'Skipped:    {dict(compressor.skipped) or "-"}')
+    print(f'Size:       {input_size} -> {output_size} bytes')
+    print(f'Device arena: up to +{max((r[1] for r in compressor.report), default=0)} bytes of scratch '
+          f'(the largest filter, decoded per op)')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,347 @@
+#!/usr/bin/env python3
+"""
+16x8 conversion of the sound classification model.
+
+Rewrites an int8 model into the 16x8 scheme (int16 activations, int8
+weights, int64 biases) with a raw PCM input, which the firmware copies into
+the input tensor without any preprocessing (predict_pcm()):
+
+- the input becomes int16 with scale 1/32768, so a sample s stands for
+  s / 32768 in [-1, 1)
+- every other activation becomes symmetric int16 covering the real range of
+  its int8 quantization, and the SOFTMAX output uses the 1/32768 scale the
+  int16 kernel requires
+- biases are requantized to int64 for the new input scales
+- FULLY_CONNECTED filters become per-tensor (TFLM has no per-channel 16x8
+  kernel), rounded to the step of their largest channel scale
+- each graph output gets a QUANTIZE back to its original int8 parameters,
+  so the output contract (classes, heads, embedding) does not change
+- CONV_2D_MAXPOOL_2X2 ops (int8 only) are split back into CONV_2D and
+  MAX_POOL_2D
+
+The weights are not retrained: the int8 model was trained on min-max
+normalized windows in [0, 1], while the converted one sees fixed-scale PCM,
+so its predictions differ. The output exercises the int16 input contract
+end to end; a deployable model has to be trained on fixed-scale PCM and
+exported with 16x8 quantization (inference_input_type=tf.int16), which this
+script then does not need to touch.
+
+The offline memory plan is dropped (every activation doubles in size);
+re-run plan_tflite_memory.py on the output if one is wanted. LUT-compressed
+models are rejected: convert first, then compress.
+
+Usage:
+    python tools/convert_tflite_int16.py \\
+        components/model/models/sound_classifier.tflite \\
+        components/model/models/sound_classifier_int16.tflite
+
+Requires TensorFlow (for the flatbuffer object API), as used to train and
+convert the model in models/fresh.ipynb.
+"""
+
+import argparse
+import sys
+
+import numpy as np
+
+try:
+    from tensorflow.lite.python import schema_py_generated as schema_fb
+    from tensorflow.lite.tools import flatbuffer_utils
+except ImportError:  # pragma: no cover - only hit without TensorFlow
+    schema_fb = None
+    flatbuffer_utils = None
+
+CONV_MAXPOOL_CUSTOM_CODE = 'CONV_2D_MAXPOOL_2X2'
+CONV_MAXPOOL_OPTIONS_VERSION = 1
+DROPPED_METADATA = ('OfflineMemoryAllocation',)
+INPUT_SCALE = 1.0 / 32768
+SOFTMAX_SCALE = 1.0 / 32768
+
+TENSOR_TYPE_INT32 = 2
+TENSOR_TYPE_INT64 = 4
+TENSOR_TYPE_INT16 = 7
+TENSOR_TYPE_INT8 = 9
+
+# Builtin operator name -> input indices of (filter, bias)
+WEIGHTED_OPS = {
+    'CONV_2D': (1, 2),
+    'DEPTHWISE_CONV_2D': (1, 2),
+    'FULLY_CONNECTED': (1, 2),
+}
+
+# Ops whose output reuses the input quantization (no requantization in the kernel)
+PASS_THROUGH_OPS = ('MAX_POOL_2D', 'RESHAPE')
+
+SUPPORTED_OPS = set(WEIGHTED_OPS) | set(PASS_THROUGH_OPS) | {'AVERAGE_POOL_2D', 'SOFTMAX'}
+
+
+def as_str(name):
+    return name.decode() if isinstance(name, bytes) else name
+
+
+class Int16Converter:
+    """Rewrites the main subgraph of a ModelT in place."""
+
+    def __init__(self, model):
+        self.model = model
+        self.graph = model.subgraphs[0]
+        self.ops = schema_fb.BuiltinOperator
+        self.op_names = {value: name for name, value in vars(self.ops).items() if not name.startswith('_')}
+        self.per_tensor = 0
+
+    # -- helpers ------------------------------------------------------------
+
+    def builtin_code(self, op):
+        code = self.model.operatorCodes[op.opcodeIndex]
+        return max(code.builtinCode, code.deprecatedBuiltinCode)
+
+    def op_name(self, op):
+        code = self.builtin_code(op)
+        if code == self.ops.CUSTOM:
+            return as_str(self.model.operatorCodes[op.opcodeIndex].customCode)
+        return self.op_names.get(code, str(code))
+
+    def opcode(self, builtin):
+        """Returns the operator code index of a builtin op, adding it if needed."""
+        for index, code in enumerate(self.model.operatorCodes):
+            if max(code.builtinCode, code.deprecatedBuiltinCode) == builtin:
+                return index
+        code = schema_fb.OperatorCodeT()
+        code.builtinCode = builtin
+        code.deprecatedBuiltinCode = min(builtin, 127)
+        code.version = 1
+        self.model.operatorCodes.append(code)
+        return len(self.model.operatorCodes) - 1
+
+    def is_constant(self, index):
+        buffer = self.model.buffers[self.graph.tensors[index].buffer]
+        return buffer.data is not None and len(buffer.data) > 0
+
+    def constant(self, index, dtype):
+        buffer = self.model.buffers[self.graph.tensors[index].buffer]
+        return np.frombuffer(bytes(bytearray(buffer.data)), dtype=dtype)
+
+    def add_tensor(self, like, shape, tensor_type, scale, zero_point, suffix):
+        """Appends a computed tensor named after `like` and returns its index."""
+        tensor = schema_fb.TensorT()
+        tensor.name = as_str(self.graph.tensors[like].name) + suffix
+        tensor.shape = np.array(shape, dtype=np.int32)
+        tensor.type = tensor_type
+        tensor.buffer = 0
+        tensor.quantization = quantization(scale, zero_point)
+        self.graph.tensors.append(tensor)
+        return len(self.graph.tensors) - 1
+
+    def per_tensor_filter(self, index):
+        """Requantizes a per-channel int8 filter to the largest channel scale.
+
+        TFLM's FULLY_CONNECTED only takes per-channel filters with int8
+        inputs, so channels with a smaller scale are rounded to the coarser
+        step of the largest one.
+        """
+        tensor = self.graph.tensors[index]
+        scales = np.asarray(tensor.quantization.scale, dtype=np.float64)
+        if len(scales) == 1:
+            return
+        channels = len(scales)
+        values = self.constant(index, np.int8).reshape(channels, -1).astype(np.float64)
+        scale = scales.max()
+        values = np.clip(np.round(values * (scales[:, None] / scale)), -127, 127).astype(np.int8)
+        buffer = schema_fb.BufferT()
+        buffer.data = np.frombuffer(values.tobytes(), dtype=np.uint8)
+        self.model.buffers.append(buffer)
+        tensor.buffer = len(self.model.buffers) - 1
+        tensor.quantization = quantization(scale, 0)
+        self.per_tensor += 1
+
+    # -- passes -------------------------------------------------------------
+
+    def split_conv_pool(self):
+        """Turns every CONV_2D_MAXPOOL_2X2 back into CONV_2D + MAX_POOL_2D."""
+        operators = []
+        split = 0
+        for op in self.graph.operators:
+            if self.op_name(op) != CONV_MAXPOOL_CUSTOM_CODE:
+                operators.append(op)
+                continue
+            version, padding, stride_w, stride_h, activation = np.frombuffer(
+                bytes(bytearray(op.customOptions)), dtype='<i4')[:5]
+            if version != CONV_MAXPOOL_OPTIONS_VERSION:
+                sys.exit(f'{CONV_MAXPOOL_CUSTOM_CODE} options version {version} is not supported')
+
+            pooled = op.outputs[0]
+            batch, height, width, channels = self.graph.tensors[pooled].shape
+            q = self.graph.tensors[pooled].quantization
+            conv_output = self.add_tensor(pooled, [batch, height * 2, width * 2, channels],
+                                          TENSOR_TYPE_INT8, q.scale[0], q.zeroPoint[0], '/conv')
+
+            conv = schema_fb.OperatorT()
+            conv.opcodeIndex = self.opcode(self.ops.CONV_2D)
+            conv.inputs = op.inputs
+            conv.outputs = [conv_output]
+            conv.builtinOptionsType = schema_fb.BuiltinOptions.Conv2DOptions
+            conv.builtinOptions = schema_fb.Conv2DOptionsT()
+            conv.builtinOptions.padding = int(padding)
+            conv.builtinOptions.strideW = int(stride_w)
+            conv.builtinOptions.strideH = int(stride_h)
+            conv.builtinOptions.fusedActivationFunction = int(activation)
+            conv.builtinOptions.dilationWFactor = 1
+            conv.builtinOptions.dilationHFactor = 1
+
+            pool = schema_fb.OperatorT()
+            pool.opcodeIndex = self.opcode(self.ops.MAX_POOL_2D)
+            pool.inputs = [conv_output]
+            pool.outputs = [pooled]
+            pool.builtinOptionsType = schema_fb.BuiltinOptions.Pool2DOptions
+            pool.builtinOptions = schema_fb.Pool2DOptionsT()
+            pool.builtinOptions.padding = schema_fb.Padding.VALID
+            pool.builtinOptions.strideW = pool.builtinOptions.strideH = 2
+            pool.builtinOptions.filterWidth = pool.builtinOptions.filterHeight = 2
+            pool.builtinOptions.fusedActivationFunction = schema_fb.ActivationFunctionType.NONE
+
+            operators += [conv, pool]
+            split += 1
+        self.graph.operators = operators
+
+        # Drop the custom operator code, which shifts the indices after it
+        code_map = {}
+        codes = []
+        for index, code in enumerate(self.model.operatorCodes):
+            if as_str(code.customCode) != CONV_MAXPOOL_CUSTOM_CODE:
+                code_map[index] = len(codes)
+                codes.append(code)
+        self.model.operatorCodes = codes
+        for op in operators:
+            op.opcodeIndex = code_map[op.opcodeIndex]
+        return split
+
+    def convert(self):
+        graph = self.graph
+        unsupported = {self.op_name(op) for op in graph.operators} - SUPPORTED_OPS
+        if unsupported:
+            sys.exit(f'Unsupported ops for 16x8 conversion: {", ".join(sorted(unsupported))}')
+
+        # New activation quantization of every computed tensor, keyed by index
+        int8_quant = {}
+        for op in graph.operators:
+            for index in list(op.inputs) + list(op.outputs):
+                if index < 0 or self.is_constant(index) or index in int8_quant:
+                    continue
+                tensor = graph.tensors[index]
+                if tensor.type != TENSOR_TYPE_INT8:
+                    sys.exit(f'{as_str(tensor.name)} is not int8')
+                int8_quant[index] = (float(tensor.quantization.scale[0]), int(tensor.quantization.zeroPoint[0]))
+
+        scales = {}
+        for index, (scale, zero_point) in int8_quant.items():
+            scales[index] = max(abs(-128 - zero_point), abs(127 - zero_point)) * scale / 32767
+        for index in graph.inputs:
+            scales[index] = INPUT_SCALE
+        for op in graph.operators:
+            name = self.op_name(op)
+            if name == 'SOFTMAX':
+                scales[op.outputs[0]] = SOFTMAX_SCALE
+            elif name in PASS_THROUGH_OPS:
+                scales[op.outputs[0]] = scales[op.inputs[0]]
+
+        # Biases follow the new input scale; filters keep their int8 values
+        for op in graph.operators:
+            if self.op_name(op) not in WEIGHTED_OPS:
+                continue
+            filter_index, bias_index = WEIGHTED_OPS[self.op_name(op)]
+            if len(op.inputs) <= bias_index or op.inputs[bias_index] < 0:
+                continue
+            bias = graph.tensors[op.inputs[bias_index]]
+            if bias.type != TENSOR_TYPE_INT32:
+                sys.exit(f'{as_str(bias.name)} is not an int32 bias')
+            if self.op_name(op) == 'FULLY_CONNECTED':
+                self.per_tensor_filter(op.inputs[filter_index])
+            filter_scales = np.asarray(graph.tensors[op.inputs[filter_index]].quantization.scale, dtype=np.float64)
+            old_scales = np.asarray(bias.quantization.scale, dtype=np.float64)
+            new_scales = scales[op.inputs[0]] * filter_scales
+            values = self.constant(op.inputs[bias_index], np.int32).astype(np.float64)
+            values = np.round(values * old_scales / new_scales).astype(np.int64)
+            buffer = schema_fb.BufferT()
+            buffer.data = np.frombuffer(values.tobytes(), dtype=np.uint8)
+            self.model.buffers.append(buffer)
+            bias.buffer = len(self.model.buffers) - 1
+            bias.type = TENSOR_TYPE_INT64
+            bias.quantization = quantization(new_scales, np.zeros(len(new_scales), dtype=np.int64))
+
+        for index, scale in scales.items():
+            graph.tensors[index].type = TENSOR_TYPE_INT16
+            graph.tensors[index].quantization = quantization(scale, 0)
+
+        # Requantize each output back to int8 so the firmware reads the same contract
+        outputs = []
+        for index in graph.outputs:
+            scale, zero_point = int8_quant[index]
+            output = self.add_tensor(index, list(graph.tensors[index].shape), TENSOR_TYPE_INT8,
+                                     scale, zero_point, '/int8')
+            op = schema_fb.OperatorT()
+            op.opcodeIndex = self.opcode(self.ops.QUANTIZE)
+            op.inputs = [index]
+            op.outputs = [output]
+            graph.operators.append(op)
+            outputs.append(output)
+        remap = dict(zip(graph.outputs, outputs))
+        graph.outputs = outputs
+        for signature in self.model.signatureDefs or []:
+            for entry in signature.outputs or []:
+                entry.tensorIndex = remap.get(entry.tensorIndex, entry.tensorIndex)
+
+        dropped = [m for m in self.model.metadata or [] if as_str(m.name) in DROPPED_METADATA]
+        self.model.metadata = [m for m in self.model.metadata or [] if m not in dropped]
+        self.prune_buffers()
+        return len(scales), [as_str(m.name) for m in dropped]
+
+    def prune_buffers(self):
+        """Removes the buffers replaced above (old biases, filters and metadata)."""
+        # Buffer 0 stays the empty sentinel required by the schema
+        buffer_map = {0: 0}
+        buffers = [self.model.buffers[0]]
+        for owner in list(self.graph.tensors) + list(self.model.metadata or []):
+            if owner.buffer not in buffer_map:
+                buffer_map[owner.buffer] = len(buffers)
+                buffers.append(self.model.buffers[owner.buffer])
+            owner.buffer = buffer_map[owner.buffer]
+        self.model.buffers = buffers
+
+
+def quantization(scale, zero_point):
+    q = schema_fb.QuantizationParametersT()
+    q.scale = np.atleast_1d(np.asarray(scale, dtype=np.float32))
+    q.zeroPoint = np.atleast_1d(np.asarray(zero_point, dtype=np.int64))
+    return q
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n\n')[0].strip())
+    parser.add_argument('input', help='int8 .tflite model')
+    parser.add_argument('output', help='16x8 .tflite model with an int16 PCM input')
+    args = parser.parse_args()
+
+    if flatbuffer_utils is None:
+        sys.exit('TensorFlow is required: pip install tensorflow')
+
+    model = flatbuffer_utils.read_model(args.input)
+    if len(model.subgraphs) != 1:
+        sys.exit('Only single-subgraph models are supported')
+    if any(as_str(m.name) == 'COMPRESSION_METADATA' for m in model.metadata or []):
+        sys.exit('LUT-compressed models are not supported: convert the plain model, then compress')
+
+    converter = Int16Converter(model)
+    split = converter.split_conv_pool()
+    converted, dropped = converter.convert()
+    flatbuffer_utils.write_model(model, args.output)
+
+    print(f'Split {CONV_MAXPOOL_CUSTOM_CODE}: {split}')
+    print(f'Activations converted to int16: {converted}')
+    print(f'Filters made per-tensor: {converter.per_tensor}')
+    print(f'Outputs requantized to int8: {len(model.subgraphs[0].outputs)}')
+    if dropped:
+        print(f'Dropped metadata: {", ".join(dropped)}')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,479 @@
+#!/usr/bin/env python3
+"""
+Generates the model sources compiled into the firmware from a .tflite file.
+
+Run by the model component's CMake custom command whenever the model changes:
+
+- model_data.cc/.h      the flatbuffer as a 16-byte aligned const array in flash
+- model_op_resolver.h   a MicroMutableOpResolver sized to exactly the ops in
+                        the graph, with the default registration of each
+                        (the ESP-NN kernels where the component builds
+                        them), plus the custom ops of this repo (the fused
+                        CONV_2D_MAXPOOL_2X2 of simplify_tflite_graph.py
+                        --fuse-conv-pool)
+- model_metadata.h      input/output shapes, types, quantization params,
+                        class names, the recurrent state of streaming
+                        models (SVDF/LSTM variable tensors, resource variables),
+                        the detection heads sharing the backbone and the
+                        embedding output, if the model has them
+
+The output layout is read from the model: output 0 is the classifier,
+every following output with 1 (sigmoid) or 2 (softmax) elements is a binary
+detection head, and a last, larger output is the embedding added by
+simplify_tflite_graph.py --expose-embedding. Heads are named after their
+signature outputs (the Keras output layer names), upper-cased, or HEAD<n>
+for the generic output_<n> names; --head-names overrides them.
+
+--name changes the "model" prefix of the files, the resolver namespace and
+the metadata macros, so a second model (the shadow model) can be compiled
+into the same component without clashing with the first.
+
+Only the Python standard library is needed, so it runs inside the ESP-IDF
+Python environment without TensorFlow.
+
+Usage:
+    python tools/generate_model_sources.py --model model.tflite \\
+        --output-dir build/generated --class-names ALARM BELL ...
+"""
+
+import argparse
+import os
+import re
+import struct
+import sys
+
+# Builtin operator code -> (schema name, MicroMutableOpResolver method)
+RESOLVER_METHODS = {
+    0: ('ADD', 'AddAdd'),
+    1: ('AVERAGE_POOL_2D', 'AddAveragePool2D'),
+    2: ('CONCATENATION', 'AddConcatenation'),
+    3: ('CONV_2D', 'AddConv2D'),
+    4: ('DEPTHWISE_CONV_2D', 'AddDepthwiseConv2D'),
+    5: ('DEPTH_TO_SPACE', 'AddDepthToSpace'),
+    6: ('DEQUANTIZE', 'AddDequantize'),
+    7: ('EMBEDDING_LOOKUP', 'AddEmbeddingLookup'),
+    8: ('FLOOR', 'AddFloor'),
+    9: ('FULLY_CONNECTED', 'AddFullyConnected'),
+    11: ('L2_NORMALIZATION', 'AddL2Normalization'),
+    12: ('L2_POOL_2D', 'AddL2Pool2D'),
+    14: ('LOGISTIC', 'AddLogistic'),
+    17: ('MAX_POOL_2D', 'AddMaxPool2D'),
+    18: ('MUL', 'AddMul'),
+    19: ('RELU', 'AddRelu'),
+    21: ('RELU6', 'AddRelu6'),
+    22: ('RESHAPE', 'AddReshape'),
+    23: ('RESIZE_BILINEAR', 'AddResizeBilinear'),
+    25: ('SOFTMAX', 'AddSoftmax'),
+    26: ('SPACE_TO_DEPTH', 'AddSpaceToDepth'),
+    27: ('SVDF', 'AddSvdf'),
+    28: ('TANH', 'AddTanh'),
+    34: ('PAD', 'AddPad'),
+    36: ('GATHER', 'AddGather'),
+    37: ('BATCH_TO_SPACE_ND', 'AddBatchToSpaceNd'),
+    38: ('SPACE_TO_BATCH_ND', 'AddSpaceToBatchNd'),
+    39: ('TRANSPOSE', 'AddTranspose'),
+    40: ('MEAN', 'AddMean'),
+    41: ('SUB', 'AddSub'),
+    42: ('DIV', 'AddDiv'),
+    43: ('SQUEEZE', 'AddSqueeze'),
+    44: ('UNIDIRECTIONAL_SEQUENCE_LSTM', 'AddUnidirectionalSequenceLSTM'),
+    45: ('STRIDED_SLICE', 'AddStridedSlice'),
+    47: ('EXP', 'AddExp'),
+    49: ('SPLIT', 'AddSplit'),
+    50: ('LOG_SOFTMAX', 'AddLogSoftmax'),
+    53: ('CAST', 'AddCast'),
+    54: ('PRELU', 'AddPrelu'),
+    55: ('MAXIMUM', 'AddMaximum'),
+    56: ('ARG_MAX', 'AddArgMax'),
+    57: ('MINIMUM', 'AddMinimum'),
+    58: ('LESS', 'AddLess'),
+    59: ('NEG', 'AddNeg'),
+    60: ('PADV2', 'AddPadV2'),
+    61: ('GREATER', 'AddGreater'),
+    62: ('GREATER_EQUAL', 'AddGreaterEqual'),
+    63: ('LESS_EQUAL', 'AddLessEqual'),
+    65: ('SLICE', 'AddSlice'),
+    66: ('SIN', 'AddSin'),
+    67: ('TRANSPOSE_CONV', 'AddTransposeConv'),
+    70: ('EXPAND_DIMS', 'AddExpandDims'),
+    71: ('EQUAL', 'AddEqual'),
+    72: ('NOT_EQUAL', 'AddNotEqual'),
+    73: ('LOG', 'AddLog'),
+    74: ('SUM', 'AddSum'),
+    75: ('SQRT', 'AddSqrt'),
+    76: ('RSQRT', 'AddRsqrt'),
+    77: ('SHAPE', 'AddShape'),
+    79: ('ARG_MIN', 'AddArgMin'),
+    82: ('REDUCE_MAX', 'AddReduceMax'),
+    83: ('PACK', 'AddPack'),
+    84: ('LOGICAL_OR', 'AddLogicalOr'),
+    86: ('LOGICAL_AND', 'AddLogicalAnd'),
+    87: ('LOGICAL_NOT', 'AddLogicalNot'),
+    88: ('UNPACK', 'AddUnpack'),
+    90: ('FLOOR_DIV', 'AddFloorDiv'),
+    92: ('SQUARE', 'AddSquare'),
+    93: ('ZEROS_LIKE', 'AddZerosLike'),
+    94: ('FILL', 'AddFill'),
+    95: ('FLOOR_MOD', 'AddFloorMod'),
+    97: ('RESIZE_NEAREST_NEIGHBOR', 'AddResizeNearestNeighbor'),
+    98: ('LEAKY_RELU', 'AddLeakyRelu'),
+    99: ('SQUARED_DIFFERENCE', 'AddSquaredDifference'),
+    100: ('MIRROR_PAD', 'AddMirrorPad'),
+    101: ('ABS', 'AddAbs'),
+    102: ('SPLIT_V', 'AddSplitV'),
+    104: ('CEIL', 'AddCeil'),
+    106: ('ADD_N', 'AddAddN'),
+    107: ('GATHER_ND', 'AddGatherNd'),
+    108: ('COS', 'AddCos'),
+    111: ('ELU', 'AddElu'),
+    114: ('QUANTIZE', 'AddQuantize'),
+    116: ('ROUND', 'AddRound'),
+    117: ('HARD_SWISH', 'AddHardSwish'),
+    118: ('IF', 'AddIf'),
+    119: ('WHILE', 'AddWhile'),
+    123: ('SELECT_V2', 'AddSelectV2'),
+    126: ('BATCH_MATMUL', 'AddBatchMatMul'),
+    128: ('CUMSUM', 'AddCumSum'),
+    129: ('CALL_ONCE', 'AddCallOnce'),
+    130: ('BROADCAST_TO', 'AddBroadcastTo'),
+    142: ('VAR_HANDLE', 'AddVarHandle'),
+    143: ('READ_VARIABLE', 'AddReadVariable'),
+    144: ('ASSIGN_VARIABLE', 'AddAssignVariable'),
+    145: ('BROADCAST_ARGS', 'AddBroadcastArgs'),
+}
+
+# Custom code -> (header in components/model/src, registration function)
+CUSTOM_REGISTRATIONS = {
+    'CONV_2D_MAXPOOL_2X2': ('model_conv_maxpool.h', 'Register_CONV_2D_MAXPOOL_2X2'),
+}
+
+# TensorType -> (name, C type)
+TENSOR_TYPES = {
+    0: ('FLOAT32', 'float'),
+    1: ('FLOAT16', 'uint16_t'),
+    2: ('INT32', 'int32_t'),
+    3: ('UINT8', 'uint8_t'),
+    4: ('INT64', 'int64_t'),
+    7: ('INT16', 'int16_t'),
+    9: ('INT8', 'int8_t'),
+}
+OP_CUSTOM = 32
+OP_VAR_HANDLE = 142
+
+
+class Table:
+    """Minimal read-only view of a flatbuffer table."""
+
+    def __init__(self, buf, pos):
+        self.buf = buf
+        self.pos = pos
+        vtable = pos - struct.unpack_from('<i', buf, pos)[0]
+        self.vtable = vtable
+        self.vtable_size = struct.unpack_from('<H', buf, vtable)[0]
+
+    def _field(self, index):
+        entry = 4 + 2 * index
+        if entry >= self.vtable_size:
+            return 0
+        return struct.unpack_from('<H', self.buf, self.vtable + entry)[0]
+
+    def scalar(self, index, fmt, default=0):
+        offset = self._field(index)
+        return struct.unpack_from('<' + fmt, self.buf, self.pos + offset)[0] if offset else default
+
+    def _indirect(self, index):
+        offset = self._field(index)
+        if not offset:
+            return None
+        pos = self.pos + offset
+        return pos + struct.unpack_from('<I', self.buf, pos)[0]
+
+    def table(self, index):
+        pos = self._indirect(index)
+        return None if pos is None else Table(self.buf, pos)
+
+    def vector(self, index, fmt):
+        pos = self._indirect(index)
+        if pos is None:
+            return []
+        length = struct.unpack_from('<I', self.buf, pos)[0]
+        return list(struct.unpack_from('<%d%s' % (length, fmt), self.buf, pos + 4))
+
+    def tables(self, index):
+        pos = self._indirect(index)
+        if pos is None:
+            return []
+        length = struct.unpack_from('<I', self.buf, pos)[0]
+        items = []
+        for i in range(length):
+            item = pos + 4 + 4 * i
+            items.append(Table(self.buf, item + struct.unpack_from('<I', self.buf, item)[0]))
+        return items
+
+    def string(self, index):
+        pos = self._indirect(index)
+        if pos is None:
+            return ''
+        length = struct.unpack_from('<I', self.buf, pos)[0]
+        return self.buf[pos + 4:pos + 4 + length].decode('utf-8', 'replace')
+
+
+def read_tensor(tensor):
+    """Extracts shape, type and quantization of a schema Tensor table."""
+    quant = tensor.table(4)
+    return {
+        'name': tensor.string(3),
+        'shape': [max(d, 1) for d in tensor.vector(0, 'i')],
+        'type': tensor.scalar(1, 'b'),
+        'scale': quant.vector(2, 'f') if quant else [],
+        'zero_point': quant.vector(3, 'q') if quant else [],
+    }
+
+
+def read_model(data):
+    """Returns the operator usage and boundary tensors of a .tflite model."""
+    if data[4:8] != b'TFL3':
+        sys.exit('Not a TFLite flatbuffer (missing TFL3 identifier)')
+    model = Table(data, struct.unpack_from('<I', data, 0)[0])
+
+    # Builtin code, or the custom_code string of a custom op
+    codes = []
+    for c in model.tables(1):
+        code = max(c.scalar(0, 'b'), c.scalar(3, 'i'))
+        codes.append(c.string(1) if code == OP_CUSTOM else code)
+    subgraphs = model.tables(2)
+
+    # Builtin codes and custom code strings used by the graph
+    ops = set()
+    variable_tensors = 0
+    resource_variables = 0
+    for graph in subgraphs:
+        tensors = graph.tables(0)
+        # Tensor.is_variable: SVDF and LSTM state kept across Invoke() calls
+        variable_tensors += sum(1 for t in tensors if t.scalar(5, 'B'))
+        for op in graph.tables(3):
+            code = codes[op.scalar(0, 'I')]
+            ops.add(code)
+            if code == OP_VAR_HANDLE:
+                resource_variables += 1
+
+    main = subgraphs[0]
+    tensors = main.tables(0)
+
+    # SignatureDef.outputs of the main subgraph: TensorMap name per tensor index
+    signature_names = {}
+    for signature in model.tables(7):
+        if signature.scalar(4, 'I') == 0:
+            for entry in signature.tables(1):
+                signature_names[entry.scalar(1, 'I')] = entry.string(0)
+    outputs = []
+    for i in main.vector(2, 'i'):
+        output = read_tensor(tensors[i])
+        output['signature_name'] = signature_names.get(i, '')
+        outputs.append(output)
+    return {
+        'ops': ops,
+        'variable_tensors': variable_tensors,
+        'resource_variables': resource_variables,
+        'inputs': [read_tensor(tensors[i]) for i in main.vector(1, 'i')],
+        'outputs': outputs,
+    }
+
+
+def element_count(shape):
+    count = 1
+    for dim in shape:
+        count *= dim
+    return count
+
+
+def write_if_changed(path, text):
+    """Writes a generated file, keeping its timestamp when unchanged."""
+    if os.path.exists(path):
+        with open(path) as f:
+            if f.read() == text:
+                return
+    with open(path, 'w') as f:
+        f.write(text)
+
+
+def banner(model_name):
+    return '// Generated by tools/generate_model_sources.py from %s - do not edit\n' % model_name
+
+
+def generate_model_data(data, name, symbol, model_name):
+    header = banner(model_name) + (
+        '#pragma once\n\n'
+        '#include <stddef.h>\n\n'
+        '#ifdef __cplusplus\nextern "C" {\n#endif\n\n'
+        'extern const unsigned char %(s)s[];   ///< Model flatbuffer in flash (16-byte aligned)\n'
+        'extern const size_t %(s)s_len;\n\n'
+        '#ifdef __cplusplus\n}\n#endif\n') % {'s': symbol}
+
+    rows = []
+    for i in range(0, len(data), 16):
+        rows.append('    ' + ', '.join('0x%02x' % b for b in data[i:i + 16]) + ',')
+    source = banner(model_name) + (
+        '#include "%(name)s_data.h"\n\n'
+        'alignas(16) extern const unsigned char %(s)s[] = {\n%(rows)s\n};\n\n'
+        'extern const size_t %(s)s_len = %(n)d;\n') % {'name': name, 's': symbol, 'rows': '\n'.join(rows), 'n': len(data)}
+    return header, source
+
+
+def generate_op_resolver(ops, name, model_name):
+    includes = {'tensorflow/lite/micro/micro_mutable_op_resolver.h'}
+    lines = []
+    # Builtin ops first, then custom ops by name
+    for code in sorted(ops, key=lambda c: (isinstance(c, str), c)):
+        if isinstance(code, str):
+            if code not in CUSTOM_REGISTRATIONS:
+                sys.exit('Custom operator %s has no registration in this firmware' % code)
+            header, function = CUSTOM_REGISTRATIONS[code]
+            includes.add(header)
+            lines.append('    TF_LITE_ENSURE_STATUS(resolver.AddCustom("%s", tflite::%s()));' % (code, function))
+            continue
+        if code not in RESOLVER_METHODS:
+            sys.exit('Operator %d is not supported by MicroMutableOpResolver' % code)
+        method = RESOLVER_METHODS[code][1]
+        lines.append('    TF_LITE_ENSURE_STATUS(resolver.%s());' % method)
+
+    return banner(model_name) + (
+        '#pragma once\n\n'
+        '%(includes)s\n\n'
+        'namespace %(name)s {\n\n'
+        'constexpr unsigned int kOpCount = %(count)d;\n\n'
+        'using OpResolver = tflite::MicroMutableOpResolver<kOpCount>;\n\n'
+        '/**\n'
+        ' * @brief Registers exactly the operators used by the model\n'
+        ' * @param resolver Resolver to fill\n'
+        ' * @return kTfLiteOk on success\n'
+        ' */\n'
+        'inline TfLiteStatus RegisterOps(OpResolver& resolver) {\n'
+        '%(lines)s\n'
+        '    return kTfLiteOk;\n'
+        '}\n\n'
+        '}  // namespace %(name)s\n') % {
+            'name': name,
+            'includes': '\n'.join('#include "%s"' % i for i in sorted(includes)),
+            'count': len(ops),
+            'lines': '\n'.join(lines),
+        }
+
+
+def tensor_defines(prefix, tensor):
+    type_name, _ = TENSOR_TYPES.get(tensor['type'], ('UNKNOWN', 'void'))
+    scale = tensor['scale'][0] if tensor['scale'] else 0.0
+    zero_point = tensor['zero_point'][0] if tensor['zero_point'] else 0
+    return [
+        '#define %s_DIMS %d' % (prefix, len(tensor['shape'])),
+        '#define %s_SHAPE { %s }' % (prefix, ', '.join(str(d) for d in tensor['shape'])),
+        '#define %s_ELEMENTS %d' % (prefix, element_count(tensor['shape'])),
+        '#define %s_TYPE_%s 1' % (prefix, type_name),
+        '#define %s_SCALE %.9gf' % (prefix, scale),
+        '#define %s_ZERO_POINT %d' % (prefix, zero_point),
+    ]
+
+
+def head_name(output, index):
+    """Names a detection head after its signature output, or HEAD<index>."""
+    name = output['signature_name']
+    if not name or re.fullmatch(r'output_\d+', name):
+        return 'HEAD%d' % index
+    return re.sub(r'\W', '_', name).upper()
+
+
+def split_outputs(outputs):
+    """Splits the outputs into the classifier, the heads and the optional embedding."""
+    heads = []
+    for output in outputs[1:]:
+        if element_count(output['shape']) > 2:
+            break
+        heads.append(output)
+    rest = outputs[1 + len(heads):]
+    if len(rest) > 1:
+        sys.exit('Expected the classifier, the detection heads (1 or 2 elements each) and an optional '
+                 'embedding, found %d more outputs after output %d (%s)'
+                 % (len(rest) - 1, len(heads) + 1, rest[0]['name']))
+    return outputs[0], heads, rest[0] if rest else None
+
+
+def generate_metadata(model, name, class_names, head_names, model_name):
+    # Classifier, then the detection heads, then the embedding added by
+    # simplify_tflite_graph.py --expose-embedding
+    if len(model['inputs']) != 1:
+        sys.exit('Expected a single input, found %d' % len(model['inputs']))
+    output, heads, embedding = split_outputs(model['outputs'])
+    if class_names and len(class_names) != element_count(output['shape']):
+        sys.exit('%d class names given for %d model outputs' % (len(class_names), element_count(output['shape'])))
+    if head_names is None:
+        head_names = [head_name(head, h) for h, head in enumerate(heads)]
+    elif len(head_names) != len(heads):
+        sys.exit('%d head names given for %d detection heads' % (len(head_names), len(heads)))
+
+    lines = ['#pragma once', '']
+    lines.append('// Input tensor (%s)' % model['inputs'][0]['name'])
+    prefix = name.upper()
+    lines += tensor_defines(prefix + '_INPUT', model['inputs'][0])
+    lines.append('')
+    lines.append('// Output tensor (%s)' % output['name'])
+    lines += tensor_defines(prefix + '_OUTPUT', output)
+    lines.append('')
+    lines.append('#define %s_OP_COUNT %d' % (prefix, len(model['ops'])))
+    lines.append('#define %s_CLASS_NAMES { %s }' % (prefix, ', '.join('"%s"' % n for n in class_names)))
+    lines.append('')
+    lines.append('// Recurrent state kept in the persistent arena between Invoke() calls')
+    lines.append('#define %s_VARIABLE_TENSORS %d' % (prefix, model['variable_tensors']))
+    lines.append('#define %s_RESOURCE_VARIABLES %d' % (prefix, model['resource_variables']))
+    lines.append('#define %s_STATEFUL %d' % (prefix, 1 if model['variable_tensors'] or model['resource_variables'] else 0))
+    lines.append('')
+    if heads:
+        lines.append('// Binary detection heads sharing the backbone, outputs 1-%d (%s)'
+                     % (len(heads), ', '.join(h['name'] for h in heads)))
+    else:
+        lines.append('// No detection heads (outputs with 1 or 2 elements after the classifier)')
+    lines.append('#define %s_HEAD_COUNT %d' % (prefix, len(heads)))
+    lines.append('#define %s_HEAD_FIRST_OUTPUT 1' % prefix)
+    lines.append('#define %s_HEAD_NAMES { %s }' % (prefix, ', '.join('"%s"' % n for n in head_names)))
+    lines.append('')
+    if embedding is not None:
+        lines.append('// Embedding tensor, output %d (%s)' % (1 + len(heads), embedding['name']))
+        lines += tensor_defines(prefix + '_EMBEDDING', embedding)
+        lines.append('#define %s_EMBEDDING_OUTPUT %d' % (prefix, 1 + len(heads)))
+    else:
+        lines.append('// No embedding output (see simplify_tflite_graph.py --expose-embedding)')
+        lines.append('#define %s_EMBEDDING_ELEMENTS 0' % prefix)
+    return banner(model_name) + '\n'.join(lines) + '\n'
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Generate firmware sources from a .tflite model')
+    parser.add_argument('--model', required=True, help='.tflite model file')
+    parser.add_argument('--output-dir', required=True, help='directory for the generated files')
+    parser.add_argument('--name', default='model', help='prefix of the generated files, namespace and macros')
+    parser.add_argument('--symbol', help='name of the model array (default: <name>_tflite)')
+    parser.add_argument('--class-names', nargs='*', default=[], help='label of every model output')
+    parser.add_argument('--head-names', nargs='*',
+                        help='name of every binary detection head, in output order after the classifier '
+                             '(default: the model\'s signature output names)')
+    args = parser.parse_args()
+
+    with open(args.model, 'rb') as f:
+        data = f.read()
+    model = read_model(data)
+    model_name = os.path.basename(args.model)
+
+    name = args.name
+    symbol = args.symbol or name + '_tflite'
+
+    os.makedirs(args.output_dir, exist_ok=True)
+    header, source = generate_model_data(data, name, symbol, model_name)
+    write_if_changed(os.path.join(args.output_dir, name + '_data.h'), header)
+    write_if_changed(os.path.join(args.output_dir, name + '_data.cc'), source)
+    write_if_changed(os.path.join(args.output_dir, name + '_op_resolver.h'),
+                     generate_op_resolver(model['ops'], name, model_name))
+    write_if_changed(os.path.join(args.output_dir, name + '_metadata.h'),
+                     generate_metadata(model, name, args.class_names, args.head_names, model_name))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,236 @@
+#!/usr/bin/env python3
+"""
+Offline activation memory planner for the sound classification model.
+
+TFLM runs its greedy memory planner inside AllocateTensors() on every boot.
+This tool computes the plan once on the host and stores it in the model's
+"OfflineMemoryAllocation" metadata, which tensorflow/lite/micro/
+micro_allocation_info.cc reads instead of planning those tensors itself:
+
+- one int32 buffer: [version 1, subgraph 0, tensor count, offset per tensor]
+- every activation tensor (no constant buffer, not a variable) gets a byte
+  offset into the non-persistent arena; constants and variable tensors get
+  -1 (not planned: constants stay in flash, variables go to the persistent
+  region)
+
+Lifetimes follow micro_allocation_info.cc exactly: graph inputs live from
+scope 0, the outputs of operator i are created at scope i + 1, a tensor
+lives until the last operator reading it, and graph outputs until the end.
+Tensors whose lifetimes overlap never share memory. Several placement
+orders are tried (largest first, as the on-device planner does, longest
+lived first, earliest first) and the smallest arena wins.
+
+Kernel scratch buffers are only known on the device; TFLM still plans them
+around the offline tensors, so the arena measured on the device can be
+slightly larger than the plan printed here. /model_benchmark?planning=1
+times AllocateTensors() with and without the plan and checks that the
+device placed the tensors at the planned offsets.
+
+Run it last: graph simplification changes the tensor list and invalidates
+the plan (LUT compression does not).
+
+Usage:
+    python tools/plan_tflite_memory.py \\
+        components/model/models/sound_classifier.tflite \\
+        components/model/models/sound_classifier.tflite --force
+
+Requires TensorFlow (for the flatbuffer object API), as used to train and
+convert the model in models/fresh.ipynb.
+"""
+
+import argparse
+import sys
+
+import numpy as np
+
+try:
+    from tensorflow.lite.tools import flatbuffer_utils
+    from tensorflow.lite.python import schema_py_generated as schema_fb
+except ImportError:  # pragma: no cover - only hit without TensorFlow
+    schema_fb = None
+    flatbuffer_utils = None
+
+OFFLINE_PLAN_METADATA = 'OfflineMemoryAllocation'
+PLAN_VERSION = 1
+ONLINE_PLANNED = -1
+ARENA_ALIGNMENT = 16  # MicroArenaBufferAlignment()
+
+# TensorType -> element size in bytes
+TENSOR_BYTES = {
+    0: 4,   # FLOAT32
+    1: 2,   # FLOAT16
+    2: 4,   # INT32
+    3: 1,   # UINT8
+    4: 8,   # INT64
+    6: 1,   # BOOL
+    7: 2,   # INT16
+    9: 1,   # INT8
+}
+
+
+def align_up(value, alignment=ARENA_ALIGNMENT):
+    return (value + alignment - 1) // alignment * alignment
+
+
+def metadata_name(metadata):
+    name = metadata.name
+    return name.decode() if isinstance(name, bytes) else name
+
+
+class Allocation:
+    """One tensor of the activation plan."""
+
+    def __init__(self, index, name, size):
+        self.index = index
+        self.name = name
+        self.size = size
+        self.first = None
+        self.last = None
+        self.offset = ONLINE_PLANNED
+
+    def mark(self, scope):
+        if self.first is None:
+            self.first = scope
+        self.last = scope if self.last is None else max(self.last, scope)
+
+    def overlaps(self, other):
+        return self.first <= other.last and other.first <= self.last
+
+
+def collect_allocations(model):
+    """Returns the planned tensors of subgraph 0 with their lifetimes."""
+    graph = model.subgraphs[0]
+    allocations = {}
+    for index, tensor in enumerate(graph.tensors):
+        buffer = model.buffers[tensor.buffer] if tensor.buffer < len(model.buffers) else None
+        constant = buffer is not None and buffer.data is not None and len(buffer.data) > 0
+        if constant or tensor.isVariable:
+            continue
+        if tensor.type not in TENSOR_BYTES:
+            sys.exit('Tensor %d has unsupported type %d' % (index, tensor.type))
+        shape = tensor.shape if tensor.shape is not None else []
+        size = int(np.prod([max(int(d), 1) for d in shape])) * TENSOR_BYTES[tensor.type]
+        if size == 0:
+            continue
+        name = tensor.name.decode() if isinstance(tensor.name, bytes) else tensor.name
+        allocations[index] = Allocation(index, name, align_up(size))
+
+    def mark(indices, scope, creating):
+        for index in indices if indices is not None else []:
+            allocation = allocations.get(int(index))
+            if allocation is None:
+                continue
+            if creating or allocation.first is not None:
+                allocation.mark(scope)
+
+    mark(graph.inputs, 0, True)
+    scope = 0
+    for op in graph.operators:
+        scope += 1
+        mark(op.outputs, scope, True)
+        mark(op.inputs, scope, False)
+    mark(graph.outputs, scope, True)
+
+    unused = [a.name for a in allocations.values() if a.first is None]
+    if unused:
+        sys.exit('Tensors never produced by the graph: %s' % ', '.join(unused))
+    return list(allocations.values())
+
+
+def place(allocations, order):
+    """Greedy first fit in the given order; returns the arena size."""
+    placed = []
+    arena = 0
+    for allocation in sorted(allocations, key=order):
+        conflicts = sorted((p for p in placed if p.overlaps(allocation)), key=lambda p: p.offset)
+        offset = 0
+        for other in conflicts:
+            if offset + allocation.size <= other.offset:
+                break
+            offset = max(offset, other.offset + other.size)
+        allocation.offset = offset
+        placed.append(allocation)
+        arena = max(arena, offset + allocation.size)
+    return arena
+
+
+ORDERS = {
+    'largest first': lambda a: (-a.size, a.first),
+    'longest lived first': lambda a: (-(a.last - a.first), -a.size),
+    'earliest first': lambda a: (a.first, -a.size),
+}
+
+
+def plan(allocations):
+    """Tries every placement order and keeps the smallest arena."""
+    results = {}
+    for name, order in ORDERS.items():
+        results[name] = (place(allocations, order), {a.index: a.offset for a in allocations})
+    best = min(results, key=lambda name: results[name][0])
+    for allocation in allocations:
+        allocation.offset = results[best][1][allocation.index]
+    return best, {name: size for name, (size, _) in results.items()}
+
+
+def check_plan(allocations):
+    for i, a in enumerate(allocations):
+        for b in allocations[i + 1:]:
+            if a.overlaps(b) and a.offset < b.offset + b.size and b.offset < a.offset + a.size:
+                sys.exit('Internal error: %s and %s overlap' % (a.name, b.name))
+
+
+def write_plan(model, allocations):
+    offsets = np.full(len(model.subgraphs[0].tensors), ONLINE_PLANNED, dtype=np.int32)
+    for allocation in allocations:
+        offsets[allocation.index] = allocation.offset
+    header = np.array([PLAN_VERSION, 0, len(offsets)], dtype=np.int32)
+
+    buffer = schema_fb.BufferT()
+    buffer.data = np.concatenate([header, offsets]).astype('<i4').view(np.uint8)
+    model.buffers.append(buffer)
+    metadata = schema_fb.MetadataT()
+    metadata.name = OFFLINE_PLAN_METADATA
+    metadata.buffer = len(model.buffers) - 1
+    model.metadata = (model.metadata or []) + [metadata]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n\n')[0].strip())
+    parser.add_argument('input', help='.tflite model')
+    parser.add_argument('output', help='.tflite model with the offline memory plan')
+    parser.add_argument('--force', action='store_true', help='replace an existing plan')
+    parser.add_argument('--verbose', action='store_true', help='print the offset of every tensor')
+    args = parser.parse_args()
+
+    if flatbuffer_utils is None:
+        sys.exit('TensorFlow is required: pip install tensorflow')
+
+    model = flatbuffer_utils.read_model(args.input)
+    if len(model.subgraphs) != 1:
+        sys.exit('Only single-subgraph models are supported')
+    existing = [m for m in model.metadata or [] if metadata_name(m) == OFFLINE_PLAN_METADATA]
+    if existing and not args.force:
+        sys.exit('Model already has an offline memory plan (use --force to replace it)')
+    # The old buffer stays in the file, unreferenced; the plan is a few hundred bytes
+    model.metadata = [m for m in model.metadata or [] if metadata_name(m) != OFFLINE_PLAN_METADATA]
+
+    allocations = collect_allocations(model)
+    if not allocations:
+        sys.exit('No activation tensors to plan')
+    order, sizes = plan(allocations)
+    check_plan(allocations)
+    write_plan(model, allocations)
+    flatbuffer_utils.write_model(model, args.output)
+
+    if args.verbose:
+        for a in sorted(allocations, key=lambda a: a.offset):
+            print(f'  {a.name[:40]:<40} {a.offset:>7} +{a.size:<7} scopes {a.first}-{a.last}')
+    print(f'Planned:  {len(allocations)} of {len(model.subgraphs[0].tensors)} tensors')
+    for name, size in sizes.items():
+        print(f'  {name:<20} {size:>7} bytes{"  <- used" if name == order else ""}')
+    print(f'Unshared: {sum(a.size for a in allocations):>7} bytes')
+    print(f'Arena:    {sizes[order]} bytes of activations, plus kernel scratch buffers planned on the device')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,586 @@
+#!/usr/bin/env python3
+"""
+Offline graph simplifier for the sound classification model.
+
+The Keras ``Reshape`` layers convert into dynamic-shape subgraphs
+(SHAPE -> STRIDED_SLICE -> PACK -> RESHAPE) that TFLM has to register,
+allocate and dispatch on every inference although their result never
+changes. This tool:
+
+- constant-folds SHAPE, STRIDED_SLICE, PACK, EXPAND_DIMS and RESHAPE ops
+  whose inputs are (or become) constant
+- removes RESHAPE ops that do not move data: in front of FULLY_CONNECTED
+  (which flattens its input anyway) or right behind the graph input (the
+  input tensor takes the reshaped shape instead)
+- fuses QUANTIZE at the graph input and DEQUANTIZE at the graph output, so
+  the model consumes and produces int8 directly (the predictor already
+  quantizes and dequantizes on the host side)
+- drops tensors, buffers and operator codes that are no longer referenced
+
+With --expose-embedding, the input of the last FULLY_CONNECTED (the
+penultimate dense layer) also becomes the second graph output. TFLM then
+keeps it alive after Invoke(), and the firmware matches it against
+enrolled custom sounds (see components/inference/src/sound_enrollment.c).
+
+With --add-class-head NAME=CLASS:REFERENCE, a binary detection head
+scoring class index CLASS against class index REFERENCE (usually the
+background class) becomes an extra graph output, after the classifier and
+before the embedding: a 1-unit FULLY_CONNECTED on the input of the
+classifier's last dense layer, followed by LOGISTIC. Its weights are the
+difference of the two classes' weights, so it reports
+p(CLASS) / (p(CLASS) + p(REFERENCE)) of the classifier. The head is
+derived, not trained: it lets the firmware's head path run before a model
+with trained heads exists. NAME becomes the signature output name, which
+generate_model_sources.py uses as the head name.
+
+With --fuse-conv-pool, every int8 CONV_2D whose only consumer is a 2x2,
+stride 2, VALID MAX_POOL_2D becomes one CONV_2D_MAXPOOL_2X2 custom op
+(components/model/src/model_conv_maxpool.cc). The full resolution conv
+output is no longer a tensor, which removes 4x the pooled size of arena
+traffic per block and lowers the activation arena peak. Fuse before
+compress_tflite_weights.py, which knows the custom op's filter input, and
+re-run the arena planner on the result.
+
+Usage:
+    python tools/simplify_tflite_graph.py model.tflite model_simplified.tflite \
+        [--expose-embedding] [--fuse-conv-pool] [--add-class-head NAME=CLASS:REFERENCE ...]
+
+Requires TensorFlow (for the flatbuffer object API), as used to train and
+convert the model in models/fresh.ipynb.
+"""
+
+import argparse
+import collections
+import sys
+
+import numpy as np
+
+try:
+    from tensorflow.lite.python import schema_py_generated as schema_fb
+    from tensorflow.lite.tools import flatbuffer_utils
+except ImportError:  # pragma: no cover - only hit without TensorFlow
+    schema_fb = None
+    flatbuffer_utils = None
+
+# Custom op written by --fuse-conv-pool and the version of its options
+CONV_MAXPOOL_CUSTOM_CODE = 'CONV_2D_MAXPOOL_2X2'
+CONV_MAXPOOL_OPTIONS_VERSION = 1
+TENSOR_TYPE_INT32 = 2
+TENSOR_TYPE_INT8 = 9
+
+# Numpy dtype of every TensorType the folder may produce
+TENSOR_DTYPES = {
+    0: np.float32,   # FLOAT32
+    2: np.int32,     # INT32
+    3: np.uint8,     # UINT8
+    4: np.int64,     # INT64
+    9: np.int8,      # INT8
+}
+
+
+def builtin_code(model, op):
+    """Returns the builtin operator code of an operator."""
+    code = model.operatorCodes[op.opcodeIndex]
+    return max(code.builtinCode, code.deprecatedBuiltinCode)
+
+
+def custom_code(code):
+    """Returns the custom_code of an OperatorCodeT as a str."""
+    name = code.customCode
+    return name.decode() if isinstance(name, bytes) else name
+
+
+def op_name(code):
+    """Returns the schema name of a builtin operator code."""
+    for name, value in vars(schema_fb.BuiltinOperator).items():
+        if value == code and not name.startswith('_'):
+            return name
+    return str(code)
+
+
+class GraphSimplifier:
+    """Rewrites the main subgraph of a ModelT in place."""
+
+    def __init__(self, model):
+        self.model = model
+        self.graph = model.subgraphs[0]
+        self.ops = schema_fb.BuiltinOperator
+        self.folded = collections.Counter()
+        self.removed = collections.Counter()
+        self.fused = collections.Counter()
+        self.added = {}
+
+    # -- tensor helpers -----------------------------------------------------
+
+    def tensor(self, index):
+        return self.graph.tensors[index]
+
+    def constant(self, index):
+        """Returns the value of a constant tensor, or None if it is computed."""
+        if index < 0:
+            return None
+        tensor = self.tensor(index)
+        buffer = self.model.buffers[tensor.buffer]
+        if buffer.data is None or len(buffer.data) == 0:
+            return None
+        dtype = TENSOR_DTYPES.get(tensor.type)
+        if dtype is None:
+            return None
+        shape = [] if tensor.shape is None else list(tensor.shape)
+        return np.frombuffer(bytes(bytearray(buffer.data)), dtype=dtype).reshape(shape)
+
+    def static_shape(self, index):
+        """Returns the shape TFLM allocates for a tensor (dynamic dims become 1)."""
+        shape = self.tensor(index).shape
+        return [] if shape is None else [max(int(d), 1) for d in shape]
+
+    def set_constant(self, index, value):
+        """Turns a computed tensor into a constant holding value."""
+        tensor = self.tensor(index)
+        value = np.asarray(value, dtype=TENSOR_DTYPES[tensor.type])
+        buffer = schema_fb.BufferT()
+        buffer.data = np.frombuffer(value.tobytes(), dtype=np.uint8)
+        self.model.buffers.append(buffer)
+        tensor.buffer = len(self.model.buffers) - 1
+        tensor.shape = np.array(value.shape, dtype=np.int32)
+        tensor.shapeSignature = None
+
+    def consumers(self, index):
+        return [op for op in self.graph.operators if index in list(op.inputs)]
+
+    def is_graph_output(self, index):
+        return index in list(self.graph.outputs)
+
+    def same_quantization(self, a, b):
+        qa = self.tensor(a).quantization
+        qb = self.tensor(b).quantization
+        if qa is None or qb is None or qa.scale is None or qb.scale is None:
+            return qa is None and qb is None
+        return (np.array_equal(qa.scale, qb.scale) and
+                np.array_equal(qa.zeroPoint, qb.zeroPoint))
+
+    def replace_uses(self, old, new):
+        """Points every consumer and graph output at new instead of old."""
+        for op in self.graph.operators:
+            op.inputs = [new if i == old else i for i in op.inputs]
+        self.graph.outputs = [new if i == old else i for i in self.graph.outputs]
+
+    # -- constant folding ---------------------------------------------------
+
+    def evaluate(self, op):
+        """Computes the output of a shape-plumbing op with constant inputs."""
+        code = builtin_code(self.model, op)
+        inputs = list(op.inputs)
+
+        if code == self.ops.SHAPE:
+            return np.array(self.static_shape(inputs[0]))
+
+        values = [self.constant(i) for i in inputs]
+        if any(v is None for v in values):
+            return None
+
+        if code == self.ops.STRIDED_SLICE:
+            return self.strided_slice(op, *values)
+        if code == self.ops.PACK:
+            return np.stack(values, axis=op.builtinOptions.axis)
+        if code == self.ops.EXPAND_DIMS:
+            return np.expand_dims(values[0], int(values[1].reshape(-1)[0]))
+        if code == self.ops.RESHAPE:
+            return values[0].reshape(self.static_shape(op.outputs[0]))
+        return None
+
+    @staticmethod
+    def strided_slice(op, data, begin, end, strides):
+        """Numpy equivalent of STRIDED_SLICE without ellipsis/new-axis masks."""
+        options = op.builtinOptions
+        if options.ellipsisMask or options.newAxisMask:
+            return None
+
+        slices = []
+        shrink = []
+        for axis in range(len(begin)):
+            b = None if options.beginMask & (1 << axis) else int(begin[axis])
+            e = None if options.endMask & (1 << axis) else int(end[axis])
+            if options.shrinkAxisMask & (1 << axis):
+                slices.append(slice(b, None if b == -1 else b + 1, 1))
+                shrink.append(axis)
+            else:
+                slices.append(slice(b, e, int(strides[axis])))
+        result = data[tuple(slices)]
+        return result.reshape([d for a, d in enumerate(result.shape) if a not in shrink])
+
+    def fold_constants(self):
+        foldable = (self.ops.SHAPE, self.ops.STRIDED_SLICE, self.ops.PACK,
+                    self.ops.EXPAND_DIMS, self.ops.RESHAPE)
+        kept = []
+        for op in self.graph.operators:
+            code = builtin_code(self.model, op)
+            value = self.evaluate(op) if code in foldable else None
+            if value is None or self.is_graph_output(op.outputs[0]):
+                kept.append(op)
+                continue
+            self.set_constant(op.outputs[0], value)
+            self.folded[op_name(code)] += 1
+        self.graph.operators = kept
+
+    # -- op elimination -----------------------------------------------------
+
+    def remove_reshapes(self):
+        """Drops reshapes that only relabel dimensions of a contiguous tensor."""
+        kept = []
+        for op in self.graph.operators:
+            if builtin_code(self.model, op) != self.ops.RESHAPE:
+                kept.append(op)
+                continue
+
+            source = op.inputs[0]
+            target = op.outputs[0]
+            if not self.same_quantization(source, target) or self.is_graph_output(target):
+                kept.append(op)
+                continue
+
+            users = self.consumers(target)
+            feeds_dense = users and all(
+                builtin_code(self.model, u) == self.ops.FULLY_CONNECTED and list(u.inputs)[0] == target
+                for u in users)
+            from_input = source in list(self.graph.inputs) and self.consumers(source) == [op]
+
+            if from_input:
+                self.tensor(source).shape = np.array(self.static_shape(target), dtype=np.int32)
+                self.tensor(source).shapeSignature = None
+            elif not feeds_dense:
+                kept.append(op)
+                continue
+
+            self.replace_uses(target, source)
+            self.removed['RESHAPE'] += 1
+        self.graph.operators = kept
+
+    def fuse_boundary_quantization(self):
+        """Lets the graph take and return the quantized tensors directly."""
+        kept = []
+        for op in self.graph.operators:
+            code = builtin_code(self.model, op)
+            source = op.inputs[0]
+            target = op.outputs[0]
+
+            if (code == self.ops.QUANTIZE and source in list(self.graph.inputs)
+                    and self.consumers(source) == [op]):
+                self.graph.inputs = [target if i == source else i for i in self.graph.inputs]
+                self.removed['QUANTIZE'] += 1
+                continue
+            if (code == self.ops.DEQUANTIZE and self.is_graph_output(target)
+                    and self.consumers(source) == [op] and self.constant(source) is None):
+                self.graph.outputs = [source if i == target else i for i in self.graph.outputs]
+                self.removed['DEQUANTIZE'] += 1
+                continue
+            kept.append(op)
+        self.graph.operators = kept
+
+    def expose_embedding(self):
+        """Adds the input of the classifier's last dense layer as a graph output.
+
+        The classifier is output 0; walking back from it skips the dense
+        layers of detection heads, which are further outputs.
+        """
+        dense = self.classifier_dense()
+        if dense is None:
+            sys.exit('No FULLY_CONNECTED layer to take the embedding from')
+        embedding = list(dense.inputs)[0]
+        if self.constant(embedding) is not None or embedding in list(self.graph.inputs):
+            sys.exit('The last dense layer does not follow another layer')
+        if not self.is_graph_output(embedding):
+            self.graph.outputs = list(self.graph.outputs) + [embedding]
+        return embedding
+
+    def classifier_dense(self):
+        """Returns the last FULLY_CONNECTED op in front of output 0, or None."""
+        producers = {out: op for op in self.graph.operators for out in op.outputs}
+        tensor = list(self.graph.outputs)[0]
+        while tensor in producers:
+            op = producers[tensor]
+            if builtin_code(self.model, op) == self.ops.FULLY_CONNECTED:
+                return op
+            tensor = list(op.inputs)[0]
+        return None
+
+    def add_tensor(self, name, shape, tensor_type, scale, zero_point, value=None):
+        """Appends a tensor (a constant when value is given) and returns its index."""
+        tensor = schema_fb.TensorT()
+        tensor.name = name
+        tensor.shape = np.array(shape, dtype=np.int32)
+        tensor.type = tensor_type
+        tensor.buffer = 0
+        tensor.quantization = schema_fb.QuantizationParametersT()
+        tensor.quantization.scale = np.atleast_1d(np.asarray(scale, dtype=np.float32))
+        tensor.quantization.zeroPoint = np.atleast_1d(np.asarray(zero_point, dtype=np.int64))
+        if value is not None:
+            buffer = schema_fb.BufferT()
+            buffer.data = np.frombuffer(np.ascontiguousarray(value).tobytes(), dtype=np.uint8)
+            self.model.buffers.append(buffer)
+            tensor.buffer = len(self.model.buffers) - 1
+        self.graph.tensors.append(tensor)
+        return len(self.graph.tensors) - 1
+
+    def add_class_head(self, name, class_index, reference):
+        """Adds a sigmoid head scoring one class against another as a graph output."""
+        dense = self.classifier_dense()
+        if dense is None:
+            sys.exit('No FULLY_CONNECTED layer to derive the head from')
+        features, weights, bias = list(dense.inputs)[:3]
+        if any(self.tensor(i).type != TENSOR_TYPE_INT8 for i in (features, weights)) or bias < 0:
+            sys.exit('The classifier\'s last dense layer must be int8 with a bias')
+        feature_q = self.tensor(features).quantization
+        feature_scale = float(feature_q.scale[0])
+        weight_scales = np.asarray(self.tensor(weights).quantization.scale, dtype=np.float64)
+        real_weights = self.constant(weights).astype(np.float64) * weight_scales.reshape(-1, 1)
+        real_bias = self.constant(bias).astype(np.float64) * feature_scale * weight_scales
+        classes = real_weights.shape[0]
+        if not (0 <= class_index < classes and 0 <= reference < classes) or class_index == reference:
+            sys.exit(f'Classes {class_index} and {reference} must be distinct and below {classes}')
+
+        head_weights = real_weights[class_index] - real_weights[reference]
+        head_bias = real_bias[class_index] - real_bias[reference]
+        weight_scale = max(np.abs(head_weights).max(), 1e-9) / 127
+        bias_scale = feature_scale * weight_scale
+        # The head logit is a difference of two class logits: twice their calibrated range
+        logit_q = self.tensor(list(dense.outputs)[0]).quantization
+        logit_zero = int(logit_q.zeroPoint[0])
+        logit_scale = 2 * float(logit_q.scale[0]) * max(abs(-128 - logit_zero), abs(127 - logit_zero)) / 127
+
+        prefix = f'head_{name.lower()}'
+        head_filter = self.add_tensor(f'{prefix}/weights', [1, len(head_weights)], TENSOR_TYPE_INT8, weight_scale, 0,
+                                      np.round(head_weights / weight_scale).astype(np.int8).reshape(1, -1))
+        head_bias_index = self.add_tensor(f'{prefix}/bias', [1], TENSOR_TYPE_INT32, bias_scale, 0,
+                                          np.array([round(head_bias / bias_scale)], dtype=np.int32))
+        logits = self.add_tensor(f'{prefix}/logits', [1, 1], TENSOR_TYPE_INT8, logit_scale, 0)
+        probability = self.add_tensor(name, [1, 1], TENSOR_TYPE_INT8, 1 / 256, -128)
+
+        fc = schema_fb.OperatorT()
+        fc.opcodeIndex = self.builtin_opcode(self.ops.FULLY_CONNECTED)
+        fc.inputs = [features, head_filter, head_bias_index]
+        fc.outputs = [logits]
+        fc.builtinOptionsType = schema_fb.BuiltinOptions.FullyConnectedOptions
+        fc.builtinOptions = schema_fb.FullyConnectedOptionsT()
+        sigmoid = schema_fb.OperatorT()
+        sigmoid.opcodeIndex = self.builtin_opcode(self.ops.LOGISTIC)
+        sigmoid.inputs = [logits]
+        sigmoid.outputs = [probability]
+        self.graph.operators = list(self.graph.operators) + [fc, sigmoid]
+
+        # After the classifier and the existing heads, before an embedding
+        outputs = list(self.graph.outputs)
+        position = 1
+        while position < len(outputs) and int(np.prod(self.static_shape(outputs[position]))) <= 2:
+            position += 1
+        self.graph.outputs = outputs[:position] + [probability] + outputs[position:]
+        for signature in self.model.signatureDefs or []:
+            if signature.subgraphIndex == 0:
+                entry = schema_fb.TensorMapT()
+                entry.name = name
+                entry.tensorIndex = probability
+                signature.outputs = list(signature.outputs or []) + [entry]
+        self.added[name] = (class_index, reference)
+
+    # -- fusion -------------------------------------------------------------
+
+    def builtin_opcode(self, code):
+        """Returns the operator code index of a builtin op, adding it if needed."""
+        for index, existing in enumerate(self.model.operatorCodes):
+            if max(existing.builtinCode, existing.deprecatedBuiltinCode) == code:
+                return index
+        opcode = schema_fb.OperatorCodeT()
+        opcode.builtinCode = code
+        opcode.deprecatedBuiltinCode = min(code, self.ops.PLACEHOLDER_FOR_GREATER_OP_CODES)
+        opcode.version = 1
+        self.model.operatorCodes.append(opcode)
+        return len(self.model.operatorCodes) - 1
+
+    def custom_opcode(self, name):
+        """Returns the operator code index of a custom op, adding it if needed."""
+        for index, code in enumerate(self.model.operatorCodes):
+            if max(code.builtinCode, code.deprecatedBuiltinCode) == self.ops.CUSTOM and custom_code(code) == name:
+                return index
+        code = schema_fb.OperatorCodeT()
+        code.builtinCode = self.ops.CUSTOM
+        code.deprecatedBuiltinCode = self.ops.CUSTOM
+        code.customCode = name
+        code.version = 1
+        self.model.operatorCodes.append(code)
+        return len(self.model.operatorCodes) - 1
+
+    def fuse_conv_pool(self):
+        """Merges CONV_2D -> MAX_POOL_2D(2x2, stride 2) pairs into one custom op.
+
+        The conv output must feed nothing but the pool, and the pool must
+        keep its quantization, so the fused op gives bit-exact results.
+        """
+        padding = schema_fb.Padding
+        activation = schema_fb.ActivationFunctionType
+        fused = set()
+        for pool in self.graph.operators:
+            if builtin_code(self.model, pool) != self.ops.MAX_POOL_2D:
+                continue
+            options = pool.builtinOptions
+            if (options.filterWidth, options.filterHeight, options.strideW, options.strideH) != (2, 2, 2, 2):
+                continue
+            if options.padding != padding.VALID or options.fusedActivationFunction != activation.NONE:
+                continue
+
+            conv_output = pool.inputs[0]
+            conv = next((op for op in self.graph.operators if conv_output in list(op.outputs)), None)
+            if conv is None or builtin_code(self.model, conv) != self.ops.CONV_2D:
+                continue
+            conv_options = conv.builtinOptions
+            if (conv_options.dilationWFactor, conv_options.dilationHFactor) != (1, 1):
+                continue
+            if (self.consumers(conv_output) != [pool] or self.is_graph_output(conv_output)
+                    or not self.same_quantization(conv_output, pool.outputs[0])):
+                continue
+            if any(self.tensor(i).type != TENSOR_TYPE_INT8 for i in list(conv.inputs)[:2] + [conv_output]):
+                continue
+
+            conv.opcodeIndex = self.custom_opcode(CONV_MAXPOOL_CUSTOM_CODE)
+            conv.outputs = [pool.outputs[0]]
+            conv.customOptions = np.array([CONV_MAXPOOL_OPTIONS_VERSION, conv_options.padding,
+                                           conv_options.strideW, conv_options.strideH,
+                                           conv_options.fusedActivationFunction],
+                                          dtype='<i4').view(np.uint8)
+            conv.builtinOptionsType = schema_fb.BuiltinOptions.NONE
+            conv.builtinOptions = None
+            fused.add(id(pool))
+            self.removed['MAX_POOL_2D'] += 1
+            self.fused[CONV_MAXPOOL_CUSTOM_CODE] += 1
+
+        self.graph.operators = [op for op in self.graph.operators if id(op) not in fused]
+        self.prune()
+
+    # -- cleanup ------------------------------------------------------------
+
+    def prune(self):
+        """Removes unreferenced tensors, buffers and operator codes."""
+        graph = self.graph
+        used = set(graph.inputs) | set(graph.outputs)
+        for op in graph.operators:
+            used.update(i for i in op.inputs if i >= 0)
+            used.update(op.outputs)
+            used.update(getattr(op, 'intermediates', None) or [])
+
+        tensor_map = {}
+        tensors = []
+        for old, tensor in enumerate(graph.tensors):
+            if old in used:
+                tensor_map[old] = len(tensors)
+                tensors.append(tensor)
+        remap = lambda indices: [tensor_map[i] if i >= 0 else i for i in indices]
+        graph.tensors = tensors
+        graph.inputs = remap(graph.inputs)
+        graph.outputs = remap(graph.outputs)
+        for op in graph.operators:
+            op.inputs = remap(op.inputs)
+            op.outputs = remap(op.outputs)
+
+        # Buffer 0 stays the empty sentinel required by the schema
+        buffer_map = {0: 0}
+        buffers = [self.model.buffers[0]]
+        for tensor in tensors:
+            if tensor.buffer not in buffer_map:
+                buffer_map[tensor.buffer] = len(buffers)
+                buffers.append(self.model.buffers[tensor.buffer])
+            tensor.buffer = buffer_map[tensor.buffer]
+        for metadata in self.model.metadata or []:
+            if metadata.buffer not in buffer_map:
+                buffer_map[metadata.buffer] = len(buffers)
+                buffers.append(self.model.buffers[metadata.buffer])
+            metadata.buffer = buffer_map[metadata.buffer]
+        self.model.buffers = buffers
+
+        code_map = {}
+        codes = []
+        for op in graph.operators:
+            if op.opcodeIndex not in code_map:
+                code_map[op.opcodeIndex] = len(codes)
+                codes.append(self.model.operatorCodes[op.opcodeIndex])
+            op.opcodeIndex = code_map[op.opcodeIndex]
+        self.model.operatorCodes = codes
+
+        # Signatures reference tensors by index as well
+        for signature in self.model.signatureDefs or []:
+            for entry in (signature.inputs or []) + (signature.outputs or []):
+                entry.tensorIndex = tensor_map.get(entry.tensorIndex, entry.tensorIndex)
+
+    def run(self):
+        self.fold_constants()
+        self.remove_reshapes()
+        self.fuse_boundary_quantization()
+        self.prune()
+
+
+def op_histogram(model):
+    names = []
+    for op in model.subgraphs[0].operators:
+        code = builtin_code(model, op)
+        if code == schema_fb.BuiltinOperator.CUSTOM:
+            names.append(custom_code(model.operatorCodes[op.opcodeIndex]))
+        else:
+            names.append(op_name(code))
+    return collections.Counter(names)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n\n')[0].strip())
+    parser.add_argument('input', help='quantized .tflite model')
+    parser.add_argument('output', help='simplified .tflite model')
+    parser.add_argument('--expose-embedding', action='store_true',
+                        help='add the penultimate dense layer as a second graph output')
+    parser.add_argument('--fuse-conv-pool', action='store_true',
+                        help='merge CONV_2D -> 2x2 MAX_POOL_2D pairs into CONV_2D_MAXPOOL_2X2')
+    parser.add_argument('--add-class-head', action='append', default=[], metavar='NAME=CLASS:REFERENCE',
+                        help='add a sigmoid head scoring a class index against a reference class (repeatable)')
+    args = parser.parse_args()
+
+    if flatbuffer_utils is None:
+        sys.exit('TensorFlow is required: pip install tensorflow')
+
+    with open(args.input, 'rb') as f:
+        input_size = len(f.read())
+    model = flatbuffer_utils.read_model(args.input)
+    if len(model.subgraphs) != 1:
+        sys.exit('Only single-subgraph models are supported')
+    before = op_histogram(model)
+
+    simplifier = GraphSimplifier(model)
+    simplifier.run()
+    if args.fuse_conv_pool:
+        simplifier.fuse_conv_pool()
+    for head in args.add_class_head:
+        name, _, classes = head.partition('=')
+        class_index, _, reference = classes.partition(':')
+        if not name or not class_index.isdigit() or not reference.isdigit():
+            sys.exit(f'--add-class-head expects NAME=CLASS:REFERENCE, got {head}')
+        simplifier.add_class_head(name, int(class_index), int(reference))
+    if args.expose_embedding:
+        embedding = simplifier.expose_embedding()
+        tensor = simplifier.tensor(embedding)
+        name = tensor.name.decode() if isinstance(tensor.name, bytes) else tensor.name
+        print(f'Embedding: {name} {simplifier.static_shape(embedding)} (output 1)')
+    flatbuffer_utils.write_model(model, args.output)
+
+    after = op_histogram(model)
+    with open(args.output, 'rb') as f:
+        output_size = len(f.read())
+
+    print(f'Folded:  {dict(simplifier.folded) or "-"}')
+    print(f'Removed: {dict(simplifier.removed) or "-"}')
+    print(f'Fused:   {dict(simplifier.fused) or "-"}')
+    if simplifier.added:
+        print('Heads:   ' + ', '.join(f'{name} (class {c} vs {r})' for name, (c, r) in simplifier.added.items()))
+    print(f'Ops:     {sum(before.values())} -> {sum(after.values())}')
+    for name in sorted(set(before) | set(after)):
+        print(f'  {name:<18} {before[name]:>3} -> {after[name]:>3}')
+    print(f'Size:    {input_size} -> {output_size} bytes')
+    print(f'Resolver ops: {", ".join(sorted(after))}')
+
+
+if __name__ == '__main__':
+    main()